@@ -0,0 +1,90 @@
+// # words 0
+// words []
+// 32   998 000 0
+// 97 a 400 0010 2
+// 101 e 684 0011 3
+// 105 i 361 0100 4
+// 110 n 494 0101 5
+// 111 o 427 0110 6
+// 114 r 360 0111 7
+// 115 s 355 1000 8
+// 116 t 586 1001 9
+// 37 % 163 10100 20
+// 39 \' 210 10101 21
+// 99 c 237 10110 22
+// 100 d 225 10111 23
+// 108 l 199 11000 24
+// 109 m 192 11001 25
+// 117 u 233 11010 26
+// 98 b 119 110110 54
+// 102 f 133 110111 55
+// 103 g 141 111000 56
+// 112 p 161 111001 57
+// 113 q 102 111010 58
+// 104 h 56 1110110 118
+// 118 v 51 1110111 119
+// 119 w 47 1111000 120
+// 120 x 55 1111001 121
+// 121 y 73 1111010 122
+// 40 ( 22 11110110 246
+// 41 ) 22 11110111 247
+// 106 j 25 11111000 248
+// 107 k 33 11111001 249
+// 44 , 17 111110100 500
+// 45 - 15 111110101 501
+// 48 0 13 111110110 502
+// 58 : 13 111110111 503
+// 95 _ 12 111111000 504
+// 42 * 8 1111110010 1010
+// 46 . 8 1111110011 1011
+// 49 1 8 1111110100 1012
+// 51 3 6 1111110101 1013
+// 61 = 7 1111110110 1014
+// 82 R 8 1111110111 1015
+// 47 / 4 11111110000 2032
+// 50 2 5 11111110001 2033
+// 52 4 3 11111110010 2034
+// 69 E 4 11111110011 2035
+// 78 N 4 11111110100 2036
+// 84 T 3 11111110101 2037
+// 122 z 5 11111110110 2038
+// 10 \n 2 111111101110 4078
+// 13 \r 2 111111101111 4079
+// 34 \" 2 111111110000 4080
+// 60 < 2 111111110001 4081
+// 62 > 2 111111110010 4082
+// 70 F 2 111111110011 4083
+// 73 I 2 111111110100 4084
+// 79 O 2 111111110101 4085
+// 83 S 2 111111110110 4086
+// 85 U 2 111111110111 4087
+// 86 V 2 111111111000 4088
+// 88 X 2 111111111001 4089
+// 35 # 1 1111111110100 8180
+// 53 5 1 1111111110101 8181
+// 66 B 1 1111111110110 8182
+// 67 C 1 1111111110111 8183
+// 71 G 1 1111111111000 8184
+// 72 H 1 1111111111001 8185
+// 76 L 1 1111111111010 8186
+// 80 P 1 1111111111011 8187
+// 91 [ 1 1111111111100 8188
+// 93 ] 1 1111111111101 8189
+// 123 { 1 1111111111110 8190
+// 125 } 1 1111111111111 8191
+// length count {3: 1, 4: 8, 5: 7, 6: 5, 7: 5, 8: 4, 9: 5, 10: 6, 11: 7, 12: 12, 13: 12}
+// values [' ', 'a', 'e', 'i', 'n', 'o', 'r', 's', 't', '%', "'", 'c', 'd', 'l', 'm', 'u', 'b', 'f', 'g', 'p', 'q', 'h', 'v', 'w', 'x', 'y', '(', ')', 'j', 'k', ',', '-', '0', ':', '_', '*', '.', '1', '3', '=', 'R', '/', '2', '4', 'E', 'N', 'T', 'z', '\n', '\r', '"', '<', '>', 'F', 'I', 'O', 'S', 'U', 'V', 'X', '#', '5', 'B', 'C', 'G', 'H', 'L', 'P', '[', ']', '{', '}'] lengths 14 bytearray(b'\x00\x00\x01\x08\x07\x05\x05\x04\x05\x06\x07\x0c\x0c\x00')
+// [' ', 'a', 'e', 'i', 'n', 'o', 'r', 's', 't', '%', "'", 'c', 'd', 'l', 'm', 'u', 'b', 'f', 'g', 'p', 'q', 'h', 'v', 'w', 'x', 'y', '(', ')', 'j', 'k', ',', '-', '0', ':', '_', '*', '.', '1', '3', '=', 'R', '/', '2', '4', 'E', 'N', 'T', 'z', '\n', '\r', '"', '<', '>', 'F', 'I', 'O', 'S', 'U', 'V', 'X', '#', '5', 'B', 'C', 'G', 'H', 'L', 'P', '[', ']', '{', '}'] bytearray(b'\x00\x00\x01\x08\x07\x05\x05\x04\x05\x06\x07\x0c\x0c\x00')
+typedef uint8_t mchar_t;
+const uint8_t lengths[] = { 0, 0, 1, 8, 7, 5, 5, 4, 5, 6, 7, 12, 12, 0 };
+const mchar_t values[] = { 32, 97, 101, 105, 110, 111, 114, 115, 116, 37, 39, 99, 100, 108, 109, 117, 98, 102, 103, 112, 113, 104, 118, 119, 120, 121, 40, 41, 106, 107, 44, 45, 48, 58, 95, 42, 46, 49, 51, 61, 82, 47, 50, 52, 69, 78, 84, 122, 10, 13, 34, 60, 62, 70, 73, 79, 83, 85, 86, 88, 35, 53, 66, 67, 71, 72, 76, 80, 91, 93, 123, 125 };
+#define compress_max_length_bits (7)
+const mchar_t words[] = {  };
+const uint8_t wlencount[] = { 0 };
+#define word_start 128
+#define word_end 127
+#define minlen 0
+#define maxlen 0
+#define translation_offstart 0
+#define translation_offset 0
+#define translation_qstr_bits 0
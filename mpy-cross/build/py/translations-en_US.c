@@ -0,0 +1,245 @@
+// This file was automatically generated by maketranslatedata.py
+#include "supervisor/shared/translate/compressed_string.h"
+
+const struct compressed_string translation0 = { .data = 40, .tail = { 7, 249, 166, 12, 127, 133, 58, 255, 15, 160, 194, 41, 138, 92 } }; //   File \"%q\", line %d
+const struct compressed_string translation1 = { .data = 43, .tail = { 74, 88, 41, 157, 224, 34, 200, 103, 22, 236, 78 } }; // %%c needs int or char
+const struct compressed_string translation2 = { .data = 53, .tail = { 75, 132, 128, 173, 32, 134, 117, 137, 78, 112, 97, 183, 20, 184 } }; // %d is not a multiple of %d
+const struct compressed_string translation3 = { .data = 71, .tail = { 78, 130, 40, 167, 67, 58, 137, 27, 24, 109, 196, 250, 228, 197, 58, 250, 5, 105, 20, 232 } }; // %q in %q must be of type %q, not %q
+const struct compressed_string translation4 = { .data = 43, .tail = { 78, 130, 45, 207, 200, 109, 72, 109, 195, 146, 240, 96 } }; // %q index out of range
+const struct compressed_string translation5 = { .data = 71, .tail = { 78, 130, 45, 210, 199, 3, 58, 137, 27, 24, 69, 147, 224, 222, 62, 129, 90, 69, 32 } }; // %q indices must be integers, not %s
+const struct compressed_string translation6 = { .data = 41, .tail = { 78, 134, 13, 120, 158, 195, 58, 137, 27, 24, 165, 192 } }; // %q length must be %d
+const struct compressed_string translation7 = { .data = 47, .tail = { 78, 134, 13, 120, 158, 195, 58, 137, 27, 24, 165, 254, 180, 184 } }; // %q length must be %d-%d
+const struct compressed_string translation8 = { .data = 47, .tail = { 78, 134, 13, 120, 158, 195, 58, 137, 27, 24, 255, 31, 216, 82, 224 } }; // %q length must be <= %d
+const struct compressed_string translation9 = { .data = 47, .tail = { 78, 134, 13, 120, 158, 195, 58, 137, 27, 24, 255, 47, 216, 82, 224 } }; // %q length must be >= %d
+const struct compressed_string translation10 = { .data = 27, .tail = { 78, 134, 117, 18, 54, 49, 75, 128 } }; // %q must be %d
+const struct compressed_string translation11 = { .data = 33, .tail = { 78, 134, 117, 18, 54, 49, 75, 253, 105, 112 } }; // %q must be %d-%d
+const struct compressed_string translation12 = { .data = 33, .tail = { 78, 134, 117, 18, 54, 49, 254, 63, 176, 165, 192 } }; // %q must be <= %d
+const struct compressed_string translation13 = { .data = 33, .tail = { 78, 134, 117, 18, 54, 49, 254, 95, 176, 165, 192 } }; // %q must be >= %d
+const struct compressed_string translation14 = { .data = 71, .tail = { 78, 134, 117, 18, 54, 48, 219, 137, 245, 201, 138, 116, 25, 197, 58, 250, 5, 105, 20, 232 } }; // %q must be of type %q or %q, not %q
+const struct compressed_string translation15 = { .data = 59, .tail = { 78, 134, 117, 18, 54, 48, 219, 137, 245, 201, 138, 117, 244, 10, 210, 41, 208 } }; // %q must be of type %q, not %q
+const struct compressed_string translation16 = { .data = 31, .tail = { 78, 131, 106, 67, 110, 28, 151, 131 } }; // %q out of range
+const struct compressed_string translation17 = { .data = 45, .tail = { 78, 132, 73, 242, 44, 74, 173, 35, 99, 31, 216, 221, 128 } }; // %q step cannot be zero
+const struct compressed_string translation18 = { .data = 105, .tail = { 78, 189, 189, 196, 151, 201, 192, 165, 199, 45, 9, 40, 202, 88, 4, 252, 107, 38, 179, 3, 109, 72, 165, 199, 131, 115, 28, 39, 115, 80 } }; // %q() takes %d positional arguments but %d were given
+const struct compressed_string translation19 = { .data = 11, .tail = { 78, 191, 106, 116 } }; // %q=%q
+const struct compressed_string translation20 = { .data = 5, .tail = { 72 } }; // %s
+const struct compressed_string translation21 = { .data = 45, .tail = { 90, 117, 80, 79, 198, 178, 107, 33, 207, 173, 35, 157, 192 } }; // '%q' argument required
+const struct compressed_string translation22 = { .data = 67, .tail = { 90, 117, 80, 219, 124, 29, 164, 93, 142, 2, 180, 136, 215, 60, 179, 200, 173, 58, 168 } }; // '%q' object does not support '%q'
+const struct compressed_string translation23 = { .data = 59, .tail = { 90, 117, 80, 219, 124, 29, 164, 36, 45, 100, 18, 132, 147, 114, 150, 112 } }; // '%q' object isn't an iterator
+const struct compressed_string translation24 = { .data = 53, .tail = { 90, 117, 80, 219, 124, 29, 164, 36, 45, 100, 88, 177, 130, 219, 6 } }; // '%q' object isn't callable
+const struct compressed_string translation25 = { .data = 53, .tail = { 90, 117, 80, 219, 124, 29, 164, 36, 45, 100, 36, 155, 150, 216, 48 } }; // '%q' object isn't iterable
+const struct compressed_string translation26 = { .data = 41, .tail = { 90, 69, 65, 249, 228, 237, 48, 8, 96, 182, 60, 0 } }; // '%s' expects a label
+const struct compressed_string translation27 = { .data = 47, .tail = { 90, 69, 65, 249, 228, 237, 48, 8, 57, 240, 145, 38, 224 } }; // '%s' expects a register
+const struct compressed_string translation28 = { .data = 63, .tail = { 90, 69, 65, 249, 228, 237, 48, 8, 71, 39, 100, 44, 7, 62, 18, 36, 220 } }; // '%s' expects a special register
+const struct compressed_string translation29 = { .data = 57, .tail = { 90, 69, 65, 249, 228, 237, 48, 9, 71, 249, 255, 239, 253, 195, 159, 9, 18, 110 } }; // '%s' expects an FPU register
+const struct compressed_string translation30 = { .data = 85, .tail = { 90, 69, 65, 249, 228, 237, 48, 9, 65, 94, 238, 113, 1, 183, 19, 216, 198, 236, 249, 31, 252, 47, 160, 219, 255, 160 } }; // '%s' expects an address of the form [a, b]
+const struct compressed_string translation31 = { .data = 47, .tail = { 90, 69, 65, 249, 228, 237, 48, 9, 66, 44, 159, 6, 224 } }; // '%s' expects an integer
+const struct compressed_string translation32 = { .data = 49, .tail = { 90, 69, 65, 249, 228, 237, 48, 10, 70, 90, 36, 61, 46 } }; // '%s' expects at most r%d
+const struct compressed_string translation33 = { .data = 53, .tail = { 90, 69, 65, 249, 228, 237, 48, 63, 252, 255, 111, 160, 127, 211, 232, 63, 63, 207, 243, 255, 248 } }; // '%s' expects {r0, r1, ...}
+const struct compressed_string translation34 = { .data = 83, .tail = { 90, 69, 66, 44, 159, 6, 226, 151, 9, 11, 89, 30, 18, 123, 34, 135, 37, 224, 197, 47, 249, 254, 116, 184 } }; // '%s' integer %d isn't within range %d..%d
+const struct compressed_string translation35 = { .data = 85, .tail = { 90, 69, 66, 44, 159, 6, 227, 237, 230, 158, 69, 216, 225, 107, 35, 116, 144, 138, 50, 81, 242, 62, 222, 105, 228 } }; // '%s' integer 0x%x doesn't fit in mask 0x%x
+const struct compressed_string translation36 = { .data = 87, .tail = { 90, 69, 67, 109, 240, 118, 145, 118, 56, 90, 200, 141, 115, 203, 60, 132, 147, 200, 40, 132, 225, 114, 107, 32 } }; // '%s' object doesn't support item assignment
+const struct compressed_string translation37 = { .data = 83, .tail = { 90, 69, 67, 109, 240, 118, 145, 118, 56, 90, 200, 141, 115, 203, 60, 132, 147, 200, 185, 224, 229, 25, 64 } }; // '%s' object doesn't support item deletion
+const struct compressed_string translation38 = { .data = 67, .tail = { 90, 69, 67, 109, 240, 118, 145, 216, 160, 43, 2, 153, 116, 219, 82, 98, 180, 234, 160 } }; // '%s' object has no attribute '%q'
+const struct compressed_string translation39 = { .data = 63, .tail = { 90, 69, 67, 109, 240, 118, 144, 144, 181, 145, 26, 218, 44, 233, 204, 150, 216, 48 } }; // '%s' object isn't subscriptable
+const struct compressed_string translation40 = { .data = 105, .tail = { 95, 218, 160, 176, 156, 46, 77, 100, 43, 72, 44, 97, 188, 29, 194, 40, 137, 116, 94, 6, 236, 249, 41, 17, 201, 217, 55, 67, 112 } }; // '=' alignment not allowed in string format specifier
+const struct compressed_string translation41 = { .data = 55, .tail = { 82, 194, 112, 181, 14, 125, 105, 28, 224, 126, 128, 159, 141, 100, 214, 64 } }; // 'align' requires 1 argument
+const struct compressed_string translation42 = { .data = 49, .tail = { 82, 240, 73, 53, 13, 169, 132, 185, 141, 244, 182, 148, 101 } }; // 'await' outside function
+const struct compressed_string translation43 = { .data = 63, .tail = { 93, 156, 203, 230, 191, 194, 182, 101, 148, 93, 29, 67, 106, 97, 46, 99, 12, 220, 128 } }; // 'break'/'continue' outside loop
+const struct compressed_string translation44 = { .data = 73, .tail = { 91, 148, 149, 67, 159, 90, 71, 56, 5, 35, 6, 81, 35, 248, 130, 126, 53, 147, 89, 128 } }; // 'data' requires at least 2 arguments
+const struct compressed_string translation45 = { .data = 67, .tail = { 91, 148, 149, 67, 159, 90, 71, 56, 8, 178, 124, 27, 130, 126, 53, 147, 89, 128 } }; // 'data' requires integer arguments
+const struct compressed_string translation46 = { .data = 55, .tail = { 92, 22, 199, 138, 135, 62, 180, 142, 112, 63, 64, 79, 198, 178, 107, 32 } }; // 'label' requires 1 argument
+const struct compressed_string translation47 = { .data = 43, .tail = { 85, 105, 168, 86, 144, 153, 231, 7, 147, 89, 59, 128 } }; // 'not' not implemented
+const struct compressed_string translation48 = { .data = 51, .tail = { 87, 57, 211, 173, 67, 106, 97, 46, 99, 125, 45, 165, 25, 64 } }; // 'return' outside function
+const struct compressed_string translation49 = { .data = 69, .tail = { 95, 72, 120, 184, 221, 219, 53, 8, 176, 151, 48, 81, 233, 108, 55, 210, 218, 81, 148 } }; // 'yield from' inside async function
+const struct compressed_string translation50 = { .data = 49, .tail = { 95, 72, 120, 189, 67, 106, 97, 46, 99, 125, 45, 165, 25, 64 } }; // 'yield' outside function
+const struct compressed_string translation51 = { .data = 29, .tail = { 249, 2, 126, 1, 111, 38, 227, 242, 252, 128 } }; // * arg after **
+const struct compressed_string translation52 = { .data = 57, .tail = { 249, 121, 25, 212, 72, 216, 193, 68, 39, 11, 147, 89, 18, 79, 193, 200 } }; // *x must be assignment target
+const struct compressed_string translation53 = { .data = 19, .tail = { 244, 8, 162, 157, 127, 127, 247, 0 } }; // , in %q\n
+const struct compressed_string translation54 = { .data = 45, .tail = { 246, 252, 254, 194, 88, 16, 179, 103, 156, 31, 145, 203, 120, 55 } }; // 0.0 to a complex power
+const struct compressed_string translation55 = { .data = 51, .tail = { 250, 253, 73, 248, 28, 183, 143, 111, 112, 173, 34, 53, 207, 44, 242, 119 } }; // 3-arg pow() not supported
+const struct compressed_string translation56 = { .data = 111, .tail = { 255, 114, 198, 4, 107, 147, 127, 111, 127, 207, 241, 248, 69, 73, 252, 126, 61, 189, 198, 199, 187, 57, 130, 181, 142, 33, 23, 128, 165, 41, 220, 195, 109, 240, 118, 159, 204 } }; // Call super().__init__() before accessing native object.
+const struct compressed_string translation57 = { .data = 59, .tail = { 252, 255, 127, 223, 253, 127, 127, 184, 167, 66, 157, 5, 105, 30, 25, 239, 245, 44, 39, 10, 119 } }; // ERROR: %q %q not word-aligned
+const struct compressed_string translation58 = { .data = 59, .tail = { 252, 255, 127, 223, 253, 127, 127, 184, 243, 38, 176, 66, 157, 6, 212, 134, 220, 57, 47, 6 } }; // ERROR: xtensa %q out of range
+const struct compressed_string translation59 = { .data = 21, .tail = { 254, 139, 220, 176, 151, 20, 232 } }; // Invalid %q
+const struct compressed_string translation60 = { .data = 65, .tail = { 255, 175, 252, 255, 176, 109, 199, 201, 250, 240, 207, 112, 79, 192, 206, 162, 70, 198, 9, 66, 92 } }; // LHS of keyword arg must be an id
+const struct compressed_string translation61 = { .data = 73, .tail = { 253, 92, 172, 123, 21, 190, 71, 182, 90, 36, 57, 216, 214, 69, 139, 24, 24, 40, 159, 127, 191, 247, 255, 112 } }; // Traceback (most recent call last):\n
+const struct compressed_string translation62 = { .data = 43, .tail = { 254, 234, 91, 96, 196, 176, 69, 73, 28, 147, 193, 184 } }; // Unable to init parser
+const struct compressed_string translation63 = { .data = 79, .tail = { 248, 252, 34, 164, 254, 63, 30, 222, 226, 59, 54, 177, 112, 231, 58, 117, 31, 209, 148, 254, 129, 90, 69, 105, 21 } }; // __init__() should return None, not '%s'
+const struct compressed_string translation64 = { .data = 63, .tail = { 248, 252, 41, 248, 252, 126, 1, 63, 3, 58, 137, 27, 24, 33, 168, 55, 250, 207, 174, 76 } }; // __new__ arg must be a user-type
+const struct compressed_string translation65 = { .data = 62, .tail = { 67, 111, 82, 113, 245, 194, 124, 152, 109, 190, 14, 210, 18, 3, 159, 90, 71, 59, 128 } }; // a bytes-like object is required
+const struct compressed_string translation66 = { .data = 28, .tail = { 91, 51, 207, 183, 184, 177, 99, 7, 112 } }; // abort() called
+const struct compressed_string translation67 = { .data = 64, .tail = { 74, 173, 37, 40, 202, 51, 168, 145, 177, 130, 80, 151, 53, 148, 221, 13, 192 } }; // annotation must be an identifier
+const struct compressed_string translation68 = { .data = 48, .tail = { 79, 192, 72, 4, 160, 243, 204, 250, 16, 125, 104, 214, 198 } }; // arg is an empty sequence
+const struct compressed_string translation69 = { .data = 40, .tail = { 79, 198, 178, 107, 33, 75, 38, 28, 245, 7, 112 } }; // argument name reused
+const struct compressed_string translation70 = { .data = 74, .tail = { 81, 233, 108, 55, 103, 254, 30, 18, 123, 6, 212, 194, 92, 193, 71, 165, 176, 223, 75, 105, 70, 80 } }; // async for/with outside async function
+const struct compressed_string translation71 = { .data = 48, .tail = { 83, 46, 155, 106, 78, 2, 180, 136, 215, 60, 179, 201, 220 } }; // attributes not supported
+const struct compressed_string translation72 = { .data = 25, .tail = { 177, 92, 79, 174, 78, 205, 115 } }; // bad typecode
+const struct compressed_string translation73 = { .data = 57, .tail = { 178, 41, 63, 160, 220, 138, 116, 21, 164, 38, 121, 193, 228, 214, 78, 224 } }; // binary op %q not implemented
+const struct compressed_string translation74 = { .data = 39, .tail = { 179, 146, 219, 176, 86, 144, 138, 28, 151, 131 } }; // branch not in range
+const struct compressed_string translation75 = { .data = 33, .tail = { 182, 183, 220, 220, 75, 48, 140, 150, 48 } }; // buffer too small
+const struct compressed_string translation76 = { .data = 35, .tail = { 183, 169, 59, 53, 204, 55, 115, 125, 240, 222, 0 } }; // bytecode overflow
+const struct compressed_string translation77 = { .data = 81, .tail = { 183, 169, 56, 24, 53, 226, 123, 5, 105, 4, 51, 172, 74, 115, 131, 13, 184, 73, 60, 136, 79, 236, 96 } }; // bytes length not a multiple of item size
+const struct compressed_string translation78 = { .data = 49, .tail = { 183, 169, 56, 29, 203, 26, 48, 218, 144, 219, 135, 37, 224, 192 } }; // bytes value out of range
+const struct compressed_string translation79 = { .data = 101, .tail = { 98, 80, 203, 143, 67, 177, 119, 49, 174, 68, 176, 254, 67, 146, 114, 201, 201, 188, 13, 217, 199, 239, 255, 31, 175, 241, 5, 16, 121, 219, 30, 128 } }; // can only have up to 4 parameters for RV32 assembly
+const struct compressed_string translation80 = { .data = 101, .tail = { 98, 80, 203, 143, 67, 177, 119, 49, 174, 68, 176, 254, 67, 146, 114, 201, 201, 188, 9, 97, 253, 123, 107, 59, 2, 136, 60, 237, 143, 64 } }; // can only have up to 4 parameters to Thumb assembly
+const struct compressed_string translation81 = { .data = 103, .tail = { 98, 80, 203, 143, 67, 177, 119, 49, 174, 68, 176, 254, 67, 146, 114, 201, 201, 188, 9, 97, 255, 50, 107, 4, 10, 32, 243, 182, 61, 0 } }; // can only have up to 4 parameters to Xtensa assembly
+const struct compressed_string translation82 = { .data = 105, .tail = { 98, 90, 200, 43, 220, 71, 39, 100, 44, 12, 156, 246, 107, 137, 96, 88, 115, 43, 250, 250, 198, 182, 182, 10, 32, 238, 45, 130, 136 } }; // can't add special method to already-subclassed class
+const struct compressed_string translation83 = { .data = 53, .tail = { 98, 90, 200, 40, 132, 225, 68, 176, 63, 60, 185, 196, 35, 40 } }; // can't assign to expression
+const struct compressed_string translation84 = { .data = 55, .tail = { 98, 90, 200, 179, 47, 115, 121, 20, 129, 44, 44, 217, 231, 7, 228 } }; // can't convert %s to complex
+const struct compressed_string translation85 = { .data = 51, .tail = { 98, 90, 200, 179, 47, 115, 121, 20, 129, 44, 55, 195, 20, 128 } }; // can't convert %s to float
+const struct compressed_string translation86 = { .data = 47, .tail = { 98, 90, 200, 179, 47, 115, 121, 20, 129, 44, 17, 100 } }; // can't convert %s to int
+const struct compressed_string translation87 = { .data = 85, .tail = { 98, 90, 200, 179, 47, 115, 121, 21, 167, 85, 13, 183, 193, 218, 68, 176, 167, 65, 51, 206, 18, 201, 56, 244 } }; // can't convert '%q' object to %q implicitly
+const struct compressed_string translation88 = { .data = 55, .tail = { 98, 90, 200, 179, 153, 73, 138, 211, 170, 132, 88, 146, 91, 28, 0 } }; // can't create '%q' instances
+const struct compressed_string translation89 = { .data = 73, .tail = { 98, 90, 200, 185, 219, 4, 230, 21, 151, 13, 98, 192, 69, 13, 169, 55, 22, 107, 152 } }; // can't declare nonlocal in outer code
+const struct compressed_string translation90 = { .data = 47, .tail = { 98, 90, 200, 185, 224, 228, 193, 249, 229, 206, 33, 25, 64 } }; // can't delete expression
+const struct compressed_string translation91 = { .data = 81, .tail = { 98, 90, 200, 187, 13, 145, 73, 253, 6, 228, 108, 115, 224, 205, 69, 105, 213, 65, 45, 197, 105, 213, 64 } }; // can't do binary op between '%q' and '%q'
+const struct compressed_string translation92 = { .data = 51, .tail = { 98, 90, 200, 187, 13, 41, 63, 160, 220, 134, 220, 86, 157, 84 } }; // can't do unary op of '%q'
+const struct compressed_string translation93 = { .data = 79, .tail = { 98, 90, 200, 76, 243, 132, 178, 78, 61, 11, 50, 247, 55, 145, 90, 117, 81, 44, 43, 179, 54, 42 } }; // can't implicitly convert '%q' to 'bool'
+const struct compressed_string translation94 = { .data = 41, .tail = { 98, 90, 200, 76, 242, 207, 33, 75, 38, 41, 208 } }; // can't import name %q
+const struct compressed_string translation95 = { .data = 41, .tail = { 98, 90, 200, 195, 21, 198, 238, 217, 21, 167, 85 } }; // can't load from '%q'
+const struct compressed_string translation96 = { .data = 53, .tail = { 98, 90, 200, 195, 21, 199, 132, 158, 194, 180, 234, 161, 22, 231, 228 } }; // can't load with '%q' index
+const struct compressed_string translation97 = { .data = 59, .tail = { 98, 90, 200, 228, 223, 118, 124, 135, 60, 20, 167, 115, 9, 158, 89, 228 } }; // can't perform relative import
+const struct compressed_string translation98 = { .data = 107, .tail = { 98, 90, 200, 131, 91, 133, 101, 250, 255, 70, 83, 29, 203, 26, 49, 44, 8, 124, 106, 39, 235, 18, 79, 39, 113, 193, 169, 185, 75, 56 } }; // can't send non-None value to a just-started generator
+const struct compressed_string translation99 = { .data = 39, .tail = { 98, 90, 200, 131, 144, 83, 46, 155, 106, 76 } }; // can't set attribute
+const struct compressed_string translation100 = { .data = 49, .tail = { 98, 90, 200, 131, 144, 83, 46, 155, 106, 76, 86, 157, 84 } }; // can't set attribute '%q'
+const struct compressed_string translation101 = { .data = 33, .tail = { 98, 90, 200, 137, 103, 49, 90, 117, 80 } }; // can't store '%q'
+const struct compressed_string translation102 = { .data = 39, .tail = { 98, 90, 200, 137, 103, 49, 44, 43, 78, 170 } }; // can't store to '%q'
+const struct compressed_string translation103 = { .data = 55, .tail = { 98, 90, 200, 137, 103, 49, 225, 39, 176, 173, 58, 168, 69, 185, 249 } }; // can't store with '%q' index
+const struct compressed_string translation104 = { .data = 147, .tail = { 98, 90, 200, 143, 9, 54, 236, 55, 118, 200, 45, 75, 100, 165, 44, 55, 67, 197, 194, 235, 59, 27, 162, 240, 37, 134, 73, 116, 88, 27, 161, 226, 226, 57, 59, 38, 233, 98, 148, 101 } }; // can't switch from automatic field numbering to manual field specification
+const struct compressed_string translation105 = { .data = 147, .tail = { 98, 90, 200, 143, 9, 54, 236, 55, 118, 200, 201, 46, 139, 3, 116, 60, 92, 71, 39, 100, 221, 44, 82, 140, 162, 88, 22, 165, 178, 82, 150, 27, 161, 226, 225, 117, 157, 141, 209, 120 } }; // can't switch from manual field specification to automatic field numbering
+const struct compressed_string translation106 = { .data = 77, .tail = { 98, 90, 200, 151, 210, 216, 164, 254, 183, 78, 233, 115, 4, 44, 217, 231, 7, 228, 46, 179, 177, 184 } }; // can't truncate-divide a complex number
+const struct compressed_string translation107 = { .data = 91, .tail = { 98, 85, 105, 7, 148, 144, 165, 41, 220, 197, 154, 230, 55, 103, 19, 217, 32, 19, 219, 178, 73, 218, 116, 230 } }; // cannot emit native code for this architecture
+const struct compressed_string translation108 = { .data = 15, .tail = { 98, 137, 69, 224 } }; // casting
+const struct compressed_string translation109 = { .data = 65, .tail = { 110, 207, 237, 238, 9, 248, 10, 210, 17, 67, 146, 240, 126, 223, 111, 63, 167, 233, 246, 251, 125, 190, 222, 224 } }; // chr() arg not in range(0x110000)
+const struct compressed_string translation110 = { .data = 53, .tail = { 102, 207, 36, 233, 12, 161, 183, 8, 178, 9, 110, 52, 139, 32 } }; // comparison of int and uint
+const struct compressed_string translation111 = { .data = 45, .tail = { 102, 207, 56, 63, 34, 233, 221, 46, 99, 111, 67, 251, 27, 176 } }; // complex divide by zero
+const struct compressed_string translation112 = { .data = 41, .tail = { 102, 94, 230, 240, 140, 162, 88, 54, 223, 7, 105 } }; // conversion to object
+const struct compressed_string translation113 = { .data = 59, .tail = { 115, 220, 181, 137, 21, 63, 54, 62, 102, 163, 58, 137, 27, 24, 193, 68, 128 } }; // default 'except' must be last
+const struct compressed_string translation114 = { .data = 75, .tail = { 116, 180, 141, 115, 114, 147, 16, 125, 104, 214, 198, 59, 20, 15, 14, 203, 192, 193, 175, 19, 216 } }; // dict update sequence has wrong length
+const struct compressed_string translation115 = { .data = 65, .tail = { 116, 239, 252, 50, 215, 10, 210, 19, 60, 224, 242, 107, 39, 113, 187, 56, 210, 44, 128 } }; // div/mod not implemented for uint
+const struct compressed_string translation116 = { .data = 33, .tail = { 116, 238, 144, 140, 163, 111, 67, 251, 27, 176 } }; // division by zero
+const struct compressed_string translation117 = { .data = 30, .tail = { 121, 230, 125, 8, 62, 73, 202, 89, 192 } }; // empty separator
+const struct compressed_string translation118 = { .data = 104, .tail = { 107, 112, 219, 141, 217, 242, 82, 60, 118, 76, 24, 195, 55, 202, 47, 3, 118, 113, 102, 94, 230, 240, 140, 162, 57, 59, 38, 232, 110 } }; // end of format while looking for conversion specifier
+const struct compressed_string translation119 = { .data = 82, .tail = { 126, 108, 124, 202, 50, 192, 206, 162, 69, 205, 211, 185, 141, 221, 178, 63, 236, 80, 127, 207, 205, 143, 153, 70, 80 } }; // exceptions must derive from BaseException
+const struct compressed_string translation120 = { .data = 70, .tail = { 126, 121, 59, 73, 220, 87, 239, 80, 91, 201, 184, 221, 159, 37, 34, 57, 59, 38, 232, 110 } }; // expected ':' after format specifier
+const struct compressed_string translation121 = { .data = 68, .tail = { 126, 121, 59, 74, 47, 0, 148, 20, 65, 231, 108, 27, 132, 88, 151, 213, 165, 25, 64 } }; // expecting an assembler instruction
+const struct compressed_string translation122 = { .data = 60, .tail = { 126, 121, 59, 74, 47, 3, 227, 81, 32, 135, 114, 198, 140, 110, 206, 32, 228 } }; // expecting just a value for set
+const struct compressed_string translation123 = { .data = 56, .tail = { 126, 121, 59, 74, 47, 3, 228, 253, 125, 251, 150, 52, 99, 118, 113, 116, 180, 128 } }; // expecting key:value for dict
+const struct compressed_string translation124 = { .data = 58, .tail = { 126, 101, 200, 124, 159, 175, 12, 247, 4, 252, 107, 38, 179, 3, 132, 238, 106 } }; // extra keyword arguments given
+const struct compressed_string translation125 = { .data = 64, .tail = { 126, 101, 200, 114, 208, 146, 140, 165, 128, 79, 198, 178, 107, 48, 56, 78, 230, 160 } }; // extra positional arguments given
+const struct compressed_string translation126 = { .data = 77, .tail = { 186, 60, 72, 39, 227, 89, 53, 145, 44, 35, 92, 155, 251, 123, 140, 234, 36, 108, 98, 125, 114, 96 } }; // first argument to super() must be type
+const struct compressed_string translation127 = { .data = 39, .tail = { 187, 62, 74, 66, 153, 222, 1, 11, 165, 164 } }; // format needs a dict
+const struct compressed_string translation128 = { .data = 85, .tail = { 187, 62, 74, 68, 75, 162, 240, 46, 151, 90, 200, 179, 47, 115, 121, 5, 140, 2, 126, 53, 147, 89, 128 } }; // format string didn't convert all arguments
+const struct compressed_string translation129 = { .data = 69, .tail = { 187, 62, 74, 68, 75, 162, 240, 20, 206, 240, 50, 206, 96, 159, 141, 100, 214, 96 } }; // format string needs more arguments
+const struct compressed_string translation130 = { .data = 79, .tail = { 190, 150, 210, 140, 162, 236, 112, 181, 145, 37, 242, 99, 228, 253, 120, 103, 184, 39, 227, 89, 53, 152 } }; // function doesn't take keyword arguments
+const struct compressed_string translation131 = { .data = 93, .tail = { 190, 150, 210, 140, 160, 252, 242, 118, 147, 184, 41, 25, 104, 145, 75, 130, 126, 53, 147, 89, 143, 160, 225, 164, 82, 224 } }; // function expected at most %d arguments, got %d
+const struct compressed_string translation132 = { .data = 93, .tail = { 190, 150, 210, 140, 163, 134, 145, 157, 98, 83, 156, 24, 238, 88, 209, 192, 221, 156, 19, 241, 172, 154, 200, 173, 58, 168 } }; // function got multiple values for argument '%q'
+const struct compressed_string translation133 = { .data = 99, .tail = { 190, 150, 210, 140, 163, 41, 16, 139, 192, 165, 195, 159, 90, 71, 59, 142, 90, 18, 81, 148, 176, 9, 248, 214, 77, 102, 0 } }; // function missing %d required positional arguments
+const struct compressed_string translation134 = { .data = 77, .tail = { 190, 150, 210, 140, 163, 41, 16, 139, 192, 249, 63, 94, 25, 239, 245, 101, 199, 160, 79, 198, 178, 107, 32 } }; // function missing keyword-only argument
+const struct compressed_string translation135 = { .data = 95, .tail = { 190, 150, 210, 140, 163, 41, 16, 139, 192, 115, 235, 72, 231, 113, 242, 126, 188, 51, 220, 19, 241, 172, 154, 200, 173, 58, 168 } }; // function missing required keyword argument '%q'
+const struct compressed_string translation136 = { .data = 99, .tail = { 190, 150, 210, 140, 163, 41, 16, 139, 192, 115, 235, 72, 231, 113, 203, 66, 74, 50, 150, 1, 63, 26, 201, 172, 143, 250, 82, 224 } }; // function missing required positional argument #%d
+const struct compressed_string translation137 = { .data = 113, .tail = { 190, 150, 210, 140, 162, 75, 228, 224, 82, 227, 150, 132, 148, 101, 44, 2, 126, 53, 147, 89, 129, 182, 164, 82, 227, 193, 185, 142, 19, 185, 168 } }; // function takes %d positional arguments but %d were given
+const struct compressed_string translation138 = { .data = 55, .tail = { 193, 169, 185, 75, 56, 44, 57, 149, 253, 3, 242, 118, 212, 162, 240 } }; // generator already executing
+const struct compressed_string translation139 = { .data = 63, .tail = { 193, 169, 185, 75, 56, 78, 21, 156, 238, 63, 240, 106, 110, 82, 207, 252, 252, 164, 128 } }; // generator ignored GeneratorExit
+const struct compressed_string translation140 = { .data = 61, .tail = { 193, 169, 185, 75, 56, 114, 72, 59, 143, 246, 150, 231, 253, 36, 220, 165, 25, 64 } }; // generator raised StopIteration
+const struct compressed_string translation141 = { .data = 60, .tail = { 151, 53, 148, 221, 13, 195, 157, 207, 116, 83, 184, 40, 28, 97, 182, 44, 0 } }; // identifier redefined as global
+const struct compressed_string translation142 = { .data = 64, .tail = { 151, 53, 148, 221, 13, 195, 157, 207, 116, 83, 184, 40, 10, 203, 134, 177, 96 } }; // identifier redefined as nonlocal
+const struct compressed_string translation143 = { .data = 56, .tail = { 153, 229, 158, 71, 228, 21, 164, 20, 140, 181, 245, 131, 24, 62, 231, 128 } }; // import * not at module level
+const struct compressed_string translation144 = { .data = 34, .tail = { 139, 102, 207, 56, 57, 49, 187, 62, 74, 64 } }; // incomplete format
+const struct compressed_string translation145 = { .data = 42, .tail = { 139, 102, 207, 56, 57, 49, 187, 62, 74, 71, 201, 250 } }; // incomplete format key
+const struct compressed_string translation146 = { .data = 70, .tail = { 139, 132, 83, 5, 16, 121, 219, 6, 227, 58, 137, 27, 24, 33, 190, 150, 210, 140, 160 } }; // inline assembler must be a function
+const struct compressed_string translation147 = { .data = 58, .tail = { 139, 220, 176, 151, 31, 191, 252, 126, 191, 196, 34, 196, 190, 173, 40, 202, 43, 78, 170 } }; // invalid RV32 instruction '%q'
+const struct compressed_string translation148 = { .data = 24, .tail = { 139, 220, 176, 151, 4, 246, 236 } }; // invalid arch
+const struct compressed_string translation149 = { .data = 48, .tail = { 139, 220, 176, 151, 27, 179, 228, 164, 71, 39, 100, 221, 13, 192 } }; // invalid format specifier
+const struct compressed_string translation150 = { .data = 58, .tail = { 139, 220, 176, 151, 25, 75, 59, 115, 234, 123, 50, 139, 157, 153, 202, 89, 192 } }; // invalid micropython decorator
+const struct compressed_string translation151 = { .data = 28, .tail = { 139, 220, 176, 151, 17, 233, 100, 188, 128 } }; // invalid syntax
+const struct compressed_string translation152 = { .data = 50, .tail = { 139, 220, 176, 151, 17, 233, 100, 188, 141, 217, 194, 235, 59, 27, 128 } }; // invalid syntax for number
+const struct compressed_string translation153 = { .data = 68, .tail = { 145, 26, 218, 216, 40, 143, 111, 112, 79, 192, 253, 6, 117, 18, 54, 48, 66, 216, 40, 128 } }; // issubclass() arg 1 must be a class
+const struct compressed_string translation154 = { .data = 112, .tail = { 145, 26, 218, 216, 40, 143, 111, 112, 79, 192, 254, 35, 58, 137, 27, 24, 33, 108, 20, 64, 103, 4, 39, 92, 224, 195, 110, 45, 130, 136, 56 } }; // issubclass() arg 2 must be a class or a tuple of classes
+const struct compressed_string translation155 = { .data = 137, .tail = { 240, 200, 160, 252, 242, 118, 152, 4, 48, 145, 33, 183, 17, 47, 252, 54, 245, 39, 1, 182, 248, 59, 76, 11, 50, 194, 68, 154, 200, 240, 147, 216, 65, 227, 112, 219, 124, 29, 164 } }; // join expects a list of str/bytes objects consistent with self object
+const struct compressed_string translation156 = { .data = 123, .tail = { 242, 126, 188, 51, 220, 19, 241, 172, 154, 207, 180, 123, 133, 105, 9, 158, 112, 121, 53, 147, 184, 250, 141, 65, 133, 103, 201, 96, 19, 241, 1, 22, 36, 202, 224 } }; // keyword argument(s) not implemented - use normal args instead
+const struct compressed_string translation157 = { .data = 45, .tail = { 130, 216, 240, 43, 78, 170, 21, 164, 92, 247, 69, 59, 128 } }; // label '%q' not defined
+const struct compressed_string translation158 = { .data = 31, .tail = { 130, 216, 240, 28, 238, 123, 162, 157, 192 } }; // label redefined
+const struct compressed_string translation159 = { .data = 87, .tail = { 134, 177, 96, 86, 157, 84, 118, 40, 19, 235, 147, 21, 167, 85, 27, 106, 68, 54, 158, 198, 18, 5, 105, 213, 64 } }; // local '%q' has type '%q' but source is '%q'
+const struct compressed_string translation160 = { .data = 67, .tail = { 134, 177, 96, 86, 157, 84, 106, 14, 227, 99, 221, 156, 196, 250, 228, 199, 202, 183, 133 } }; // local '%q' used before type known
+const struct compressed_string translation161 = { .data = 87, .tail = { 134, 177, 96, 119, 39, 66, 219, 6, 28, 247, 55, 53, 177, 220, 108, 123, 179, 152, 40, 132, 225, 114, 107, 32 } }; // local variable referenced before assignment
+const struct compressed_string translation162 = { .data = 37, .tail = { 146, 198, 236, 249, 59, 141, 254, 177, 46, 139, 192 } }; // malformed f-string
+const struct compressed_string translation163 = { .data = 35, .tail = { 146, 158, 194, 237, 146, 69, 6, 238, 206 } }; // math domain error
+const struct compressed_string translation164 = { .data = 65, .tail = { 146, 242, 153, 214, 67, 157, 180, 240, 140, 162, 231, 204, 246, 7, 230, 198, 119, 59, 128 } }; // maximum recursion depth exceeded
+const struct compressed_string translation165 = { .data = 91, .tail = { 147, 203, 63, 160, 88, 195, 88, 165, 25, 70, 228, 152, 59, 253, 1, 99, 13, 98, 148, 94, 5, 52, 54, 245, 39, 0 } }; // memory allocation failed, allocating %u bytes
+const struct compressed_string translation166 = { .data = 81, .tail = { 147, 203, 63, 160, 88, 195, 88, 165, 25, 70, 228, 152, 59, 253, 7, 99, 46, 66, 64, 195, 91, 228, 238 } }; // memory allocation failed, heap is locked
+const struct compressed_string translation167 = { .data = 51, .tail = { 157, 98, 83, 156, 24, 252, 188, 132, 80, 81, 9, 194, 228, 214, 64 } }; // multiple *x in assignment
+const struct compressed_string translation168 = { .data = 91, .tail = { 157, 98, 83, 156, 24, 216, 160, 224, 118, 46, 230, 17, 98, 73, 108, 99, 5, 235, 234, 218, 145, 102, 93, 240, 150, 144 } }; // multiple bases have instance lay-out conflict
+const struct compressed_string translation169 = { .data = 41, .tail = { 157, 68, 135, 36, 131, 4, 161, 182, 248, 59, 72 } }; // must raise an object
+const struct compressed_string translation170 = { .data = 85, .tail = { 157, 68, 141, 65, 143, 147, 245, 225, 158, 224, 159, 141, 100, 214, 70, 236, 227, 228, 253, 13, 244, 182, 148, 101 } }; // must use keyword argument for key function
+const struct compressed_string translation171 = { .data = 46, .tail = { 165, 147, 21, 167, 85, 9, 11, 89, 23, 61, 209, 78, 224 } }; // name '%q' isn't defined
+const struct compressed_string translation172 = { .data = 26, .tail = { 165, 147, 18, 204, 48, 203, 192 } }; // name too long
+const struct compressed_string translation173 = { .data = 24, .tail = { 165, 41, 220, 199, 164, 60, 92 } }; // native yield
+const struct compressed_string translation174 = { .data = 68, .tail = { 166, 119, 25, 103, 49, 61, 137, 69, 46, 59, 150, 52, 112, 37, 134, 151, 146, 183, 200 } }; // need more than %d values to unpack
+const struct compressed_string translation175 = { .data = 40, .tail = { 167, 193, 74, 119, 49, 29, 147, 121, 22, 109, 44, 128 } }; // negative shift count
+const struct compressed_string translation176 = { .data = 60, .tail = { 172, 10, 210, 157, 204, 31, 155, 31, 50, 140, 162, 88, 57, 185, 36, 24 } }; // no active exception to reraise
+const struct compressed_string translation177 = { .data = 58, .tail = { 172, 54, 69, 186, 47, 3, 118, 112, 172, 184, 107, 22, 6, 237, 165, 184 } }; // no binding for nonlocal found
+const struct compressed_string translation178 = { .data = 40, .tail = { 172, 50, 215, 214, 12, 41, 100, 238, 43, 78, 170 } }; // no module named '%q'
+const struct compressed_string translation179 = { .data = 90, .tail = { 172, 191, 91, 158, 229, 172, 72, 39, 227, 89, 53, 145, 187, 99, 13, 226, 5, 207, 114, 214, 36, 19, 241, 172, 154, 200 } }; // non-default argument follows default argument
+const struct compressed_string translation180 = { .data = 28, .tail = { 173, 32, 133, 153, 98, 73, 100 } }; // not a constant
+const struct compressed_string translation181 = { .data = 66, .tail = { 219, 124, 29, 164, 86, 145, 80, 144, 181, 144, 66, 117, 206, 12, 51, 140, 36, 72 } }; // object '%s' isn't a tuple or list
+const struct compressed_string translation182 = { .data = 44, .tail = { 219, 124, 29, 164, 43, 72, 69, 16, 125, 104, 214, 198 } }; // object not in sequence
+const struct compressed_string translation183 = { .data = 64, .tail = { 219, 124, 29, 164, 54, 226, 125, 114, 98, 180, 138, 142, 197, 1, 88, 96, 215, 219, 220 } }; // object of type '%s' has no len()
+const struct compressed_string translation184 = { .data = 72, .tail = { 219, 124, 29, 164, 120, 73, 236, 54, 214, 251, 155, 142, 93, 165, 172, 216, 14, 125, 105, 28, 238 } }; // object with buffer protocol required
+const struct compressed_string translation185 = { .data = 96, .tail = { 203, 143, 66, 48, 150, 56, 30, 18, 123, 8, 147, 231, 246, 253, 7, 177, 124, 144, 254, 140, 167, 238, 9, 204, 70, 185, 229, 158, 78, 224 } }; // only slices with step=1 (aka None) are supported
+const struct compressed_string translation186 = { .data = 12, .tail = { 220, 217, 174, 96 } }; // opcode
+const struct compressed_string translation187 = { .data = 74, .tail = { 220, 217, 174, 98, 180, 234, 160, 159, 141, 100, 214, 69, 47, 247, 7, 231, 147, 180, 162, 240, 41, 208 } }; // opcode '%q' argument %d: expecting %q
+const struct compressed_string translation188 = { .data = 82, .tail = { 220, 217, 174, 98, 180, 234, 160, 159, 141, 100, 214, 69, 47, 247, 25, 212, 72, 86, 145, 177, 143, 236, 110, 192 } }; // opcode '%q' argument %d: must not be zero
+const struct compressed_string translation189 = { .data = 74, .tail = { 220, 217, 174, 98, 180, 234, 160, 159, 141, 100, 214, 69, 47, 247, 13, 169, 13, 184, 114, 94, 12 } }; // opcode '%q' argument %d: out of range
+const struct compressed_string translation190 = { .data = 90, .tail = { 220, 217, 174, 98, 180, 234, 160, 159, 141, 100, 214, 69, 47, 247, 26, 91, 158, 232, 167, 113, 130, 216, 240, 43, 78, 170 } }; // opcode '%q' argument %d: undefined label '%q'
+const struct compressed_string translation191 = { .data = 82, .tail = { 220, 217, 174, 98, 180, 234, 160, 159, 141, 100, 214, 69, 47, 247, 26, 95, 149, 111, 10, 28, 248, 72, 147, 112 } }; // opcode '%q' argument %d: unknown register
+const struct compressed_string translation192 = { .data = 70, .tail = { 220, 217, 174, 98, 180, 234, 191, 112, 126, 121, 59, 74, 47, 2, 151, 4, 252, 107, 38, 179, 0 } }; // opcode '%q': expecting %d arguments
+const struct compressed_string translation193 = { .data = 114, .tail = { 207, 127, 111, 112, 126, 121, 59, 73, 220, 16, 183, 98, 114, 180, 155, 253, 6, 218, 145, 18, 232, 188, 6, 220, 96, 215, 137, 236, 41, 113, 187, 105, 110 } }; // ord() expected a character, but string of length %d found
+const struct compressed_string translation194 = { .data = 88, .tail = { 221, 205, 247, 195, 120, 22, 101, 238, 111, 40, 188, 12, 50, 240, 17, 100, 75, 12, 149, 187, 34, 152, 240, 207, 112 } }; // overflow converting long int to machine word
+const struct compressed_string translation195 = { .data = 87, .tail = { 201, 91, 228, 31, 158, 78, 210, 119, 20, 184, 73, 60, 192, 221, 156, 114, 86, 249, 69, 224, 123, 112, 210, 41, 127, 112 } }; // pack expected %d items for packing (got %d)
+const struct compressed_string translation196 = { .data = 99, .tail = { 201, 57, 100, 228, 222, 6, 117, 18, 54, 48, 231, 194, 68, 155, 192, 69, 16, 125, 104, 214, 198, 11, 236, 37, 129, 126, 160 } }; // parameters must be registers in sequence a0 to a3
+const struct compressed_string translation197 = { .data = 99, .tail = { 201, 57, 100, 228, 222, 6, 117, 18, 54, 48, 231, 194, 68, 155, 192, 69, 16, 125, 104, 214, 198, 11, 248, 137, 96, 95, 245 } }; // parameters must be registers in sequence a2 to a5
+const struct compressed_string translation198 = { .data = 99, .tail = { 201, 57, 100, 228, 222, 6, 117, 18, 54, 48, 231, 194, 68, 155, 192, 69, 16, 125, 104, 214, 198, 31, 236, 37, 131, 254, 160 } }; // parameters must be registers in sequence r0 to r3
+const struct compressed_string translation199 = { .data = 35, .tail = { 203, 114, 55, 118, 200, 60, 243, 62, 133, 58 } }; // pop from empty %q
+const struct compressed_string translation200 = { .data = 47, .tail = { 203, 66, 74, 50, 150, 1, 63, 0, 183, 147, 113, 249, 126, 64 } }; // positional arg after **
+const struct compressed_string translation201 = { .data = 65, .tail = { 203, 66, 74, 50, 150, 1, 63, 0, 183, 147, 113, 242, 126, 188, 51, 220, 19, 240 } }; // positional arg after keyword arg
+const struct compressed_string translation202 = { .data = 88, .tail = { 231, 214, 142, 36, 238, 48, 107, 196, 246, 20, 184, 219, 82, 27, 111, 131, 180, 142, 197, 3, 6, 188, 79, 97, 75, 128 } }; // requested length %d but object has length %d
+const struct compressed_string translation203 = { .data = 78, .tail = { 231, 58, 117, 4, 170, 210, 82, 140, 163, 58, 137, 27, 24, 37, 9, 115, 89, 77, 208, 220 } }; // return annotation must be an identifier
+const struct compressed_string translation204 = { .data = 66, .tail = { 231, 58, 117, 7, 231, 147, 180, 157, 197, 105, 213, 70, 218, 145, 195, 72, 173, 58, 168 } }; // return expected '%q' but got '%q'
+const struct compressed_string translation205 = { .data = 28, .tail = { 241, 206, 18, 125, 191, 163, 41, 253, 23, 220 } }; // rsplit(None,n)
+const struct compressed_string translation206 = { .data = 87, .tail = { 9, 194, 133, 105, 5, 140, 55, 131, 184, 69, 17, 46, 139, 192, 221, 159, 37, 34, 57, 59, 38, 232, 110 } }; // sign not allowed in string format specifier
+const struct compressed_string translation207 = { .data = 101, .tail = { 9, 194, 133, 105, 5, 140, 55, 131, 184, 240, 147, 216, 34, 201, 240, 110, 55, 103, 201, 72, 142, 78, 201, 186, 27, 138, 218, 160 } }; // sign not allowed with integer format specifier 'c'
+const struct compressed_string translation208 = { .data = 37, .tail = { 25, 44, 96, 34, 200, 110, 230, 251, 225, 188, 0 } }; // small int overflow
+const struct compressed_string translation209 = { .data = 61, .tail = { 18, 230, 89, 13, 201, 185, 74, 50, 133, 105, 17, 174, 121, 103, 147, 184 } }; // stream operation not supported
+const struct compressed_string translation210 = { .data = 71, .tail = { 18, 232, 188, 2, 126, 53, 147, 89, 30, 18, 123, 54, 164, 18, 131, 91, 53, 209, 120 } }; // string argument without an encoding
+const struct compressed_string translation211 = { .data = 51, .tail = { 18, 232, 188, 4, 91, 159, 144, 218, 144, 219, 135, 37, 224, 192 } }; // string index out of range
+const struct compressed_string translation212 = { .data = 79, .tail = { 18, 232, 188, 4, 91, 165, 142, 6, 117, 18, 54, 48, 139, 39, 193, 188, 125, 2, 180, 138, 64 } }; // string indices must be integers, not %s
+const struct compressed_string translation213 = { .data = 39, .tail = { 26, 218, 37, 209, 120, 10, 210, 55, 109, 45, 192 } }; // substring not found
+const struct compressed_string translation214 = { .data = 47, .tail = { 26, 228, 223, 219, 220, 88, 150, 178, 55, 69, 184, 131, 198, 224 } }; // super() can't find self
+const struct compressed_string translation215 = { .data = 27, .tail = { 44, 195, 36, 190, 129, 63, 16 } }; // too many args
+const struct compressed_string translation216 = { .data = 67, .tail = { 44, 195, 36, 190, 134, 26, 197, 136, 27, 179, 133, 41, 78, 230, 50, 115, 217, 174 } }; // too many locals for native method
+const struct compressed_string translation217 = { .data = 79, .tail = { 44, 195, 36, 190, 135, 114, 198, 142, 4, 176, 210, 242, 86, 249, 30, 199, 231, 147, 180, 157, 197, 47, 238 } }; // too many values to unpack (expected %d)
+const struct compressed_string translation218 = { .data = 79, .tail = { 62, 185, 49, 90, 117, 80, 144, 181, 144, 74, 10, 214, 62, 100, 182, 193, 141, 138, 12, 79, 174, 76 } }; // type '%q' isn't an acceptable base type
+const struct compressed_string translation219 = { .data = 77, .tail = { 62, 185, 48, 219, 124, 29, 164, 86, 157, 84, 118, 40, 10, 192, 166, 93, 54, 212, 152, 173, 58, 168 } }; // type object '%q' has no attribute '%q'
+const struct compressed_string translation220 = { .data = 55, .tail = { 62, 185, 49, 37, 242, 112, 63, 64, 206, 63, 80, 79, 198, 178, 107, 48 } }; // type takes 1 or 3 arguments
+const struct compressed_string translation221 = { .data = 35, .tail = { 165, 63, 60, 157, 164, 238, 17, 110, 107, 32 } }; // unexpected indent
+const struct compressed_string translation222 = { .data = 65, .tail = { 165, 63, 60, 157, 164, 238, 62, 79, 215, 134, 123, 130, 126, 53, 147, 89, 21, 167, 85 } }; // unexpected keyword argument '%q'
+const struct compressed_string translation223 = { .data = 41, .tail = { 165, 75, 53, 204, 41, 100, 193, 197, 139, 147, 128 } }; // unicode name escapes
+const struct compressed_string translation224 = { .data = 91, .tail = { 165, 69, 185, 172, 139, 177, 194, 214, 70, 74, 109, 216, 18, 250, 13, 169, 55, 8, 183, 53, 145, 131, 238, 120 } }; // unindent doesn't match any outer indent level
+const struct compressed_string translation225 = { .data = 63, .tail = { 165, 249, 86, 240, 162, 204, 189, 205, 225, 25, 68, 114, 118, 77, 208, 220, 82, 192 } }; // unknown conversion specifier %c
+const struct compressed_string translation226 = { .data = 97, .tail = { 165, 249, 86, 240, 163, 118, 124, 148, 139, 53, 204, 86, 150, 168, 221, 156, 54, 223, 7, 105, 13, 184, 159, 92, 152, 173, 58, 168 } }; // unknown format code '%c' for object of type '%q'
+const struct compressed_string translation227 = { .data = 25, .tail = { 165, 249, 86, 240, 162, 125, 114, 96 } }; // unknown type
+const struct compressed_string translation228 = { .data = 35, .tail = { 165, 249, 86, 240, 162, 125, 114, 98, 180, 234, 160 } }; // unknown type '%q'
+const struct compressed_string translation229 = { .data = 49, .tail = { 165, 201, 77, 187, 29, 197, 105, 106, 132, 81, 187, 62, 74, 64 } }; // unmatched '%c' in format
+const struct compressed_string translation230 = { .data = 41, .tail = { 165, 115, 43, 150, 216, 48, 83, 46, 155, 106, 76 } }; // unreadable attribute
+const struct compressed_string translation231 = { .data = 105, .tail = { 165, 141, 115, 203, 60, 157, 199, 245, 237, 172, 236, 17, 98, 95, 86, 148, 101, 21, 164, 84, 120, 73, 236, 41, 112, 79, 198, 178, 107, 48 } }; // unsupported Thumb instruction '%s' with %d arguments
+const struct compressed_string translation232 = { .data = 107, .tail = { 165, 141, 115, 203, 60, 157, 199, 252, 201, 172, 16, 69, 137, 125, 90, 81, 148, 86, 145, 81, 225, 39, 176, 165, 193, 63, 26, 201, 172, 192 } }; // unsupported Xtensa instruction '%s' with %d arguments
+const struct compressed_string translation233 = { .data = 105, .tail = { 165, 141, 115, 203, 60, 157, 198, 236, 249, 41, 22, 236, 78, 86, 147, 113, 90, 90, 163, 219, 237, 230, 158, 125, 193, 72, 69, 185, 249, 20, 184 } }; // unsupported format character '%c' (0x%x) at index %d
+const struct compressed_string translation234 = { .data = 59, .tail = { 165, 141, 115, 203, 60, 157, 196, 250, 228, 198, 236, 226, 157, 125, 197, 105, 21 } }; // unsupported type for %q: '%s'
+const struct compressed_string translation235 = { .data = 73, .tail = { 165, 141, 115, 203, 60, 157, 196, 250, 228, 224, 110, 206, 41, 215, 220, 86, 157, 87, 232, 43, 78, 170 } }; // unsupported types for %q: '%q', '%q'
+const struct compressed_string translation236 = { .data = 57, .tail = { 220, 177, 163, 25, 212, 72, 221, 36, 34, 138, 92, 109, 234, 79, 218, 61, 192 } }; // value must fit in %d byte(s)
+const struct compressed_string translation237 = { .data = 51, .tail = { 225, 217, 120, 11, 172, 236, 110, 27, 112, 79, 198, 178, 107, 48 } }; // wrong number of arguments
+
+// 7343 bytes worth of translations
+// 4498 bytes worth of translations compressed
+// 2845 bytes saved
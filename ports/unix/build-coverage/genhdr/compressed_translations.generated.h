@@ -0,0 +1,98 @@
+// # words 0
+// words []
+// 32   1467 000 0
+// 97 a 553 0010 2
+// 101 e 978 0011 3
+// 105 i 530 0100 4
+// 110 n 603 0101 5
+// 111 o 644 0110 6
+// 114 r 523 0111 7
+// 115 s 499 1000 8
+// 116 t 816 1001 9
+// 99 c 312 10100 20
+// 100 d 304 10101 21
+// 108 l 315 10110 22
+// 109 m 298 10111 23
+// 112 p 272 11000 24
+// 117 u 360 11001 25
+// 37 % 158 110100 52
+// 39 \' 186 110101 53
+// 98 b 209 110110 54
+// 102 f 212 110111 55
+// 103 g 158 111000 56
+// 121 y 143 111001 57
+// 104 h 123 1110100 116
+// 113 q 119 1110101 117
+// 118 v 93 1110110 118
+// 119 w 65 1110111 119
+// 120 x 64 1111000 120
+// 40 ( 32 11110010 242
+// 41 ) 32 11110011 243
+// 44 , 47 11110100 244
+// 95 _ 32 11110101 245
+// 107 k 38 11110110 246
+// 45 - 21 111101110 494
+// 46 . 18 111101111 495
+// 48 0 18 111110000 496
+// 106 j 30 111110001 497
+// 122 z 19 111110010 498
+// 10 \n 11 1111100110 998
+// 13 \r 11 1111100111 999
+// 42 * 9 1111101000 1000
+// 49 1 15 1111101001 1001
+// 50 2 10 1111101010 1002
+// 51 3 10 1111101011 1003
+// 54 6 12 1111101100 1004
+// 58 : 10 1111101101 1005
+// 66 B 15 1111101110 1006
+// 67 C 11 1111101111 1007
+// 71 G 8 1111110000 1008
+// 73 I 13 1111110001 1009
+// 78 N 9 1111110010 1010
+// 80 P 10 1111110011 1011
+// 83 S 9 1111110100 1012
+// 84 T 9 1111110101 1013
+// 34 \" 4 11111101100 2028
+// 47 / 8 11111101101 2029
+// 52 4 5 11111101110 2030
+// 53 5 5 11111101111 2031
+// 56 8 7 11111110000 2032
+// 61 = 8 11111110001 2033
+// 65 A 4 11111110010 2034
+// 68 D 5 11111110011 2035
+// 69 E 7 11111110100 2036
+// 70 F 5 11111110101 2037
+// 76 L 6 11111110110 2038
+// 77 M 6 11111110111 2039
+// 79 O 7 11111111000 2040
+// 82 R 8 11111111001 2041
+// 85 U 6 11111111010 2042
+// 57 9 3 111111110110 4086
+// 60 < 2 111111110111 4087
+// 62 > 2 111111111000 4088
+// 72 H 2 111111111001 4089
+// 74 J 2 111111111010 4090
+// 87 W 2 111111111011 4091
+// 96 ` 2 111111111100 4092
+// 33 ! 1 1111111111010 8186
+// 35 # 1 1111111111011 8187
+// 43 + 1 1111111111100 8188
+// 59 ; 1 1111111111101 8189
+// 75 K 1 1111111111110 8190
+// 86 V 1 1111111111111 8191
+// length count {3: 1, 4: 8, 5: 6, 6: 6, 7: 5, 8: 5, 9: 5, 10: 16, 11: 15, 12: 7, 13: 6}
+// values [' ', 'a', 'e', 'i', 'n', 'o', 'r', 's', 't', 'c', 'd', 'l', 'm', 'p', 'u', '%', "'", 'b', 'f', 'g', 'y', 'h', 'q', 'v', 'w', 'x', '(', ')', ',', '_', 'k', '-', '.', '0', 'j', 'z', '\n', '\r', '*', '1', '2', '3', '6', ':', 'B', 'C', 'G', 'I', 'N', 'P', 'S', 'T', '"', '/', '4', '5', '8', '=', 'A', 'D', 'E', 'F', 'L', 'M', 'O', 'R', 'U', '9', '<', '>', 'H', 'J', 'W', '`', '!', '#', '+', ';', 'K', 'V'] lengths 14 bytearray(b'\x00\x00\x01\x08\x06\x06\x05\x05\x05\x10\x0f\x07\x06\x00')
+// [' ', 'a', 'e', 'i', 'n', 'o', 'r', 's', 't', 'c', 'd', 'l', 'm', 'p', 'u', '%', "'", 'b', 'f', 'g', 'y', 'h', 'q', 'v', 'w', 'x', '(', ')', ',', '_', 'k', '-', '.', '0', 'j', 'z', '\n', '\r', '*', '1', '2', '3', '6', ':', 'B', 'C', 'G', 'I', 'N', 'P', 'S', 'T', '"', '/', '4', '5', '8', '=', 'A', 'D', 'E', 'F', 'L', 'M', 'O', 'R', 'U', '9', '<', '>', 'H', 'J', 'W', '`', '!', '#', '+', ';', 'K', 'V'] bytearray(b'\x00\x00\x01\x08\x06\x06\x05\x05\x05\x10\x0f\x07\x06\x00')
+typedef uint8_t mchar_t;
+const uint8_t lengths[] = { 0, 0, 1, 8, 6, 6, 5, 5, 5, 16, 15, 7, 6, 0 };
+const mchar_t values[] = { 32, 97, 101, 105, 110, 111, 114, 115, 116, 99, 100, 108, 109, 112, 117, 37, 39, 98, 102, 103, 121, 104, 113, 118, 119, 120, 40, 41, 44, 95, 107, 45, 46, 48, 106, 122, 10, 13, 42, 49, 50, 51, 54, 58, 66, 67, 71, 73, 78, 80, 83, 84, 34, 47, 52, 53, 56, 61, 65, 68, 69, 70, 76, 77, 79, 82, 85, 57, 60, 62, 72, 74, 87, 96, 33, 35, 43, 59, 75, 86 };
+#define compress_max_length_bits (8)
+const mchar_t words[] = {  };
+const uint8_t wlencount[] = { 0 };
+#define word_start 128
+#define word_end 127
+#define minlen 0
+#define maxlen 0
+#define translation_offstart 0
+#define translation_offset 0
+#define translation_qstr_bits 0
@@ -0,0 +1,1372 @@
+// This file was automatically generated by makeqstrdata.py
+
+QDEF0(MP_QSTRnull, 0, 0, "")
+QDEF0(MP_QSTR_, 5381, 0, "")
+QDEF0(MP_QSTR___dir__, 36730, 7, "__dir__")
+QDEF0(MP_QSTR__0x0a_, 46511, 1, "\x0a")
+QDEF0(MP_QSTR__space_, 46469, 1, " ")
+QDEF0(MP_QSTR__star_, 46479, 1, "*")
+QDEF0(MP_QSTR__slash_, 46474, 1, "/")
+QDEF0(MP_QSTR__lt_module_gt_, 38077, 8, "<module>")
+QDEF0(MP_QSTR__, 46586, 1, "_")
+QDEF0(MP_QSTR___call__, 63911, 8, "__call__")
+QDEF0(MP_QSTR___class__, 50475, 9, "__class__")
+QDEF0(MP_QSTR___delitem__, 13821, 11, "__delitem__")
+QDEF0(MP_QSTR___enter__, 47725, 9, "__enter__")
+QDEF0(MP_QSTR___exit__, 63557, 8, "__exit__")
+QDEF0(MP_QSTR___getattr__, 63552, 11, "__getattr__")
+QDEF0(MP_QSTR___getitem__, 14630, 11, "__getitem__")
+QDEF0(MP_QSTR___hash__, 51447, 8, "__hash__")
+QDEF0(MP_QSTR___init__, 42335, 8, "__init__")
+QDEF0(MP_QSTR___int__, 6934, 7, "__int__")
+QDEF0(MP_QSTR___iter__, 13007, 8, "__iter__")
+QDEF0(MP_QSTR___len__, 45282, 7, "__len__")
+QDEF0(MP_QSTR___main__, 5006, 8, "__main__")
+QDEF0(MP_QSTR___module__, 12543, 10, "__module__")
+QDEF0(MP_QSTR___name__, 14562, 8, "__name__")
+QDEF0(MP_QSTR___new__, 5497, 7, "__new__")
+QDEF0(MP_QSTR___next__, 29442, 8, "__next__")
+QDEF0(MP_QSTR___qualname__, 107, 12, "__qualname__")
+QDEF0(MP_QSTR___repr__, 2832, 8, "__repr__")
+QDEF0(MP_QSTR___setitem__, 15922, 11, "__setitem__")
+QDEF0(MP_QSTR___str__, 52688, 7, "__str__")
+QDEF0(MP_QSTR_ArithmeticError, 35885, 15, "ArithmeticError")
+QDEF0(MP_QSTR_AssertionError, 23191, 14, "AssertionError")
+QDEF0(MP_QSTR_AttributeError, 56865, 14, "AttributeError")
+QDEF0(MP_QSTR_BaseException, 37383, 13, "BaseException")
+QDEF0(MP_QSTR_EOFError, 49041, 8, "EOFError")
+QDEF0(MP_QSTR_Ellipsis, 57584, 8, "Ellipsis")
+QDEF0(MP_QSTR_Exception, 10738, 9, "Exception")
+QDEF0(MP_QSTR_GeneratorExit, 25110, 13, "GeneratorExit")
+QDEF0(MP_QSTR_ImportError, 39968, 11, "ImportError")
+QDEF0(MP_QSTR_IndentationError, 8284, 16, "IndentationError")
+QDEF0(MP_QSTR_IndexError, 44419, 10, "IndexError")
+QDEF0(MP_QSTR_KeyError, 234, 8, "KeyError")
+QDEF0(MP_QSTR_KeyboardInterrupt, 58031, 17, "KeyboardInterrupt")
+QDEF0(MP_QSTR_LookupError, 27135, 11, "LookupError")
+QDEF0(MP_QSTR_MemoryError, 33756, 11, "MemoryError")
+QDEF0(MP_QSTR_NameError, 11706, 9, "NameError")
+QDEF0(MP_QSTR_NoneType, 26647, 8, "NoneType")
+QDEF0(MP_QSTR_NotImplementedError, 39110, 19, "NotImplementedError")
+QDEF0(MP_QSTR_OSError, 26017, 7, "OSError")
+QDEF0(MP_QSTR_OverflowError, 57729, 13, "OverflowError")
+QDEF0(MP_QSTR_RuntimeError, 61793, 12, "RuntimeError")
+QDEF0(MP_QSTR_StopIteration, 7402, 13, "StopIteration")
+QDEF0(MP_QSTR_SyntaxError, 36756, 11, "SyntaxError")
+QDEF0(MP_QSTR_SystemExit, 65312, 10, "SystemExit")
+QDEF0(MP_QSTR_TypeError, 38437, 9, "TypeError")
+QDEF0(MP_QSTR_ValueError, 34710, 10, "ValueError")
+QDEF0(MP_QSTR_ZeroDivisionError, 10166, 17, "ZeroDivisionError")
+QDEF0(MP_QSTR_abs, 12949, 3, "abs")
+QDEF0(MP_QSTR_all, 13124, 3, "all")
+QDEF0(MP_QSTR_any, 13075, 3, "any")
+QDEF0(MP_QSTR_append, 38763, 6, "append")
+QDEF0(MP_QSTR_args, 50882, 4, "args")
+QDEF0(MP_QSTR_bool, 15595, 4, "bool")
+QDEF0(MP_QSTR_builtins, 12791, 8, "builtins")
+QDEF0(MP_QSTR_bytearray, 41846, 9, "bytearray")
+QDEF0(MP_QSTR_bytecode, 32034, 8, "bytecode")
+QDEF0(MP_QSTR_bytes, 45660, 5, "bytes")
+QDEF0(MP_QSTR_callable, 28685, 8, "callable")
+QDEF0(MP_QSTR_chr, 19676, 3, "chr")
+QDEF0(MP_QSTR_classmethod, 36020, 11, "classmethod")
+QDEF0(MP_QSTR_clear, 41084, 5, "clear")
+QDEF0(MP_QSTR_close, 26419, 5, "close")
+QDEF0(MP_QSTR_const, 65472, 5, "const")
+QDEF0(MP_QSTR_copy, 56288, 4, "copy")
+QDEF0(MP_QSTR_count, 19878, 5, "count")
+QDEF0(MP_QSTR_dict, 64575, 4, "dict")
+QDEF0(MP_QSTR_dir, 7930, 3, "dir")
+QDEF0(MP_QSTR_divmod, 1208, 6, "divmod")
+QDEF0(MP_QSTR_end, 8970, 3, "end")
+QDEF0(MP_QSTR_endswith, 41755, 8, "endswith")
+QDEF0(MP_QSTR_eval, 42651, 4, "eval")
+QDEF0(MP_QSTR_exec, 49182, 4, "exec")
+QDEF0(MP_QSTR_extend, 59491, 6, "extend")
+QDEF0(MP_QSTR_find, 13312, 4, "find")
+QDEF0(MP_QSTR_format, 13094, 6, "format")
+QDEF0(MP_QSTR_from_bytes, 29749, 10, "from_bytes")
+QDEF0(MP_QSTR_get, 15155, 3, "get")
+QDEF0(MP_QSTR_getattr, 6080, 7, "getattr")
+QDEF0(MP_QSTR_globals, 18845, 7, "globals")
+QDEF0(MP_QSTR_hasattr, 45196, 7, "hasattr")
+QDEF0(MP_QSTR_hash, 28855, 4, "hash")
+QDEF0(MP_QSTR_id, 28456, 2, "id")
+QDEF0(MP_QSTR_index, 10363, 5, "index")
+QDEF0(MP_QSTR_insert, 21522, 6, "insert")
+QDEF0(MP_QSTR_int, 21270, 3, "int")
+QDEF0(MP_QSTR_isalpha, 14315, 7, "isalpha")
+QDEF0(MP_QSTR_isdigit, 39592, 7, "isdigit")
+QDEF0(MP_QSTR_isinstance, 48822, 10, "isinstance")
+QDEF0(MP_QSTR_islower, 33020, 7, "islower")
+QDEF0(MP_QSTR_isspace, 63579, 7, "isspace")
+QDEF0(MP_QSTR_issubclass, 32693, 10, "issubclass")
+QDEF0(MP_QSTR_isupper, 42973, 7, "isupper")
+QDEF0(MP_QSTR_items, 21475, 5, "items")
+QDEF0(MP_QSTR_iter, 8591, 4, "iter")
+QDEF0(MP_QSTR_join, 23719, 4, "join")
+QDEF0(MP_QSTR_key, 27954, 3, "key")
+QDEF0(MP_QSTR_keys, 4865, 4, "keys")
+QDEF0(MP_QSTR_len, 16482, 3, "len")
+QDEF0(MP_QSTR_list, 7463, 4, "list")
+QDEF0(MP_QSTR_little, 27273, 6, "little")
+QDEF0(MP_QSTR_locals, 41275, 6, "locals")
+QDEF0(MP_QSTR_lower, 52166, 5, "lower")
+QDEF0(MP_QSTR_lstrip, 47589, 6, "lstrip")
+QDEF0(MP_QSTR_main, 47054, 4, "main")
+QDEF0(MP_QSTR_map, 17337, 3, "map")
+QDEF0(MP_QSTR_micropython, 31755, 11, "micropython")
+QDEF0(MP_QSTR_next, 34882, 4, "next")
+QDEF0(MP_QSTR_object, 36240, 6, "object")
+QDEF0(MP_QSTR_open, 15057, 4, "open")
+QDEF0(MP_QSTR_ord, 24092, 3, "ord")
+QDEF0(MP_QSTR_pop, 29482, 3, "pop")
+QDEF0(MP_QSTR_popitem, 11455, 7, "popitem")
+QDEF0(MP_QSTR_pow, 29485, 3, "pow")
+QDEF0(MP_QSTR_print, 50772, 5, "print")
+QDEF0(MP_QSTR_range, 24090, 5, "range")
+QDEF0(MP_QSTR_read, 63927, 4, "read")
+QDEF0(MP_QSTR_readinto, 48971, 8, "readinto")
+QDEF0(MP_QSTR_readline, 6649, 8, "readline")
+QDEF0(MP_QSTR_remove, 35427, 6, "remove")
+QDEF0(MP_QSTR_replace, 9545, 7, "replace")
+QDEF0(MP_QSTR_repr, 63440, 4, "repr")
+QDEF0(MP_QSTR_reverse, 10789, 7, "reverse")
+QDEF0(MP_QSTR_rfind, 40146, 5, "rfind")
+QDEF0(MP_QSTR_rindex, 11241, 6, "rindex")
+QDEF0(MP_QSTR_round, 9703, 5, "round")
+QDEF0(MP_QSTR_rsplit, 165, 6, "rsplit")
+QDEF0(MP_QSTR_rstrip, 38203, 6, "rstrip")
+QDEF0(MP_QSTR_self, 30585, 4, "self")
+QDEF0(MP_QSTR_send, 30393, 4, "send")
+QDEF0(MP_QSTR_sep, 36643, 3, "sep")
+QDEF0(MP_QSTR_set, 36647, 3, "set")
+QDEF0(MP_QSTR_setattr, 43220, 7, "setattr")
+QDEF0(MP_QSTR_setdefault, 41836, 10, "setdefault")
+QDEF0(MP_QSTR_sort, 40383, 4, "sort")
+QDEF0(MP_QSTR_sorted, 5470, 6, "sorted")
+QDEF0(MP_QSTR_split, 13239, 5, "split")
+QDEF0(MP_QSTR_start, 61317, 5, "start")
+QDEF0(MP_QSTR_startswith, 59508, 10, "startswith")
+QDEF0(MP_QSTR_staticmethod, 44898, 12, "staticmethod")
+QDEF0(MP_QSTR_step, 13911, 4, "step")
+QDEF0(MP_QSTR_stop, 13981, 4, "stop")
+QDEF0(MP_QSTR_str, 36176, 3, "str")
+QDEF0(MP_QSTR_strip, 7721, 5, "strip")
+QDEF0(MP_QSTR_sum, 36142, 3, "sum")
+QDEF0(MP_QSTR_super, 45764, 5, "super")
+QDEF0(MP_QSTR_throw, 17587, 5, "throw")
+QDEF0(MP_QSTR_to_bytes, 16088, 8, "to_bytes")
+QDEF0(MP_QSTR_tuple, 16893, 5, "tuple")
+QDEF0(MP_QSTR_type, 32669, 4, "type")
+QDEF0(MP_QSTR_update, 30388, 6, "update")
+QDEF0(MP_QSTR_upper, 37927, 5, "upper")
+QDEF0(MP_QSTR_utf_hyphen_8, 33463, 5, "utf-8")
+QDEF0(MP_QSTR_value, 13390, 5, "value")
+QDEF0(MP_QSTR_values, 48765, 6, "values")
+QDEF0(MP_QSTR_write, 43160, 5, "write")
+QDEF0(MP_QSTR_zip, 44262, 3, "zip")
+QDEF1(MP_QSTR__percent__hash_o, 6764, 3, "%#o")
+QDEF1(MP_QSTR__percent__hash_x, 6779, 3, "%#x")
+QDEF1(MP_QSTR__dot__dot__dot__space_, 10379, 4, "... ")
+QDEF1(MP_QSTR__dot_frozen, 62593, 7, ".frozen")
+QDEF0(MP_QSTR__lt_dictcomp_gt_, 36300, 10, "<dictcomp>")
+QDEF0(MP_QSTR__lt_genexpr_gt_, 27188, 9, "<genexpr>")
+QDEF1(MP_QSTR__lt_input_gt_, 369, 7, "<input>")
+QDEF0(MP_QSTR__lt_lambda_gt_, 35968, 8, "<lambda>")
+QDEF0(MP_QSTR__lt_listcomp_gt_, 5588, 10, "<listcomp>")
+QDEF0(MP_QSTR__lt_setcomp_gt_, 20820, 9, "<setcomp>")
+QDEF1(MP_QSTR__lt_stdin_gt_, 25571, 7, "<stdin>")
+QDEF1(MP_QSTR__lt_string_gt_, 21330, 8, "<string>")
+QDEF1(MP_QSTR__gt__gt__gt__space_, 44187, 4, ">>> ")
+QDEF1(MP_QSTR_A, 46564, 1, "A")
+QDEF1(MP_QSTR_ABS, 46773, 3, "ABS")
+QDEF1(MP_QSTR_ADD_DIV, 62816, 7, "ADD_DIV")
+QDEF1(MP_QSTR_ADD_SUB, 34559, 7, "ADD_SUB")
+QDEF1(MP_QSTR_AES, 46610, 3, "AES")
+QDEF1(MP_QSTR_ATTACK, 31117, 6, "ATTACK")
+QDEF1(MP_QSTR_Atkinson, 65358, 8, "Atkinson")
+QDEF1(MP_QSTR_BAND_PASS, 30370, 9, "BAND_PASS")
+QDEF1(MP_QSTR_BGR555, 2119, 6, "BGR555")
+QDEF1(MP_QSTR_BGR555_SWAPPED, 58748, 14, "BGR555_SWAPPED")
+QDEF1(MP_QSTR_BGR565, 2148, 6, "BGR565")
+QDEF1(MP_QSTR_BGR565_SWAPPED, 21727, 14, "BGR565_SWAPPED")
+QDEF1(MP_QSTR_Biquad, 53871, 6, "Biquad")
+QDEF1(MP_QSTR_Bitmap, 33094, 6, "Bitmap")
+QDEF1(MP_QSTR_BlendMode, 30183, 9, "BlendMode")
+QDEF1(MP_QSTR_BlockInput, 9402, 10, "BlockInput")
+QDEF1(MP_QSTR_BrokenPipeError, 25902, 15, "BrokenPipeError")
+QDEF1(MP_QSTR_BufferedWriter, 11499, 14, "BufferedWriter")
+QDEF1(MP_QSTR_BytesIO, 46874, 7, "BytesIO")
+QDEF1(MP_QSTR_CLIP, 56467, 4, "CLIP")
+QDEF1(MP_QSTR_CONSTRAINED_LERP, 58881, 16, "CONSTRAINED_LERP")
+QDEF1(MP_QSTR_CancelledError, 39926, 14, "CancelledError")
+QDEF1(MP_QSTR_ChannelMixer, 51405, 12, "ChannelMixer")
+QDEF1(MP_QSTR_ChannelMixerOffset, 53216, 18, "ChannelMixerOffset")
+QDEF1(MP_QSTR_ChannelScale, 36542, 12, "ChannelScale")
+QDEF1(MP_QSTR_ChannelScaleOffset, 10067, 18, "ChannelScaleOffset")
+QDEF1(MP_QSTR_Chorus, 35861, 6, "Chorus")
+QDEF1(MP_QSTR_Circle, 57751, 6, "Circle")
+QDEF1(MP_QSTR_ColorConverter, 37304, 14, "ColorConverter")
+QDEF1(MP_QSTR_ColorSpace, 46044, 10, "ColorSpace")
+QDEF1(MP_QSTR_Colorspace, 21180, 10, "Colorspace")
+QDEF1(MP_QSTR_ConnectionError, 4427, 15, "ConnectionError")
+QDEF1(MP_QSTR_DEBUG, 27956, 5, "DEBUG")
+QDEF1(MP_QSTR_DECAY, 28607, 5, "DECAY")
+QDEF1(MP_QSTR_DIV_ADD, 8032, 7, "DIV_ADD")
+QDEF1(MP_QSTR_DecompIO, 46995, 8, "DecompIO")
+QDEF1(MP_QSTR_Distortion, 44366, 10, "Distortion")
+QDEF1(MP_QSTR_DistortionMode, 24141, 14, "DistortionMode")
+QDEF1(MP_QSTR_DitherAlgorithm, 10156, 15, "DitherAlgorithm")
+QDEF1(MP_QSTR_EACCES, 49719, 6, "EACCES")
+QDEF1(MP_QSTR_EADDRINUSE, 4375, 10, "EADDRINUSE")
+QDEF1(MP_QSTR_EAGAIN, 60448, 6, "EAGAIN")
+QDEF1(MP_QSTR_EALREADY, 5446, 8, "EALREADY")
+QDEF1(MP_QSTR_EBADF, 41825, 5, "EBADF")
+QDEF1(MP_QSTR_ECONNABORTED, 43815, 12, "ECONNABORTED")
+QDEF1(MP_QSTR_ECONNREFUSED, 11322, 12, "ECONNREFUSED")
+QDEF1(MP_QSTR_ECONNRESET, 64281, 10, "ECONNRESET")
+QDEF1(MP_QSTR_EEXIST, 44371, 6, "EEXIST")
+QDEF1(MP_QSTR_EHOSTUNREACH, 9606, 12, "EHOSTUNREACH")
+QDEF1(MP_QSTR_EINPROGRESS, 41114, 11, "EINPROGRESS")
+QDEF1(MP_QSTR_EINVAL, 65372, 6, "EINVAL")
+QDEF1(MP_QSTR_EIO, 42630, 3, "EIO")
+QDEF1(MP_QSTR_EISDIR, 20389, 6, "EISDIR")
+QDEF1(MP_QSTR_ENOBUFS, 34787, 7, "ENOBUFS")
+QDEF1(MP_QSTR_ENODEV, 26550, 6, "ENODEV")
+QDEF1(MP_QSTR_ENOENT, 25950, 6, "ENOENT")
+QDEF1(MP_QSTR_ENOMEM, 34212, 6, "ENOMEM")
+QDEF1(MP_QSTR_ENOSPC, 36097, 6, "ENOSPC")
+QDEF1(MP_QSTR_ENOTCONN, 55161, 8, "ENOTCONN")
+QDEF1(MP_QSTR_EOPNOTSUPP, 38828, 10, "EOPNOTSUPP")
+QDEF1(MP_QSTR_EPERM, 32746, 5, "EPERM")
+QDEF1(MP_QSTR_EROFS, 33320, 5, "EROFS")
+QDEF1(MP_QSTR_ETIMEDOUT, 63743, 9, "ETIMEDOUT")
+QDEF1(MP_QSTR_Echo, 53892, 4, "Echo")
+QDEF1(MP_QSTR_Envelope, 33227, 8, "Envelope")
+QDEF1(MP_QSTR_EnvelopeState, 10620, 13, "EnvelopeState")
+QDEF1(MP_QSTR_FileIO, 5573, 6, "FileIO")
+QDEF1(MP_QSTR_Filter, 16389, 6, "Filter")
+QDEF1(MP_QSTR_FilterMode, 52742, 10, "FilterMode")
+QDEF1(MP_QSTR_Flanger, 49104, 7, "Flanger")
+QDEF1(MP_QSTR_FloydStenberg, 30563, 13, "FloydStenberg")
+QDEF1(MP_QSTR_Framebuffer, 41400, 11, "Framebuffer")
+QDEF1(MP_QSTR_FramebufferDisplay, 64930, 18, "FramebufferDisplay")
+QDEF1(MP_QSTR_Freeverb, 61266, 8, "Freeverb")
+QDEF1(MP_QSTR_GranularPitchShift, 16819, 18, "GranularPitchShift")
+QDEF1(MP_QSTR_Group, 53722, 5, "Group")
+QDEF1(MP_QSTR_HIGH_PASS, 60325, 9, "HIGH_PASS")
+QDEF1(MP_QSTR_HIGH_SHELF, 9536, 10, "HIGH_SHELF")
+QDEF1(MP_QSTR_IOBase, 48694, 6, "IOBase")
+QDEF1(MP_QSTR_IV, 29498, 2, "IV")
+QDEF1(MP_QSTR_JpegDecoder, 56195, 11, "JpegDecoder")
+QDEF1(MP_QSTR_L8, 29489, 2, "L8")
+QDEF1(MP_QSTR_LERP, 28686, 4, "LERP")
+QDEF1(MP_QSTR_LFO, 56672, 3, "LFO")
+QDEF1(MP_QSTR_LOFI, 25609, 4, "LOFI")
+QDEF1(MP_QSTR_LOW_PASS, 29855, 8, "LOW_PASS")
+QDEF1(MP_QSTR_LOW_SHELF, 15226, 9, "LOW_SHELF")
+QDEF1(MP_QSTR_LockType, 8246, 8, "LockType")
+QDEF1(MP_QSTR_MAX, 51089, 3, "MAX")
+QDEF1(MP_QSTR_MID, 50821, 3, "MID")
+QDEF1(MP_QSTR_MIN, 50831, 3, "MIN")
+QDEF1(MP_QSTR_MODE_CBC, 8987, 8, "MODE_CBC")
+QDEF1(MP_QSTR_MODE_CTR, 8796, 8, "MODE_CTR")
+QDEF1(MP_QSTR_MODE_ECB, 7101, 8, "MODE_ECB")
+QDEF1(MP_QSTR_MUL_DIV, 58389, 7, "MUL_DIV")
+QDEF1(MP_QSTR_Math, 16149, 4, "Math")
+QDEF1(MP_QSTR_MathOperation, 43520, 13, "MathOperation")
+QDEF1(MP_QSTR_MidiTrack, 20195, 9, "MidiTrack")
+QDEF1(MP_QSTR_Mixer, 53614, 5, "Mixer")
+QDEF1(MP_QSTR_MixerVoice, 19384, 10, "MixerVoice")
+QDEF1(MP_QSTR_MultiTapDelay, 45532, 13, "MultiTapDelay")
+QDEF1(MP_QSTR_NONE, 19791, 4, "NONE")
+QDEF1(MP_QSTR_NOTCH, 65467, 5, "NOTCH")
+QDEF1(MP_QSTR_NativeBaseClass, 61887, 15, "NativeBaseClass")
+QDEF1(MP_QSTR_None, 53615, 4, "None")
+QDEF1(MP_QSTR_Normal, 30998, 6, "Normal")
+QDEF1(MP_QSTR_NotImplemented, 50750, 14, "NotImplemented")
+QDEF1(MP_QSTR_Note, 53685, 4, "Note")
+QDEF1(MP_QSTR_OFFSET_SCALE, 16015, 12, "OFFSET_SCALE")
+QDEF1(MP_QSTR_OLDEST, 48192, 6, "OLDEST")
+QDEF1(MP_QSTR_OVERDRIVE, 48999, 9, "OVERDRIVE")
+QDEF1(MP_QSTR_OnDiskBitmap, 62226, 12, "OnDiskBitmap")
+QDEF1(MP_QSTR_OrderedDict, 32496, 11, "OrderedDict")
+QDEF1(MP_QSTR_PEAKING_EQ, 18065, 10, "PEAKING_EQ")
+QDEF1(MP_QSTR_POLLERR, 49375, 7, "POLLERR")
+QDEF1(MP_QSTR_POLLHUP, 35447, 7, "POLLHUP")
+QDEF1(MP_QSTR_POLLIN, 24957, 6, "POLLIN")
+QDEF1(MP_QSTR_POLLOUT, 34164, 7, "POLLOUT")
+QDEF1(MP_QSTR_PRODUCT, 11086, 7, "PRODUCT")
+QDEF1(MP_QSTR_Palette, 37880, 7, "Palette")
+QDEF1(MP_QSTR_Phaser, 59064, 6, "Phaser")
+QDEF1(MP_QSTR_PitchShift, 62595, 10, "PitchShift")
+QDEF1(MP_QSTR_Polygon, 31561, 7, "Polygon")
+QDEF1(MP_QSTR_Q, 46580, 1, "Q")
+QDEF1(MP_QSTR_QUIETEST, 22395, 8, "QUIETEST")
+QDEF1(MP_QSTR_RELEASE, 18700, 7, "RELEASE")
+QDEF1(MP_QSTR_RGB555, 52295, 6, "RGB555")
+QDEF1(MP_QSTR_RGB555_SWAPPED, 43388, 14, "RGB555_SWAPPED")
+QDEF1(MP_QSTR_RGB565, 52324, 6, "RGB565")
+QDEF1(MP_QSTR_RGB565_SWAPPED, 6367, 14, "RGB565_SWAPPED")
+QDEF1(MP_QSTR_RGB888, 53418, 6, "RGB888")
+QDEF1(MP_QSTR_RawSample, 30439, 9, "RawSample")
+QDEF1(MP_QSTR_ReadableBuffer, 56381, 14, "ReadableBuffer")
+QDEF1(MP_QSTR_Rectangle, 19652, 9, "Rectangle")
+QDEF1(MP_QSTR_ReloadException, 49667, 15, "ReloadException")
+QDEF1(MP_QSTR_SCALE_OFFSET, 25391, 12, "SCALE_OFFSET")
+QDEF1(MP_QSTR_SUM, 4366, 3, "SUM")
+QDEF1(MP_QSTR_SUSTAIN, 39330, 7, "SUSTAIN")
+QDEF1(MP_QSTR_ScaleMixer, 24054, 10, "ScaleMixer")
+QDEF1(MP_QSTR_ScaleMixerOffset, 14747, 16, "ScaleMixerOffset")
+QDEF1(MP_QSTR_Screen, 54505, 6, "Screen")
+QDEF1(MP_QSTR_Sequence, 28730, 8, "Sequence")
+QDEF1(MP_QSTR_StopAsyncIteration, 61676, 18, "StopAsyncIteration")
+QDEF1(MP_QSTR_StringIO, 30326, 8, "StringIO")
+QDEF1(MP_QSTR_Synthesizer, 52335, 11, "Synthesizer")
+QDEF1(MP_QSTR_Task, 16904, 4, "Task")
+QDEF1(MP_QSTR_TaskQueue, 23705, 9, "TaskQueue")
+QDEF1(MP_QSTR_TextIOWrapper, 36269, 13, "TextIOWrapper")
+QDEF1(MP_QSTR_TileGrid, 3401, 8, "TileGrid")
+QDEF1(MP_QSTR_TimeoutError, 19302, 12, "TimeoutError")
+QDEF1(MP_QSTR_True, 5907, 4, "True")
+QDEF1(MP_QSTR_UnicodeError, 53538, 12, "UnicodeError")
+QDEF1(MP_QSTR_VectorShape, 47475, 11, "VectorShape")
+QDEF1(MP_QSTR_VfsFat, 39701, 6, "VfsFat")
+QDEF1(MP_QSTR_VfsPosix, 20155, 8, "VfsPosix")
+QDEF1(MP_QSTR_ViperTypeError, 1501, 14, "ViperTypeError")
+QDEF1(MP_QSTR_VoiceStealing, 42844, 13, "VoiceStealing")
+QDEF1(MP_QSTR_WAVESHAPE, 44655, 9, "WAVESHAPE")
+QDEF1(MP_QSTR_WaveFile, 29414, 8, "WaveFile")
+QDEF1(MP_QSTR_WritableBuffer, 60823, 14, "WritableBuffer")
+QDEF0(MP_QSTR___abs__, 54933, 7, "__abs__")
+QDEF0(MP_QSTR___add__, 33476, 7, "__add__")
+QDEF1(MP_QSTR___aenter__, 33868, 10, "__aenter__")
+QDEF1(MP_QSTR___aexit__, 53188, 9, "__aexit__")
+QDEF1(MP_QSTR___aiter__, 11086, 9, "__aiter__")
+QDEF1(MP_QSTR___all__, 50116, 7, "__all__")
+QDEF0(MP_QSTR___and__, 56078, 7, "__and__")
+QDEF1(MP_QSTR___anext__, 46211, 9, "__anext__")
+QDEF1(MP_QSTR___await__, 64079, 9, "__await__")
+QDEF1(MP_QSTR___bases__, 12291, 9, "__bases__")
+QDEF0(MP_QSTR___bool__, 25899, 8, "__bool__")
+QDEF1(MP_QSTR___build_class__, 34882, 15, "__build_class__")
+QDEF1(MP_QSTR___bytes__, 33244, 9, "__bytes__")
+QDEF1(MP_QSTR___cause__, 9028, 9, "__cause__")
+QDEF1(MP_QSTR___code__, 58664, 8, "__code__")
+QDEF0(MP_QSTR___complex__, 58053, 11, "__complex__")
+QDEF0(MP_QSTR___contains__, 24518, 12, "__contains__")
+QDEF1(MP_QSTR___context__, 26234, 11, "__context__")
+QDEF1(MP_QSTR___del__, 14184, 7, "__del__")
+QDEF1(MP_QSTR___delattr__, 30555, 11, "__delattr__")
+QDEF0(MP_QSTR___delete__, 60892, 10, "__delete__")
+QDEF1(MP_QSTR___dict__, 21631, 8, "__dict__")
+QDEF0(MP_QSTR___divmod__, 4472, 10, "__divmod__")
+QDEF0(MP_QSTR___eq__, 15985, 6, "__eq__")
+QDEF1(MP_QSTR___file__, 21507, 8, "__file__")
+QDEF0(MP_QSTR___float__, 28725, 9, "__float__")
+QDEF0(MP_QSTR___floordiv__, 24390, 12, "__floordiv__")
+QDEF1(MP_QSTR___future__, 60736, 10, "__future__")
+QDEF0(MP_QSTR___ge__, 18087, 6, "__ge__")
+QDEF0(MP_QSTR___get__, 36787, 7, "__get__")
+QDEF1(MP_QSTR___globals__, 44701, 11, "__globals__")
+QDEF0(MP_QSTR___gt__, 33462, 6, "__gt__")
+QDEF0(MP_QSTR___iadd__, 19053, 8, "__iadd__")
+QDEF0(MP_QSTR___iand__, 8615, 8, "__iand__")
+QDEF0(MP_QSTR___ifloordiv__, 3919, 13, "__ifloordiv__")
+QDEF0(MP_QSTR___ilshift__, 41600, 11, "__ilshift__")
+QDEF0(MP_QSTR___imatmul__, 28352, 11, "__imatmul__")
+QDEF0(MP_QSTR___imod__, 34378, 8, "__imod__")
+QDEF1(MP_QSTR___import__, 15928, 10, "__import__")
+QDEF0(MP_QSTR___imul__, 52760, 8, "__imul__")
+QDEF0(MP_QSTR___invert__, 30711, 10, "__invert__")
+QDEF0(MP_QSTR___ior__, 36849, 7, "__ior__")
+QDEF0(MP_QSTR___ipow__, 54660, 8, "__ipow__")
+QDEF0(MP_QSTR___irshift__, 63710, 11, "__irshift__")
+QDEF0(MP_QSTR___isub__, 30728, 8, "__isub__")
+QDEF0(MP_QSTR___itruediv__, 545, 12, "__itruediv__")
+QDEF0(MP_QSTR___ixor__, 47369, 8, "__ixor__")
+QDEF0(MP_QSTR___le__, 5068, 6, "__le__")
+QDEF0(MP_QSTR___lshift__, 34825, 10, "__lshift__")
+QDEF0(MP_QSTR___lt__, 26717, 6, "__lt__")
+QDEF0(MP_QSTR___matmul__, 62281, 10, "__matmul__")
+QDEF0(MP_QSTR___mod__, 14179, 7, "__mod__")
+QDEF0(MP_QSTR___mul__, 16945, 7, "__mul__")
+QDEF0(MP_QSTR___ne__, 2830, 6, "__ne__")
+QDEF0(MP_QSTR___neg__, 54633, 7, "__neg__")
+QDEF0(MP_QSTR___or__, 47928, 6, "__or__")
+QDEF1(MP_QSTR___path__, 9160, 8, "__path__")
+QDEF0(MP_QSTR___pos__, 61481, 7, "__pos__")
+QDEF0(MP_QSTR___pow__, 45, 7, "__pow__")
+QDEF0(MP_QSTR___radd__, 50454, 8, "__radd__")
+QDEF0(MP_QSTR___rand__, 11996, 8, "__rand__")
+QDEF1(MP_QSTR___repl_print__, 47872, 14, "__repl_print__")
+QDEF1(MP_QSTR___reversed__, 65377, 12, "__reversed__")
+QDEF0(MP_QSTR___rfloordiv__, 38996, 13, "__rfloordiv__")
+QDEF0(MP_QSTR___rlshift__, 53531, 11, "__rlshift__")
+QDEF0(MP_QSTR___rmatmul__, 987, 11, "__rmatmul__")
+QDEF0(MP_QSTR___rmod__, 35377, 8, "__rmod__")
+QDEF0(MP_QSTR___rmul__, 355, 8, "__rmul__")
+QDEF0(MP_QSTR___ror__, 56362, 7, "__ror__")
+QDEF0(MP_QSTR___rpow__, 39679, 8, "__rpow__")
+QDEF0(MP_QSTR___rrshift__, 40389, 11, "__rrshift__")
+QDEF0(MP_QSTR___rshift__, 38999, 10, "__rshift__")
+QDEF0(MP_QSTR___rsub__, 30579, 8, "__rsub__")
+QDEF0(MP_QSTR___rtruediv__, 55130, 12, "__rtruediv__")
+QDEF0(MP_QSTR___rxor__, 34546, 8, "__rxor__")
+QDEF0(MP_QSTR___set__, 45991, 7, "__set__")
+QDEF1(MP_QSTR___set_name__, 21695, 12, "__set_name__")
+QDEF1(MP_QSTR___setattr__, 6484, 11, "__setattr__")
+QDEF0(MP_QSTR___sizeof__, 15113, 10, "__sizeof__")
+QDEF0(MP_QSTR___sub__, 2337, 7, "__sub__")
+QDEF1(MP_QSTR___suppress_context__, 32564, 20, "__suppress_context__")
+QDEF1(MP_QSTR___traceback__, 53071, 13, "__traceback__")
+QDEF0(MP_QSTR___truediv__, 61320, 11, "__truediv__")
+QDEF0(MP_QSTR___xor__, 60448, 7, "__xor__")
+QDEF1(MP_QSTR__asdict, 18482, 7, "_asdict")
+QDEF1(MP_QSTR__asyncio, 18906, 8, "_asyncio")
+QDEF1(MP_QSTR__build, 9004, 6, "_build")
+QDEF1(MP_QSTR__fill_area, 64029, 10, "_fill_area")
+QDEF1(MP_QSTR__machine, 19391, 8, "_machine")
+QDEF1(MP_QSTR__mpy, 10590, 4, "_mpy")
+QDEF1(MP_QSTR__task_queue, 50649, 11, "_task_queue")
+QDEF1(MP_QSTR__thread, 724, 7, "_thread")
+QDEF1(MP_QSTR_a, 46532, 1, "a")
+QDEF1(MP_QSTR_a2b_base64, 2876, 10, "a2b_base64")
+QDEF1(MP_QSTR_abs_tol, 28029, 7, "abs_tol")
+QDEF1(MP_QSTR_acos, 40987, 4, "acos")
+QDEF1(MP_QSTR_acosh, 41747, 5, "acosh")
+QDEF1(MP_QSTR_acquire, 54045, 7, "acquire")
+QDEF1(MP_QSTR_add, 12868, 3, "add")
+QDEF1(MP_QSTR_aesio, 31508, 5, "aesio")
+QDEF1(MP_QSTR_algorithm, 10, 9, "algorithm")
+QDEF1(MP_QSTR_allocate_lock, 60908, 13, "allocate_lock")
+QDEF1(MP_QSTR_alphablend, 64848, 10, "alphablend")
+QDEF1(MP_QSTR_amplitude, 16316, 9, "amplitude")
+QDEF1(MP_QSTR_angle, 11396, 5, "angle")
+QDEF1(MP_QSTR_annotations, 28017, 11, "annotations")
+QDEF1(MP_QSTR_appendleft, 7856, 10, "appendleft")
+QDEF1(MP_QSTR_arg, 13457, 3, "arg")
+QDEF1(MP_QSTR_argv, 50887, 4, "argv")
+QDEF1(MP_QSTR_array, 29308, 5, "array")
+QDEF1(MP_QSTR_arrayblit, 65039, 9, "arrayblit")
+QDEF1(MP_QSTR_asin, 58704, 4, "asin")
+QDEF1(MP_QSTR_asinh, 36664, 5, "asinh")
+QDEF1(MP_QSTR_atan, 48671, 4, "atan")
+QDEF1(MP_QSTR_atan2, 33229, 5, "atan2")
+QDEF1(MP_QSTR_atanh, 33175, 5, "atanh")
+QDEF1(MP_QSTR_atexit, 39088, 6, "atexit")
+QDEF1(MP_QSTR_attack_level, 3012, 12, "attack_level")
+QDEF1(MP_QSTR_attack_time, 16519, 11, "attack_time")
+QDEF1(MP_QSTR_audiocore, 44264, 9, "audiocore")
+QDEF1(MP_QSTR_audiodelays, 22389, 11, "audiodelays")
+QDEF1(MP_QSTR_audiofilters, 13344, 12, "audiofilters")
+QDEF1(MP_QSTR_audiofreeverb, 64036, 13, "audiofreeverb")
+QDEF1(MP_QSTR_audiomixer, 52056, 10, "audiomixer")
+QDEF1(MP_QSTR_auto_refresh, 5864, 12, "auto_refresh")
+QDEF1(MP_QSTR_b, 46535, 1, "b")
+QDEF1(MP_QSTR_b2a_base64, 36668, 10, "b2a_base64")
+QDEF1(MP_QSTR_b_add, 7193, 5, "b_add")
+QDEF1(MP_QSTR_base, 18160, 4, "base")
+QDEF1(MP_QSTR_bb, 28357, 2, "bb")
+QDEF1(MP_QSTR_bend, 13448, 4, "bend")
+QDEF1(MP_QSTR_bg, 28352, 2, "bg")
+QDEF1(MP_QSTR_big, 18665, 3, "big")
+QDEF1(MP_QSTR_bin, 18656, 3, "bin")
+QDEF1(MP_QSTR_binascii, 15505, 8, "binascii")
+QDEF1(MP_QSTR_bit_length, 6841, 10, "bit_length")
+QDEF1(MP_QSTR_bitmap, 56934, 6, "bitmap")
+QDEF1(MP_QSTR_bitmapfilter, 26950, 12, "bitmapfilter")
+QDEF1(MP_QSTR_bitmaptools, 8301, 11, "bitmaptools")
+QDEF1(MP_QSTR_bits_per_pixel, 17382, 14, "bits_per_pixel")
+QDEF1(MP_QSTR_bits_per_sample, 12360, 15, "bits_per_sample")
+QDEF1(MP_QSTR_bits_per_value, 57829, 14, "bits_per_value")
+QDEF1(MP_QSTR_blend, 40452, 5, "blend")
+QDEF1(MP_QSTR_blend_precompute, 38345, 16, "blend_precompute")
+QDEF1(MP_QSTR_blendmode, 61927, 9, "blendmode")
+QDEF1(MP_QSTR_blit, 20726, 4, "blit")
+QDEF1(MP_QSTR_block_size, 20822, 10, "block_size")
+QDEF1(MP_QSTR_blocks, 8991, 6, "blocks")
+QDEF1(MP_QSTR_bound_method, 41623, 12, "bound_method")
+QDEF1(MP_QSTR_boundary_fill, 47629, 13, "boundary_fill")
+QDEF1(MP_QSTR_br, 28373, 2, "br")
+QDEF1(MP_QSTR_brightness, 50764, 10, "brightness")
+QDEF1(MP_QSTR_buffer, 41189, 6, "buffer")
+QDEF1(MP_QSTR_buffer_size, 54719, 11, "buffer_size")
+QDEF1(MP_QSTR_buffering, 56101, 9, "buffering")
+QDEF1(MP_QSTR_byteorder, 39265, 9, "byteorder")
+QDEF1(MP_QSTR_c, 46534, 1, "c")
+QDEF1(MP_QSTR_calcsize, 14413, 8, "calcsize")
+QDEF1(MP_QSTR_cancel, 34563, 6, "cancel")
+QDEF1(MP_QSTR_cast, 49728, 4, "cast")
+QDEF1(MP_QSTR_ceil, 45062, 4, "ceil")
+QDEF1(MP_QSTR_center, 48974, 6, "center")
+QDEF1(MP_QSTR_chain, 49128, 5, "chain")
+QDEF1(MP_QSTR_change, 36643, 6, "change")
+QDEF1(MP_QSTR_channel_count, 922, 13, "channel_count")
+QDEF1(MP_QSTR_chdir, 45745, 5, "chdir")
+QDEF1(MP_QSTR_choice, 13102, 6, "choice")
+QDEF1(MP_QSTR_circuitpython, 15106, 13, "circuitpython")
+QDEF1(MP_QSTR_clock, 25901, 5, "clock")
+QDEF1(MP_QSTR_closure, 51828, 7, "closure")
+QDEF1(MP_QSTR_cmath, 62646, 5, "cmath")
+QDEF1(MP_QSTR_code, 55912, 4, "code")
+QDEF1(MP_QSTR_codeop, 1943, 6, "codeop")
+QDEF1(MP_QSTR_collect, 26011, 7, "collect")
+QDEF1(MP_QSTR_collections, 51424, 11, "collections")
+QDEF1(MP_QSTR_color, 1752, 5, "color")
+QDEF1(MP_QSTR_color_count, 43492, 11, "color_count")
+QDEF1(MP_QSTR_color_depth, 2346, 11, "color_depth")
+QDEF1(MP_QSTR_color_index, 50233, 11, "color_index")
+QDEF1(MP_QSTR_colorspace, 37084, 10, "colorspace")
+QDEF1(MP_QSTR_colorwheel, 47371, 10, "colorwheel")
+QDEF1(MP_QSTR_compile, 51700, 7, "compile")
+QDEF1(MP_QSTR_compile_command, 63276, 15, "compile_command")
+QDEF1(MP_QSTR_complex, 40389, 7, "complex")
+QDEF1(MP_QSTR_contains, 1030, 8, "contains")
+QDEF1(MP_QSTR_convert, 40690, 7, "convert")
+QDEF1(MP_QSTR_copysign, 5171, 8, "copysign")
+QDEF1(MP_QSTR_coro, 56244, 4, "coro")
+QDEF1(MP_QSTR_coroutine, 32279, 9, "coroutine")
+QDEF1(MP_QSTR_cos, 19578, 3, "cos")
+QDEF1(MP_QSTR_cosh, 56274, 4, "cosh")
+QDEF1(MP_QSTR_counter, 16913, 7, "counter")
+QDEF1(MP_QSTR_crc32, 59510, 5, "crc32")
+QDEF1(MP_QSTR_ctrl, 62764, 4, "ctrl")
+QDEF1(MP_QSTR_cur_task, 11763, 8, "cur_task")
+QDEF1(MP_QSTR_damp, 56317, 4, "damp")
+QDEF1(MP_QSTR_data, 56341, 4, "data")
+QDEF1(MP_QSTR_data_source, 19287, 11, "data_source")
+QDEF1(MP_QSTR_deadbeef, 59525, 8, "deadbeef")
+QDEF1(MP_QSTR_decay, 20383, 5, "decay")
+QDEF1(MP_QSTR_decay_time, 61269, 10, "decay_time")
+QDEF1(MP_QSTR_decode, 22953, 6, "decode")
+QDEF1(MP_QSTR_decompress, 64354, 10, "decompress")
+QDEF1(MP_QSTR_decrypt_into, 27787, 12, "decrypt_into")
+QDEF1(MP_QSTR_default, 32206, 7, "default")
+QDEF1(MP_QSTR_default_tile, 8133, 12, "default_tile")
+QDEF1(MP_QSTR_degrees, 16642, 7, "degrees")
+QDEF1(MP_QSTR_deinit, 36254, 6, "deinit")
+QDEF1(MP_QSTR_delattr, 51419, 7, "delattr")
+QDEF1(MP_QSTR_delay_ms, 34737, 8, "delay_ms")
+QDEF1(MP_QSTR_deleter, 56174, 7, "deleter")
+QDEF1(MP_QSTR_density, 21789, 7, "density")
+QDEF1(MP_QSTR_depth, 31976, 5, "depth")
+QDEF1(MP_QSTR_deque, 39173, 5, "deque")
+QDEF1(MP_QSTR_dest, 60707, 4, "dest")
+QDEF1(MP_QSTR_dest_bitmap, 57087, 11, "dest_bitmap")
+QDEF1(MP_QSTR_dest_clip0, 60410, 10, "dest_clip0")
+QDEF1(MP_QSTR_dest_clip1, 60411, 10, "dest_clip1")
+QDEF1(MP_QSTR_dict_view, 43309, 9, "dict_view")
+QDEF1(MP_QSTR_difference, 9330, 10, "difference")
+QDEF1(MP_QSTR_difference_update, 64156, 17, "difference_update")
+QDEF1(MP_QSTR_digest, 50381, 6, "digest")
+QDEF1(MP_QSTR_dirty, 51319, 5, "dirty")
+QDEF1(MP_QSTR_disable, 30353, 7, "disable")
+QDEF1(MP_QSTR_discard, 28943, 7, "discard")
+QDEF1(MP_QSTR_displayio, 2873, 9, "displayio")
+QDEF1(MP_QSTR_dither, 57187, 6, "dither")
+QDEF1(MP_QSTR_doc, 7981, 3, "doc")
+QDEF1(MP_QSTR_done, 837, 4, "done")
+QDEF1(MP_QSTR_draw_circle, 18792, 11, "draw_circle")
+QDEF1(MP_QSTR_draw_line, 34132, 9, "draw_line")
+QDEF1(MP_QSTR_draw_polygon, 4054, 12, "draw_polygon")
+QDEF1(MP_QSTR_drive, 26697, 5, "drive")
+QDEF1(MP_QSTR_dump, 12265, 4, "dump")
+QDEF1(MP_QSTR_dumps, 11642, 5, "dumps")
+QDEF1(MP_QSTR_e, 46528, 1, "e")
+QDEF1(MP_QSTR_element_size, 5793, 12, "element_size")
+QDEF1(MP_QSTR_enable, 56836, 6, "enable")
+QDEF1(MP_QSTR_encode, 51779, 6, "encode")
+QDEF1(MP_QSTR_encoding, 39942, 8, "encoding")
+QDEF1(MP_QSTR_encrypt_into, 6369, 12, "encrypt_into")
+QDEF1(MP_QSTR_enumerate, 47729, 9, "enumerate")
+QDEF1(MP_QSTR_envelope, 24299, 8, "envelope")
+QDEF1(MP_QSTR_erf, 9108, 3, "erf")
+QDEF1(MP_QSTR_erfc, 38519, 4, "erfc")
+QDEF1(MP_QSTR_errno, 4545, 5, "errno")
+QDEF1(MP_QSTR_error_location, 21663, 14, "error_location")
+QDEF1(MP_QSTR_errorcode, 56592, 9, "errorcode")
+QDEF1(MP_QSTR_exc_info, 65290, 8, "exc_info")
+QDEF1(MP_QSTR_execfile, 10328, 8, "execfile")
+QDEF1(MP_QSTR_executable, 12821, 10, "executable")
+QDEF1(MP_QSTR_exit, 48773, 4, "exit")
+QDEF1(MP_QSTR_exp, 9416, 3, "exp")
+QDEF1(MP_QSTR_expm1, 29300, 5, "expm1")
+QDEF1(MP_QSTR_extra_coverage, 39534, 14, "extra_coverage")
+QDEF1(MP_QSTR_extra_cpp_coverage, 28210, 18, "extra_cpp_coverage")
+QDEF1(MP_QSTR_f0, 28179, 2, "f0")
+QDEF1(MP_QSTR_fabs, 4755, 4, "fabs")
+QDEF1(MP_QSTR_factor_1, 23878, 8, "factor_1")
+QDEF1(MP_QSTR_factor_2, 23877, 8, "factor_2")
+QDEF1(MP_QSTR_factorial, 13004, 9, "factorial")
+QDEF1(MP_QSTR_false_color, 27738, 11, "false_color")
+QDEF1(MP_QSTR_feedback, 45708, 8, "feedback")
+QDEF1(MP_QSTR_file, 13507, 4, "file")
+QDEF1(MP_QSTR_filename, 21732, 8, "filename")
+QDEF1(MP_QSTR_filename2, 61782, 9, "filename2")
+QDEF1(MP_QSTR_fileno, 30338, 6, "fileno")
+QDEF1(MP_QSTR_fill, 13514, 4, "fill")
+QDEF1(MP_QSTR_fill_color_value, 1116, 16, "fill_color_value")
+QDEF1(MP_QSTR_fill_region, 3021, 11, "fill_region")
+QDEF1(MP_QSTR_fill_row, 51839, 8, "fill_row")
+QDEF1(MP_QSTR_filter, 48677, 6, "filter")
+QDEF1(MP_QSTR_flip_x, 32241, 6, "flip_x")
+QDEF1(MP_QSTR_flip_y, 32240, 6, "flip_y")
+QDEF1(MP_QSTR_float, 17461, 5, "float")
+QDEF1(MP_QSTR_floor, 18045, 5, "floor")
+QDEF1(MP_QSTR_flush, 49505, 5, "flush")
+QDEF1(MP_QSTR_fmod, 17637, 4, "fmod")
+QDEF1(MP_QSTR_format_exception, 6574, 16, "format_exception")
+QDEF1(MP_QSTR_framebuffer, 33432, 11, "framebuffer")
+QDEF1(MP_QSTR_framebufferio, 38014, 13, "framebufferio")
+QDEF1(MP_QSTR_freeverb, 52338, 8, "freeverb")
+QDEF1(MP_QSTR_freq_shift, 3002, 10, "freq_shift")
+QDEF1(MP_QSTR_frequency, 52897, 9, "frequency")
+QDEF1(MP_QSTR_frexp, 38940, 5, "frexp")
+QDEF1(MP_QSTR_from_file, 37386, 9, "from_file")
+QDEF1(MP_QSTR_fromhex, 14598, 7, "fromhex")
+QDEF1(MP_QSTR_fromkeys, 48439, 8, "fromkeys")
+QDEF1(MP_QSTR_frozenset, 40173, 9, "frozenset")
+QDEF1(MP_QSTR_function, 551, 8, "function")
+QDEF1(MP_QSTR_g, 46530, 1, "g")
+QDEF1(MP_QSTR_g_add, 7196, 5, "g_add")
+QDEF1(MP_QSTR_gamma, 36866, 5, "gamma")
+QDEF1(MP_QSTR_gb, 28256, 2, "gb")
+QDEF1(MP_QSTR_gc, 28257, 2, "gc")
+QDEF1(MP_QSTR_generator, 50070, 9, "generator")
+QDEF1(MP_QSTR_get_buffer, 3820, 10, "get_buffer")
+QDEF1(MP_QSTR_get_ident, 45566, 9, "get_ident")
+QDEF1(MP_QSTR_get_structure, 19481, 13, "get_structure")
+QDEF1(MP_QSTR_getcwd, 53251, 6, "getcwd")
+QDEF1(MP_QSTR_getenv, 64430, 6, "getenv")
+QDEF1(MP_QSTR_getlocale, 64731, 9, "getlocale")
+QDEF1(MP_QSTR_getrandbits, 32102, 11, "getrandbits")
+QDEF1(MP_QSTR_getsizeof, 9215, 9, "getsizeof")
+QDEF1(MP_QSTR_getter, 45712, 6, "getter")
+QDEF1(MP_QSTR_getvalue, 44152, 8, "getvalue")
+QDEF1(MP_QSTR_gg, 28261, 2, "gg")
+QDEF1(MP_QSTR_gmtime, 36442, 6, "gmtime")
+QDEF1(MP_QSTR_gr, 28272, 2, "gr")
+QDEF1(MP_QSTR_grain_size, 24268, 10, "grain_size")
+QDEF1(MP_QSTR_group, 45242, 5, "group")
+QDEF1(MP_QSTR_groups, 51081, 6, "groups")
+QDEF1(MP_QSTR_hashlib, 27920, 7, "hashlib")
+QDEF1(MP_QSTR_heap_lock, 36013, 9, "heap_lock")
+QDEF1(MP_QSTR_heap_locked, 26444, 11, "heap_locked")
+QDEF1(MP_QSTR_heap_unlock, 11606, 11, "heap_unlock")
+QDEF1(MP_QSTR_heapify, 11695, 7, "heapify")
+QDEF1(MP_QSTR_heappop, 10198, 7, "heappop")
+QDEF1(MP_QSTR_heappush, 27527, 8, "heappush")
+QDEF1(MP_QSTR_heapq, 7528, 5, "heapq")
+QDEF1(MP_QSTR_height, 13306, 6, "height")
+QDEF1(MP_QSTR_help, 23700, 4, "help")
+QDEF1(MP_QSTR_hex, 20592, 3, "hex")
+QDEF1(MP_QSTR_hexlify, 32554, 7, "hexlify")
+QDEF1(MP_QSTR_hidden, 18671, 6, "hidden")
+QDEF1(MP_QSTR_i, 46540, 1, "i")
+QDEF1(MP_QSTR_ilistdir, 27249, 8, "ilistdir")
+QDEF1(MP_QSTR_imag, 46919, 4, "imag")
+QDEF1(MP_QSTR_implementation, 11543, 14, "implementation")
+QDEF1(MP_QSTR_indices, 18522, 7, "indices")
+QDEF1(MP_QSTR_inf, 21252, 3, "inf")
+QDEF1(MP_QSTR_input, 23155, 5, "input")
+QDEF1(MP_QSTR_input_colorspace, 9301, 16, "input_colorspace")
+QDEF1(MP_QSTR_intern, 63727, 6, "intern")
+QDEF1(MP_QSTR_interpolate, 13666, 11, "interpolate")
+QDEF1(MP_QSTR_intersection, 10792, 12, "intersection")
+QDEF1(MP_QSTR_intersection_update, 56582, 19, "intersection_update")
+QDEF1(MP_QSTR_invert, 183, 6, "invert")
+QDEF1(MP_QSTR_io, 28451, 2, "io")
+QDEF1(MP_QSTR_ioctl, 49784, 5, "ioctl")
+QDEF1(MP_QSTR_ipoll, 23891, 5, "ipoll")
+QDEF1(MP_QSTR_is_transparent, 32550, 14, "is_transparent")
+QDEF1(MP_QSTR_isclose, 20041, 7, "isclose")
+QDEF1(MP_QSTR_isdisjoint, 26871, 10, "isdisjoint")
+QDEF1(MP_QSTR_isenabled, 58778, 9, "isenabled")
+QDEF1(MP_QSTR_isfinite, 43942, 8, "isfinite")
+QDEF1(MP_QSTR_isinf, 4414, 5, "isinf")
+QDEF1(MP_QSTR_isnan, 926, 5, "isnan")
+QDEF1(MP_QSTR_issubset, 49593, 8, "issubset")
+QDEF1(MP_QSTR_issuperset, 60668, 10, "issuperset")
+QDEF1(MP_QSTR_itemsize, 30581, 8, "itemsize")
+QDEF1(MP_QSTR_iterable, 37413, 8, "iterable")
+QDEF1(MP_QSTR_iterator, 48711, 8, "iterator")
+QDEF1(MP_QSTR_jpegio, 50587, 6, "jpegio")
+QDEF1(MP_QSTR_json, 53757, 4, "json")
+QDEF1(MP_QSTR_kbd_intr, 5110, 8, "kbd_intr")
+QDEF1(MP_QSTR_keepends, 35682, 8, "keepends")
+QDEF1(MP_QSTR_key_size, 58440, 8, "key_size")
+QDEF1(MP_QSTR_label, 59203, 5, "label")
+QDEF1(MP_QSTR_last, 16175, 4, "last")
+QDEF1(MP_QSTR_layer, 3206, 5, "layer")
+QDEF1(MP_QSTR_ldexp, 28480, 5, "ldexp")
+QDEF1(MP_QSTR_length, 34649, 6, "length")
+QDEF1(MP_QSTR_level, 19411, 5, "level")
+QDEF1(MP_QSTR_lfo_tick, 23274, 8, "lfo_tick")
+QDEF1(MP_QSTR_lfo_value, 38100, 9, "lfo_value")
+QDEF1(MP_QSTR_lgamma, 27854, 6, "lgamma")
+QDEF1(MP_QSTR_libc_ver, 47615, 8, "libc_ver")
+QDEF1(MP_QSTR_limit, 47376, 5, "limit")
+QDEF1(MP_QSTR_listdir, 58264, 7, "listdir")
+QDEF1(MP_QSTR_load, 9315, 4, "load")
+QDEF1(MP_QSTR_loads, 45232, 5, "loads")
+QDEF1(MP_QSTR_locale, 41261, 6, "locale")
+QDEF1(MP_QSTR_localtime, 18045, 9, "localtime")
+QDEF1(MP_QSTR_location, 3992, 8, "location")
+QDEF1(MP_QSTR_lock, 9134, 4, "lock")
+QDEF1(MP_QSTR_locked, 47631, 6, "locked")
+QDEF1(MP_QSTR_log, 16161, 3, "log")
+QDEF1(MP_QSTR_log10, 37184, 5, "log10")
+QDEF1(MP_QSTR_log2, 9075, 4, "log2")
+QDEF1(MP_QSTR_lookup, 43655, 6, "lookup")
+QDEF1(MP_QSTR_loop, 9273, 4, "loop")
+QDEF1(MP_QSTR_machine, 43872, 7, "machine")
+QDEF1(MP_QSTR_make_opaque, 16135, 11, "make_opaque")
+QDEF1(MP_QSTR_make_transparent, 3422, 16, "make_transparent")
+QDEF1(MP_QSTR_mask, 47761, 4, "mask")
+QDEF1(MP_QSTR_match, 8854, 5, "match")
+QDEF1(MP_QSTR_math, 47925, 4, "math")
+QDEF1(MP_QSTR_max, 17329, 3, "max")
+QDEF1(MP_QSTR_max_delay_ms, 18106, 12, "max_delay_ms")
+QDEF1(MP_QSTR_max_polyphony, 51364, 13, "max_polyphony")
+QDEF1(MP_QSTR_max_voices, 43019, 10, "max_voices")
+QDEF1(MP_QSTR_maxsize, 28884, 7, "maxsize")
+QDEF1(MP_QSTR_mem_alloc, 11090, 9, "mem_alloc")
+QDEF1(MP_QSTR_mem_current, 47638, 11, "mem_current")
+QDEF1(MP_QSTR_mem_free, 25291, 8, "mem_free")
+QDEF1(MP_QSTR_mem_info, 61905, 8, "mem_info")
+QDEF1(MP_QSTR_mem_peak, 9536, 8, "mem_peak")
+QDEF1(MP_QSTR_mem_total, 27389, 9, "mem_total")
+QDEF1(MP_QSTR_memoryview, 17513, 10, "memoryview")
+QDEF1(MP_QSTR_midi_to_hz, 50213, 10, "midi_to_hz")
+QDEF1(MP_QSTR_min, 17071, 3, "min")
+QDEF1(MP_QSTR_min_delay_ms, 49380, 12, "min_delay_ms")
+QDEF1(MP_QSTR_minimum_frames_per_second, 65525, 25, "minimum_frames_per_second")
+QDEF1(MP_QSTR_mix, 17081, 3, "mix")
+QDEF1(MP_QSTR_mkdir, 46492, 5, "mkdir")
+QDEF1(MP_QSTR_mkfs, 45174, 4, "mkfs")
+QDEF1(MP_QSTR_mktime, 11158, 6, "mktime")
+QDEF1(MP_QSTR_mode, 49190, 4, "mode")
+QDEF1(MP_QSTR_modf, 49189, 4, "modf")
+QDEF1(MP_QSTR_modify, 26357, 6, "modify")
+QDEF1(MP_QSTR_module, 39359, 6, "module")
+QDEF1(MP_QSTR_modules, 53740, 7, "modules")
+QDEF1(MP_QSTR_morph, 8173, 5, "morph")
+QDEF1(MP_QSTR_mount, 3496, 5, "mount")
+QDEF1(MP_QSTR_move_to_end, 28640, 11, "move_to_end")
+QDEF1(MP_QSTR_mul, 17969, 3, "mul")
+QDEF1(MP_QSTR_name, 30114, 4, "name")
+QDEF1(MP_QSTR_namedtuple, 5662, 10, "namedtuple")
+QDEF1(MP_QSTR_nan, 22756, 3, "nan")
+QDEF1(MP_QSTR_native, 2948, 6, "native")
+QDEF1(MP_QSTR_new_attribute, 37370, 13, "new_attribute")
+QDEF1(MP_QSTR_new_color, 62203, 9, "new_color")
+QDEF1(MP_QSTR_newline, 35127, 7, "newline")
+QDEF1(MP_QSTR_nframes, 46405, 7, "nframes")
+QDEF1(MP_QSTR_nodename, 43874, 8, "nodename")
+QDEF1(MP_QSTR_note, 19925, 4, "note")
+QDEF1(MP_QSTR_note_info, 10308, 9, "note_info")
+QDEF1(MP_QSTR_oct, 23805, 3, "oct")
+QDEF1(MP_QSTR_offscreen, 42886, 9, "offscreen")
+QDEF1(MP_QSTR_offset, 15432, 6, "offset")
+QDEF1(MP_QSTR_old_color, 22272, 9, "old_color")
+QDEF1(MP_QSTR_once, 52226, 4, "once")
+QDEF1(MP_QSTR_operation, 17136, 9, "operation")
+QDEF1(MP_QSTR_opt_level, 26503, 9, "opt_level")
+QDEF1(MP_QSTR_os, 28537, 2, "os")
+QDEF1(MP_QSTR_overlap, 23926, 7, "overlap")
+QDEF1(MP_QSTR_ox, 28530, 2, "ox")
+QDEF1(MP_QSTR_oy, 28531, 2, "oy")
+QDEF1(MP_QSTR_pack, 53692, 4, "pack")
+QDEF1(MP_QSTR_pack_into, 43295, 9, "pack_into")
+QDEF1(MP_QSTR_palette, 29144, 7, "palette")
+QDEF1(MP_QSTR_palette_index, 28473, 13, "palette_index")
+QDEF1(MP_QSTR_panning, 15092, 7, "panning")
+QDEF1(MP_QSTR_partition, 58759, 9, "partition")
+QDEF1(MP_QSTR_path, 52872, 4, "path")
+QDEF1(MP_QSTR_peek, 49534, 4, "peek")
+QDEF1(MP_QSTR_pend_throw, 29939, 10, "pend_throw")
+QDEF1(MP_QSTR_ph_key, 6901, 6, "ph_key")
+QDEF1(MP_QSTR_phase, 54634, 5, "phase")
+QDEF1(MP_QSTR_phase_offset, 60984, 12, "phase_offset")
+QDEF1(MP_QSTR_pi, 28700, 2, "pi")
+QDEF1(MP_QSTR_pixel_shader, 18523, 12, "pixel_shader")
+QDEF1(MP_QSTR_platform, 6458, 8, "platform")
+QDEF1(MP_QSTR_play, 56865, 4, "play")
+QDEF1(MP_QSTR_playing, 53345, 7, "playing")
+QDEF1(MP_QSTR_point, 6633, 5, "point")
+QDEF1(MP_QSTR_points, 22394, 6, "points")
+QDEF1(MP_QSTR_polar, 3077, 5, "polar")
+QDEF1(MP_QSTR_poll, 55706, 4, "poll")
+QDEF1(MP_QSTR_popleft, 39537, 7, "popleft")
+QDEF1(MP_QSTR_position, 1052, 8, "position")
+QDEF1(MP_QSTR_post_filter, 47714, 11, "post_filter")
+QDEF1(MP_QSTR_post_gain, 25091, 9, "post_gain")
+QDEF1(MP_QSTR_pre_filter, 12733, 10, "pre_filter")
+QDEF1(MP_QSTR_pre_gain, 1308, 8, "pre_gain")
+QDEF1(MP_QSTR_prefetch, 56062, 8, "prefetch")
+QDEF1(MP_QSTR_press, 38562, 5, "press")
+QDEF1(MP_QSTR_pressed, 47875, 7, "pressed")
+QDEF1(MP_QSTR_print_exception, 8732, 15, "print_exception")
+QDEF1(MP_QSTR_print_subclass_attr, 6605, 19, "print_subclass_attr")
+QDEF1(MP_QSTR_property, 10690, 8, "property")
+QDEF1(MP_QSTR_protocol_audiosample, 59068, 20, "protocol_audiosample")
+QDEF1(MP_QSTR_protocol_draw, 50476, 13, "protocol_draw")
+QDEF1(MP_QSTR_protocol_framebuffer, 41457, 20, "protocol_framebuffer")
+QDEF1(MP_QSTR_protocol_vfs, 16367, 12, "protocol_vfs")
+QDEF1(MP_QSTR_ps1, 28919, 3, "ps1")
+QDEF1(MP_QSTR_ps2, 28916, 3, "ps2")
+QDEF1(MP_QSTR_ptr, 28755, 3, "ptr")
+QDEF1(MP_QSTR_ptr16, 51956, 5, "ptr16")
+QDEF1(MP_QSTR_ptr32, 51890, 5, "ptr32")
+QDEF1(MP_QSTR_ptr8, 31371, 4, "ptr8")
+QDEF1(MP_QSTR_push, 32443, 4, "push")
+QDEF1(MP_QSTR_putenv, 27849, 6, "putenv")
+QDEF1(MP_QSTR_px, 28685, 2, "px")
+QDEF1(MP_QSTR_py, 28684, 2, "py")
+QDEF1(MP_QSTR_python_compiler, 38285, 15, "python_compiler")
+QDEF1(MP_QSTR_qstr_info, 33200, 9, "qstr_info")
+QDEF1(MP_QSTR_r, 46551, 1, "r")
+QDEF1(MP_QSTR_r_add, 6153, 5, "r_add")
+QDEF1(MP_QSTR_radians, 16263, 7, "radians")
+QDEF1(MP_QSTR_radius, 4093, 6, "radius")
+QDEF1(MP_QSTR_rainbowio, 51373, 9, "rainbowio")
+QDEF1(MP_QSTR_randint, 56495, 7, "randint")
+QDEF1(MP_QSTR_random, 11454, 6, "random")
+QDEF1(MP_QSTR_randrange, 16035, 9, "randrange")
+QDEF1(MP_QSTR_rate, 2119, 4, "rate")
+QDEF1(MP_QSTR_rb, 28885, 2, "rb")
+QDEF1(MP_QSTR_re, 28882, 2, "re")
+QDEF1(MP_QSTR_read1, 12454, 5, "read1")
+QDEF1(MP_QSTR_readblocks, 7213, 10, "readblocks")
+QDEF1(MP_QSTR_readinto1, 43162, 9, "readinto1")
+QDEF1(MP_QSTR_readlines, 22890, 9, "readlines")
+QDEF1(MP_QSTR_readonly, 35075, 8, "readonly")
+QDEF1(MP_QSTR_real, 63935, 4, "real")
+QDEF1(MP_QSTR_rect, 63973, 4, "rect")
+QDEF1(MP_QSTR_refresh, 19608, 7, "refresh")
+QDEF1(MP_QSTR_refresh_count, 53412, 13, "refresh_count")
+QDEF1(MP_QSTR_register, 41388, 8, "register")
+QDEF1(MP_QSTR_rekey, 23045, 5, "rekey")
+QDEF1(MP_QSTR_rel_tol, 18006, 7, "rel_tol")
+QDEF1(MP_QSTR_release, 36844, 7, "release")
+QDEF1(MP_QSTR_release_all, 65138, 11, "release_all")
+QDEF1(MP_QSTR_release_all_then_press, 48034, 22, "release_all_then_press")
+QDEF1(MP_QSTR_release_displays, 14394, 16, "release_displays")
+QDEF1(MP_QSTR_release_then_press, 9596, 18, "release_then_press")
+QDEF1(MP_QSTR_release_time, 34310, 12, "release_time")
+QDEF1(MP_QSTR_rename, 6197, 6, "rename")
+QDEF1(MP_QSTR_render, 3567, 6, "render")
+QDEF1(MP_QSTR_render_into, 12524, 11, "render_into")
+QDEF1(MP_QSTR_replace_color, 44171, 13, "replace_color")
+QDEF1(MP_QSTR_replaced_color_value, 22427, 20, "replaced_color_value")
+QDEF1(MP_QSTR_reset_buffer, 44847, 12, "reset_buffer")
+QDEF1(MP_QSTR_retrigger, 24490, 9, "retrigger")
+QDEF1(MP_QSTR_reverse_pixels_in_element, 19256, 25, "reverse_pixels_in_element")
+QDEF1(MP_QSTR_reverse_rows, 18851, 12, "reverse_rows")
+QDEF1(MP_QSTR_reversed, 28321, 8, "reversed")
+QDEF1(MP_QSTR_rg, 28880, 2, "rg")
+QDEF1(MP_QSTR_ring_bend, 7589, 9, "ring_bend")
+QDEF1(MP_QSTR_ring_frequency, 8300, 14, "ring_frequency")
+QDEF1(MP_QSTR_ring_waveform, 8475, 13, "ring_waveform")
+QDEF1(MP_QSTR_ring_waveform_loop_end, 17800, 22, "ring_waveform_loop_end")
+QDEF1(MP_QSTR_ring_waveform_loop_start, 2055, 24, "ring_waveform_loop_start")
+QDEF1(MP_QSTR_rmdir, 42821, 5, "rmdir")
+QDEF1(MP_QSTR_roomsize, 31455, 8, "roomsize")
+QDEF1(MP_QSTR_root_group, 15747, 10, "root_group")
+QDEF1(MP_QSTR_rotation, 12273, 8, "rotation")
+QDEF1(MP_QSTR_rotozoom, 56884, 8, "rotozoom")
+QDEF1(MP_QSTR_rpartition, 53269, 10, "rpartition")
+QDEF1(MP_QSTR_rr, 28869, 2, "rr")
+QDEF1(MP_QSTR_sample, 19459, 6, "sample")
+QDEF1(MP_QSTR_sample_rate, 894, 11, "sample_rate")
+QDEF1(MP_QSTR_samples_signed, 25469, 14, "samples_signed")
+QDEF1(MP_QSTR_scale, 20861, 5, "scale")
+QDEF1(MP_QSTR_schedule, 44256, 8, "schedule")
+QDEF1(MP_QSTR_search, 49579, 6, "search")
+QDEF1(MP_QSTR_seed, 30098, 4, "seed")
+QDEF1(MP_QSTR_seek, 30109, 4, "seek")
+QDEF1(MP_QSTR_segment_size, 64508, 12, "segment_size")
+QDEF1(MP_QSTR_select, 16781, 6, "select")
+QDEF1(MP_QSTR_semitones, 53332, 9, "semitones")
+QDEF1(MP_QSTR_separators, 3307, 10, "separators")
+QDEF1(MP_QSTR_set_buf, 42889, 7, "set_buf")
+QDEF1(MP_QSTR_set_error, 64320, 9, "set_error")
+QDEF1(MP_QSTR_setter, 22788, 6, "setter")
+QDEF1(MP_QSTR_sha256, 302, 6, "sha256")
+QDEF1(MP_QSTR_shape, 18122, 5, "shape")
+QDEF1(MP_QSTR_show, 43654, 4, "show")
+QDEF1(MP_QSTR_signed, 311, 6, "signed")
+QDEF1(MP_QSTR_signedness, 6300, 10, "signedness")
+QDEF1(MP_QSTR_sin, 37041, 3, "sin")
+QDEF1(MP_QSTR_single, 8255, 6, "single")
+QDEF1(MP_QSTR_single_buffer, 7776, 13, "single_buffer")
+QDEF1(MP_QSTR_sinh, 42681, 4, "sinh")
+QDEF1(MP_QSTR_skip_dest_index, 25436, 15, "skip_dest_index")
+QDEF1(MP_QSTR_skip_index, 26725, 10, "skip_index")
+QDEF1(MP_QSTR_skip_source1_index, 33974, 18, "skip_source1_index")
+QDEF1(MP_QSTR_skip_source2_index, 4725, 18, "skip_source2_index")
+QDEF1(MP_QSTR_skip_source_index, 44167, 17, "skip_source_index")
+QDEF1(MP_QSTR_sleep, 10218, 5, "sleep")
+QDEF1(MP_QSTR_sleep_ms, 25355, 8, "sleep_ms")
+QDEF1(MP_QSTR_sleep_us, 24595, 8, "sleep_us")
+QDEF1(MP_QSTR_slice, 62645, 5, "slice")
+QDEF1(MP_QSTR_soft_clip, 11394, 9, "soft_clip")
+QDEF1(MP_QSTR_solarize, 37744, 8, "solarize")
+QDEF1(MP_QSTR_source, 30904, 6, "source")
+QDEF1(MP_QSTR_source_bitmap, 24260, 13, "source_bitmap")
+QDEF1(MP_QSTR_source_bitmap_1, 6730, 15, "source_bitmap_1")
+QDEF1(MP_QSTR_source_bitmap_2, 6729, 15, "source_bitmap_2")
+QDEF1(MP_QSTR_source_clip0, 21601, 12, "source_clip0")
+QDEF1(MP_QSTR_source_clip1, 21600, 12, "source_clip1")
+QDEF1(MP_QSTR_source_colorspace, 4670, 17, "source_colorspace")
+QDEF1(MP_QSTR_span, 18121, 4, "span")
+QDEF1(MP_QSTR_splitlines, 54122, 10, "splitlines")
+QDEF1(MP_QSTR_spread, 5204, 6, "spread")
+QDEF1(MP_QSTR_sqrt, 17441, 4, "sqrt")
+QDEF1(MP_QSTR_src1, 11734, 4, "src1")
+QDEF1(MP_QSTR_src2, 11733, 4, "src2")
+QDEF1(MP_QSTR_stack_size, 15153, 10, "stack_size")
+QDEF1(MP_QSTR_stack_use, 63383, 9, "stack_use")
+QDEF1(MP_QSTR_stages, 45618, 6, "stages")
+QDEF1(MP_QSTR_start_new_thread, 9687, 16, "start_new_thread")
+QDEF1(MP_QSTR_stat, 13783, 4, "stat")
+QDEF1(MP_QSTR_state, 61650, 5, "state")
+QDEF1(MP_QSTR_statvfs, 6420, 7, "statvfs")
+QDEF1(MP_QSTR_stderr, 22691, 6, "stderr")
+QDEF1(MP_QSTR_stdin, 1057, 5, "stdin")
+QDEF1(MP_QSTR_stdout, 33544, 6, "stdout")
+QDEF1(MP_QSTR_stest_fileio, 10847, 12, "stest_fileio")
+QDEF1(MP_QSTR_stest_textio2, 12790, 13, "stest_textio2")
+QDEF1(MP_QSTR_stop_voice, 24852, 10, "stop_voice")
+QDEF1(MP_QSTR_strerror, 29000, 8, "strerror")
+QDEF1(MP_QSTR_struct, 36882, 6, "struct")
+QDEF1(MP_QSTR_sub, 36129, 3, "sub")
+QDEF1(MP_QSTR_sustain_level, 19083, 13, "sustain_level")
+QDEF1(MP_QSTR_swap_bytes_in_element, 27599, 21, "swap_bytes_in_element")
+QDEF1(MP_QSTR_symbol, 4259, 6, "symbol")
+QDEF1(MP_QSTR_symmetric_difference, 26574, 20, "symmetric_difference")
+QDEF1(MP_QSTR_symmetric_difference_update, 63584, 27, "symmetric_difference_update")
+QDEF1(MP_QSTR_sync, 25250, 4, "sync")
+QDEF1(MP_QSTR_synthio, 63323, 7, "synthio")
+QDEF1(MP_QSTR_synthio_block, 20077, 13, "synthio_block")
+QDEF1(MP_QSTR_sys, 36540, 3, "sys")
+QDEF1(MP_QSTR_sysname, 13979, 7, "sysname")
+QDEF1(MP_QSTR_system, 5280, 6, "system")
+QDEF1(MP_QSTR_table, 44155, 5, "table")
+QDEF1(MP_QSTR_tan, 25086, 3, "tan")
+QDEF1(MP_QSTR_tanh, 41430, 4, "tanh")
+QDEF1(MP_QSTR_taps, 40339, 4, "taps")
+QDEF1(MP_QSTR_target_frames_per_second, 24690, 24, "target_frames_per_second")
+QDEF1(MP_QSTR_tau, 25061, 3, "tau")
+QDEF1(MP_QSTR_tb, 28563, 2, "tb")
+QDEF1(MP_QSTR_tell, 45332, 4, "tell")
+QDEF1(MP_QSTR_tempo, 61286, 5, "tempo")
+QDEF1(MP_QSTR_test, 44851, 4, "test")
+QDEF1(MP_QSTR_threshold, 12274, 9, "threshold")
+QDEF1(MP_QSTR_ticks_add, 44701, 9, "ticks_add")
+QDEF1(MP_QSTR_ticks_cpu, 42266, 9, "ticks_cpu")
+QDEF1(MP_QSTR_ticks_diff, 57521, 10, "ticks_diff")
+QDEF1(MP_QSTR_ticks_ms, 12866, 8, "ticks_ms")
+QDEF1(MP_QSTR_ticks_us, 12634, 8, "ticks_us")
+QDEF1(MP_QSTR_tile, 49425, 4, "tile")
+QDEF1(MP_QSTR_tile_height, 46481, 11, "tile_height")
+QDEF1(MP_QSTR_tile_width, 23784, 10, "tile_width")
+QDEF1(MP_QSTR_time, 49648, 4, "time")
+QDEF1(MP_QSTR_time_ns, 45682, 7, "time_ns")
+QDEF1(MP_QSTR_traceback, 45775, 9, "traceback")
+QDEF1(MP_QSTR_tracebacklimit, 41242, 14, "tracebacklimit")
+QDEF1(MP_QSTR_transpose_xy, 5352, 12, "transpose_xy")
+QDEF1(MP_QSTR_trunc, 39259, 5, "trunc")
+QDEF1(MP_QSTR_uint, 15843, 4, "uint")
+QDEF1(MP_QSTR_umount, 40669, 6, "umount")
+QDEF1(MP_QSTR_uname, 40119, 5, "uname")
+QDEF1(MP_QSTR_unhexlify, 47537, 9, "unhexlify")
+QDEF1(MP_QSTR_uniform, 62721, 7, "uniform")
+QDEF1(MP_QSTR_union, 31990, 5, "union")
+QDEF1(MP_QSTR_unlink, 36862, 6, "unlink")
+QDEF1(MP_QSTR_unpack, 15367, 6, "unpack")
+QDEF1(MP_QSTR_unpack_from, 27918, 11, "unpack_from")
+QDEF1(MP_QSTR_unregister, 54295, 10, "unregister")
+QDEF1(MP_QSTR_unsafe, 42767, 6, "unsafe")
+QDEF1(MP_QSTR_unsetenv, 18049, 8, "unsetenv")
+QDEF1(MP_QSTR_urandom, 44715, 7, "urandom")
+QDEF1(MP_QSTR_usys, 62409, 4, "usys")
+QDEF1(MP_QSTR_utime, 40421, 5, "utime")
+QDEF1(MP_QSTR_uzlib, 39789, 5, "uzlib")
+QDEF1(MP_QSTR_value_count, 57330, 11, "value_count")
+QDEF1(MP_QSTR_vectorio, 46778, 8, "vectorio")
+QDEF1(MP_QSTR_version, 54207, 7, "version")
+QDEF1(MP_QSTR_version_info, 2670, 12, "version_info")
+QDEF1(MP_QSTR_viper, 9053, 5, "viper")
+QDEF1(MP_QSTR_voct_to_hz, 4642, 10, "voct_to_hz")
+QDEF1(MP_QSTR_voice, 14483, 5, "voice")
+QDEF1(MP_QSTR_voice_count, 20591, 11, "voice_count")
+QDEF1(MP_QSTR_voice_stealing, 59427, 14, "voice_stealing")
+QDEF1(MP_QSTR_voices, 19072, 6, "voices")
+QDEF1(MP_QSTR_waveform, 27958, 8, "waveform")
+QDEF1(MP_QSTR_waveform_loop_end, 13253, 17, "waveform_loop_end")
+QDEF1(MP_QSTR_waveform_loop_start, 20554, 19, "waveform_loop_start")
+QDEF1(MP_QSTR_waveform_max_length, 26686, 19, "waveform_max_length")
+QDEF1(MP_QSTR_weights, 58454, 7, "weights")
+QDEF1(MP_QSTR_width, 29987, 5, "width")
+QDEF1(MP_QSTR_window, 50057, 6, "window")
+QDEF1(MP_QSTR_write1, 48041, 6, "write1")
+QDEF1(MP_QSTR_writeblocks, 57090, 11, "writeblocks")
+QDEF1(MP_QSTR_x, 46557, 1, "x")
+QDEF1(MP_QSTR_x1, 29004, 2, "x1")
+QDEF1(MP_QSTR_x2, 29007, 2, "x2")
+QDEF1(MP_QSTR_xs, 28942, 2, "xs")
+QDEF1(MP_QSTR_y, 46556, 1, "y")
+QDEF1(MP_QSTR_y1, 29037, 2, "y1")
+QDEF1(MP_QSTR_y2, 29038, 2, "y2")
+QDEF1(MP_QSTR_ys, 28975, 2, "ys")
+QDEF1(MP_QSTR_zlib, 14328, 4, "zlib")
+QDEF1(MP_QSTR__brace_open__colon__hash_b_brace_close_, 14168, 5, "{:#b}")
+// Enumerate translated texts but don't actually include translations. Instead, the linker will link them in.
+TRANSLATION("  File \"%q\", line %d", 0)
+TRANSLATION(" is of type %q\n", 1)
+TRANSLATION("%%c needs int or char", 2)
+TRANSLATION("%q in %q must be of type %q or %q, not %q", 3)
+TRANSLATION("%q in %q must be of type %q, not %q", 4)
+TRANSLATION("%q in use", 5)
+TRANSLATION("%q index out of range", 6)
+TRANSLATION("%q indices must be integers, not %s", 7)
+TRANSLATION("%q length must be %d", 8)
+TRANSLATION("%q length must be %d-%d", 9)
+TRANSLATION("%q length must be <= %d", 10)
+TRANSLATION("%q length must be >= %d", 11)
+TRANSLATION("%q must be %d", 12)
+TRANSLATION("%q must be %d-%d", 13)
+TRANSLATION("%q must be <= %d", 14)
+TRANSLATION("%q must be >= %d", 15)
+TRANSLATION("%q must be a bytearray or array of type 'h', 'H', 'b', or 'B'", 16)
+TRANSLATION("%q must be array of type 'h'", 17)
+TRANSLATION("%q must be of type %q or %q, not %q", 18)
+TRANSLATION("%q must be of type %q, %q, or %q, not %q", 19)
+TRANSLATION("%q must be of type %q, not %q", 20)
+TRANSLATION("%q out of range", 21)
+TRANSLATION("%q step cannot be zero", 22)
+TRANSLATION("%q() takes %d positional arguments but %d were given", 23)
+TRANSLATION("%q() without %q()", 24)
+TRANSLATION("%q=%q", 25)
+TRANSLATION("%s", 26)
+TRANSLATION("'%q' argument required", 27)
+TRANSLATION("'%q' object does not support '%q'", 28)
+TRANSLATION("'%q' object isn't an iterator", 29)
+TRANSLATION("'%q' object isn't callable", 30)
+TRANSLATION("'%q' object isn't iterable", 31)
+TRANSLATION("'%s' object doesn't support item assignment", 32)
+TRANSLATION("'%s' object doesn't support item deletion", 33)
+TRANSLATION("'%s' object has no attribute '%q'", 34)
+TRANSLATION("'%s' object isn't subscriptable", 35)
+TRANSLATION("'=' alignment not allowed in string format specifier", 36)
+TRANSLATION("'S' and 'O' are not supported format types", 37)
+TRANSLATION("'await' outside function", 38)
+TRANSLATION("'break'/'continue' outside loop", 39)
+TRANSLATION("'not' not implemented", 40)
+TRANSLATION("'return' outside function", 41)
+TRANSLATION("'yield from' inside async function", 42)
+TRANSLATION("'yield' outside function", 43)
+TRANSLATION("* arg after **", 44)
+TRANSLATION("*x must be assignment target", 45)
+TRANSLATION(", in %q\n", 46)
+TRANSLATION(".show(x) removed. Use .root_group = x", 47)
+TRANSLATION("0.0 to a complex power", 48)
+TRANSLATION("An error occurred while retrieving '%s':\n", 49)
+TRANSLATION("Audio source error", 50)
+TRANSLATION("Below minimum frame rate", 51)
+TRANSLATION("Bitmap size and bits per value must match", 52)
+TRANSLATION("Brightness not adjustable", 53)
+TRANSLATION("Buffer is not a bytearray.", 54)
+TRANSLATION("Buffer too small", 55)
+TRANSLATION("CBC blocks must be multiples of 16 bytes", 56)
+TRANSLATION("Call super().__init__() before accessing native object.", 57)
+TRANSLATION("Cannot delete values", 58)
+TRANSLATION("Cannot subclass slice", 59)
+TRANSLATION("Coordinate arrays have different lengths", 60)
+TRANSLATION("Coordinate arrays types have different sizes", 61)
+TRANSLATION("Data format error (may be broken data)", 62)
+TRANSLATION("Device error or wrong termination of input stream", 63)
+TRANSLATION("Display must have a 16 bit colorspace.", 64)
+TRANSLATION("Display rotation must be in 90 degree increments", 65)
+TRANSLATION("During handling of the above exception, another exception occurred:", 66)
+TRANSLATION("ECB only operates on 16 bytes at a time", 67)
+TRANSLATION("Error in regex", 68)
+TRANSLATION("File exists", 69)
+TRANSLATION("For L8 colorspace, input bitmap must have 8 bits per pixel", 70)
+TRANSLATION("For RGB colorspaces, input bitmap must have 16 bits per pixel", 71)
+TRANSLATION("Format not supported", 72)
+TRANSLATION("Group already used", 73)
+TRANSLATION("I/O operation on closed file", 74)
+TRANSLATION("Input/output error", 75)
+TRANSLATION("Insufficient memory pool for the image", 76)
+TRANSLATION("Insufficient stream input buffer", 77)
+TRANSLATION("Internal error", 78)
+TRANSLATION("Interrupted by output function", 79)
+TRANSLATION("Invalid %q", 80)
+TRANSLATION("Invalid argument", 81)
+TRANSLATION("Invalid bits per value", 82)
+TRANSLATION("Invalid format", 83)
+TRANSLATION("Invalid format chunk size", 84)
+TRANSLATION("Invalid unicode escape", 85)
+TRANSLATION("Key must be 16, 24, or 32 bytes long", 86)
+TRANSLATION("LHS of keyword arg must be an id", 87)
+TRANSLATION("Layer already in a group", 88)
+TRANSLATION("Layer must be a Group or TileGrid subclass", 89)
+TRANSLATION("Length of %q must be an even multiple of channel_count * type_size", 90)
+TRANSLATION("Mask bitmap must have 8 bits per pixel", 91)
+TRANSLATION("Mask bitmap size must match the other bitmaps", 92)
+TRANSLATION("MicroPython .mpy file; use CircuitPython mpy-cross", 93)
+TRANSLATION("Must be a %q subclass.", 94)
+TRANSLATION("New bitmap must be same size as old bitmap", 95)
+TRANSLATION("No space left on device", 96)
+TRANSLATION("No such device", 97)
+TRANSLATION("No such file/directory", 98)
+TRANSLATION("Object has been deinitialized and can no longer be used. Create a new object.", 99)
+TRANSLATION("Only Windows format, uncompressed BMP supported: given header size is %d", 100)
+TRANSLATION("Only one color can be transparent at a time", 101)
+TRANSLATION("Operation not permitted", 102)
+TRANSLATION("Parameter error", 103)
+TRANSLATION("Permission denied", 104)
+TRANSLATION("Plus any modules on the filesystem\n", 105)
+TRANSLATION("Polygon needs at least 3 points", 106)
+TRANSLATION("RLE-compressed BMP not supported", 107)
+TRANSLATION("Read-only", 108)
+TRANSLATION("Read-only filesystem", 109)
+TRANSLATION("Requested AES mode is unsupported", 110)
+TRANSLATION("Right format but not supported", 111)
+TRANSLATION("Slices not supported", 112)
+TRANSLATION("Source and destination buffers must be the same length", 113)
+TRANSLATION("Supply both or neither of %q and %q", 114)
+TRANSLATION("The above exception was the direct cause of the following exception:", 115)
+TRANSLATION("The sample's %q does not match", 116)
+TRANSLATION("Tile height must exactly divide bitmap height", 117)
+TRANSLATION("Tile index out of bounds", 118)
+TRANSLATION("Tile width must exactly divide bitmap width", 119)
+TRANSLATION("Too many displays", 120)
+TRANSLATION("Traceback (most recent call last):\n", 121)
+TRANSLATION("Unable to init parser", 122)
+TRANSLATION("Unable to read color palette data", 123)
+TRANSLATION("Unsupported JPEG (may be progressive)", 124)
+TRANSLATION("Unsupported colorspace", 125)
+TRANSLATION("Welcome to Adafruit CircuitPython %s!\n\nVisit circuitpython.org for more information.\n\nTo list built-in modules type `help(\"modules\")`.\n", 126)
+TRANSLATION("__init__() should return None, not '%s'", 127)
+TRANSLATION("__new__ arg must be a user-type", 128)
+TRANSLATION("a bytes-like object is required", 129)
+TRANSLATION("abort() called", 130)
+TRANSLATION("annotation must be an identifier", 131)
+TRANSLATION("arg is an empty sequence", 132)
+TRANSLATION("arg must be user-type", 133)
+TRANSLATION("argument name reused", 134)
+TRANSLATION("array/bytes required on right side", 135)
+TRANSLATION("async for/with outside async function", 136)
+TRANSLATION("attributes not supported", 137)
+TRANSLATION("background value out of range of target", 138)
+TRANSLATION("bad compile mode", 139)
+TRANSLATION("bad typecode", 140)
+TRANSLATION("binary op %q not implemented", 141)
+TRANSLATION("bitmap size and depth must match", 142)
+TRANSLATION("bitmap sizes must match", 143)
+TRANSLATION("bits must be 32 or less", 144)
+TRANSLATION("bits_per_sample must be 16", 145)
+TRANSLATION("bits_per_sample must be 8 or 16", 146)
+TRANSLATION("buffer size must match format", 147)
+TRANSLATION("buffer too small", 148)
+TRANSLATION("bytecode overflow", 149)
+TRANSLATION("bytes length not a multiple of item size", 150)
+TRANSLATION("bytes value out of range", 151)
+TRANSLATION("can only have one parent", 152)
+TRANSLATION("can't add special method to already-subclassed class", 153)
+TRANSLATION("can't assign to expression", 154)
+TRANSLATION("can't cancel self", 155)
+TRANSLATION("can't convert %q to %q", 156)
+TRANSLATION("can't convert %s to complex", 157)
+TRANSLATION("can't convert %s to float", 158)
+TRANSLATION("can't convert %s to int", 159)
+TRANSLATION("can't convert '%q' object to %q implicitly", 160)
+TRANSLATION("can't create '%q' instances", 161)
+TRANSLATION("can't declare nonlocal in outer code", 162)
+TRANSLATION("can't delete expression", 163)
+TRANSLATION("can't do binary op between '%q' and '%q'", 164)
+TRANSLATION("can't do unary op of '%q'", 165)
+TRANSLATION("can't implicitly convert '%q' to 'bool'", 166)
+TRANSLATION("can't import name %q", 167)
+TRANSLATION("can't load from '%q'", 168)
+TRANSLATION("can't load with '%q' index", 169)
+TRANSLATION("can't perform relative import", 170)
+TRANSLATION("can't send non-None value to a just-started generator", 171)
+TRANSLATION("can't set attribute", 172)
+TRANSLATION("can't set attribute '%q'", 173)
+TRANSLATION("can't store '%q'", 174)
+TRANSLATION("can't store to '%q'", 175)
+TRANSLATION("can't store with '%q' index", 176)
+TRANSLATION("can't switch from automatic field numbering to manual field specification", 177)
+TRANSLATION("can't switch from manual field specification to automatic field numbering", 178)
+TRANSLATION("can't truncate-divide a complex number", 179)
+TRANSLATION("can't wait", 180)
+TRANSLATION("cannot emit native code for this architecture", 181)
+TRANSLATION("casting", 182)
+TRANSLATION("chr() arg not in range(0x110000)", 183)
+TRANSLATION("clip point must be (x,y) tuple", 184)
+TRANSLATION("color buffer must be 3 bytes (RGB) or 4 bytes (RGB + pad byte)", 185)
+TRANSLATION("color buffer must be a buffer, tuple, list, or int", 186)
+TRANSLATION("color buffer must be a bytearray or array of type 'b' or 'B'", 187)
+TRANSLATION("color must be between 0x000000 and 0xffffff", 188)
+TRANSLATION("comparison of int and uint", 189)
+TRANSLATION("complex divide by zero", 190)
+TRANSLATION("compression header", 191)
+TRANSLATION("conversion to object", 192)
+TRANSLATION("default 'except' must be last", 193)
+TRANSLATION("dict update sequence has wrong length", 194)
+TRANSLATION("div/mod not implemented for uint", 195)
+TRANSLATION("divide by zero", 196)
+TRANSLATION("division by zero", 197)
+TRANSLATION("empty", 198)
+TRANSLATION("empty heap", 199)
+TRANSLATION("empty separator", 200)
+TRANSLATION("en_US", 201)
+TRANSLATION("end of format while looking for conversion specifier", 202)
+TRANSLATION("exceptions must derive from BaseException", 203)
+TRANSLATION("expected ':' after format specifier", 204)
+TRANSLATION("expecting a dict for keyword args", 205)
+TRANSLATION("expecting just a value for set", 206)
+TRANSLATION("expecting key:value for dict", 207)
+TRANSLATION("extra keyword arguments given", 208)
+TRANSLATION("extra positional arguments given", 209)
+TRANSLATION("file must be a file opened in byte mode", 210)
+TRANSLATION("first argument to super() must be type", 211)
+TRANSLATION("format needs a dict", 212)
+TRANSLATION("format string didn't convert all arguments", 213)
+TRANSLATION("format string needs more arguments", 214)
+TRANSLATION("full", 215)
+TRANSLATION("function doesn't take keyword arguments", 216)
+TRANSLATION("function expected at most %d arguments, got %d", 217)
+TRANSLATION("function got multiple values for argument '%q'", 218)
+TRANSLATION("function missing %d required positional arguments", 219)
+TRANSLATION("function missing keyword-only argument", 220)
+TRANSLATION("function missing required keyword argument '%q'", 221)
+TRANSLATION("function missing required positional argument #%d", 222)
+TRANSLATION("function takes %d positional arguments but %d were given", 223)
+TRANSLATION("generator already executing", 224)
+TRANSLATION("generator ignored GeneratorExit", 225)
+TRANSLATION("generator raised StopIteration", 226)
+TRANSLATION("heap must be a list", 227)
+TRANSLATION("identifier redefined as global", 228)
+TRANSLATION("identifier redefined as nonlocal", 229)
+TRANSLATION("import * not at module level", 230)
+TRANSLATION("incompatible .mpy arch", 231)
+TRANSLATION("incompatible .mpy file", 232)
+TRANSLATION("incomplete format", 233)
+TRANSLATION("incomplete format key", 234)
+TRANSLATION("incorrect padding", 235)
+TRANSLATION("index out of range", 236)
+TRANSLATION("invalid bits_per_pixel %d, must be, 1, 2, 4, 8, 16, 24, or 32", 237)
+TRANSLATION("invalid element size %d for bits_per_pixel %d\n", 238)
+TRANSLATION("invalid element_size %d, must be, 1, 2, or 4", 239)
+TRANSLATION("invalid exception", 240)
+TRANSLATION("invalid format specifier", 241)
+TRANSLATION("invalid micropython decorator", 242)
+TRANSLATION("invalid mktime usage", 243)
+TRANSLATION("invalid syntax", 244)
+TRANSLATION("invalid syntax for number", 245)
+TRANSLATION("issubclass() arg 1 must be a class", 246)
+TRANSLATION("issubclass() arg 2 must be a class or a tuple of classes", 247)
+TRANSLATION("join expects a list of str/bytes objects consistent with self object", 248)
+TRANSLATION("keyword argument(s) not implemented - use normal args instead", 249)
+TRANSLATION("lhs and rhs should be compatible", 250)
+TRANSLATION("local '%q' has type '%q' but source is '%q'", 251)
+TRANSLATION("local '%q' used before type known", 252)
+TRANSLATION("local variable referenced before assignment", 253)
+TRANSLATION("malformed f-string", 254)
+TRANSLATION("math domain error", 255)
+TRANSLATION("maximum recursion depth exceeded", 256)
+TRANSLATION("memory allocation failed, allocating %u bytes", 257)
+TRANSLATION("memory allocation failed, heap is locked", 258)
+TRANSLATION("memoryview offset too large", 259)
+TRANSLATION("memoryview: length is not a multiple of itemsize", 260)
+TRANSLATION("mktime needs a tuple of length 8 or 9", 261)
+TRANSLATION("module '%q' has no attribute '%q'", 262)
+TRANSLATION("multiple *x in assignment", 263)
+TRANSLATION("multiple bases have instance lay-out conflict", 264)
+TRANSLATION("must raise an object", 265)
+TRANSLATION("must use keyword argument for key function", 266)
+TRANSLATION("name '%q' isn't defined", 267)
+TRANSLATION("name too long", 268)
+TRANSLATION("native code in .mpy unsupported", 269)
+TRANSLATION("native yield", 270)
+TRANSLATION("need more than %d values to unpack", 271)
+TRANSLATION("negative factorial", 272)
+TRANSLATION("negative shift count", 273)
+TRANSLATION("no active exception to reraise", 274)
+TRANSLATION("no binding for nonlocal found", 275)
+TRANSLATION("no module named '%q'", 276)
+TRANSLATION("no such attribute", 277)
+TRANSLATION("non-default argument follows default argument", 278)
+TRANSLATION("non-hex digit", 279)
+TRANSLATION("not a constant", 280)
+TRANSLATION("object ", 281)
+TRANSLATION("object '%s' isn't a tuple or list", 282)
+TRANSLATION("object not in sequence", 283)
+TRANSLATION("object of type '%s' has no len()", 284)
+TRANSLATION("object with buffer protocol required", 285)
+TRANSLATION("only slices with step=1 (aka None) are supported", 286)
+TRANSLATION("opcode", 287)
+TRANSLATION("ord() expected a character, but string of length %d found", 288)
+TRANSLATION("out of range of target", 289)
+TRANSLATION("overflow converting long int to machine word", 290)
+TRANSLATION("pop from empty %q", 291)
+TRANSLATION("positional arg after **", 292)
+TRANSLATION("positional arg after keyword arg", 293)
+TRANSLATION("pow() 3rd argument cannot be 0", 294)
+TRANSLATION("pow() with 3 arguments requires integers", 295)
+TRANSLATION("regex too complex", 296)
+TRANSLATION("requested length %d but object has length %d", 297)
+TRANSLATION("return expected '%q' but got '%q'", 298)
+TRANSLATION("rsplit(None,n)", 299)
+TRANSLATION("samples_signed must be true", 300)
+TRANSLATION("schedule queue full", 301)
+TRANSLATION("sign not allowed in string format specifier", 302)
+TRANSLATION("sign not allowed with integer format specifier 'c'", 303)
+TRANSLATION("small int overflow", 304)
+TRANSLATION("source palette too large", 305)
+TRANSLATION("source_bitmap must have value_count of 2 or 65536", 306)
+TRANSLATION("source_bitmap must have value_count of 65536", 307)
+TRANSLATION("source_bitmap must have value_count of 8", 308)
+TRANSLATION("splitting with sub-captures", 309)
+TRANSLATION("stream operation not supported", 310)
+TRANSLATION("string argument without an encoding", 311)
+TRANSLATION("string index out of range", 312)
+TRANSLATION("string indices must be integers, not %s", 313)
+TRANSLATION("substring not found", 314)
+TRANSLATION("super() can't find self", 315)
+TRANSLATION("syntax error in JSON", 316)
+TRANSLATION("ticks interval overflow", 317)
+TRANSLATION("too many args", 318)
+TRANSLATION("too many values to unpack (expected %d)", 319)
+TRANSLATION("type '%q' isn't an acceptable base type", 320)
+TRANSLATION("type object '%q' has no attribute '%q'", 321)
+TRANSLATION("type takes 1 or 3 arguments", 322)
+TRANSLATION("unexpected indent", 323)
+TRANSLATION("unexpected keyword argument '%q'", 324)
+TRANSLATION("unicode name escapes", 325)
+TRANSLATION("unindent doesn't match any outer indent level", 326)
+TRANSLATION("unknown conversion specifier %c", 327)
+TRANSLATION("unknown format code '%c' for object of type '%q'", 328)
+TRANSLATION("unknown type '%q'", 329)
+TRANSLATION("unmatched '%c' in format", 330)
+TRANSLATION("unreadable attribute", 331)
+TRANSLATION("unsupported %q type", 332)
+TRANSLATION("unsupported bitmap depth", 333)
+TRANSLATION("unsupported colorspace for dither", 334)
+TRANSLATION("unsupported format character '%c' (0x%x) at index %d", 335)
+TRANSLATION("unsupported type for %q: '%s'", 336)
+TRANSLATION("unsupported types for %q: '%q', '%q'", 337)
+TRANSLATION("value must fit in %d byte(s)", 338)
+TRANSLATION("value out of range of target", 339)
+TRANSLATION("weights must be a sequence with an odd square number of elements (usually 9 or 25)", 340)
+TRANSLATION("weights must be an object of type %q, %q, %q, or %q, not %q ", 341)
+TRANSLATION("wrong number of arguments", 342)
+
+// 6895 bytes worth of qstr
@@ -0,0 +1,239 @@
+// Automatically generated by makemoduledefs.py.
+
+extern const struct _mp_obj_module_t mp_module_array;
+#undef MODULE_DEF_ARRAY
+#define MODULE_DEF_ARRAY { MP_ROM_QSTR(MP_QSTR_array), MP_ROM_PTR(&mp_module_array) },
+
+extern const struct _mp_obj_module_t mp_module_binascii;
+#undef MODULE_DEF_BINASCII
+#define MODULE_DEF_BINASCII { MP_ROM_QSTR(MP_QSTR_binascii), MP_ROM_PTR(&mp_module_binascii) },
+
+extern const struct _mp_obj_module_t mp_module_collections;
+#undef MODULE_DEF_COLLECTIONS
+#define MODULE_DEF_COLLECTIONS { MP_ROM_QSTR(MP_QSTR_collections), MP_ROM_PTR(&mp_module_collections) },
+
+extern const struct _mp_obj_module_t mp_module_errno;
+#undef MODULE_DEF_ERRNO
+#define MODULE_DEF_ERRNO { MP_ROM_QSTR(MP_QSTR_errno), MP_ROM_PTR(&mp_module_errno) },
+
+extern const struct _mp_obj_module_t mp_module_hashlib;
+#undef MODULE_DEF_HASHLIB
+#define MODULE_DEF_HASHLIB { MP_ROM_QSTR(MP_QSTR_hashlib), MP_ROM_PTR(&mp_module_hashlib) },
+
+extern const struct _mp_obj_module_t mp_module_heapq;
+#undef MODULE_DEF_HEAPQ
+#define MODULE_DEF_HEAPQ { MP_ROM_QSTR(MP_QSTR_heapq), MP_ROM_PTR(&mp_module_heapq) },
+
+extern const struct _mp_obj_module_t mp_module_io;
+#undef MODULE_DEF_IO
+#define MODULE_DEF_IO { MP_ROM_QSTR(MP_QSTR_io), MP_ROM_PTR(&mp_module_io) },
+
+extern const struct _mp_obj_module_t mp_module_json;
+#undef MODULE_DEF_JSON
+#define MODULE_DEF_JSON { MP_ROM_QSTR(MP_QSTR_json), MP_ROM_PTR(&mp_module_json) },
+
+extern const struct _mp_obj_module_t mp_module_os;
+#undef MODULE_DEF_OS
+#define MODULE_DEF_OS { MP_ROM_QSTR(MP_QSTR_os), MP_ROM_PTR(&mp_module_os) },
+
+extern const struct _mp_obj_module_t mp_module_platform;
+#undef MODULE_DEF_PLATFORM
+#define MODULE_DEF_PLATFORM { MP_ROM_QSTR(MP_QSTR_platform), MP_ROM_PTR(&mp_module_platform) },
+
+extern const struct _mp_obj_module_t mp_module_random;
+#undef MODULE_DEF_RANDOM
+#define MODULE_DEF_RANDOM { MP_ROM_QSTR(MP_QSTR_random), MP_ROM_PTR(&mp_module_random) },
+
+extern const struct _mp_obj_module_t mp_module_re;
+#undef MODULE_DEF_RE
+#define MODULE_DEF_RE { MP_ROM_QSTR(MP_QSTR_re), MP_ROM_PTR(&mp_module_re) },
+
+extern const struct _mp_obj_module_t mp_module_select;
+#undef MODULE_DEF_SELECT
+#define MODULE_DEF_SELECT { MP_ROM_QSTR(MP_QSTR_select), MP_ROM_PTR(&mp_module_select) },
+
+extern const struct _mp_obj_module_t mp_module_time;
+#undef MODULE_DEF_TIME
+#define MODULE_DEF_TIME { MP_ROM_QSTR(MP_QSTR_time), MP_ROM_PTR(&mp_module_time) },
+
+extern const struct _mp_obj_module_t future_module;
+#undef MODULE_DEF___FUTURE__
+#define MODULE_DEF___FUTURE__ { MP_ROM_QSTR(MP_QSTR___future__), MP_ROM_PTR(&future_module) },
+
+extern const struct _mp_obj_module_t mp_module___main__;
+#undef MODULE_DEF___MAIN__
+#define MODULE_DEF___MAIN__ { MP_ROM_QSTR(MP_QSTR___main__), MP_ROM_PTR(&mp_module___main__) },
+
+extern const struct _mp_obj_module_t mp_module_asyncio;
+#undef MODULE_DEF__ASYNCIO
+#define MODULE_DEF__ASYNCIO { MP_ROM_QSTR(MP_QSTR__asyncio), MP_ROM_PTR(&mp_module_asyncio) },
+
+extern const struct _mp_obj_module_t mp_module_thread;
+#undef MODULE_DEF__THREAD
+#define MODULE_DEF__THREAD { MP_ROM_QSTR(MP_QSTR__thread), MP_ROM_PTR(&mp_module_thread) },
+
+extern const struct _mp_obj_module_t aesio_module;
+#undef MODULE_DEF_AESIO
+#define MODULE_DEF_AESIO { MP_ROM_QSTR(MP_QSTR_aesio), MP_ROM_PTR(&aesio_module) },
+
+extern const struct _mp_obj_module_t audiocore_module;
+#undef MODULE_DEF_AUDIOCORE
+#define MODULE_DEF_AUDIOCORE { MP_ROM_QSTR(MP_QSTR_audiocore), MP_ROM_PTR(&audiocore_module) },
+
+extern const struct _mp_obj_module_t audiodelays_module;
+#undef MODULE_DEF_AUDIODELAYS
+#define MODULE_DEF_AUDIODELAYS { MP_ROM_QSTR(MP_QSTR_audiodelays), MP_ROM_PTR(&audiodelays_module) },
+
+extern const struct _mp_obj_module_t audiofilters_module;
+#undef MODULE_DEF_AUDIOFILTERS
+#define MODULE_DEF_AUDIOFILTERS { MP_ROM_QSTR(MP_QSTR_audiofilters), MP_ROM_PTR(&audiofilters_module) },
+
+extern const struct _mp_obj_module_t audiofreeverb_module;
+#undef MODULE_DEF_AUDIOFREEVERB
+#define MODULE_DEF_AUDIOFREEVERB { MP_ROM_QSTR(MP_QSTR_audiofreeverb), MP_ROM_PTR(&audiofreeverb_module) },
+
+extern const struct _mp_obj_module_t audiomixer_module;
+#undef MODULE_DEF_AUDIOMIXER
+#define MODULE_DEF_AUDIOMIXER { MP_ROM_QSTR(MP_QSTR_audiomixer), MP_ROM_PTR(&audiomixer_module) },
+
+extern const struct _mp_obj_module_t bitmapfilter_module;
+#undef MODULE_DEF_BITMAPFILTER
+#define MODULE_DEF_BITMAPFILTER { MP_ROM_QSTR(MP_QSTR_bitmapfilter), MP_ROM_PTR(&bitmapfilter_module) },
+
+extern const struct _mp_obj_module_t bitmaptools_module;
+#undef MODULE_DEF_BITMAPTOOLS
+#define MODULE_DEF_BITMAPTOOLS { MP_ROM_QSTR(MP_QSTR_bitmaptools), MP_ROM_PTR(&bitmaptools_module) },
+
+extern const struct _mp_obj_module_t mp_module_builtins;
+#undef MODULE_DEF_BUILTINS
+#define MODULE_DEF_BUILTINS { MP_ROM_QSTR(MP_QSTR_builtins), MP_ROM_PTR(&mp_module_builtins) },
+
+extern const struct _mp_obj_module_t mp_module_cmath;
+#undef MODULE_DEF_CMATH
+#define MODULE_DEF_CMATH { MP_ROM_QSTR(MP_QSTR_cmath), MP_ROM_PTR(&mp_module_cmath) },
+
+extern const struct _mp_obj_module_t codeop_module;
+#undef MODULE_DEF_CODEOP
+#define MODULE_DEF_CODEOP { MP_ROM_QSTR(MP_QSTR_codeop), MP_ROM_PTR(&codeop_module) },
+
+extern const struct _mp_obj_module_t displayio_module;
+#undef MODULE_DEF_DISPLAYIO
+#define MODULE_DEF_DISPLAYIO { MP_ROM_QSTR(MP_QSTR_displayio), MP_ROM_PTR(&displayio_module) },
+
+extern const struct _mp_obj_module_t framebufferio_module;
+#undef MODULE_DEF_FRAMEBUFFERIO
+#define MODULE_DEF_FRAMEBUFFERIO { MP_ROM_QSTR(MP_QSTR_framebufferio), MP_ROM_PTR(&framebufferio_module) },
+
+extern const struct _mp_obj_module_t mp_module_gc;
+#undef MODULE_DEF_GC
+#define MODULE_DEF_GC { MP_ROM_QSTR(MP_QSTR_gc), MP_ROM_PTR(&mp_module_gc) },
+
+extern const struct _mp_obj_module_t jpegio_module;
+#undef MODULE_DEF_JPEGIO
+#define MODULE_DEF_JPEGIO { MP_ROM_QSTR(MP_QSTR_jpegio), MP_ROM_PTR(&jpegio_module) },
+
+extern const struct _mp_obj_module_t locale_module;
+#undef MODULE_DEF_LOCALE
+#define MODULE_DEF_LOCALE { MP_ROM_QSTR(MP_QSTR_locale), MP_ROM_PTR(&locale_module) },
+
+extern const struct _mp_obj_module_t mp_module_math;
+#undef MODULE_DEF_MATH
+#define MODULE_DEF_MATH { MP_ROM_QSTR(MP_QSTR_math), MP_ROM_PTR(&mp_module_math) },
+
+extern const struct _mp_obj_module_t mp_module_micropython;
+#undef MODULE_DEF_MICROPYTHON
+#define MODULE_DEF_MICROPYTHON { MP_ROM_QSTR(MP_QSTR_micropython), MP_ROM_PTR(&mp_module_micropython) },
+
+extern const struct _mp_obj_module_t offscreen_module;
+#undef MODULE_DEF_OFFSCREEN
+#define MODULE_DEF_OFFSCREEN { MP_ROM_QSTR(MP_QSTR_offscreen), MP_ROM_PTR(&offscreen_module) },
+
+extern const struct _mp_obj_module_t rainbowio_module;
+#undef MODULE_DEF_RAINBOWIO
+#define MODULE_DEF_RAINBOWIO { MP_ROM_QSTR(MP_QSTR_rainbowio), MP_ROM_PTR(&rainbowio_module) },
+
+extern const struct _mp_obj_module_t struct_module;
+#undef MODULE_DEF_STRUCT
+#define MODULE_DEF_STRUCT { MP_ROM_QSTR(MP_QSTR_struct), MP_ROM_PTR(&struct_module) },
+
+extern const struct _mp_obj_module_t synthio_module;
+#undef MODULE_DEF_SYNTHIO
+#define MODULE_DEF_SYNTHIO { MP_ROM_QSTR(MP_QSTR_synthio), MP_ROM_PTR(&synthio_module) },
+
+extern const struct _mp_obj_module_t mp_module_sys;
+#undef MODULE_DEF_SYS
+#define MODULE_DEF_SYS { MP_ROM_QSTR(MP_QSTR_sys), MP_ROM_PTR(&mp_module_sys) },
+
+extern const struct _mp_obj_module_t traceback_module;
+#undef MODULE_DEF_TRACEBACK
+#define MODULE_DEF_TRACEBACK { MP_ROM_QSTR(MP_QSTR_traceback), MP_ROM_PTR(&traceback_module) },
+
+extern const struct _mp_obj_module_t vectorio_module;
+#undef MODULE_DEF_VECTORIO
+#define MODULE_DEF_VECTORIO { MP_ROM_QSTR(MP_QSTR_vectorio), MP_ROM_PTR(&vectorio_module) },
+
+extern const struct _mp_obj_module_t mp_module_uzlib;
+#undef MODULE_DEF_ZLIB
+#define MODULE_DEF_ZLIB { MP_ROM_QSTR(MP_QSTR_zlib), MP_ROM_PTR(&mp_module_uzlib) },
+
+extern const struct _mp_obj_module_t zlib_module;
+#undef MODULE_DEF_ZLIB
+#define MODULE_DEF_ZLIB { MP_ROM_QSTR(MP_QSTR_zlib), MP_ROM_PTR(&zlib_module) },
+
+
+#define MICROPY_REGISTERED_MODULES \
+    MODULE_DEF_AESIO \
+    MODULE_DEF_AUDIOCORE \
+    MODULE_DEF_AUDIODELAYS \
+    MODULE_DEF_AUDIOFILTERS \
+    MODULE_DEF_AUDIOFREEVERB \
+    MODULE_DEF_AUDIOMIXER \
+    MODULE_DEF_BITMAPFILTER \
+    MODULE_DEF_BITMAPTOOLS \
+    MODULE_DEF_BUILTINS \
+    MODULE_DEF_CMATH \
+    MODULE_DEF_CODEOP \
+    MODULE_DEF_DISPLAYIO \
+    MODULE_DEF_FRAMEBUFFERIO \
+    MODULE_DEF_GC \
+    MODULE_DEF_JPEGIO \
+    MODULE_DEF_LOCALE \
+    MODULE_DEF_MATH \
+    MODULE_DEF_MICROPYTHON \
+    MODULE_DEF_OFFSCREEN \
+    MODULE_DEF_RAINBOWIO \
+    MODULE_DEF_STRUCT \
+    MODULE_DEF_SYNTHIO \
+    MODULE_DEF_SYS \
+    MODULE_DEF_TRACEBACK \
+    MODULE_DEF_VECTORIO \
+    MODULE_DEF_ZLIB \
+    MODULE_DEF__ASYNCIO \
+    MODULE_DEF__THREAD \
+    MODULE_DEF___FUTURE__ \
+    MODULE_DEF___MAIN__ \
+// MICROPY_REGISTERED_MODULES
+
+#define MICROPY_HAVE_REGISTERED_EXTENSIBLE_MODULES  14
+
+#define MICROPY_REGISTERED_EXTENSIBLE_MODULES \
+    MODULE_DEF_ARRAY \
+    MODULE_DEF_BINASCII \
+    MODULE_DEF_COLLECTIONS \
+    MODULE_DEF_ERRNO \
+    MODULE_DEF_HASHLIB \
+    MODULE_DEF_HEAPQ \
+    MODULE_DEF_IO \
+    MODULE_DEF_JSON \
+    MODULE_DEF_OS \
+    MODULE_DEF_PLATFORM \
+    MODULE_DEF_RANDOM \
+    MODULE_DEF_RE \
+    MODULE_DEF_SELECT \
+    MODULE_DEF_TIME \
+// MICROPY_REGISTERED_EXTENSIBLE_MODULES
+
+extern void mp_module_sys_attr(mp_obj_t self_in, qstr attr, mp_obj_t *dest);
+#define MICROPY_MODULE_DELEGATIONS \
+    { MP_ROM_PTR(&mp_module_sys), mp_module_sys_attr }, \
+// MICROPY_MODULE_DELEGATIONS
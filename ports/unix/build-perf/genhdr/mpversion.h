@@ -0,0 +1,12 @@
+// This file was generated by py/makeversionhdr.py
+#define MICROPY_GIT_TAG "9.9.9-24-g4ff9556-dirty"
+#define MICROPY_GIT_HASH "4ff9556-dirty"
+#define MICROPY_BUILD_DATE "2026-10-16"
+#define MICROPY_VERSION_MAJOR (9)
+#define MICROPY_VERSION_MINOR (9)
+#define MICROPY_VERSION_MICRO (9)
+#define MICROPY_VERSION_PRERELEASE 0
+#define MICROPY_VERSION_STRING "9.9.9"
+// Combined version as a 32-bit number for convenience
+#define MICROPY_VERSION (MICROPY_VERSION_MAJOR << 16 | MICROPY_VERSION_MINOR << 8 | MICROPY_VERSION_MICRO)
+#define MICROPY_FULL_VERSION_INFO "Adafruit CircuitPython " MICROPY_GIT_TAG " on " MICROPY_BUILD_DATE "; " MICROPY_BANNER_MACHINE
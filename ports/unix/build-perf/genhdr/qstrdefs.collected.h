@@ -0,0 +1,6153 @@
+Q( )
+
+Q(%#o)
+
+Q(%#x)
+
+Q(*)
+
+Q(*)
+
+Q(*)
+
+Q(/)
+
+Q(/)
+
+Q(/)
+
+Q(/)
+
+Q(/)
+
+Q(/)
+
+Q(/)
+
+Q(/)
+
+Q(/)
+
+Q(<dictcomp>)
+
+Q(<dictcomp>)
+
+Q(<dictcomp>)
+
+Q(<genexpr>)
+
+Q(<genexpr>)
+
+Q(<genexpr>)
+
+Q(<input>)
+
+Q(<lambda>)
+
+Q(<lambda>)
+
+Q(<lambda>)
+
+Q(<listcomp>)
+
+Q(<listcomp>)
+
+Q(<listcomp>)
+
+Q(<module>)
+
+Q(<module>)
+
+Q(<module>)
+
+Q(<setcomp>)
+
+Q(<setcomp>)
+
+Q(<setcomp>)
+
+Q(<stdin>)
+
+Q(<stdin>)
+
+Q(<stdin>)
+
+Q(<stdin>)
+
+Q(<string>)
+
+Q(A)
+
+Q(A)
+
+Q(A)
+
+Q(ABS)
+
+Q(ABS)
+
+Q(ADD_DIV)
+
+Q(ADD_DIV)
+
+Q(ADD_SUB)
+
+Q(ADD_SUB)
+
+Q(AES)
+
+Q(AES)
+
+Q(AES)
+
+Q(ATTACK)
+
+Q(ATTACK)
+
+Q(ArithmeticError)
+
+Q(ArithmeticError)
+
+Q(AssertionError)
+
+Q(AssertionError)
+
+Q(AssertionError)
+
+Q(Atkinson)
+
+Q(Atkinson)
+
+Q(AttributeError)
+
+Q(AttributeError)
+
+Q(BAND_PASS)
+
+Q(BAND_PASS)
+
+Q(BGR555)
+
+Q(BGR555)
+
+Q(BGR555_SWAPPED)
+
+Q(BGR555_SWAPPED)
+
+Q(BGR565)
+
+Q(BGR565)
+
+Q(BGR565_SWAPPED)
+
+Q(BGR565_SWAPPED)
+
+Q(BaseException)
+
+Q(BaseException)
+
+Q(BaseException)
+
+Q(BaseException)
+
+Q(BaseException)
+
+Q(Biquad)
+
+Q(Biquad)
+
+Q(Biquad)
+
+Q(Biquad)
+
+Q(Biquad)
+
+Q(Bitmap)
+
+Q(Bitmap)
+
+Q(BlendMode)
+
+Q(BlendMode)
+
+Q(BlockInput)
+
+Q(BrokenPipeError)
+
+Q(BrokenPipeError)
+
+Q(BufferedWriter)
+
+Q(BufferedWriter)
+
+Q(BytesIO)
+
+Q(BytesIO)
+
+Q(BytesIO)
+
+Q(CLIP)
+
+Q(CLIP)
+
+Q(CONSTRAINED_LERP)
+
+Q(CONSTRAINED_LERP)
+
+Q(CancelledError)
+
+Q(ChannelMixer)
+
+Q(ChannelMixer)
+
+Q(ChannelMixer)
+
+Q(ChannelMixerOffset)
+
+Q(ChannelMixerOffset)
+
+Q(ChannelMixerOffset)
+
+Q(ChannelScale)
+
+Q(ChannelScale)
+
+Q(ChannelScaleOffset)
+
+Q(ChannelScaleOffset)
+
+Q(Chorus)
+
+Q(Chorus)
+
+Q(Circle)
+
+Q(Circle)
+
+Q(ColorConverter)
+
+Q(ColorConverter)
+
+Q(ColorSpace)
+
+Q(Colorspace)
+
+Q(ConnectionError)
+
+Q(ConnectionError)
+
+Q(DEBUG)
+
+Q(DECAY)
+
+Q(DECAY)
+
+Q(DIV_ADD)
+
+Q(DIV_ADD)
+
+Q(DecompIO)
+
+Q(DecompIO)
+
+Q(Distortion)
+
+Q(Distortion)
+
+Q(DistortionMode)
+
+Q(DistortionMode)
+
+Q(DitherAlgorithm)
+
+Q(DitherAlgorithm)
+
+Q(EACCES)
+
+Q(EACCES)
+
+Q(EADDRINUSE)
+
+Q(EADDRINUSE)
+
+Q(EAGAIN)
+
+Q(EAGAIN)
+
+Q(EALREADY)
+
+Q(EALREADY)
+
+Q(EBADF)
+
+Q(EBADF)
+
+Q(ECONNABORTED)
+
+Q(ECONNABORTED)
+
+Q(ECONNREFUSED)
+
+Q(ECONNREFUSED)
+
+Q(ECONNRESET)
+
+Q(ECONNRESET)
+
+Q(EEXIST)
+
+Q(EEXIST)
+
+Q(EHOSTUNREACH)
+
+Q(EHOSTUNREACH)
+
+Q(EINPROGRESS)
+
+Q(EINPROGRESS)
+
+Q(EINVAL)
+
+Q(EINVAL)
+
+Q(EIO)
+
+Q(EIO)
+
+Q(EISDIR)
+
+Q(EISDIR)
+
+Q(ENOBUFS)
+
+Q(ENOBUFS)
+
+Q(ENODEV)
+
+Q(ENODEV)
+
+Q(ENOENT)
+
+Q(ENOENT)
+
+Q(ENOMEM)
+
+Q(ENOMEM)
+
+Q(ENOSPC)
+
+Q(ENOSPC)
+
+Q(ENOTCONN)
+
+Q(ENOTCONN)
+
+Q(EOFError)
+
+Q(EOFError)
+
+Q(EOPNOTSUPP)
+
+Q(EOPNOTSUPP)
+
+Q(EPERM)
+
+Q(EPERM)
+
+Q(EROFS)
+
+Q(EROFS)
+
+Q(ETIMEDOUT)
+
+Q(ETIMEDOUT)
+
+Q(Echo)
+
+Q(Echo)
+
+Q(Ellipsis)
+
+Q(Ellipsis)
+
+Q(Envelope)
+
+Q(Envelope)
+
+Q(EnvelopeState)
+
+Q(EnvelopeState)
+
+Q(Exception)
+
+Q(Exception)
+
+Q(FileIO)
+
+Q(FileIO)
+
+Q(Filter)
+
+Q(Filter)
+
+Q(FilterMode)
+
+Q(FilterMode)
+
+Q(Flanger)
+
+Q(Flanger)
+
+Q(FloydStenberg)
+
+Q(FloydStenberg)
+
+Q(Framebuffer)
+
+Q(Framebuffer)
+
+Q(FramebufferDisplay)
+
+Q(FramebufferDisplay)
+
+Q(Freeverb)
+
+Q(GeneratorExit)
+
+Q(GeneratorExit)
+
+Q(GranularPitchShift)
+
+Q(GranularPitchShift)
+
+Q(Group)
+
+Q(Group)
+
+Q(Group)
+
+Q(HIGH_PASS)
+
+Q(HIGH_PASS)
+
+Q(HIGH_SHELF)
+
+Q(HIGH_SHELF)
+
+Q(IOBase)
+
+Q(IOBase)
+
+Q(IV)
+
+Q(IV)
+
+Q(IV)
+
+Q(IV)
+
+Q(ImportError)
+
+Q(ImportError)
+
+Q(IndentationError)
+
+Q(IndentationError)
+
+Q(IndexError)
+
+Q(IndexError)
+
+Q(JpegDecoder)
+
+Q(JpegDecoder)
+
+Q(KeyError)
+
+Q(KeyError)
+
+Q(KeyboardInterrupt)
+
+Q(KeyboardInterrupt)
+
+Q(L8)
+
+Q(L8)
+
+Q(LERP)
+
+Q(LERP)
+
+Q(LFO)
+
+Q(LFO)
+
+Q(LOFI)
+
+Q(LOFI)
+
+Q(LOW_PASS)
+
+Q(LOW_PASS)
+
+Q(LOW_SHELF)
+
+Q(LOW_SHELF)
+
+Q(LockType)
+
+Q(LookupError)
+
+Q(LookupError)
+
+Q(MAX)
+
+Q(MAX)
+
+Q(MID)
+
+Q(MID)
+
+Q(MIN)
+
+Q(MIN)
+
+Q(MODE_CBC)
+
+Q(MODE_CTR)
+
+Q(MODE_ECB)
+
+Q(MUL_DIV)
+
+Q(MUL_DIV)
+
+Q(Math)
+
+Q(Math)
+
+Q(MathOperation)
+
+Q(MathOperation)
+
+Q(MemoryError)
+
+Q(MemoryError)
+
+Q(MidiTrack)
+
+Q(MidiTrack)
+
+Q(Mixer)
+
+Q(Mixer)
+
+Q(MixerVoice)
+
+Q(MultiTapDelay)
+
+Q(MultiTapDelay)
+
+Q(NONE)
+
+Q(NONE)
+
+Q(NOTCH)
+
+Q(NOTCH)
+
+Q(NameError)
+
+Q(NameError)
+
+Q(NativeBaseClass)
+
+Q(NativeBaseClass)
+
+Q(None)
+
+Q(None)
+
+Q(None)
+
+Q(None)
+
+Q(None)
+
+Q(NoneType)
+
+Q(NoneType)
+
+Q(Normal)
+
+Q(Normal)
+
+Q(NotImplemented)
+
+Q(NotImplemented)
+
+Q(NotImplementedError)
+
+Q(NotImplementedError)
+
+Q(Note)
+
+Q(Note)
+
+Q(Note)
+
+Q(OFFSET_SCALE)
+
+Q(OFFSET_SCALE)
+
+Q(OLDEST)
+
+Q(OLDEST)
+
+Q(OSError)
+
+Q(OSError)
+
+Q(OVERDRIVE)
+
+Q(OVERDRIVE)
+
+Q(OnDiskBitmap)
+
+Q(OnDiskBitmap)
+
+Q(OrderedDict)
+
+Q(OrderedDict)
+
+Q(OrderedDict)
+
+Q(OverflowError)
+
+Q(OverflowError)
+
+Q(PEAKING_EQ)
+
+Q(PEAKING_EQ)
+
+Q(POLLERR)
+
+Q(POLLHUP)
+
+Q(POLLIN)
+
+Q(POLLOUT)
+
+Q(PRODUCT)
+
+Q(PRODUCT)
+
+Q(Palette)
+
+Q(Palette)
+
+Q(Phaser)
+
+Q(Phaser)
+
+Q(PitchShift)
+
+Q(PitchShift)
+
+Q(Polygon)
+
+Q(Polygon)
+
+Q(Q)
+
+Q(Q)
+
+Q(Q)
+
+Q(QUIETEST)
+
+Q(QUIETEST)
+
+Q(RELEASE)
+
+Q(RELEASE)
+
+Q(RGB555)
+
+Q(RGB555)
+
+Q(RGB555_SWAPPED)
+
+Q(RGB555_SWAPPED)
+
+Q(RGB565)
+
+Q(RGB565)
+
+Q(RGB565_SWAPPED)
+
+Q(RGB565_SWAPPED)
+
+Q(RGB888)
+
+Q(RGB888)
+
+Q(RawSample)
+
+Q(RawSample)
+
+Q(ReadableBuffer)
+
+Q(ReadableBuffer)
+
+Q(Rectangle)
+
+Q(Rectangle)
+
+Q(ReloadException)
+
+Q(ReloadException)
+
+Q(RuntimeError)
+
+Q(RuntimeError)
+
+Q(SCALE_OFFSET)
+
+Q(SCALE_OFFSET)
+
+Q(SUM)
+
+Q(SUM)
+
+Q(SUSTAIN)
+
+Q(SUSTAIN)
+
+Q(ScaleMixer)
+
+Q(ScaleMixerOffset)
+
+Q(Screen)
+
+Q(Screen)
+
+Q(Sequence)
+
+Q(StopAsyncIteration)
+
+Q(StopAsyncIteration)
+
+Q(StopAsyncIteration)
+
+Q(StopIteration)
+
+Q(StopIteration)
+
+Q(StringIO)
+
+Q(StringIO)
+
+Q(SyntaxError)
+
+Q(SyntaxError)
+
+Q(Synthesizer)
+
+Q(Synthesizer)
+
+Q(SystemExit)
+
+Q(SystemExit)
+
+Q(Task)
+
+Q(Task)
+
+Q(TaskQueue)
+
+Q(TaskQueue)
+
+Q(TextIOWrapper)
+
+Q(TextIOWrapper)
+
+Q(TileGrid)
+
+Q(TileGrid)
+
+Q(TimeoutError)
+
+Q(TimeoutError)
+
+Q(True)
+
+Q(True)
+
+Q(True)
+
+Q(True)
+
+Q(TypeError)
+
+Q(TypeError)
+
+Q(UnicodeError)
+
+Q(UnicodeError)
+
+Q(ValueError)
+
+Q(ValueError)
+
+Q(VectorShape)
+
+Q(VfsFat)
+
+Q(VfsFat)
+
+Q(VfsPosix)
+
+Q(VfsPosix)
+
+Q(ViperTypeError)
+
+Q(ViperTypeError)
+
+Q(VoiceStealing)
+
+Q(VoiceStealing)
+
+Q(WAVESHAPE)
+
+Q(WAVESHAPE)
+
+Q(WaveFile)
+
+Q(WaveFile)
+
+Q(WritableBuffer)
+
+Q(ZeroDivisionError)
+
+Q(ZeroDivisionError)
+
+Q(_)
+
+Q(_0x0a_)
+
+Q(__abs__)
+
+Q(__add__)
+
+Q(__aenter__)
+
+Q(__aenter__)
+
+Q(__aexit__)
+
+Q(__aexit__)
+
+Q(__aiter__)
+
+Q(__all__)
+
+Q(__and__)
+
+Q(__anext__)
+
+Q(__await__)
+
+Q(__await__)
+
+Q(__await__)
+
+Q(__bases__)
+
+Q(__bool__)
+
+Q(__build_class__)
+
+Q(__build_class__)
+
+Q(__bytes__)
+
+Q(__call__)
+
+Q(__cause__)
+
+Q(__cause__)
+
+Q(__cause__)
+
+Q(__cause__)
+
+Q(__class__)
+
+Q(__class__)
+
+Q(__class__)
+
+Q(__class__)
+
+Q(__class__)
+
+Q(__class__)
+
+Q(__class__)
+
+Q(__code__)
+
+Q(__complex__)
+
+Q(__contains__)
+
+Q(__contains__)
+
+Q(__contains__)
+
+Q(__context__)
+
+Q(__context__)
+
+Q(__context__)
+
+Q(__context__)
+
+Q(__context__)
+
+Q(__context__)
+
+Q(__context__)
+
+Q(__del__)
+
+Q(__del__)
+
+Q(__del__)
+
+Q(__del__)
+
+Q(__delattr__)
+
+Q(__delattr__)
+
+Q(__delattr__)
+
+Q(__delattr__)
+
+Q(__delete__)
+
+Q(__delete__)
+
+Q(__delete__)
+
+Q(__delitem__)
+
+Q(__delitem__)
+
+Q(__dict__)
+
+Q(__dict__)
+
+Q(__dict__)
+
+Q(__dir__)
+
+Q(__divmod__)
+
+Q(__enter__)
+
+Q(__enter__)
+
+Q(__enter__)
+
+Q(__enter__)
+
+Q(__enter__)
+
+Q(__enter__)
+
+Q(__enter__)
+
+Q(__enter__)
+
+Q(__enter__)
+
+Q(__enter__)
+
+Q(__enter__)
+
+Q(__enter__)
+
+Q(__enter__)
+
+Q(__enter__)
+
+Q(__enter__)
+
+Q(__enter__)
+
+Q(__enter__)
+
+Q(__enter__)
+
+Q(__enter__)
+
+Q(__enter__)
+
+Q(__enter__)
+
+Q(__eq__)
+
+Q(__eq__)
+
+Q(__exit__)
+
+Q(__exit__)
+
+Q(__exit__)
+
+Q(__exit__)
+
+Q(__exit__)
+
+Q(__exit__)
+
+Q(__exit__)
+
+Q(__exit__)
+
+Q(__exit__)
+
+Q(__exit__)
+
+Q(__exit__)
+
+Q(__exit__)
+
+Q(__exit__)
+
+Q(__exit__)
+
+Q(__exit__)
+
+Q(__exit__)
+
+Q(__exit__)
+
+Q(__exit__)
+
+Q(__exit__)
+
+Q(__exit__)
+
+Q(__exit__)
+
+Q(__file__)
+
+Q(__file__)
+
+Q(__file__)
+
+Q(__file__)
+
+Q(__file__)
+
+Q(__float__)
+
+Q(__floordiv__)
+
+Q(__future__)
+
+Q(__future__)
+
+Q(__ge__)
+
+Q(__get__)
+
+Q(__get__)
+
+Q(__get__)
+
+Q(__get__)
+
+Q(__getattr__)
+
+Q(__getattr__)
+
+Q(__getattr__)
+
+Q(__getattr__)
+
+Q(__getitem__)
+
+Q(__getitem__)
+
+Q(__getitem__)
+
+Q(__getitem__)
+
+Q(__globals__)
+
+Q(__gt__)
+
+Q(__hash__)
+
+Q(__iadd__)
+
+Q(__iand__)
+
+Q(__ifloordiv__)
+
+Q(__ilshift__)
+
+Q(__imatmul__)
+
+Q(__imod__)
+
+Q(__import__)
+
+Q(__import__)
+
+Q(__imul__)
+
+Q(__init__)
+
+Q(__init__)
+
+Q(__init__)
+
+Q(__init__)
+
+Q(__init__)
+
+Q(__int__)
+
+Q(__invert__)
+
+Q(__ior__)
+
+Q(__ipow__)
+
+Q(__irshift__)
+
+Q(__isub__)
+
+Q(__iter__)
+
+Q(__itruediv__)
+
+Q(__ixor__)
+
+Q(__le__)
+
+Q(__len__)
+
+Q(__lshift__)
+
+Q(__lt__)
+
+Q(__main__)
+
+Q(__main__)
+
+Q(__main__)
+
+Q(__main__)
+
+Q(__main__)
+
+Q(__main__)
+
+Q(__main__)
+
+Q(__matmul__)
+
+Q(__mod__)
+
+Q(__module__)
+
+Q(__mul__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__ne__)
+
+Q(__neg__)
+
+Q(__new__)
+
+Q(__new__)
+
+Q(__new__)
+
+Q(__next__)
+
+Q(__next__)
+
+Q(__next__)
+
+Q(__next__)
+
+Q(__or__)
+
+Q(__path__)
+
+Q(__path__)
+
+Q(__path__)
+
+Q(__path__)
+
+Q(__path__)
+
+Q(__pos__)
+
+Q(__pow__)
+
+Q(__qualname__)
+
+Q(__radd__)
+
+Q(__rand__)
+
+Q(__repl_print__)
+
+Q(__repl_print__)
+
+Q(__repr__)
+
+Q(__repr__)
+
+Q(__reversed__)
+
+Q(__rfloordiv__)
+
+Q(__rlshift__)
+
+Q(__rmatmul__)
+
+Q(__rmod__)
+
+Q(__rmul__)
+
+Q(__ror__)
+
+Q(__rpow__)
+
+Q(__rrshift__)
+
+Q(__rshift__)
+
+Q(__rsub__)
+
+Q(__rtruediv__)
+
+Q(__rxor__)
+
+Q(__set__)
+
+Q(__set__)
+
+Q(__set__)
+
+Q(__set_name__)
+
+Q(__set_name__)
+
+Q(__setattr__)
+
+Q(__setattr__)
+
+Q(__setattr__)
+
+Q(__setattr__)
+
+Q(__setitem__)
+
+Q(__setitem__)
+
+Q(__sizeof__)
+
+Q(__str__)
+
+Q(__sub__)
+
+Q(__suppress_context__)
+
+Q(__suppress_context__)
+
+Q(__traceback__)
+
+Q(__traceback__)
+
+Q(__truediv__)
+
+Q(__xor__)
+
+Q(_asdict)
+
+Q(_asyncio)
+
+Q(_asyncio)
+
+Q(_build)
+
+Q(_dot__dot__dot_ )
+
+Q(_fill_area)
+
+Q(_gt__gt__gt_ )
+
+Q(_machine)
+
+Q(_mpy)
+
+Q(_task_queue)
+
+Q(_thread)
+
+Q(_thread)
+
+Q(_thread)
+
+Q(a)
+
+Q(a)
+
+Q(a)
+
+Q(a2b_base64)
+
+Q(abs)
+
+Q(abs_tol)
+
+Q(acos)
+
+Q(acosh)
+
+Q(acquire)
+
+Q(add)
+
+Q(add)
+
+Q(aesio)
+
+Q(aesio)
+
+Q(algorithm)
+
+Q(algorithm)
+
+Q(all)
+
+Q(allocate_lock)
+
+Q(alphablend)
+
+Q(amplitude)
+
+Q(amplitude)
+
+Q(amplitude)
+
+Q(angle)
+
+Q(annotations)
+
+Q(any)
+
+Q(append)
+
+Q(append)
+
+Q(append)
+
+Q(append)
+
+Q(append)
+
+Q(appendleft)
+
+Q(arg)
+
+Q(args)
+
+Q(argv)
+
+Q(array)
+
+Q(array)
+
+Q(array)
+
+Q(array)
+
+Q(arrayblit)
+
+Q(asin)
+
+Q(asinh)
+
+Q(atan)
+
+Q(atan2)
+
+Q(atanh)
+
+Q(atexit)
+
+Q(attack_level)
+
+Q(attack_level)
+
+Q(attack_level)
+
+Q(attack_time)
+
+Q(attack_time)
+
+Q(attack_time)
+
+Q(audiocore)
+
+Q(audiocore)
+
+Q(audiodelays)
+
+Q(audiodelays)
+
+Q(audiofilters)
+
+Q(audiofilters)
+
+Q(audiofilters)
+
+Q(audiofreeverb)
+
+Q(audiofreeverb)
+
+Q(audiomixer)
+
+Q(audiomixer)
+
+Q(auto_refresh)
+
+Q(auto_refresh)
+
+Q(b)
+
+Q(b)
+
+Q(b)
+
+Q(b)
+
+Q(b)
+
+Q(b2a_base64)
+
+Q(b_add)
+
+Q(b_add)
+
+Q(base)
+
+Q(bb)
+
+Q(bb)
+
+Q(bend)
+
+Q(bend)
+
+Q(bend)
+
+Q(bg)
+
+Q(bg)
+
+Q(big)
+
+Q(big)
+
+Q(big)
+
+Q(bin)
+
+Q(binascii)
+
+Q(binascii)
+
+Q(bit_length)
+
+Q(bitmap)
+
+Q(bitmap)
+
+Q(bitmap)
+
+Q(bitmap)
+
+Q(bitmap)
+
+Q(bitmap)
+
+Q(bitmap)
+
+Q(bitmap)
+
+Q(bitmap)
+
+Q(bitmap)
+
+Q(bitmap)
+
+Q(bitmap)
+
+Q(bitmap)
+
+Q(bitmap)
+
+Q(bitmap)
+
+Q(bitmap)
+
+Q(bitmap)
+
+Q(bitmap)
+
+Q(bitmap)
+
+Q(bitmap)
+
+Q(bitmap)
+
+Q(bitmap)
+
+Q(bitmapfilter)
+
+Q(bitmapfilter)
+
+Q(bitmaptools)
+
+Q(bitmaptools)
+
+Q(bitmaptools)
+
+Q(bitmaptools)
+
+Q(bits_per_pixel)
+
+Q(bits_per_sample)
+
+Q(bits_per_sample)
+
+Q(bits_per_sample)
+
+Q(bits_per_sample)
+
+Q(bits_per_sample)
+
+Q(bits_per_sample)
+
+Q(bits_per_sample)
+
+Q(bits_per_sample)
+
+Q(bits_per_sample)
+
+Q(bits_per_sample)
+
+Q(bits_per_sample)
+
+Q(bits_per_sample)
+
+Q(bits_per_sample)
+
+Q(bits_per_sample)
+
+Q(bits_per_sample)
+
+Q(bits_per_sample)
+
+Q(bits_per_sample)
+
+Q(bits_per_sample)
+
+Q(bits_per_sample)
+
+Q(bits_per_sample)
+
+Q(bits_per_sample)
+
+Q(bits_per_sample)
+
+Q(bits_per_sample)
+
+Q(bits_per_sample)
+
+Q(bits_per_sample)
+
+Q(bits_per_sample)
+
+Q(bits_per_sample)
+
+Q(bits_per_value)
+
+Q(blend)
+
+Q(blend_precompute)
+
+Q(blendmode)
+
+Q(blendmode)
+
+Q(blit)
+
+Q(block_size)
+
+Q(blocks)
+
+Q(bool)
+
+Q(bool)
+
+Q(bool)
+
+Q(bool)
+
+Q(bound_method)
+
+Q(boundary_fill)
+
+Q(br)
+
+Q(br)
+
+Q(brightness)
+
+Q(brightness)
+
+Q(budget_us)
+
+Q(budget_us)
+
+Q(buffer)
+
+Q(buffer)
+
+Q(buffer)
+
+Q(buffer)
+
+Q(buffer)
+
+Q(buffer)
+
+Q(buffer)
+
+Q(buffer)
+
+Q(buffer)
+
+Q(buffer)
+
+Q(buffer_size)
+
+Q(buffer_size)
+
+Q(buffer_size)
+
+Q(buffer_size)
+
+Q(buffer_size)
+
+Q(buffer_size)
+
+Q(buffer_size)
+
+Q(buffer_size)
+
+Q(buffer_size)
+
+Q(buffer_size)
+
+Q(buffer_size)
+
+Q(buffering)
+
+Q(builtins)
+
+Q(builtins)
+
+Q(bytearray)
+
+Q(bytearray)
+
+Q(bytecode)
+
+Q(byteorder)
+
+Q(byteorder)
+
+Q(byteorder)
+
+Q(byteorder)
+
+Q(bytes)
+
+Q(bytes)
+
+Q(bytes)
+
+Q(bytes)
+
+Q(c)
+
+Q(c)
+
+Q(c)
+
+Q(calcsize)
+
+Q(callable)
+
+Q(callable)
+
+Q(cancel)
+
+Q(cast)
+
+Q(ceil)
+
+Q(center)
+
+Q(chain)
+
+Q(change)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(chdir)
+
+Q(chdir)
+
+Q(chdir)
+
+Q(chdir)
+
+Q(chdir)
+
+Q(chdir)
+
+Q(chdir)
+
+Q(choice)
+
+Q(chr)
+
+Q(circuitpython)
+
+Q(classmethod)
+
+Q(classmethod)
+
+Q(clear)
+
+Q(clear)
+
+Q(clear)
+
+Q(clock)
+
+Q(close)
+
+Q(close)
+
+Q(close)
+
+Q(close)
+
+Q(close)
+
+Q(close)
+
+Q(close)
+
+Q(closure)
+
+Q(cmath)
+
+Q(cmath)
+
+Q(code)
+
+Q(codeop)
+
+Q(codeop)
+
+Q(collect)
+
+Q(collect_step)
+
+Q(collections)
+
+Q(collections)
+
+Q(color)
+
+Q(color)
+
+Q(color_count)
+
+Q(color_count)
+
+Q(color_depth)
+
+Q(color_depth)
+
+Q(color_depth)
+
+Q(color_index)
+
+Q(color_index)
+
+Q(color_index)
+
+Q(color_index)
+
+Q(color_index)
+
+Q(color_index)
+
+Q(colorspace)
+
+Q(colorspace)
+
+Q(colorwheel)
+
+Q(compile)
+
+Q(compile)
+
+Q(compile_command)
+
+Q(complex)
+
+Q(complex)
+
+Q(const)
+
+Q(const)
+
+Q(contains)
+
+Q(contains)
+
+Q(contains)
+
+Q(contains)
+
+Q(convert)
+
+Q(copy)
+
+Q(copy)
+
+Q(copy)
+
+Q(copy)
+
+Q(copysign)
+
+Q(coro)
+
+Q(coroutine)
+
+Q(coroutine)
+
+Q(coroutine)
+
+Q(cos)
+
+Q(cos)
+
+Q(cosh)
+
+Q(count)
+
+Q(count)
+
+Q(count)
+
+Q(count)
+
+Q(counter)
+
+Q(crc32)
+
+Q(ctrl)
+
+Q(cur_task)
+
+Q(cur_task)
+
+Q(damp)
+
+Q(damp)
+
+Q(damp)
+
+Q(damp)
+
+Q(data)
+
+Q(data)
+
+Q(data)
+
+Q(data_source)
+
+Q(deadbeef)
+
+Q(decay)
+
+Q(decay)
+
+Q(decay)
+
+Q(decay)
+
+Q(decay)
+
+Q(decay)
+
+Q(decay)
+
+Q(decay)
+
+Q(decay_time)
+
+Q(decay_time)
+
+Q(decay_time)
+
+Q(decode)
+
+Q(decode)
+
+Q(decode)
+
+Q(decode)
+
+Q(decompress)
+
+Q(decompress)
+
+Q(decrypt_into)
+
+Q(default)
+
+Q(default_tile)
+
+Q(degrees)
+
+Q(deinit)
+
+Q(deinit)
+
+Q(deinit)
+
+Q(deinit)
+
+Q(deinit)
+
+Q(deinit)
+
+Q(deinit)
+
+Q(deinit)
+
+Q(deinit)
+
+Q(deinit)
+
+Q(deinit)
+
+Q(deinit)
+
+Q(deinit)
+
+Q(deinit)
+
+Q(deinit)
+
+Q(deinit)
+
+Q(deinit)
+
+Q(deinit)
+
+Q(delattr)
+
+Q(delay_ms)
+
+Q(delay_ms)
+
+Q(delay_ms)
+
+Q(delay_ms)
+
+Q(delay_ms)
+
+Q(delay_ms)
+
+Q(delay_ms)
+
+Q(delay_ms)
+
+Q(delay_ms)
+
+Q(delay_ms)
+
+Q(deleter)
+
+Q(density)
+
+Q(density)
+
+Q(depth)
+
+Q(depth)
+
+Q(depth)
+
+Q(depth)
+
+Q(deque)
+
+Q(deque)
+
+Q(dest)
+
+Q(dest)
+
+Q(dest_bitmap)
+
+Q(dest_bitmap)
+
+Q(dest_bitmap)
+
+Q(dest_bitmap)
+
+Q(dest_bitmap)
+
+Q(dest_bitmap)
+
+Q(dest_bitmap)
+
+Q(dest_bitmap)
+
+Q(dest_bitmap)
+
+Q(dest_bitmap)
+
+Q(dest_bitmap)
+
+Q(dest_bitmap)
+
+Q(dest_bitmap)
+
+Q(dest_bitmap)
+
+Q(dest_bitmap)
+
+Q(dest_bitmap)
+
+Q(dest_bitmap)
+
+Q(dest_bitmap)
+
+Q(dest_clip0)
+
+Q(dest_clip1)
+
+Q(dict)
+
+Q(dict)
+
+Q(dict)
+
+Q(dict_view)
+
+Q(difference)
+
+Q(difference)
+
+Q(difference_update)
+
+Q(digest)
+
+Q(dir)
+
+Q(dirty)
+
+Q(disable)
+
+Q(discard)
+
+Q(displayio)
+
+Q(displayio)
+
+Q(displayio)
+
+Q(dither)
+
+Q(dither)
+
+Q(dither)
+
+Q(dither)
+
+Q(dither)
+
+Q(divmod)
+
+Q(doc)
+
+Q(done)
+
+Q(draw_circle)
+
+Q(draw_line)
+
+Q(draw_polygon)
+
+Q(drive)
+
+Q(drive)
+
+Q(drive)
+
+Q(drive)
+
+Q(dump)
+
+Q(dumps)
+
+Q(e)
+
+Q(e)
+
+Q(element_size)
+
+Q(enable)
+
+Q(encode)
+
+Q(encoding)
+
+Q(encrypt_into)
+
+Q(end)
+
+Q(end)
+
+Q(end)
+
+Q(endswith)
+
+Q(enumerate)
+
+Q(enumerate)
+
+Q(envelope)
+
+Q(envelope)
+
+Q(envelope)
+
+Q(envelope)
+
+Q(envelope)
+
+Q(envelope)
+
+Q(envelope)
+
+Q(envelope)
+
+Q(erf)
+
+Q(erfc)
+
+Q(errno)
+
+Q(errno)
+
+Q(errno)
+
+Q(errno)
+
+Q(errno)
+
+Q(error_location)
+
+Q(errorcode)
+
+Q(eval)
+
+Q(eval)
+
+Q(exc_info)
+
+Q(exec)
+
+Q(exec)
+
+Q(execfile)
+
+Q(executable)
+
+Q(exit)
+
+Q(exit)
+
+Q(exp)
+
+Q(exp)
+
+Q(expm1)
+
+Q(extend)
+
+Q(extend)
+
+Q(extend)
+
+Q(extend)
+
+Q(extra_coverage)
+
+Q(extra_cpp_coverage)
+
+Q(f0)
+
+Q(f0)
+
+Q(fabs)
+
+Q(factor_1)
+
+Q(factor_2)
+
+Q(factorial)
+
+Q(false_color)
+
+Q(feedback)
+
+Q(feedback)
+
+Q(feedback)
+
+Q(feedback)
+
+Q(feedback)
+
+Q(feedback)
+
+Q(feedback)
+
+Q(feedback)
+
+Q(file)
+
+Q(file)
+
+Q(file)
+
+Q(file)
+
+Q(file)
+
+Q(file)
+
+Q(file)
+
+Q(file)
+
+Q(file)
+
+Q(file)
+
+Q(file)
+
+Q(file)
+
+Q(file)
+
+Q(file)
+
+Q(filename)
+
+Q(filename)
+
+Q(filename2)
+
+Q(fileno)
+
+Q(fill)
+
+Q(fill_color_value)
+
+Q(fill_region)
+
+Q(fill_row)
+
+Q(filter)
+
+Q(filter)
+
+Q(filter)
+
+Q(filter)
+
+Q(filter)
+
+Q(filter)
+
+Q(filter)
+
+Q(filter)
+
+Q(filter)
+
+Q(filter)
+
+Q(filter)
+
+Q(find)
+
+Q(find)
+
+Q(flip_x)
+
+Q(flip_y)
+
+Q(float)
+
+Q(float)
+
+Q(float)
+
+Q(float)
+
+Q(floor)
+
+Q(flush)
+
+Q(flush)
+
+Q(flush)
+
+Q(flush)
+
+Q(flush)
+
+Q(fmod)
+
+Q(format)
+
+Q(format)
+
+Q(format_exception)
+
+Q(framebuffer)
+
+Q(framebuffer)
+
+Q(framebuffer)
+
+Q(framebufferio)
+
+Q(framebufferio)
+
+Q(freeverb)
+
+Q(freq_shift)
+
+Q(freq_shift)
+
+Q(frequency)
+
+Q(frequency)
+
+Q(frequency)
+
+Q(frequency)
+
+Q(frequency)
+
+Q(frequency)
+
+Q(frequency)
+
+Q(frequency)
+
+Q(frequency)
+
+Q(frequency)
+
+Q(frexp)
+
+Q(from_bytes)
+
+Q(from_file)
+
+Q(fromhex)
+
+Q(fromkeys)
+
+Q(frozenset)
+
+Q(frozenset)
+
+Q(function)
+
+Q(function)
+
+Q(function)
+
+Q(function)
+
+Q(function)
+
+Q(function)
+
+Q(function)
+
+Q(function)
+
+Q(function)
+
+Q(function)
+
+Q(g)
+
+Q(g)
+
+Q(g_add)
+
+Q(g_add)
+
+Q(gamma)
+
+Q(gb)
+
+Q(gb)
+
+Q(gc)
+
+Q(gc)
+
+Q(generator)
+
+Q(generator)
+
+Q(generator)
+
+Q(get)
+
+Q(get_buffer)
+
+Q(get_ident)
+
+Q(get_structure)
+
+Q(getattr)
+
+Q(getcwd)
+
+Q(getcwd)
+
+Q(getcwd)
+
+Q(getcwd)
+
+Q(getenv)
+
+Q(getlocale)
+
+Q(getrandbits)
+
+Q(getsizeof)
+
+Q(getter)
+
+Q(getvalue)
+
+Q(gg)
+
+Q(gg)
+
+Q(globals)
+
+Q(gmtime)
+
+Q(gr)
+
+Q(gr)
+
+Q(grain_size)
+
+Q(grain_size)
+
+Q(group)
+
+Q(groups)
+
+Q(hasattr)
+
+Q(hash)
+
+Q(hashlib)
+
+Q(hashlib)
+
+Q(heap_lock)
+
+Q(heap_locked)
+
+Q(heap_unlock)
+
+Q(heapify)
+
+Q(heappop)
+
+Q(heappush)
+
+Q(heapq)
+
+Q(heapq)
+
+Q(height)
+
+Q(height)
+
+Q(height)
+
+Q(height)
+
+Q(height)
+
+Q(height)
+
+Q(height)
+
+Q(height)
+
+Q(height)
+
+Q(height)
+
+Q(height)
+
+Q(height)
+
+Q(height)
+
+Q(help)
+
+Q(hex)
+
+Q(hex)
+
+Q(hex)
+
+Q(hexlify)
+
+Q(hidden)
+
+Q(hidden)
+
+Q(hidden)
+
+Q(hidden)
+
+Q(hidden)
+
+Q(i)
+
+Q(id)
+
+Q(ilistdir)
+
+Q(ilistdir)
+
+Q(ilistdir)
+
+Q(ilistdir)
+
+Q(ilistdir)
+
+Q(ilistdir)
+
+Q(imag)
+
+Q(implementation)
+
+Q(incremental)
+
+Q(index)
+
+Q(index)
+
+Q(index)
+
+Q(index)
+
+Q(index)
+
+Q(index)
+
+Q(index)
+
+Q(indices)
+
+Q(inf)
+
+Q(input)
+
+Q(input_colorspace)
+
+Q(input_colorspace)
+
+Q(insert)
+
+Q(insert)
+
+Q(int)
+
+Q(int)
+
+Q(int)
+
+Q(int)
+
+Q(int)
+
+Q(int)
+
+Q(intern)
+
+Q(interpolate)
+
+Q(interpolate)
+
+Q(intersection)
+
+Q(intersection)
+
+Q(intersection_update)
+
+Q(invert)
+
+Q(invert)
+
+Q(invert)
+
+Q(io)
+
+Q(io)
+
+Q(ioctl)
+
+Q(ioctl)
+
+Q(ioctl)
+
+Q(ipoll)
+
+Q(is_transparent)
+
+Q(isalpha)
+
+Q(isclose)
+
+Q(isdigit)
+
+Q(isdisjoint)
+
+Q(isdisjoint)
+
+Q(isenabled)
+
+Q(isfinite)
+
+Q(isinf)
+
+Q(isinstance)
+
+Q(islower)
+
+Q(isnan)
+
+Q(isspace)
+
+Q(issubclass)
+
+Q(issubset)
+
+Q(issubset)
+
+Q(issuperset)
+
+Q(issuperset)
+
+Q(isupper)
+
+Q(items)
+
+Q(items)
+
+Q(items)
+
+Q(itemsize)
+
+Q(iter)
+
+Q(iterable)
+
+Q(iterable)
+
+Q(iterable)
+
+Q(iterator)
+
+Q(iterator)
+
+Q(iterator)
+
+Q(iterator)
+
+Q(iterator)
+
+Q(iterator)
+
+Q(join)
+
+Q(jpegio)
+
+Q(jpegio)
+
+Q(json)
+
+Q(json)
+
+Q(json)
+
+Q(kbd_intr)
+
+Q(keepends)
+
+Q(key)
+
+Q(key)
+
+Q(key)
+
+Q(key)
+
+Q(key)
+
+Q(key_size)
+
+Q(keys)
+
+Q(keys)
+
+Q(label)
+
+Q(last)
+
+Q(layer)
+
+Q(ldexp)
+
+Q(len)
+
+Q(length)
+
+Q(level)
+
+Q(level)
+
+Q(level)
+
+Q(lfo_tick)
+
+Q(lfo_value)
+
+Q(lgamma)
+
+Q(libc_ver)
+
+Q(limit)
+
+Q(list)
+
+Q(list)
+
+Q(list)
+
+Q(listdir)
+
+Q(little)
+
+Q(little)
+
+Q(little)
+
+Q(little)
+
+Q(load)
+
+Q(loads)
+
+Q(locale)
+
+Q(locale)
+
+Q(locals)
+
+Q(localtime)
+
+Q(location)
+
+Q(location)
+
+Q(location)
+
+Q(location)
+
+Q(lock)
+
+Q(locked)
+
+Q(log)
+
+Q(log)
+
+Q(log10)
+
+Q(log10)
+
+Q(log2)
+
+Q(lookup)
+
+Q(lookup)
+
+Q(lookup)
+
+Q(lookup)
+
+Q(lookup)
+
+Q(lookup)
+
+Q(loop)
+
+Q(loop)
+
+Q(loop)
+
+Q(loop)
+
+Q(loop)
+
+Q(loop)
+
+Q(loop)
+
+Q(loop)
+
+Q(loop)
+
+Q(loop)
+
+Q(loop)
+
+Q(loop)
+
+Q(loop)
+
+Q(lower)
+
+Q(lstrip)
+
+Q(machine)
+
+Q(make_opaque)
+
+Q(make_opaque)
+
+Q(make_transparent)
+
+Q(make_transparent)
+
+Q(map)
+
+Q(map)
+
+Q(mask)
+
+Q(mask)
+
+Q(mask)
+
+Q(mask)
+
+Q(mask)
+
+Q(mask)
+
+Q(mask)
+
+Q(mask)
+
+Q(mask)
+
+Q(mask)
+
+Q(mask)
+
+Q(mask)
+
+Q(mask)
+
+Q(mask)
+
+Q(match)
+
+Q(match)
+
+Q(match)
+
+Q(math)
+
+Q(math)
+
+Q(math)
+
+Q(max)
+
+Q(max_delay_ms)
+
+Q(max_delay_ms)
+
+Q(max_delay_ms)
+
+Q(max_delay_ms)
+
+Q(max_delay_ms)
+
+Q(max_delay_ms)
+
+Q(max_delay_ms)
+
+Q(max_delay_ms)
+
+Q(max_polyphony)
+
+Q(max_voices)
+
+Q(max_voices)
+
+Q(max_voices)
+
+Q(maxsize)
+
+Q(mem_alloc)
+
+Q(mem_current)
+
+Q(mem_free)
+
+Q(mem_info)
+
+Q(mem_peak)
+
+Q(mem_total)
+
+Q(memoryview)
+
+Q(memoryview)
+
+Q(micropython)
+
+Q(micropython)
+
+Q(micropython)
+
+Q(midi_to_hz)
+
+Q(min)
+
+Q(min_delay_ms)
+
+Q(min_delay_ms)
+
+Q(min_delay_ms)
+
+Q(min_delay_ms)
+
+Q(minimum_frames_per_second)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mkdir)
+
+Q(mkdir)
+
+Q(mkdir)
+
+Q(mkdir)
+
+Q(mkdir)
+
+Q(mkfs)
+
+Q(mkfs)
+
+Q(mktime)
+
+Q(mode)
+
+Q(mode)
+
+Q(mode)
+
+Q(mode)
+
+Q(mode)
+
+Q(mode)
+
+Q(mode)
+
+Q(mode)
+
+Q(mode)
+
+Q(mode)
+
+Q(mode)
+
+Q(modf)
+
+Q(modify)
+
+Q(module)
+
+Q(modules)
+
+Q(modules)
+
+Q(morph)
+
+Q(mount)
+
+Q(mount)
+
+Q(mount)
+
+Q(mount)
+
+Q(mount)
+
+Q(move_to_end)
+
+Q(mul)
+
+Q(name)
+
+Q(namedtuple)
+
+Q(nan)
+
+Q(native)
+
+Q(new_attribute)
+
+Q(new_color)
+
+Q(newline)
+
+Q(next)
+
+Q(nframes)
+
+Q(nodename)
+
+Q(note)
+
+Q(note)
+
+Q(note)
+
+Q(note_info)
+
+Q(object)
+
+Q(object)
+
+Q(object)
+
+Q(object)
+
+Q(object)
+
+Q(object)
+
+Q(object)
+
+Q(oct)
+
+Q(offscreen)
+
+Q(offscreen)
+
+Q(offset)
+
+Q(offset)
+
+Q(offset)
+
+Q(offset)
+
+Q(offset)
+
+Q(old_color)
+
+Q(once)
+
+Q(once)
+
+Q(open)
+
+Q(open)
+
+Q(open)
+
+Q(open)
+
+Q(open)
+
+Q(open)
+
+Q(open)
+
+Q(operation)
+
+Q(operation)
+
+Q(operation)
+
+Q(opt_level)
+
+Q(ord)
+
+Q(os)
+
+Q(os)
+
+Q(overlap)
+
+Q(ox)
+
+Q(oy)
+
+Q(pack)
+
+Q(pack_into)
+
+Q(palette)
+
+Q(palette)
+
+Q(palette)
+
+Q(palette_index)
+
+Q(palette_index)
+
+Q(palette_index)
+
+Q(palette_index)
+
+Q(palette_index)
+
+Q(palette_index)
+
+Q(panning)
+
+Q(panning)
+
+Q(panning)
+
+Q(panning)
+
+Q(panning)
+
+Q(partition)
+
+Q(path)
+
+Q(peek)
+
+Q(pend_throw)
+
+Q(pend_throw)
+
+Q(ph_key)
+
+Q(phase)
+
+Q(phase)
+
+Q(phase_offset)
+
+Q(phase_offset)
+
+Q(phase_offset)
+
+Q(pi)
+
+Q(pi)
+
+Q(pixel_shader)
+
+Q(pixel_shader)
+
+Q(pixel_shader)
+
+Q(pixel_shader)
+
+Q(pixel_shader)
+
+Q(pixel_shader)
+
+Q(pixel_shader)
+
+Q(pixel_shader)
+
+Q(pixel_shader)
+
+Q(pixel_shader)
+
+Q(pixel_shader)
+
+Q(pixel_shader)
+
+Q(platform)
+
+Q(platform)
+
+Q(platform)
+
+Q(platform)
+
+Q(play)
+
+Q(play)
+
+Q(play)
+
+Q(play)
+
+Q(play)
+
+Q(play)
+
+Q(play)
+
+Q(play)
+
+Q(play)
+
+Q(play)
+
+Q(play)
+
+Q(play)
+
+Q(playing)
+
+Q(playing)
+
+Q(playing)
+
+Q(playing)
+
+Q(playing)
+
+Q(playing)
+
+Q(playing)
+
+Q(playing)
+
+Q(playing)
+
+Q(playing)
+
+Q(playing)
+
+Q(playing)
+
+Q(point)
+
+Q(point)
+
+Q(points)
+
+Q(points)
+
+Q(points)
+
+Q(polar)
+
+Q(poll)
+
+Q(poll)
+
+Q(poll)
+
+Q(pop)
+
+Q(pop)
+
+Q(pop)
+
+Q(pop)
+
+Q(pop)
+
+Q(pop)
+
+Q(popitem)
+
+Q(popleft)
+
+Q(position)
+
+Q(position)
+
+Q(post_filter)
+
+Q(post_filter)
+
+Q(post_gain)
+
+Q(post_gain)
+
+Q(post_gain)
+
+Q(post_gain)
+
+Q(pow)
+
+Q(pow)
+
+Q(pre_filter)
+
+Q(pre_filter)
+
+Q(pre_gain)
+
+Q(pre_gain)
+
+Q(pre_gain)
+
+Q(pre_gain)
+
+Q(prefetch)
+
+Q(press)
+
+Q(press)
+
+Q(pressed)
+
+Q(print)
+
+Q(print_exception)
+
+Q(print_subclass_attr)
+
+Q(property)
+
+Q(property)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_draw)
+
+Q(protocol_draw)
+
+Q(protocol_draw)
+
+Q(protocol_draw)
+
+Q(protocol_draw)
+
+Q(protocol_draw)
+
+Q(protocol_draw)
+
+Q(protocol_draw)
+
+Q(protocol_draw)
+
+Q(protocol_draw)
+
+Q(protocol_draw)
+
+Q(protocol_draw)
+
+Q(protocol_draw)
+
+Q(protocol_draw)
+
+Q(protocol_draw)
+
+Q(protocol_draw)
+
+Q(protocol_draw)
+
+Q(protocol_draw)
+
+Q(protocol_draw)
+
+Q(protocol_draw)
+
+Q(protocol_draw)
+
+Q(protocol_draw)
+
+Q(protocol_draw)
+
+Q(protocol_framebuffer)
+
+Q(protocol_framebuffer)
+
+Q(protocol_vfs)
+
+Q(ps1)
+
+Q(ps2)
+
+Q(ptr)
+
+Q(ptr)
+
+Q(ptr16)
+
+Q(ptr16)
+
+Q(ptr32)
+
+Q(ptr32)
+
+Q(ptr8)
+
+Q(ptr8)
+
+Q(push)
+
+Q(putenv)
+
+Q(px)
+
+Q(py)
+
+Q(python_compiler)
+
+Q(qstr_info)
+
+Q(r)
+
+Q(r)
+
+Q(r)
+
+Q(r_add)
+
+Q(r_add)
+
+Q(radians)
+
+Q(radius)
+
+Q(radius)
+
+Q(radius)
+
+Q(radius)
+
+Q(radius)
+
+Q(rainbowio)
+
+Q(rainbowio)
+
+Q(randint)
+
+Q(random)
+
+Q(random)
+
+Q(random)
+
+Q(randrange)
+
+Q(range)
+
+Q(range)
+
+Q(range)
+
+Q(range)
+
+Q(rate)
+
+Q(rate)
+
+Q(rate)
+
+Q(rate)
+
+Q(rate)
+
+Q(rate)
+
+Q(rate)
+
+Q(rb)
+
+Q(rb)
+
+Q(rb)
+
+Q(rb)
+
+Q(rb)
+
+Q(rb)
+
+Q(rb)
+
+Q(re)
+
+Q(re)
+
+Q(re)
+
+Q(read)
+
+Q(read)
+
+Q(read)
+
+Q(read)
+
+Q(read)
+
+Q(read)
+
+Q(read1)
+
+Q(readblocks)
+
+Q(readinto)
+
+Q(readinto)
+
+Q(readinto)
+
+Q(readinto)
+
+Q(readinto)
+
+Q(readinto)
+
+Q(readinto)
+
+Q(readinto)
+
+Q(readinto1)
+
+Q(readline)
+
+Q(readline)
+
+Q(readline)
+
+Q(readline)
+
+Q(readline)
+
+Q(readlines)
+
+Q(readlines)
+
+Q(readonly)
+
+Q(readonly)
+
+Q(real)
+
+Q(rect)
+
+Q(refresh)
+
+Q(refresh_count)
+
+Q(register)
+
+Q(rekey)
+
+Q(rel_tol)
+
+Q(release)
+
+Q(release)
+
+Q(release)
+
+Q(release)
+
+Q(release_all)
+
+Q(release_all_then_press)
+
+Q(release_displays)
+
+Q(release_then_press)
+
+Q(release_time)
+
+Q(release_time)
+
+Q(release_time)
+
+Q(remove)
+
+Q(remove)
+
+Q(remove)
+
+Q(remove)
+
+Q(remove)
+
+Q(remove)
+
+Q(remove)
+
+Q(remove)
+
+Q(remove)
+
+Q(remove)
+
+Q(rename)
+
+Q(rename)
+
+Q(rename)
+
+Q(rename)
+
+Q(rename)
+
+Q(render)
+
+Q(render_into)
+
+Q(replace)
+
+Q(replace_color)
+
+Q(replaced_color_value)
+
+Q(repr)
+
+Q(reset_buffer)
+
+Q(retrigger)
+
+Q(retrigger)
+
+Q(retrigger)
+
+Q(retrigger)
+
+Q(reverse)
+
+Q(reverse)
+
+Q(reverse_pixels_in_element)
+
+Q(reverse_rows)
+
+Q(reversed)
+
+Q(reversed)
+
+Q(rfind)
+
+Q(rfind)
+
+Q(rg)
+
+Q(rg)
+
+Q(rindex)
+
+Q(rindex)
+
+Q(ring_bend)
+
+Q(ring_bend)
+
+Q(ring_bend)
+
+Q(ring_frequency)
+
+Q(ring_frequency)
+
+Q(ring_frequency)
+
+Q(ring_waveform)
+
+Q(ring_waveform)
+
+Q(ring_waveform_loop_end)
+
+Q(ring_waveform_loop_end)
+
+Q(ring_waveform_loop_end)
+
+Q(ring_waveform_loop_start)
+
+Q(ring_waveform_loop_start)
+
+Q(ring_waveform_loop_start)
+
+Q(rmdir)
+
+Q(rmdir)
+
+Q(rmdir)
+
+Q(rmdir)
+
+Q(rmdir)
+
+Q(roomsize)
+
+Q(roomsize)
+
+Q(roomsize)
+
+Q(roomsize)
+
+Q(root_group)
+
+Q(rotation)
+
+Q(rotation)
+
+Q(rotozoom)
+
+Q(round)
+
+Q(rpartition)
+
+Q(rr)
+
+Q(rr)
+
+Q(rsplit)
+
+Q(rstrip)
+
+Q(sample)
+
+Q(sample)
+
+Q(sample)
+
+Q(sample)
+
+Q(sample)
+
+Q(sample)
+
+Q(sample)
+
+Q(sample)
+
+Q(sample)
+
+Q(sample)
+
+Q(sample)
+
+Q(sample)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(samples_signed)
+
+Q(samples_signed)
+
+Q(samples_signed)
+
+Q(samples_signed)
+
+Q(samples_signed)
+
+Q(samples_signed)
+
+Q(samples_signed)
+
+Q(samples_signed)
+
+Q(samples_signed)
+
+Q(samples_signed)
+
+Q(samples_signed)
+
+Q(scale)
+
+Q(scale)
+
+Q(scale)
+
+Q(scale)
+
+Q(scale)
+
+Q(scale)
+
+Q(scale)
+
+Q(scale)
+
+Q(scale)
+
+Q(scale)
+
+Q(schedule)
+
+Q(search)
+
+Q(search)
+
+Q(seed)
+
+Q(seek)
+
+Q(seek)
+
+Q(seek)
+
+Q(segment_size)
+
+Q(select)
+
+Q(select)
+
+Q(self)
+
+Q(self)
+
+Q(self)
+
+Q(semitones)
+
+Q(semitones)
+
+Q(semitones)
+
+Q(semitones)
+
+Q(semitones)
+
+Q(semitones)
+
+Q(semitones)
+
+Q(semitones)
+
+Q(send)
+
+Q(send)
+
+Q(send)
+
+Q(sep)
+
+Q(sep)
+
+Q(separators)
+
+Q(set)
+
+Q(set)
+
+Q(set)
+
+Q(set_buf)
+
+Q(set_error)
+
+Q(setattr)
+
+Q(setdefault)
+
+Q(setter)
+
+Q(sha256)
+
+Q(sha256)
+
+Q(shape)
+
+Q(show)
+
+Q(signed)
+
+Q(signed)
+
+Q(signed)
+
+Q(signedness)
+
+Q(sin)
+
+Q(sin)
+
+Q(single)
+
+Q(single)
+
+Q(single_buffer)
+
+Q(sinh)
+
+Q(skip_dest_index)
+
+Q(skip_dest_index)
+
+Q(skip_index)
+
+Q(skip_index)
+
+Q(skip_source1_index)
+
+Q(skip_source2_index)
+
+Q(skip_source_index)
+
+Q(skip_source_index)
+
+Q(sleep)
+
+Q(sleep_ms)
+
+Q(sleep_us)
+
+Q(slice)
+
+Q(slice)
+
+Q(slice)
+
+Q(soft_clip)
+
+Q(soft_clip)
+
+Q(solarize)
+
+Q(sort)
+
+Q(sort)
+
+Q(sorted)
+
+Q(source)
+
+Q(source)
+
+Q(source_bitmap)
+
+Q(source_bitmap)
+
+Q(source_bitmap)
+
+Q(source_bitmap)
+
+Q(source_bitmap)
+
+Q(source_bitmap)
+
+Q(source_bitmap_1)
+
+Q(source_bitmap_1)
+
+Q(source_bitmap_2)
+
+Q(source_bitmap_2)
+
+Q(source_clip0)
+
+Q(source_clip1)
+
+Q(source_colorspace)
+
+Q(source_colorspace)
+
+Q(span)
+
+Q(split)
+
+Q(split)
+
+Q(splitlines)
+
+Q(spread)
+
+Q(spread)
+
+Q(sqrt)
+
+Q(sqrt)
+
+Q(src1)
+
+Q(src1)
+
+Q(src2)
+
+Q(src2)
+
+Q(stack_size)
+
+Q(stack_use)
+
+Q(stages)
+
+Q(stages)
+
+Q(start)
+
+Q(start)
+
+Q(start)
+
+Q(start)
+
+Q(start)
+
+Q(start_new_thread)
+
+Q(startswith)
+
+Q(stat)
+
+Q(stat)
+
+Q(stat)
+
+Q(stat)
+
+Q(stat)
+
+Q(stat)
+
+Q(state)
+
+Q(state)
+
+Q(staticmethod)
+
+Q(staticmethod)
+
+Q(statvfs)
+
+Q(statvfs)
+
+Q(statvfs)
+
+Q(statvfs)
+
+Q(statvfs)
+
+Q(stderr)
+
+Q(stdin)
+
+Q(stdout)
+
+Q(step)
+
+Q(step)
+
+Q(step)
+
+Q(stest_fileio)
+
+Q(stest_textio2)
+
+Q(stop)
+
+Q(stop)
+
+Q(stop)
+
+Q(stop)
+
+Q(stop)
+
+Q(stop)
+
+Q(stop)
+
+Q(stop)
+
+Q(stop)
+
+Q(stop)
+
+Q(stop)
+
+Q(stop)
+
+Q(stop)
+
+Q(stop)
+
+Q(stop_voice)
+
+Q(str)
+
+Q(str)
+
+Q(str)
+
+Q(str)
+
+Q(str)
+
+Q(str)
+
+Q(strerror)
+
+Q(strip)
+
+Q(struct)
+
+Q(struct)
+
+Q(sub)
+
+Q(sub)
+
+Q(sum)
+
+Q(super)
+
+Q(super)
+
+Q(super)
+
+Q(sustain_level)
+
+Q(sustain_level)
+
+Q(sustain_level)
+
+Q(swap_bytes_in_element)
+
+Q(symbol)
+
+Q(symmetric_difference)
+
+Q(symmetric_difference)
+
+Q(symmetric_difference_update)
+
+Q(sync)
+
+Q(synthio)
+
+Q(synthio)
+
+Q(synthio)
+
+Q(synthio)
+
+Q(synthio)
+
+Q(synthio)
+
+Q(synthio_block)
+
+Q(synthio_block)
+
+Q(synthio_block)
+
+Q(sys)
+
+Q(sys)
+
+Q(sys)
+
+Q(sys)
+
+Q(sysname)
+
+Q(system)
+
+Q(table)
+
+Q(table)
+
+Q(tan)
+
+Q(tanh)
+
+Q(taps)
+
+Q(taps)
+
+Q(taps)
+
+Q(taps)
+
+Q(target_frames_per_second)
+
+Q(tau)
+
+Q(tb)
+
+Q(tb)
+
+Q(tb)
+
+Q(tell)
+
+Q(tell)
+
+Q(tell)
+
+Q(tempo)
+
+Q(tempo)
+
+Q(tempo)
+
+Q(test)
+
+Q(test)
+
+Q(threshold)
+
+Q(threshold)
+
+Q(threshold)
+
+Q(throw)
+
+Q(throw)
+
+Q(throw)
+
+Q(ticks_add)
+
+Q(ticks_cpu)
+
+Q(ticks_diff)
+
+Q(ticks_ms)
+
+Q(ticks_us)
+
+Q(tile)
+
+Q(tile_height)
+
+Q(tile_height)
+
+Q(tile_width)
+
+Q(tile_width)
+
+Q(time)
+
+Q(time)
+
+Q(time)
+
+Q(time_ns)
+
+Q(to_bytes)
+
+Q(traceback)
+
+Q(traceback)
+
+Q(traceback)
+
+Q(traceback)
+
+Q(traceback)
+
+Q(tracebacklimit)
+
+Q(transpose_xy)
+
+Q(trunc)
+
+Q(tuple)
+
+Q(tuple)
+
+Q(tuple)
+
+Q(tuple)
+
+Q(tuple)
+
+Q(tuple)
+
+Q(type)
+
+Q(type)
+
+Q(uint)
+
+Q(uint)
+
+Q(umount)
+
+Q(umount)
+
+Q(umount)
+
+Q(umount)
+
+Q(uname)
+
+Q(unhexlify)
+
+Q(uniform)
+
+Q(union)
+
+Q(union)
+
+Q(unlink)
+
+Q(unpack)
+
+Q(unpack_from)
+
+Q(unregister)
+
+Q(unsafe)
+
+Q(unsetenv)
+
+Q(update)
+
+Q(update)
+
+Q(update)
+
+Q(upper)
+
+Q(urandom)
+
+Q(usys)
+
+Q(utf-8)
+
+Q(utf-8)
+
+Q(utf-8)
+
+Q(utf-8)
+
+Q(utime)
+
+Q(utime)
+
+Q(uzlib)
+
+Q(value)
+
+Q(value)
+
+Q(value)
+
+Q(value)
+
+Q(value)
+
+Q(value)
+
+Q(value)
+
+Q(value)
+
+Q(value)
+
+Q(value)
+
+Q(value)
+
+Q(value_count)
+
+Q(values)
+
+Q(values)
+
+Q(vectorio)
+
+Q(vectorio)
+
+Q(version)
+
+Q(version)
+
+Q(version)
+
+Q(version_info)
+
+Q(viper)
+
+Q(voct_to_hz)
+
+Q(voice)
+
+Q(voice)
+
+Q(voice)
+
+Q(voice)
+
+Q(voice)
+
+Q(voice)
+
+Q(voice_count)
+
+Q(voice_count)
+
+Q(voice_stealing)
+
+Q(voice_stealing)
+
+Q(voice_stealing)
+
+Q(voice_stealing)
+
+Q(voices)
+
+Q(voices)
+
+Q(voices)
+
+Q(voices)
+
+Q(waveform)
+
+Q(waveform)
+
+Q(waveform)
+
+Q(waveform)
+
+Q(waveform)
+
+Q(waveform)
+
+Q(waveform)
+
+Q(waveform)
+
+Q(waveform_loop_end)
+
+Q(waveform_loop_end)
+
+Q(waveform_loop_end)
+
+Q(waveform_loop_start)
+
+Q(waveform_loop_start)
+
+Q(waveform_loop_start)
+
+Q(waveform_max_length)
+
+Q(weights)
+
+Q(weights)
+
+Q(weights)
+
+Q(width)
+
+Q(width)
+
+Q(width)
+
+Q(width)
+
+Q(width)
+
+Q(width)
+
+Q(width)
+
+Q(width)
+
+Q(width)
+
+Q(width)
+
+Q(width)
+
+Q(width)
+
+Q(width)
+
+Q(window)
+
+Q(write)
+
+Q(write)
+
+Q(write)
+
+Q(write)
+
+Q(write)
+
+Q(write)
+
+Q(write1)
+
+Q(writeblocks)
+
+Q(x)
+
+Q(x)
+
+Q(x)
+
+Q(x)
+
+Q(x)
+
+Q(x)
+
+Q(x)
+
+Q(x)
+
+Q(x)
+
+Q(x)
+
+Q(x)
+
+Q(x)
+
+Q(x)
+
+Q(x)
+
+Q(x)
+
+Q(x)
+
+Q(x)
+
+Q(x)
+
+Q(x)
+
+Q(x)
+
+Q(x)
+
+Q(x)
+
+Q(x)
+
+Q(x)
+
+Q(x1)
+
+Q(x1)
+
+Q(x1)
+
+Q(x1)
+
+Q(x1)
+
+Q(x1)
+
+Q(x1)
+
+Q(x2)
+
+Q(x2)
+
+Q(x2)
+
+Q(x2)
+
+Q(x2)
+
+Q(x2)
+
+Q(x2)
+
+Q(xs)
+
+Q(y)
+
+Q(y)
+
+Q(y)
+
+Q(y)
+
+Q(y)
+
+Q(y)
+
+Q(y)
+
+Q(y)
+
+Q(y)
+
+Q(y)
+
+Q(y)
+
+Q(y)
+
+Q(y)
+
+Q(y)
+
+Q(y)
+
+Q(y)
+
+Q(y)
+
+Q(y)
+
+Q(y)
+
+Q(y)
+
+Q(y)
+
+Q(y)
+
+Q(y)
+
+Q(y)
+
+Q(y)
+
+Q(y1)
+
+Q(y1)
+
+Q(y1)
+
+Q(y1)
+
+Q(y1)
+
+Q(y1)
+
+Q(y1)
+
+Q(y2)
+
+Q(y2)
+
+Q(y2)
+
+Q(y2)
+
+Q(y2)
+
+Q(y2)
+
+Q(y2)
+
+Q(ys)
+
+Q(zip)
+
+Q(zip)
+
+Q(zip)
+
+Q(zlib)
+
+Q(zlib)
+
+Q(zlib)
+
+Q({_colon_#b})
+
+TRANSLATE("  File \"%q\", line %d")
+
+TRANSLATE(" is of type %q\n")
+
+TRANSLATE("%%c needs int or char")
+
+TRANSLATE("%%c needs int or char")
+
+TRANSLATE("%q in %q must be of type %q or %q, not %q")
+
+TRANSLATE("%q in %q must be of type %q, not %q")
+
+TRANSLATE("%q in %q must be of type %q, not %q")
+
+TRANSLATE("%q index out of range")
+
+TRANSLATE("%q index out of range")
+
+TRANSLATE("%q indices must be integers, not %s")
+
+TRANSLATE("%q length must be %d")
+
+TRANSLATE("%q length must be %d-%d")
+
+TRANSLATE("%q length must be <= %d")
+
+TRANSLATE("%q length must be >= %d")
+
+TRANSLATE("%q must be %d")
+
+TRANSLATE("%q must be %d-%d")
+
+TRANSLATE("%q must be %d-%d")
+
+TRANSLATE("%q must be %d-%d")
+
+TRANSLATE("%q must be %d-%d")
+
+TRANSLATE("%q must be %d-%d")
+
+TRANSLATE("%q must be %d-%d")
+
+TRANSLATE("%q must be <= %d")
+
+TRANSLATE("%q must be >= %d")
+
+TRANSLATE("%q must be >= %d")
+
+TRANSLATE("%q must be a bytearray or array of type 'h', 'H', 'b', or 'B'")
+
+TRANSLATE("%q must be array of type 'h'")
+
+TRANSLATE("%q must be of type %q or %q, not %q")
+
+TRANSLATE("%q must be of type %q or %q, not %q")
+
+TRANSLATE("%q must be of type %q or %q, not %q")
+
+TRANSLATE("%q must be of type %q or %q, not %q")
+
+TRANSLATE("%q must be of type %q or %q, not %q")
+
+TRANSLATE("%q must be of type %q or %q, not %q")
+
+TRANSLATE("%q must be of type %q or %q, not %q")
+
+TRANSLATE("%q must be of type %q or %q, not %q")
+
+TRANSLATE("%q must be of type %q, %q, or %q, not %q")
+
+TRANSLATE("%q must be of type %q, not %q")
+
+TRANSLATE("%q must be of type %q, not %q")
+
+TRANSLATE("%q must be of type %q, not %q")
+
+TRANSLATE("%q must be of type %q, not %q")
+
+TRANSLATE("%q must be of type %q, not %q")
+
+TRANSLATE("%q must be of type %q, not %q")
+
+TRANSLATE("%q must be of type %q, not %q")
+
+TRANSLATE("%q must be of type %q, not %q")
+
+TRANSLATE("%q must be of type %q, not %q")
+
+TRANSLATE("%q out of range")
+
+TRANSLATE("%q out of range")
+
+TRANSLATE("%q step cannot be zero")
+
+TRANSLATE("%q step cannot be zero")
+
+TRANSLATE("%q() takes %d positional arguments but %d were given")
+
+TRANSLATE("%q() takes %d positional arguments but %d were given")
+
+TRANSLATE("%q() without %q()")
+
+TRANSLATE("%q=%q")
+
+TRANSLATE("%s")
+
+TRANSLATE("'%q' argument required")
+
+TRANSLATE("'%q' object does not support '%q'")
+
+TRANSLATE("'%q' object isn't an iterator")
+
+TRANSLATE("'%q' object isn't an iterator")
+
+TRANSLATE("'%q' object isn't callable")
+
+TRANSLATE("'%q' object isn't callable")
+
+TRANSLATE("'%q' object isn't iterable")
+
+TRANSLATE("'%s' object doesn't support item assignment")
+
+TRANSLATE("'%s' object doesn't support item deletion")
+
+TRANSLATE("'%s' object has no attribute '%q'")
+
+TRANSLATE("'%s' object isn't subscriptable")
+
+TRANSLATE("'=' alignment not allowed in string format specifier")
+
+TRANSLATE("'S' and 'O' are not supported format types")
+
+TRANSLATE("'await' outside function")
+
+TRANSLATE("'break'/'continue' outside loop")
+
+TRANSLATE("'not' not implemented")
+
+TRANSLATE("'return' outside function")
+
+TRANSLATE("'yield from' inside async function")
+
+TRANSLATE("'yield' outside function")
+
+TRANSLATE("* arg after **")
+
+TRANSLATE("*x must be assignment target")
+
+TRANSLATE(", in %q\n")
+
+TRANSLATE(".show(x) removed. Use .root_group = x")
+
+TRANSLATE("0.0 to a complex power")
+
+TRANSLATE("An error occurred while retrieving '%s':\n")
+
+TRANSLATE("Below minimum frame rate")
+
+TRANSLATE("Bitmap size and bits per value must match")
+
+TRANSLATE("Brightness not adjustable")
+
+TRANSLATE("Brightness not adjustable")
+
+TRANSLATE("Buffer is not a bytearray.")
+
+TRANSLATE("Buffer too small")
+
+TRANSLATE("Buffer too small")
+
+TRANSLATE("Buffer too small")
+
+TRANSLATE("Buffer too small")
+
+TRANSLATE("CBC blocks must be multiples of 16 bytes")
+
+TRANSLATE("Call super().__init__() before accessing native object.")
+
+TRANSLATE("Cannot delete values")
+
+TRANSLATE("Cannot subclass slice")
+
+TRANSLATE("Coordinate arrays have different lengths")
+
+TRANSLATE("Coordinate arrays types have different sizes")
+
+TRANSLATE("Data format error (may be broken data)")
+
+TRANSLATE("Device error or wrong termination of input stream")
+
+TRANSLATE("Display must have a 16 bit colorspace.")
+
+TRANSLATE("Display rotation must be in 90 degree increments")
+
+TRANSLATE("During handling of the above exception, another exception occurred:")
+
+TRANSLATE("ECB only operates on 16 bytes at a time")
+
+TRANSLATE("Error in regex")
+
+TRANSLATE("File exists")
+
+TRANSLATE("For L8 colorspace, input bitmap must have 8 bits per pixel")
+
+TRANSLATE("For RGB colorspaces, input bitmap must have 16 bits per pixel")
+
+TRANSLATE("Format not supported")
+
+TRANSLATE("Group already used")
+
+TRANSLATE("Group already used")
+
+TRANSLATE("I/O operation on closed file")
+
+TRANSLATE("I/O operation on closed file")
+
+TRANSLATE("Input/output error")
+
+TRANSLATE("Insufficient memory pool for the image")
+
+TRANSLATE("Insufficient stream input buffer")
+
+TRANSLATE("Internal error")
+
+TRANSLATE("Interrupted by output function")
+
+TRANSLATE("Invalid %q")
+
+TRANSLATE("Invalid %q")
+
+TRANSLATE("Invalid argument")
+
+TRANSLATE("Invalid bits per value")
+
+TRANSLATE("Invalid format chunk size")
+
+TRANSLATE("Invalid format")
+
+TRANSLATE("Invalid unicode escape")
+
+TRANSLATE("Key must be 16, 24, or 32 bytes long")
+
+TRANSLATE("Key must be 16, 24, or 32 bytes long")
+
+TRANSLATE("LHS of keyword arg must be an id")
+
+TRANSLATE("Layer already in a group")
+
+TRANSLATE("Layer already in a group")
+
+TRANSLATE("Layer already in a group")
+
+TRANSLATE("Layer must be a Group or TileGrid subclass")
+
+TRANSLATE("Length of %q must be an even multiple of channel_count * type_size")
+
+TRANSLATE("Mask bitmap must have 8 bits per pixel")
+
+TRANSLATE("Mask bitmap size must match the other bitmaps")
+
+TRANSLATE("MicroPython .mpy file; use CircuitPython mpy-cross")
+
+TRANSLATE("Must be a %q subclass.")
+
+TRANSLATE("New bitmap must be same size as old bitmap")
+
+TRANSLATE("New bitmap must be same size as old bitmap")
+
+TRANSLATE("No space left on device")
+
+TRANSLATE("No such device")
+
+TRANSLATE("No such file/directory")
+
+TRANSLATE("Object has been deinitialized and can no longer be used. Create a new object.")
+
+TRANSLATE("Only Windows format, uncompressed BMP supported: given header size is %d")
+
+TRANSLATE("Only one color can be transparent at a time")
+
+TRANSLATE("Operation not permitted")
+
+TRANSLATE("Parameter error")
+
+TRANSLATE("Permission denied")
+
+TRANSLATE("Plus any modules on the filesystem\n")
+
+TRANSLATE("Polygon needs at least 3 points")
+
+TRANSLATE("RLE-compressed BMP not supported")
+
+TRANSLATE("Read-only filesystem")
+
+TRANSLATE("Read-only filesystem")
+
+TRANSLATE("Read-only")
+
+TRANSLATE("Read-only")
+
+TRANSLATE("Read-only")
+
+TRANSLATE("Read-only")
+
+TRANSLATE("Read-only")
+
+TRANSLATE("Read-only")
+
+TRANSLATE("Read-only")
+
+TRANSLATE("Requested AES mode is unsupported")
+
+TRANSLATE("Requested AES mode is unsupported")
+
+TRANSLATE("Right format but not supported")
+
+TRANSLATE("Slices not supported")
+
+TRANSLATE("Slices not supported")
+
+TRANSLATE("Slices not supported")
+
+TRANSLATE("Source and destination buffers must be the same length")
+
+TRANSLATE("Supply both or neither of %q and %q")
+
+TRANSLATE("The above exception was the direct cause of the following exception:")
+
+TRANSLATE("The sample's %q does not match")
+
+TRANSLATE("The sample's %q does not match")
+
+TRANSLATE("The sample's %q does not match")
+
+TRANSLATE("The sample's %q does not match")
+
+TRANSLATE("Tile height must exactly divide bitmap height")
+
+TRANSLATE("Tile index out of bounds")
+
+TRANSLATE("Tile index out of bounds")
+
+TRANSLATE("Tile index out of bounds")
+
+TRANSLATE("Tile width must exactly divide bitmap width")
+
+TRANSLATE("Too many displays")
+
+TRANSLATE("Traceback (most recent call last):\n")
+
+TRANSLATE("Unable to init parser")
+
+TRANSLATE("Unable to read color palette data")
+
+TRANSLATE("Unsupported JPEG (may be progressive)")
+
+TRANSLATE("Unsupported colorspace")
+
+TRANSLATE("Welcome to Adafruit CircuitPython %s!\n\nVisit circuitpython.org for more information.\n\nTo list built-in modules type `help(\"modules\")`.\n")
+
+TRANSLATE("__init__() should return None, not '%s'")
+
+TRANSLATE("__new__ arg must be a user-type")
+
+TRANSLATE("a bytes-like object is required")
+
+TRANSLATE("a bytes-like object is required")
+
+TRANSLATE("abort() called")
+
+TRANSLATE("annotation must be an identifier")
+
+TRANSLATE("arg is an empty sequence")
+
+TRANSLATE("arg must be user-type")
+
+TRANSLATE("arg must be user-type")
+
+TRANSLATE("argument name reused")
+
+TRANSLATE("array/bytes required on right side")
+
+TRANSLATE("async for/with outside async function")
+
+TRANSLATE("attributes not supported")
+
+TRANSLATE("background value out of range of target")
+
+TRANSLATE("bad compile mode")
+
+TRANSLATE("bad typecode")
+
+TRANSLATE("bad typecode")
+
+TRANSLATE("binary op %q not implemented")
+
+TRANSLATE("bitmap size and depth must match")
+
+TRANSLATE("bitmap sizes must match")
+
+TRANSLATE("bits must be 32 or less")
+
+TRANSLATE("bits_per_sample must be 16")
+
+TRANSLATE("bits_per_sample must be 8 or 16")
+
+TRANSLATE("bits_per_sample must be 8 or 16")
+
+TRANSLATE("bits_per_sample must be 8 or 16")
+
+TRANSLATE("bits_per_sample must be 8 or 16")
+
+TRANSLATE("bits_per_sample must be 8 or 16")
+
+TRANSLATE("bits_per_sample must be 8 or 16")
+
+TRANSLATE("bits_per_sample must be 8 or 16")
+
+TRANSLATE("bits_per_sample must be 8 or 16")
+
+TRANSLATE("bits_per_sample must be 8 or 16")
+
+TRANSLATE("bits_per_sample must be 8 or 16")
+
+TRANSLATE("buffer size must match format")
+
+TRANSLATE("buffer too small")
+
+TRANSLATE("bytecode overflow")
+
+TRANSLATE("bytes length not a multiple of item size")
+
+TRANSLATE("bytes value out of range")
+
+TRANSLATE("can only have one parent")
+
+TRANSLATE("can only have one parent")
+
+TRANSLATE("can only have one parent")
+
+TRANSLATE("can't add special method to already-subclassed class")
+
+TRANSLATE("can't assign to expression")
+
+TRANSLATE("can't assign to expression")
+
+TRANSLATE("can't assign to expression")
+
+TRANSLATE("can't cancel self")
+
+TRANSLATE("can't convert %q to %q")
+
+TRANSLATE("can't convert %s to complex")
+
+TRANSLATE("can't convert %s to float")
+
+TRANSLATE("can't convert %s to int")
+
+TRANSLATE("can't convert %s to int")
+
+TRANSLATE("can't convert %s to int")
+
+TRANSLATE("can't convert '%q' object to %q implicitly")
+
+TRANSLATE("can't create '%q' instances")
+
+TRANSLATE("can't declare nonlocal in outer code")
+
+TRANSLATE("can't delete expression")
+
+TRANSLATE("can't do binary op between '%q' and '%q'")
+
+TRANSLATE("can't do unary op of '%q'")
+
+TRANSLATE("can't implicitly convert '%q' to 'bool'")
+
+TRANSLATE("can't import name %q")
+
+TRANSLATE("can't load from '%q'")
+
+TRANSLATE("can't load from '%q'")
+
+TRANSLATE("can't load with '%q' index")
+
+TRANSLATE("can't perform relative import")
+
+TRANSLATE("can't send non-None value to a just-started generator")
+
+TRANSLATE("can't set attribute '%q'")
+
+TRANSLATE("can't set attribute")
+
+TRANSLATE("can't store '%q'")
+
+TRANSLATE("can't store '%q'")
+
+TRANSLATE("can't store to '%q'")
+
+TRANSLATE("can't store to '%q'")
+
+TRANSLATE("can't store with '%q' index")
+
+TRANSLATE("can't switch from automatic field numbering to manual field specification")
+
+TRANSLATE("can't switch from manual field specification to automatic field numbering")
+
+TRANSLATE("can't truncate-divide a complex number")
+
+TRANSLATE("can't wait")
+
+TRANSLATE("cannot emit native code for this architecture")
+
+TRANSLATE("casting")
+
+TRANSLATE("chr() arg not in range(0x110000)")
+
+TRANSLATE("clip point must be (x,y) tuple")
+
+TRANSLATE("color buffer must be 3 bytes (RGB) or 4 bytes (RGB + pad byte)")
+
+TRANSLATE("color buffer must be a buffer, tuple, list, or int")
+
+TRANSLATE("color buffer must be a bytearray or array of type 'b' or 'B'")
+
+TRANSLATE("color must be between 0x000000 and 0xffffff")
+
+TRANSLATE("comparison of int and uint")
+
+TRANSLATE("complex divide by zero")
+
+TRANSLATE("compression header")
+
+TRANSLATE("conversion to object")
+
+TRANSLATE("default 'except' must be last")
+
+TRANSLATE("dict update sequence has wrong length")
+
+TRANSLATE("div/mod not implemented for uint")
+
+TRANSLATE("divide by zero")
+
+TRANSLATE("division by zero")
+
+TRANSLATE("empty heap")
+
+TRANSLATE("empty heap")
+
+TRANSLATE("empty separator")
+
+TRANSLATE("empty separator")
+
+TRANSLATE("empty separator")
+
+TRANSLATE("empty")
+
+TRANSLATE("empty")
+
+TRANSLATE("en_US")
+
+TRANSLATE("end of format while looking for conversion specifier")
+
+TRANSLATE("exceptions must derive from BaseException")
+
+TRANSLATE("expected ':' after format specifier")
+
+TRANSLATE("expecting a dict for keyword args")
+
+TRANSLATE("expecting just a value for set")
+
+TRANSLATE("expecting key:value for dict")
+
+TRANSLATE("extra keyword arguments given")
+
+TRANSLATE("extra positional arguments given")
+
+TRANSLATE("file must be a file opened in byte mode")
+
+TRANSLATE("file must be a file opened in byte mode")
+
+TRANSLATE("file must be a file opened in byte mode")
+
+TRANSLATE("first argument to super() must be type")
+
+TRANSLATE("format needs a dict")
+
+TRANSLATE("format string didn't convert all arguments")
+
+TRANSLATE("format string needs more arguments")
+
+TRANSLATE("full")
+
+TRANSLATE("full")
+
+TRANSLATE("function doesn't take keyword arguments")
+
+TRANSLATE("function expected at most %d arguments, got %d")
+
+TRANSLATE("function got multiple values for argument '%q'")
+
+TRANSLATE("function got multiple values for argument '%q'")
+
+TRANSLATE("function missing %d required positional arguments")
+
+TRANSLATE("function missing keyword-only argument")
+
+TRANSLATE("function missing required keyword argument '%q'")
+
+TRANSLATE("function missing required positional argument #%d")
+
+TRANSLATE("function takes %d positional arguments but %d were given")
+
+TRANSLATE("generator already executing")
+
+TRANSLATE("generator already executing")
+
+TRANSLATE("generator ignored GeneratorExit")
+
+TRANSLATE("generator raised StopIteration")
+
+TRANSLATE("generator raised StopIteration")
+
+TRANSLATE("heap must be a list")
+
+TRANSLATE("identifier redefined as global")
+
+TRANSLATE("identifier redefined as nonlocal")
+
+TRANSLATE("import * not at module level")
+
+TRANSLATE("incompatible .mpy arch")
+
+TRANSLATE("incompatible .mpy file")
+
+TRANSLATE("incompatible .mpy file")
+
+TRANSLATE("incomplete format key")
+
+TRANSLATE("incomplete format")
+
+TRANSLATE("incorrect padding")
+
+TRANSLATE("index out of range")
+
+TRANSLATE("invalid bits_per_pixel %d, must be, 1, 2, 4, 8, 16, 24, or 32")
+
+TRANSLATE("invalid element size %d for bits_per_pixel %d\n")
+
+TRANSLATE("invalid element_size %d, must be, 1, 2, or 4")
+
+TRANSLATE("invalid exception")
+
+TRANSLATE("invalid format specifier")
+
+TRANSLATE("invalid micropython decorator")
+
+TRANSLATE("invalid micropython decorator")
+
+TRANSLATE("invalid mktime usage")
+
+TRANSLATE("invalid syntax for number")
+
+TRANSLATE("invalid syntax")
+
+TRANSLATE("invalid syntax")
+
+TRANSLATE("invalid syntax")
+
+TRANSLATE("issubclass() arg 1 must be a class")
+
+TRANSLATE("issubclass() arg 2 must be a class or a tuple of classes")
+
+TRANSLATE("join expects a list of str/bytes objects consistent with self object")
+
+TRANSLATE("keyword argument(s) not implemented - use normal args instead")
+
+TRANSLATE("lhs and rhs should be compatible")
+
+TRANSLATE("local '%q' has type '%q' but source is '%q'")
+
+TRANSLATE("local '%q' used before type known")
+
+TRANSLATE("local variable referenced before assignment")
+
+TRANSLATE("malformed f-string")
+
+TRANSLATE("math domain error")
+
+TRANSLATE("maximum recursion depth exceeded")
+
+TRANSLATE("memory allocation failed, allocating %u bytes")
+
+TRANSLATE("memory allocation failed, heap is locked")
+
+TRANSLATE("memoryview offset too large")
+
+TRANSLATE("memoryview: length is not a multiple of itemsize")
+
+TRANSLATE("mktime needs a tuple of length 8 or 9")
+
+TRANSLATE("module '%q' has no attribute '%q'")
+
+TRANSLATE("multiple *x in assignment")
+
+TRANSLATE("multiple bases have instance lay-out conflict")
+
+TRANSLATE("must raise an object")
+
+TRANSLATE("must use keyword argument for key function")
+
+TRANSLATE("name '%q' isn't defined")
+
+TRANSLATE("name too long")
+
+TRANSLATE("native code in .mpy unsupported")
+
+TRANSLATE("native yield")
+
+TRANSLATE("need more than %d values to unpack")
+
+TRANSLATE("need more than %d values to unpack")
+
+TRANSLATE("negative factorial")
+
+TRANSLATE("negative shift count")
+
+TRANSLATE("negative shift count")
+
+TRANSLATE("negative shift count")
+
+TRANSLATE("no active exception to reraise")
+
+TRANSLATE("no binding for nonlocal found")
+
+TRANSLATE("no module named '%q'")
+
+TRANSLATE("no such attribute")
+
+TRANSLATE("non-default argument follows default argument")
+
+TRANSLATE("non-hex digit")
+
+TRANSLATE("not a constant")
+
+TRANSLATE("object ")
+
+TRANSLATE("object '%s' isn't a tuple or list")
+
+TRANSLATE("object not in sequence")
+
+TRANSLATE("object not in sequence")
+
+TRANSLATE("object of type '%s' has no len()")
+
+TRANSLATE("object with buffer protocol required")
+
+TRANSLATE("only slices with step=1 (aka None) are supported")
+
+TRANSLATE("only slices with step=1 (aka None) are supported")
+
+TRANSLATE("only slices with step=1 (aka None) are supported")
+
+TRANSLATE("only slices with step=1 (aka None) are supported")
+
+TRANSLATE("opcode")
+
+TRANSLATE("ord() expected a character, but string of length %d found")
+
+TRANSLATE("out of range of target")
+
+TRANSLATE("out of range of target")
+
+TRANSLATE("out of range of target")
+
+TRANSLATE("out of range of target")
+
+TRANSLATE("out of range of target")
+
+TRANSLATE("out of range of target")
+
+TRANSLATE("overflow converting long int to machine word")
+
+TRANSLATE("overflow converting long int to machine word")
+
+TRANSLATE("pop from empty %q")
+
+TRANSLATE("pop from empty %q")
+
+TRANSLATE("pop from empty %q")
+
+TRANSLATE("positional arg after **")
+
+TRANSLATE("positional arg after keyword arg")
+
+TRANSLATE("pow() 3rd argument cannot be 0")
+
+TRANSLATE("pow() with 3 arguments requires integers")
+
+TRANSLATE("regex too complex")
+
+TRANSLATE("requested length %d but object has length %d")
+
+TRANSLATE("return expected '%q' but got '%q'")
+
+TRANSLATE("rsplit(None,n)")
+
+TRANSLATE("samples_signed must be true")
+
+TRANSLATE("schedule queue full")
+
+TRANSLATE("sign not allowed in string format specifier")
+
+TRANSLATE("sign not allowed with integer format specifier 'c'")
+
+TRANSLATE("small int overflow")
+
+TRANSLATE("source palette too large")
+
+TRANSLATE("source palette too large")
+
+TRANSLATE("source_bitmap must have value_count of 2 or 65536")
+
+TRANSLATE("source_bitmap must have value_count of 65536")
+
+TRANSLATE("source_bitmap must have value_count of 8")
+
+TRANSLATE("splitting with sub-captures")
+
+TRANSLATE("stream operation not supported")
+
+TRANSLATE("string argument without an encoding")
+
+TRANSLATE("string argument without an encoding")
+
+TRANSLATE("string index out of range")
+
+TRANSLATE("string index out of range")
+
+TRANSLATE("string indices must be integers, not %s")
+
+TRANSLATE("substring not found")
+
+TRANSLATE("substring not found")
+
+TRANSLATE("super() can't find self")
+
+TRANSLATE("syntax error in JSON")
+
+TRANSLATE("ticks interval overflow")
+
+TRANSLATE("too many args")
+
+TRANSLATE("too many values to unpack (expected %d)")
+
+TRANSLATE("type '%q' isn't an acceptable base type")
+
+TRANSLATE("type object '%q' has no attribute '%q'")
+
+TRANSLATE("type takes 1 or 3 arguments")
+
+TRANSLATE("unexpected indent")
+
+TRANSLATE("unexpected keyword argument '%q'")
+
+TRANSLATE("unexpected keyword argument '%q'")
+
+TRANSLATE("unexpected keyword argument '%q'")
+
+TRANSLATE("unicode name escapes")
+
+TRANSLATE("unindent doesn't match any outer indent level")
+
+TRANSLATE("unknown conversion specifier %c")
+
+TRANSLATE("unknown format code '%c' for object of type '%q'")
+
+TRANSLATE("unknown format code '%c' for object of type '%q'")
+
+TRANSLATE("unknown format code '%c' for object of type '%q'")
+
+TRANSLATE("unknown type '%q'")
+
+TRANSLATE("unmatched '%c' in format")
+
+TRANSLATE("unmatched '%c' in format")
+
+TRANSLATE("unreadable attribute")
+
+TRANSLATE("unreadable attribute")
+
+TRANSLATE("unreadable attribute")
+
+TRANSLATE("unsupported %q type")
+
+TRANSLATE("unsupported %q type")
+
+TRANSLATE("unsupported %q type")
+
+TRANSLATE("unsupported %q type")
+
+TRANSLATE("unsupported %q type")
+
+TRANSLATE("unsupported %q type")
+
+TRANSLATE("unsupported %q type")
+
+TRANSLATE("unsupported bitmap depth")
+
+TRANSLATE("unsupported bitmap depth")
+
+TRANSLATE("unsupported bitmap depth")
+
+TRANSLATE("unsupported bitmap depth")
+
+TRANSLATE("unsupported bitmap depth")
+
+TRANSLATE("unsupported bitmap depth")
+
+TRANSLATE("unsupported colorspace for dither")
+
+TRANSLATE("unsupported format character '%c' (0x%x) at index %d")
+
+TRANSLATE("unsupported type for %q: '%s'")
+
+TRANSLATE("unsupported types for %q: '%q', '%q'")
+
+TRANSLATE("value must fit in %d byte(s)")
+
+TRANSLATE("value must fit in %d byte(s)")
+
+TRANSLATE("value out of range of target")
+
+TRANSLATE("weights must be a sequence with an odd square number of elements (usually 9 or 25)")
+
+TRANSLATE("weights must be an object of type %q, %q, %q, or %q, not %q ")
+
+TRANSLATE("wrong number of arguments")
+
+TRANSLATE("wrong number of arguments")
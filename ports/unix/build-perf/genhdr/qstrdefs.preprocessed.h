@@ -0,0 +1,8763 @@
+# 0 "<stdin>"
+# 1 "/root/repo/ports/unix//"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "<stdin>"
+# 29 "<stdin>"
+# 1 "../../py/mpconfig.h" 1
+# 29 "../../py/mpconfig.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long int ptrdiff_t;
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long unsigned int size_t;
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef int wchar_t;
+# 30 "../../py/mpconfig.h" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 1 3 4
+# 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 3 4
+# 1 "/usr/include/stdint.h" 1 3 4
+# 26 "/usr/include/stdint.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+# 1 "/usr/include/features.h" 1 3 4
+# 392 "/usr/include/features.h" 3 4
+# 1 "/usr/include/features-time64.h" 1 3 4
+# 20 "/usr/include/features-time64.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 21 "/usr/include/features-time64.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 22 "/usr/include/features-time64.h" 2 3 4
+# 393 "/usr/include/features.h" 2 3 4
+# 489 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 1 3 4
+# 561 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 562 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 563 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 490 "/usr/include/features.h" 2 3 4
+# 513 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 2 3 4
+# 514 "/usr/include/features.h" 2 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 2 3 4
+# 27 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 28 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 29 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned char __u_char;
+typedef unsigned short int __u_short;
+typedef unsigned int __u_int;
+typedef unsigned long int __u_long;
+
+
+typedef signed char __int8_t;
+typedef unsigned char __uint8_t;
+typedef signed short int __int16_t;
+typedef unsigned short int __uint16_t;
+typedef signed int __int32_t;
+typedef unsigned int __uint32_t;
+
+typedef signed long int __int64_t;
+typedef unsigned long int __uint64_t;
+
+
+
+
+
+
+typedef __int8_t __int_least8_t;
+typedef __uint8_t __uint_least8_t;
+typedef __int16_t __int_least16_t;
+typedef __uint16_t __uint_least16_t;
+typedef __int32_t __int_least32_t;
+typedef __uint32_t __uint_least32_t;
+typedef __int64_t __int_least64_t;
+typedef __uint64_t __uint_least64_t;
+
+
+
+typedef long int __quad_t;
+typedef unsigned long int __u_quad_t;
+
+
+
+
+
+
+
+typedef long int __intmax_t;
+typedef unsigned long int __uintmax_t;
+# 141 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 1 3 4
+# 142 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/time64.h" 1 3 4
+# 143 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned long int __dev_t;
+typedef unsigned int __uid_t;
+typedef unsigned int __gid_t;
+typedef unsigned long int __ino_t;
+typedef unsigned long int __ino64_t;
+typedef unsigned int __mode_t;
+typedef unsigned long int __nlink_t;
+typedef long int __off_t;
+typedef long int __off64_t;
+typedef int __pid_t;
+typedef struct { int __val[2]; } __fsid_t;
+typedef long int __clock_t;
+typedef unsigned long int __rlim_t;
+typedef unsigned long int __rlim64_t;
+typedef unsigned int __id_t;
+typedef long int __time_t;
+typedef unsigned int __useconds_t;
+typedef long int __suseconds_t;
+typedef long int __suseconds64_t;
+
+typedef int __daddr_t;
+typedef int __key_t;
+
+
+typedef int __clockid_t;
+
+
+typedef void * __timer_t;
+
+
+typedef long int __blksize_t;
+
+
+
+
+typedef long int __blkcnt_t;
+typedef long int __blkcnt64_t;
+
+
+typedef unsigned long int __fsblkcnt_t;
+typedef unsigned long int __fsblkcnt64_t;
+
+
+typedef unsigned long int __fsfilcnt_t;
+typedef unsigned long int __fsfilcnt64_t;
+
+
+typedef long int __fsword_t;
+
+typedef long int __ssize_t;
+
+
+typedef long int __syscall_slong_t;
+
+typedef unsigned long int __syscall_ulong_t;
+
+
+
+typedef __off64_t __loff_t;
+typedef char *__caddr_t;
+
+
+typedef long int __intptr_t;
+
+
+typedef unsigned int __socklen_t;
+
+
+
+
+typedef int __sig_atomic_t;
+# 28 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wchar.h" 1 3 4
+# 29 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 30 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 3 4
+typedef __int8_t int8_t;
+typedef __int16_t int16_t;
+typedef __int32_t int32_t;
+typedef __int64_t int64_t;
+# 35 "/usr/include/stdint.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 3 4
+typedef __uint8_t uint8_t;
+typedef __uint16_t uint16_t;
+typedef __uint32_t uint32_t;
+typedef __uint64_t uint64_t;
+# 38 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+
+typedef __int_least8_t int_least8_t;
+typedef __int_least16_t int_least16_t;
+typedef __int_least32_t int_least32_t;
+typedef __int_least64_t int_least64_t;
+
+
+typedef __uint_least8_t uint_least8_t;
+typedef __uint_least16_t uint_least16_t;
+typedef __uint_least32_t uint_least32_t;
+typedef __uint_least64_t uint_least64_t;
+
+
+
+
+
+typedef signed char int_fast8_t;
+
+typedef long int int_fast16_t;
+typedef long int int_fast32_t;
+typedef long int int_fast64_t;
+# 71 "/usr/include/stdint.h" 3 4
+typedef unsigned char uint_fast8_t;
+
+typedef unsigned long int uint_fast16_t;
+typedef unsigned long int uint_fast32_t;
+typedef unsigned long int uint_fast64_t;
+# 87 "/usr/include/stdint.h" 3 4
+typedef long int intptr_t;
+
+
+typedef unsigned long int uintptr_t;
+# 101 "/usr/include/stdint.h" 3 4
+typedef __intmax_t intmax_t;
+typedef __uintmax_t uintmax_t;
+# 10 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 2 3 4
+# 31 "../../py/mpconfig.h" 2
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h" 1 3 4
+# 34 "/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/syslimits.h" 1 3 4
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h" 1 3 4
+# 203 "/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h" 3 4
+# 1 "/usr/include/limits.h" 1 3 4
+# 26 "/usr/include/limits.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/limits.h" 2 3 4
+# 195 "/usr/include/limits.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/posix1_lim.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/posix1_lim.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 28 "/usr/include/x86_64-linux-gnu/bits/posix1_lim.h" 2 3 4
+# 161 "/usr/include/x86_64-linux-gnu/bits/posix1_lim.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/local_lim.h" 1 3 4
+# 38 "/usr/include/x86_64-linux-gnu/bits/local_lim.h" 3 4
+# 1 "/usr/include/linux/limits.h" 1 3 4
+# 39 "/usr/include/x86_64-linux-gnu/bits/local_lim.h" 2 3 4
+# 81 "/usr/include/x86_64-linux-gnu/bits/local_lim.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h" 1 3 4
+# 29 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min.h" 1 3 4
+# 30 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h" 2 3 4
+# 82 "/usr/include/x86_64-linux-gnu/bits/local_lim.h" 2 3 4
+# 162 "/usr/include/x86_64-linux-gnu/bits/posix1_lim.h" 2 3 4
+# 196 "/usr/include/limits.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/posix2_lim.h" 1 3 4
+# 200 "/usr/include/limits.h" 2 3 4
+# 204 "/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h" 2 3 4
+# 8 "/usr/lib/gcc/x86_64-linux-gnu/12/include/syslimits.h" 2 3 4
+# 35 "/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h" 2 3 4
+# 36 "../../py/mpconfig.h" 2
+# 46 "../../py/mpconfig.h"
+# 1 "build-perf/genhdr/mpversion.h" 1
+# 47 "../../py/mpconfig.h" 2
+# 112 "../../py/mpconfig.h"
+# 1 "./mpconfigport.h" 1
+# 28 "./mpconfigport.h"
+       
+
+
+
+
+
+
+
+# 1 "/usr/include/time.h" 1 3 4
+# 29 "/usr/include/time.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 30 "/usr/include/time.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/time.h" 1 3 4
+# 34 "/usr/include/time.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h" 1 3 4
+
+
+
+
+
+
+typedef __clock_t clock_t;
+# 38 "/usr/include/time.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h" 3 4
+typedef __time_t time_t;
+# 39 "/usr/include/time.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_tm.h" 1 3 4
+
+
+
+
+
+
+struct tm
+{
+  int tm_sec;
+  int tm_min;
+  int tm_hour;
+  int tm_mday;
+  int tm_mon;
+  int tm_year;
+  int tm_wday;
+  int tm_yday;
+  int tm_isdst;
+
+
+  long int tm_gmtoff;
+  const char *tm_zone;
+
+
+
+
+};
+# 40 "/usr/include/time.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 1 3 4
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/endian.h" 1 3 4
+# 35 "/usr/include/x86_64-linux-gnu/bits/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/endianness.h" 1 3 4
+# 36 "/usr/include/x86_64-linux-gnu/bits/endian.h" 2 3 4
+# 7 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 2 3 4
+
+
+
+
+struct timespec
+{
+
+
+
+  __time_t tv_sec;
+
+
+
+
+  __syscall_slong_t tv_nsec;
+# 31 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 3 4
+};
+# 43 "/usr/include/time.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h" 1 3 4
+
+
+
+
+
+
+typedef __clockid_t clockid_t;
+# 47 "/usr/include/time.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h" 1 3 4
+
+
+
+
+
+
+typedef __timer_t timer_t;
+# 48 "/usr/include/time.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_itimerspec.h" 1 3 4
+
+
+
+
+
+
+
+struct itimerspec
+  {
+    struct timespec it_interval;
+    struct timespec it_value;
+  };
+# 49 "/usr/include/time.h" 2 3 4
+struct sigevent;
+
+
+
+
+typedef __pid_t pid_t;
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 3 4
+struct __locale_struct
+{
+
+  struct __locale_data *__locales[13];
+
+
+  const unsigned short int *__ctype_b;
+  const int *__ctype_tolower;
+  const int *__ctype_toupper;
+
+
+  const char *__names[13];
+};
+
+typedef struct __locale_struct *__locale_t;
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 2 3 4
+
+typedef __locale_t locale_t;
+# 61 "/usr/include/time.h" 2 3 4
+
+
+
+
+
+
+
+
+
+
+
+extern clock_t clock (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern time_t time (time_t *__timer) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double difftime (time_t __time1, time_t __time0)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern time_t mktime (struct tm *__tp) __attribute__ ((__nothrow__ , __leaf__));
+# 100 "/usr/include/time.h" 3 4
+extern size_t strftime (char *__restrict __s, size_t __maxsize,
+   const char *__restrict __format,
+   const struct tm *__restrict __tp) __attribute__ ((__nothrow__ , __leaf__));
+# 116 "/usr/include/time.h" 3 4
+extern size_t strftime_l (char *__restrict __s, size_t __maxsize,
+     const char *__restrict __format,
+     const struct tm *__restrict __tp,
+     locale_t __loc) __attribute__ ((__nothrow__ , __leaf__));
+# 132 "/usr/include/time.h" 3 4
+extern struct tm *gmtime (const time_t *__timer) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern struct tm *localtime (const time_t *__timer) __attribute__ ((__nothrow__ , __leaf__));
+# 154 "/usr/include/time.h" 3 4
+extern struct tm *gmtime_r (const time_t *__restrict __timer,
+       struct tm *__restrict __tp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern struct tm *localtime_r (const time_t *__restrict __timer,
+          struct tm *__restrict __tp) __attribute__ ((__nothrow__ , __leaf__));
+# 179 "/usr/include/time.h" 3 4
+extern char *asctime (const struct tm *__tp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern char *ctime (const time_t *__timer) __attribute__ ((__nothrow__ , __leaf__));
+# 197 "/usr/include/time.h" 3 4
+extern char *asctime_r (const struct tm *__restrict __tp,
+   char *__restrict __buf) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern char *ctime_r (const time_t *__restrict __timer,
+        char *__restrict __buf) __attribute__ ((__nothrow__ , __leaf__));
+# 217 "/usr/include/time.h" 3 4
+extern char *__tzname[2];
+extern int __daylight;
+extern long int __timezone;
+
+
+
+
+extern char *tzname[2];
+
+
+
+extern void tzset (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int daylight;
+extern long int timezone;
+# 246 "/usr/include/time.h" 3 4
+extern time_t timegm (struct tm *__tp) __attribute__ ((__nothrow__ , __leaf__));
+# 263 "/usr/include/time.h" 3 4
+extern time_t timelocal (struct tm *__tp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern int dysize (int __year) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+# 281 "/usr/include/time.h" 3 4
+extern int nanosleep (const struct timespec *__requested_time,
+        struct timespec *__remaining);
+
+
+extern int clock_getres (clockid_t __clock_id, struct timespec *__res) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int clock_gettime (clockid_t __clock_id, struct timespec *__tp)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+extern int clock_settime (clockid_t __clock_id, const struct timespec *__tp)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+# 323 "/usr/include/time.h" 3 4
+extern int clock_nanosleep (clockid_t __clock_id, int __flags,
+       const struct timespec *__req,
+       struct timespec *__rem);
+# 338 "/usr/include/time.h" 3 4
+extern int clock_getcpuclockid (pid_t __pid, clockid_t *__clock_id) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern int timer_create (clockid_t __clock_id,
+    struct sigevent *__restrict __evp,
+    timer_t *__restrict __timerid) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int timer_delete (timer_t __timerid) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int timer_settime (timer_t __timerid, int __flags,
+     const struct itimerspec *__restrict __value,
+     struct itimerspec *__restrict __ovalue) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int timer_gettime (timer_t __timerid, struct itimerspec *__value)
+     __attribute__ ((__nothrow__ , __leaf__));
+# 376 "/usr/include/time.h" 3 4
+extern int timer_getoverrun (timer_t __timerid) __attribute__ ((__nothrow__ , __leaf__));
+# 452 "/usr/include/time.h" 3 4
+
+# 37 "./mpconfigport.h" 2
+
+
+# 1 "/usr/include/unistd.h" 1 3 4
+# 27 "/usr/include/unistd.h" 3 4
+
+# 202 "/usr/include/unistd.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/posix_opt.h" 1 3 4
+# 203 "/usr/include/unistd.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/environments.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/environments.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/environments.h" 2 3 4
+# 207 "/usr/include/unistd.h" 2 3 4
+# 220 "/usr/include/unistd.h" 3 4
+typedef __ssize_t ssize_t;
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 227 "/usr/include/unistd.h" 2 3 4
+
+
+
+
+
+typedef __gid_t gid_t;
+
+
+
+
+typedef __uid_t uid_t;
+
+
+
+
+
+
+
+typedef __off64_t off_t;
+# 255 "/usr/include/unistd.h" 3 4
+typedef __useconds_t useconds_t;
+# 274 "/usr/include/unistd.h" 3 4
+typedef __socklen_t socklen_t;
+# 287 "/usr/include/unistd.h" 3 4
+extern int access (const char *__name, int __type) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 309 "/usr/include/unistd.h" 3 4
+extern int faccessat (int __fd, const char *__file, int __type, int __flag)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) ;
+# 342 "/usr/include/unistd.h" 3 4
+extern __off64_t lseek (int __fd, __off64_t __offset, int __whence) __asm__ ("" "lseek64") __attribute__ ((__nothrow__ , __leaf__))
+
+             ;
+# 358 "/usr/include/unistd.h" 3 4
+extern int close (int __fd);
+
+
+
+
+extern void closefrom (int __lowfd) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern ssize_t read (int __fd, void *__buf, size_t __nbytes)
+    __attribute__ ((__access__ (__write_only__, 2, 3)));
+
+
+
+
+
+extern ssize_t write (int __fd, const void *__buf, size_t __n)
+    __attribute__ ((__access__ (__read_only__, 2, 3)));
+# 404 "/usr/include/unistd.h" 3 4
+extern ssize_t pread (int __fd, void *__buf, size_t __nbytes, __off64_t __offset) __asm__ ("" "pread64")
+
+
+    __attribute__ ((__access__ (__write_only__, 2, 3)));
+extern ssize_t pwrite (int __fd, const void *__buf, size_t __nbytes, __off64_t __offset) __asm__ ("" "pwrite64")
+
+
+    __attribute__ ((__access__ (__read_only__, 2, 3)));
+# 437 "/usr/include/unistd.h" 3 4
+extern int pipe (int __pipedes[2]) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 452 "/usr/include/unistd.h" 3 4
+extern unsigned int alarm (unsigned int __seconds) __attribute__ ((__nothrow__ , __leaf__));
+# 464 "/usr/include/unistd.h" 3 4
+extern unsigned int sleep (unsigned int __seconds);
+
+
+
+
+
+
+
+extern __useconds_t ualarm (__useconds_t __value, __useconds_t __interval)
+     __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern int usleep (__useconds_t __useconds);
+# 489 "/usr/include/unistd.h" 3 4
+extern int pause (void);
+
+
+
+extern int chown (const char *__file, __uid_t __owner, __gid_t __group)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+extern int fchown (int __fd, __uid_t __owner, __gid_t __group) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int lchown (const char *__file, __uid_t __owner, __gid_t __group)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+
+
+extern int fchownat (int __fd, const char *__file, __uid_t __owner,
+       __gid_t __group, int __flag)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) ;
+
+
+
+extern int chdir (const char *__path) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+extern int fchdir (int __fd) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 531 "/usr/include/unistd.h" 3 4
+extern char *getcwd (char *__buf, size_t __size) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 545 "/usr/include/unistd.h" 3 4
+extern char *getwd (char *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) __attribute__ ((__deprecated__))
+    __attribute__ ((__access__ (__write_only__, 1)));
+
+
+
+
+extern int dup (int __fd) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern int dup2 (int __fd, int __fd2) __attribute__ ((__nothrow__ , __leaf__));
+# 564 "/usr/include/unistd.h" 3 4
+extern char **__environ;
+
+
+
+
+
+
+
+extern int execve (const char *__path, char *const __argv[],
+     char *const __envp[]) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern int fexecve (int __fd, char *const __argv[], char *const __envp[])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+
+extern int execv (const char *__path, char *const __argv[])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern int execle (const char *__path, const char *__arg, ...)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern int execl (const char *__path, const char *__arg, ...)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern int execvp (const char *__file, char *const __argv[])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern int execlp (const char *__file, const char *__arg, ...)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+# 619 "/usr/include/unistd.h" 3 4
+extern int nice (int __inc) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern void _exit (int __status) __attribute__ ((__noreturn__));
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/confname.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/confname.h" 3 4
+enum
+  {
+    _PC_LINK_MAX,
+
+    _PC_MAX_CANON,
+
+    _PC_MAX_INPUT,
+
+    _PC_NAME_MAX,
+
+    _PC_PATH_MAX,
+
+    _PC_PIPE_BUF,
+
+    _PC_CHOWN_RESTRICTED,
+
+    _PC_NO_TRUNC,
+
+    _PC_VDISABLE,
+
+    _PC_SYNC_IO,
+
+    _PC_ASYNC_IO,
+
+    _PC_PRIO_IO,
+
+    _PC_SOCK_MAXBUF,
+
+    _PC_FILESIZEBITS,
+
+    _PC_REC_INCR_XFER_SIZE,
+
+    _PC_REC_MAX_XFER_SIZE,
+
+    _PC_REC_MIN_XFER_SIZE,
+
+    _PC_REC_XFER_ALIGN,
+
+    _PC_ALLOC_SIZE_MIN,
+
+    _PC_SYMLINK_MAX,
+
+    _PC_2_SYMLINKS
+
+  };
+
+
+enum
+  {
+    _SC_ARG_MAX,
+
+    _SC_CHILD_MAX,
+
+    _SC_CLK_TCK,
+
+    _SC_NGROUPS_MAX,
+
+    _SC_OPEN_MAX,
+
+    _SC_STREAM_MAX,
+
+    _SC_TZNAME_MAX,
+
+    _SC_JOB_CONTROL,
+
+    _SC_SAVED_IDS,
+
+    _SC_REALTIME_SIGNALS,
+
+    _SC_PRIORITY_SCHEDULING,
+
+    _SC_TIMERS,
+
+    _SC_ASYNCHRONOUS_IO,
+
+    _SC_PRIORITIZED_IO,
+
+    _SC_SYNCHRONIZED_IO,
+
+    _SC_FSYNC,
+
+    _SC_MAPPED_FILES,
+
+    _SC_MEMLOCK,
+
+    _SC_MEMLOCK_RANGE,
+
+    _SC_MEMORY_PROTECTION,
+
+    _SC_MESSAGE_PASSING,
+
+    _SC_SEMAPHORES,
+
+    _SC_SHARED_MEMORY_OBJECTS,
+
+    _SC_AIO_LISTIO_MAX,
+
+    _SC_AIO_MAX,
+
+    _SC_AIO_PRIO_DELTA_MAX,
+
+    _SC_DELAYTIMER_MAX,
+
+    _SC_MQ_OPEN_MAX,
+
+    _SC_MQ_PRIO_MAX,
+
+    _SC_VERSION,
+
+    _SC_PAGESIZE,
+
+
+    _SC_RTSIG_MAX,
+
+    _SC_SEM_NSEMS_MAX,
+
+    _SC_SEM_VALUE_MAX,
+
+    _SC_SIGQUEUE_MAX,
+
+    _SC_TIMER_MAX,
+
+
+
+
+    _SC_BC_BASE_MAX,
+
+    _SC_BC_DIM_MAX,
+
+    _SC_BC_SCALE_MAX,
+
+    _SC_BC_STRING_MAX,
+
+    _SC_COLL_WEIGHTS_MAX,
+
+    _SC_EQUIV_CLASS_MAX,
+
+    _SC_EXPR_NEST_MAX,
+
+    _SC_LINE_MAX,
+
+    _SC_RE_DUP_MAX,
+
+    _SC_CHARCLASS_NAME_MAX,
+
+
+    _SC_2_VERSION,
+
+    _SC_2_C_BIND,
+
+    _SC_2_C_DEV,
+
+    _SC_2_FORT_DEV,
+
+    _SC_2_FORT_RUN,
+
+    _SC_2_SW_DEV,
+
+    _SC_2_LOCALEDEF,
+
+
+    _SC_PII,
+
+    _SC_PII_XTI,
+
+    _SC_PII_SOCKET,
+
+    _SC_PII_INTERNET,
+
+    _SC_PII_OSI,
+
+    _SC_POLL,
+
+    _SC_SELECT,
+
+    _SC_UIO_MAXIOV,
+
+    _SC_IOV_MAX = _SC_UIO_MAXIOV,
+
+    _SC_PII_INTERNET_STREAM,
+
+    _SC_PII_INTERNET_DGRAM,
+
+    _SC_PII_OSI_COTS,
+
+    _SC_PII_OSI_CLTS,
+
+    _SC_PII_OSI_M,
+
+    _SC_T_IOV_MAX,
+
+
+
+    _SC_THREADS,
+
+    _SC_THREAD_SAFE_FUNCTIONS,
+
+    _SC_GETGR_R_SIZE_MAX,
+
+    _SC_GETPW_R_SIZE_MAX,
+
+    _SC_LOGIN_NAME_MAX,
+
+    _SC_TTY_NAME_MAX,
+
+    _SC_THREAD_DESTRUCTOR_ITERATIONS,
+
+    _SC_THREAD_KEYS_MAX,
+
+    _SC_THREAD_STACK_MIN,
+
+    _SC_THREAD_THREADS_MAX,
+
+    _SC_THREAD_ATTR_STACKADDR,
+
+    _SC_THREAD_ATTR_STACKSIZE,
+
+    _SC_THREAD_PRIORITY_SCHEDULING,
+
+    _SC_THREAD_PRIO_INHERIT,
+
+    _SC_THREAD_PRIO_PROTECT,
+
+    _SC_THREAD_PROCESS_SHARED,
+
+
+    _SC_NPROCESSORS_CONF,
+
+    _SC_NPROCESSORS_ONLN,
+
+    _SC_PHYS_PAGES,
+
+    _SC_AVPHYS_PAGES,
+
+    _SC_ATEXIT_MAX,
+
+    _SC_PASS_MAX,
+
+
+    _SC_XOPEN_VERSION,
+
+    _SC_XOPEN_XCU_VERSION,
+
+    _SC_XOPEN_UNIX,
+
+    _SC_XOPEN_CRYPT,
+
+    _SC_XOPEN_ENH_I18N,
+
+    _SC_XOPEN_SHM,
+
+
+    _SC_2_CHAR_TERM,
+
+    _SC_2_C_VERSION,
+
+    _SC_2_UPE,
+
+
+    _SC_XOPEN_XPG2,
+
+    _SC_XOPEN_XPG3,
+
+    _SC_XOPEN_XPG4,
+
+
+    _SC_CHAR_BIT,
+
+    _SC_CHAR_MAX,
+
+    _SC_CHAR_MIN,
+
+    _SC_INT_MAX,
+
+    _SC_INT_MIN,
+
+    _SC_LONG_BIT,
+
+    _SC_WORD_BIT,
+
+    _SC_MB_LEN_MAX,
+
+    _SC_NZERO,
+
+    _SC_SSIZE_MAX,
+
+    _SC_SCHAR_MAX,
+
+    _SC_SCHAR_MIN,
+
+    _SC_SHRT_MAX,
+
+    _SC_SHRT_MIN,
+
+    _SC_UCHAR_MAX,
+
+    _SC_UINT_MAX,
+
+    _SC_ULONG_MAX,
+
+    _SC_USHRT_MAX,
+
+
+    _SC_NL_ARGMAX,
+
+    _SC_NL_LANGMAX,
+
+    _SC_NL_MSGMAX,
+
+    _SC_NL_NMAX,
+
+    _SC_NL_SETMAX,
+
+    _SC_NL_TEXTMAX,
+
+
+    _SC_XBS5_ILP32_OFF32,
+
+    _SC_XBS5_ILP32_OFFBIG,
+
+    _SC_XBS5_LP64_OFF64,
+
+    _SC_XBS5_LPBIG_OFFBIG,
+
+
+    _SC_XOPEN_LEGACY,
+
+    _SC_XOPEN_REALTIME,
+
+    _SC_XOPEN_REALTIME_THREADS,
+
+
+    _SC_ADVISORY_INFO,
+
+    _SC_BARRIERS,
+
+    _SC_BASE,
+
+    _SC_C_LANG_SUPPORT,
+
+    _SC_C_LANG_SUPPORT_R,
+
+    _SC_CLOCK_SELECTION,
+
+    _SC_CPUTIME,
+
+    _SC_THREAD_CPUTIME,
+
+    _SC_DEVICE_IO,
+
+    _SC_DEVICE_SPECIFIC,
+
+    _SC_DEVICE_SPECIFIC_R,
+
+    _SC_FD_MGMT,
+
+    _SC_FIFO,
+
+    _SC_PIPE,
+
+    _SC_FILE_ATTRIBUTES,
+
+    _SC_FILE_LOCKING,
+
+    _SC_FILE_SYSTEM,
+
+    _SC_MONOTONIC_CLOCK,
+
+    _SC_MULTI_PROCESS,
+
+    _SC_SINGLE_PROCESS,
+
+    _SC_NETWORKING,
+
+    _SC_READER_WRITER_LOCKS,
+
+    _SC_SPIN_LOCKS,
+
+    _SC_REGEXP,
+
+    _SC_REGEX_VERSION,
+
+    _SC_SHELL,
+
+    _SC_SIGNALS,
+
+    _SC_SPAWN,
+
+    _SC_SPORADIC_SERVER,
+
+    _SC_THREAD_SPORADIC_SERVER,
+
+    _SC_SYSTEM_DATABASE,
+
+    _SC_SYSTEM_DATABASE_R,
+
+    _SC_TIMEOUTS,
+
+    _SC_TYPED_MEMORY_OBJECTS,
+
+    _SC_USER_GROUPS,
+
+    _SC_USER_GROUPS_R,
+
+    _SC_2_PBS,
+
+    _SC_2_PBS_ACCOUNTING,
+
+    _SC_2_PBS_LOCATE,
+
+    _SC_2_PBS_MESSAGE,
+
+    _SC_2_PBS_TRACK,
+
+    _SC_SYMLOOP_MAX,
+
+    _SC_STREAMS,
+
+    _SC_2_PBS_CHECKPOINT,
+
+
+    _SC_V6_ILP32_OFF32,
+
+    _SC_V6_ILP32_OFFBIG,
+
+    _SC_V6_LP64_OFF64,
+
+    _SC_V6_LPBIG_OFFBIG,
+
+
+    _SC_HOST_NAME_MAX,
+
+    _SC_TRACE,
+
+    _SC_TRACE_EVENT_FILTER,
+
+    _SC_TRACE_INHERIT,
+
+    _SC_TRACE_LOG,
+
+
+    _SC_LEVEL1_ICACHE_SIZE,
+
+    _SC_LEVEL1_ICACHE_ASSOC,
+
+    _SC_LEVEL1_ICACHE_LINESIZE,
+
+    _SC_LEVEL1_DCACHE_SIZE,
+
+    _SC_LEVEL1_DCACHE_ASSOC,
+
+    _SC_LEVEL1_DCACHE_LINESIZE,
+
+    _SC_LEVEL2_CACHE_SIZE,
+
+    _SC_LEVEL2_CACHE_ASSOC,
+
+    _SC_LEVEL2_CACHE_LINESIZE,
+
+    _SC_LEVEL3_CACHE_SIZE,
+
+    _SC_LEVEL3_CACHE_ASSOC,
+
+    _SC_LEVEL3_CACHE_LINESIZE,
+
+    _SC_LEVEL4_CACHE_SIZE,
+
+    _SC_LEVEL4_CACHE_ASSOC,
+
+    _SC_LEVEL4_CACHE_LINESIZE,
+
+
+
+    _SC_IPV6 = _SC_LEVEL1_ICACHE_SIZE + 50,
+
+    _SC_RAW_SOCKETS,
+
+
+    _SC_V7_ILP32_OFF32,
+
+    _SC_V7_ILP32_OFFBIG,
+
+    _SC_V7_LP64_OFF64,
+
+    _SC_V7_LPBIG_OFFBIG,
+
+
+    _SC_SS_REPL_MAX,
+
+
+    _SC_TRACE_EVENT_NAME_MAX,
+
+    _SC_TRACE_NAME_MAX,
+
+    _SC_TRACE_SYS_MAX,
+
+    _SC_TRACE_USER_EVENT_MAX,
+
+
+    _SC_XOPEN_STREAMS,
+
+
+    _SC_THREAD_ROBUST_PRIO_INHERIT,
+
+    _SC_THREAD_ROBUST_PRIO_PROTECT,
+
+
+    _SC_MINSIGSTKSZ,
+
+
+    _SC_SIGSTKSZ
+
+  };
+
+
+enum
+  {
+    _CS_PATH,
+
+
+    _CS_V6_WIDTH_RESTRICTED_ENVS,
+
+
+
+    _CS_GNU_LIBC_VERSION,
+
+    _CS_GNU_LIBPTHREAD_VERSION,
+
+
+    _CS_V5_WIDTH_RESTRICTED_ENVS,
+
+
+
+    _CS_V7_WIDTH_RESTRICTED_ENVS,
+
+
+
+    _CS_LFS_CFLAGS = 1000,
+
+    _CS_LFS_LDFLAGS,
+
+    _CS_LFS_LIBS,
+
+    _CS_LFS_LINTFLAGS,
+
+    _CS_LFS64_CFLAGS,
+
+    _CS_LFS64_LDFLAGS,
+
+    _CS_LFS64_LIBS,
+
+    _CS_LFS64_LINTFLAGS,
+
+
+    _CS_XBS5_ILP32_OFF32_CFLAGS = 1100,
+
+    _CS_XBS5_ILP32_OFF32_LDFLAGS,
+
+    _CS_XBS5_ILP32_OFF32_LIBS,
+
+    _CS_XBS5_ILP32_OFF32_LINTFLAGS,
+
+    _CS_XBS5_ILP32_OFFBIG_CFLAGS,
+
+    _CS_XBS5_ILP32_OFFBIG_LDFLAGS,
+
+    _CS_XBS5_ILP32_OFFBIG_LIBS,
+
+    _CS_XBS5_ILP32_OFFBIG_LINTFLAGS,
+
+    _CS_XBS5_LP64_OFF64_CFLAGS,
+
+    _CS_XBS5_LP64_OFF64_LDFLAGS,
+
+    _CS_XBS5_LP64_OFF64_LIBS,
+
+    _CS_XBS5_LP64_OFF64_LINTFLAGS,
+
+    _CS_XBS5_LPBIG_OFFBIG_CFLAGS,
+
+    _CS_XBS5_LPBIG_OFFBIG_LDFLAGS,
+
+    _CS_XBS5_LPBIG_OFFBIG_LIBS,
+
+    _CS_XBS5_LPBIG_OFFBIG_LINTFLAGS,
+
+
+    _CS_POSIX_V6_ILP32_OFF32_CFLAGS,
+
+    _CS_POSIX_V6_ILP32_OFF32_LDFLAGS,
+
+    _CS_POSIX_V6_ILP32_OFF32_LIBS,
+
+    _CS_POSIX_V6_ILP32_OFF32_LINTFLAGS,
+
+    _CS_POSIX_V6_ILP32_OFFBIG_CFLAGS,
+
+    _CS_POSIX_V6_ILP32_OFFBIG_LDFLAGS,
+
+    _CS_POSIX_V6_ILP32_OFFBIG_LIBS,
+
+    _CS_POSIX_V6_ILP32_OFFBIG_LINTFLAGS,
+
+    _CS_POSIX_V6_LP64_OFF64_CFLAGS,
+
+    _CS_POSIX_V6_LP64_OFF64_LDFLAGS,
+
+    _CS_POSIX_V6_LP64_OFF64_LIBS,
+
+    _CS_POSIX_V6_LP64_OFF64_LINTFLAGS,
+
+    _CS_POSIX_V6_LPBIG_OFFBIG_CFLAGS,
+
+    _CS_POSIX_V6_LPBIG_OFFBIG_LDFLAGS,
+
+    _CS_POSIX_V6_LPBIG_OFFBIG_LIBS,
+
+    _CS_POSIX_V6_LPBIG_OFFBIG_LINTFLAGS,
+
+
+    _CS_POSIX_V7_ILP32_OFF32_CFLAGS,
+
+    _CS_POSIX_V7_ILP32_OFF32_LDFLAGS,
+
+    _CS_POSIX_V7_ILP32_OFF32_LIBS,
+
+    _CS_POSIX_V7_ILP32_OFF32_LINTFLAGS,
+
+    _CS_POSIX_V7_ILP32_OFFBIG_CFLAGS,
+
+    _CS_POSIX_V7_ILP32_OFFBIG_LDFLAGS,
+
+    _CS_POSIX_V7_ILP32_OFFBIG_LIBS,
+
+    _CS_POSIX_V7_ILP32_OFFBIG_LINTFLAGS,
+
+    _CS_POSIX_V7_LP64_OFF64_CFLAGS,
+
+    _CS_POSIX_V7_LP64_OFF64_LDFLAGS,
+
+    _CS_POSIX_V7_LP64_OFF64_LIBS,
+
+    _CS_POSIX_V7_LP64_OFF64_LINTFLAGS,
+
+    _CS_POSIX_V7_LPBIG_OFFBIG_CFLAGS,
+
+    _CS_POSIX_V7_LPBIG_OFFBIG_LDFLAGS,
+
+    _CS_POSIX_V7_LPBIG_OFFBIG_LIBS,
+
+    _CS_POSIX_V7_LPBIG_OFFBIG_LINTFLAGS,
+
+
+    _CS_V6_ENV,
+
+    _CS_V7_ENV
+
+  };
+# 631 "/usr/include/unistd.h" 2 3 4
+
+
+extern long int pathconf (const char *__path, int __name)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern long int fpathconf (int __fd, int __name) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long int sysconf (int __name) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern size_t confstr (int __name, char *__buf, size_t __len) __attribute__ ((__nothrow__ , __leaf__))
+    __attribute__ ((__access__ (__write_only__, 2, 3)));
+
+
+
+
+extern __pid_t getpid (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern __pid_t getppid (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern __pid_t getpgrp (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern __pid_t __getpgid (__pid_t __pid) __attribute__ ((__nothrow__ , __leaf__));
+
+extern __pid_t getpgid (__pid_t __pid) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern int setpgid (__pid_t __pid, __pid_t __pgid) __attribute__ ((__nothrow__ , __leaf__));
+# 682 "/usr/include/unistd.h" 3 4
+extern int setpgrp (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern __pid_t setsid (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern __pid_t getsid (__pid_t __pid) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern __uid_t getuid (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern __uid_t geteuid (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern __gid_t getgid (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern __gid_t getegid (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern int getgroups (int __size, __gid_t __list[]) __attribute__ ((__nothrow__ , __leaf__))
+    __attribute__ ((__access__ (__write_only__, 2, 1)));
+# 722 "/usr/include/unistd.h" 3 4
+extern int setuid (__uid_t __uid) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int setreuid (__uid_t __ruid, __uid_t __euid) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int seteuid (__uid_t __uid) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+extern int setgid (__gid_t __gid) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int setregid (__gid_t __rgid, __gid_t __egid) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int setegid (__gid_t __gid) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 778 "/usr/include/unistd.h" 3 4
+extern __pid_t fork (void) __attribute__ ((__nothrow__));
+
+
+
+
+
+
+
+extern __pid_t vfork (void) __attribute__ ((__nothrow__ , __leaf__));
+# 799 "/usr/include/unistd.h" 3 4
+extern char *ttyname (int __fd) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ttyname_r (int __fd, char *__buf, size_t __buflen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)))
+     __attribute__ ((__access__ (__write_only__, 2, 3)));
+
+
+
+extern int isatty (int __fd) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern int ttyslot (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern int link (const char *__from, const char *__to)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) ;
+
+
+
+
+extern int linkat (int __fromfd, const char *__from, int __tofd,
+     const char *__to, int __flags)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4))) ;
+
+
+
+
+extern int symlink (const char *__from, const char *__to)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) ;
+
+
+
+
+extern ssize_t readlink (const char *__restrict __path,
+    char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)))
+     __attribute__ ((__access__ (__write_only__, 2, 3)));
+
+
+
+
+
+extern int symlinkat (const char *__from, int __tofd,
+        const char *__to) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3))) ;
+
+
+extern ssize_t readlinkat (int __fd, const char *__restrict __path,
+      char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)))
+     __attribute__ ((__access__ (__write_only__, 3, 4)));
+
+
+
+extern int unlink (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int unlinkat (int __fd, const char *__name, int __flag)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern int rmdir (const char *__path) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern __pid_t tcgetpgrp (int __fd) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int tcsetpgrp (int __fd, __pid_t __pgrp_id) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern char *getlogin (void);
+
+
+
+
+
+
+
+extern int getlogin_r (char *__name, size_t __name_len) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+
+
+
+
+extern int setlogin (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/getopt_posix.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/getopt_posix.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/getopt_core.h" 1 3 4
+# 28 "/usr/include/x86_64-linux-gnu/bits/getopt_core.h" 3 4
+
+
+
+
+
+
+
+
+extern char *optarg;
+# 50 "/usr/include/x86_64-linux-gnu/bits/getopt_core.h" 3 4
+extern int optind;
+
+
+
+
+extern int opterr;
+
+
+
+extern int optopt;
+# 91 "/usr/include/x86_64-linux-gnu/bits/getopt_core.h" 3 4
+extern int getopt (int ___argc, char *const *___argv, const char *__shortopts)
+       __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+
+# 28 "/usr/include/x86_64-linux-gnu/bits/getopt_posix.h" 2 3 4
+
+
+# 49 "/usr/include/x86_64-linux-gnu/bits/getopt_posix.h" 3 4
+
+# 904 "/usr/include/unistd.h" 2 3 4
+
+
+
+
+
+
+
+extern int gethostname (char *__name, size_t __len) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+
+
+
+
+
+
+extern int sethostname (const char *__name, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) __attribute__ ((__access__ (__read_only__, 1, 2)));
+
+
+
+extern int sethostid (long int __id) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+extern int getdomainname (char *__name, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+     __attribute__ ((__access__ (__write_only__, 1, 2)));
+extern int setdomainname (const char *__name, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) __attribute__ ((__access__ (__read_only__, 1, 2)));
+
+
+
+
+extern int vhangup (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int revoke (const char *__file) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+
+
+
+extern int profil (unsigned short int *__sample_buffer, size_t __size,
+     size_t __offset, unsigned int __scale)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int acct (const char *__name) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern char *getusershell (void) __attribute__ ((__nothrow__ , __leaf__));
+extern void endusershell (void) __attribute__ ((__nothrow__ , __leaf__));
+extern void setusershell (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern int daemon (int __nochdir, int __noclose) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+extern int chroot (const char *__path) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+extern char *getpass (const char *__prompt) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+extern int fsync (int __fd);
+# 1002 "/usr/include/unistd.h" 3 4
+extern long int gethostid (void);
+
+
+extern void sync (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern int getpagesize (void) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern int getdtablesize (void) __attribute__ ((__nothrow__ , __leaf__));
+# 1030 "/usr/include/unistd.h" 3 4
+extern int truncate (const char *__file, __off64_t __length) __asm__ ("" "truncate64") __attribute__ ((__nothrow__ , __leaf__))
+
+                  __attribute__ ((__nonnull__ (1))) ;
+# 1052 "/usr/include/unistd.h" 3 4
+extern int ftruncate (int __fd, __off64_t __length) __asm__ ("" "ftruncate64") __attribute__ ((__nothrow__ , __leaf__))
+                        ;
+# 1070 "/usr/include/unistd.h" 3 4
+extern int brk (void *__addr) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+extern void *sbrk (intptr_t __delta) __attribute__ ((__nothrow__ , __leaf__));
+# 1091 "/usr/include/unistd.h" 3 4
+extern long int syscall (long int __sysno, ...) __attribute__ ((__nothrow__ , __leaf__));
+# 1117 "/usr/include/unistd.h" 3 4
+extern int lockf (int __fd, int __cmd, __off64_t __len) __asm__ ("" "lockf64")
+                       ;
+# 1150 "/usr/include/unistd.h" 3 4
+extern int fdatasync (int __fildes);
+# 1159 "/usr/include/unistd.h" 3 4
+extern char *crypt (const char *__key, const char *__salt)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+# 1198 "/usr/include/unistd.h" 3 4
+int getentropy (void *__buffer, size_t __length)
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+# 1218 "/usr/include/unistd.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/unistd_ext.h" 1 3 4
+# 1219 "/usr/include/unistd.h" 2 3 4
+
+
+# 40 "./mpconfigport.h" 2
+
+
+# 1 "/tmp/gate/perf/mpconfigvariant.h" 1
+# 34 "/tmp/gate/perf/mpconfigvariant.h"
+# 1 "/tmp/gate/perf/../mpconfigvariant_common.h" 1
+# 35 "/tmp/gate/perf/mpconfigvariant.h" 2
+# 43 "./mpconfigport.h" 2
+# 89 "./mpconfigport.h"
+
+# 89 "./mpconfigport.h"
+typedef long mp_off_t;
+# 98 "./mpconfigport.h"
+# 1 "/usr/include/alloca.h" 1 3 4
+# 24 "/usr/include/alloca.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 25 "/usr/include/alloca.h" 2 3 4
+
+
+
+
+
+
+
+
+# 32 "/usr/include/alloca.h" 3 4
+extern void *alloca (size_t __size) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+# 99 "./mpconfigport.h" 2
+# 180 "./mpconfigport.h"
+
+# 180 "./mpconfigport.h"
+extern const struct _mp_print_t mp_stderr_print;
+
+
+
+
+void mp_unix_alloc_exec(size_t min_size, void **ptr, size_t *size);
+void mp_unix_free_exec(void *ptr, size_t size);
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 193 "./mpconfigport.h" 2
+void mp_hal_get_random(size_t n, void *buf);
+static inline unsigned long mp_random_seed_init(void) {
+    unsigned long r;
+    mp_hal_get_random(sizeof(r), &r);
+    return r;
+}
+# 231 "./mpconfigport.h"
+# 1 "/usr/include/stdio.h" 1 3 4
+# 27 "/usr/include/stdio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 28 "/usr/include/stdio.h" 2 3 4
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 34 "/usr/include/stdio.h" 2 3 4
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 1 3 4
+# 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+
+# 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+typedef __builtin_va_list __gnuc_va_list;
+# 37 "/usr/include/stdio.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h" 1 3 4
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h" 1 3 4
+# 13 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h" 3 4
+typedef struct
+{
+  int __count;
+  union
+  {
+    unsigned int __wch;
+    char __wchb[4];
+  } __value;
+} __mbstate_t;
+# 6 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h" 2 3 4
+
+
+
+
+typedef struct _G_fpos_t
+{
+  __off_t __pos;
+  __mbstate_t __state;
+} __fpos_t;
+# 40 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h" 3 4
+typedef struct _G_fpos64_t
+{
+  __off64_t __pos;
+  __mbstate_t __state;
+} __fpos64_t;
+# 41 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__FILE.h" 1 3 4
+
+
+
+struct _IO_FILE;
+typedef struct _IO_FILE __FILE;
+# 42 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h" 1 3 4
+
+
+
+struct _IO_FILE;
+
+
+typedef struct _IO_FILE FILE;
+# 43 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h" 1 3 4
+# 35 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h" 3 4
+struct _IO_FILE;
+struct _IO_marker;
+struct _IO_codecvt;
+struct _IO_wide_data;
+
+
+
+
+typedef void _IO_lock_t;
+
+
+
+
+
+struct _IO_FILE
+{
+  int _flags;
+
+
+  char *_IO_read_ptr;
+  char *_IO_read_end;
+  char *_IO_read_base;
+  char *_IO_write_base;
+  char *_IO_write_ptr;
+  char *_IO_write_end;
+  char *_IO_buf_base;
+  char *_IO_buf_end;
+
+
+  char *_IO_save_base;
+  char *_IO_backup_base;
+  char *_IO_save_end;
+
+  struct _IO_marker *_markers;
+
+  struct _IO_FILE *_chain;
+
+  int _fileno;
+  int _flags2;
+  __off_t _old_offset;
+
+
+  unsigned short _cur_column;
+  signed char _vtable_offset;
+  char _shortbuf[1];
+
+  _IO_lock_t *_lock;
+
+
+
+
+
+
+
+  __off64_t _offset;
+
+  struct _IO_codecvt *_codecvt;
+  struct _IO_wide_data *_wide_data;
+  struct _IO_FILE *_freeres_list;
+  void *_freeres_buf;
+  size_t __pad5;
+  int _mode;
+
+  char _unused2[15 * sizeof (int) - 4 * sizeof (void *) - sizeof (size_t)];
+};
+# 44 "/usr/include/stdio.h" 2 3 4
+# 52 "/usr/include/stdio.h" 3 4
+typedef __gnuc_va_list va_list;
+# 86 "/usr/include/stdio.h" 3 4
+typedef __fpos64_t fpos_t;
+# 133 "/usr/include/stdio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdio_lim.h" 1 3 4
+# 134 "/usr/include/stdio.h" 2 3 4
+# 143 "/usr/include/stdio.h" 3 4
+extern FILE *stdin;
+extern FILE *stdout;
+extern FILE *stderr;
+
+
+
+
+
+
+extern int remove (const char *__filename) __attribute__ ((__nothrow__ , __leaf__));
+
+extern int rename (const char *__old, const char *__new) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int renameat (int __oldfd, const char *__old, int __newfd,
+       const char *__new) __attribute__ ((__nothrow__ , __leaf__));
+# 178 "/usr/include/stdio.h" 3 4
+extern int fclose (FILE *__stream);
+# 192 "/usr/include/stdio.h" 3 4
+extern FILE *tmpfile (void) __asm__ ("" "tmpfile64")
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 205 "/usr/include/stdio.h" 3 4
+extern char *tmpnam (char[20]) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern char *tmpnam_r (char __s[20]) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 222 "/usr/include/stdio.h" 3 4
+extern char *tempnam (const char *__dir, const char *__pfx)
+   __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (__builtin_free, 1)));
+
+
+
+
+
+
+extern int fflush (FILE *__stream);
+# 239 "/usr/include/stdio.h" 3 4
+extern int fflush_unlocked (FILE *__stream);
+# 270 "/usr/include/stdio.h" 3 4
+extern FILE *fopen (const char *__restrict __filename, const char *__restrict __modes) __asm__ ("" "fopen64")
+
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+extern FILE *freopen (const char *__restrict __filename, const char *__restrict __modes, FILE *__restrict __stream) __asm__ ("" "freopen64")
+
+
+  ;
+# 293 "/usr/include/stdio.h" 3 4
+extern FILE *fdopen (int __fd, const char *__modes) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 308 "/usr/include/stdio.h" 3 4
+extern FILE *fmemopen (void *__s, size_t __len, const char *__modes)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+
+
+
+
+extern FILE *open_memstream (char **__bufloc, size_t *__sizeloc) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 328 "/usr/include/stdio.h" 3 4
+extern void setbuf (FILE *__restrict __stream, char *__restrict __buf) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int setvbuf (FILE *__restrict __stream, char *__restrict __buf,
+      int __modes, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern void setbuffer (FILE *__restrict __stream, char *__restrict __buf,
+         size_t __size) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern void setlinebuf (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern int fprintf (FILE *__restrict __stream,
+      const char *__restrict __format, ...);
+
+
+
+
+extern int printf (const char *__restrict __format, ...);
+
+extern int sprintf (char *__restrict __s,
+      const char *__restrict __format, ...) __attribute__ ((__nothrow__));
+
+
+
+
+
+extern int vfprintf (FILE *__restrict __s, const char *__restrict __format,
+       __gnuc_va_list __arg);
+
+
+
+
+extern int vprintf (const char *__restrict __format, __gnuc_va_list __arg);
+
+extern int vsprintf (char *__restrict __s, const char *__restrict __format,
+       __gnuc_va_list __arg) __attribute__ ((__nothrow__));
+
+
+
+extern int snprintf (char *__restrict __s, size_t __maxlen,
+       const char *__restrict __format, ...)
+     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 3, 4)));
+
+extern int vsnprintf (char *__restrict __s, size_t __maxlen,
+        const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 3, 0)));
+# 403 "/usr/include/stdio.h" 3 4
+extern int vdprintf (int __fd, const char *__restrict __fmt,
+       __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__printf__, 2, 0)));
+extern int dprintf (int __fd, const char *__restrict __fmt, ...)
+     __attribute__ ((__format__ (__printf__, 2, 3)));
+
+
+
+
+
+
+
+extern int fscanf (FILE *__restrict __stream,
+     const char *__restrict __format, ...) ;
+
+
+
+
+extern int scanf (const char *__restrict __format, ...) ;
+
+extern int sscanf (const char *__restrict __s,
+     const char *__restrict __format, ...) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 1 3 4
+# 120 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 2 3 4
+# 121 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 2 3 4
+# 431 "/usr/include/stdio.h" 2 3 4
+
+
+
+extern int fscanf (FILE *__restrict __stream, const char *__restrict __format, ...) __asm__ ("" "__isoc99_fscanf")
+
+                               ;
+extern int scanf (const char *__restrict __format, ...) __asm__ ("" "__isoc99_scanf")
+                              ;
+extern int sscanf (const char *__restrict __s, const char *__restrict __format, ...) __asm__ ("" "__isoc99_sscanf") __attribute__ ((__nothrow__ , __leaf__))
+
+                      ;
+# 459 "/usr/include/stdio.h" 3 4
+extern int vfscanf (FILE *__restrict __s, const char *__restrict __format,
+      __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__scanf__, 2, 0))) ;
+
+
+
+
+
+extern int vscanf (const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__scanf__, 1, 0))) ;
+
+
+extern int vsscanf (const char *__restrict __s,
+      const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__format__ (__scanf__, 2, 0)));
+
+
+
+
+
+extern int vfscanf (FILE *__restrict __s, const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vfscanf")
+
+
+
+     __attribute__ ((__format__ (__scanf__, 2, 0))) ;
+extern int vscanf (const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vscanf")
+
+     __attribute__ ((__format__ (__scanf__, 1, 0))) ;
+extern int vsscanf (const char *__restrict __s, const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vsscanf") __attribute__ ((__nothrow__ , __leaf__))
+
+
+
+     __attribute__ ((__format__ (__scanf__, 2, 0)));
+# 513 "/usr/include/stdio.h" 3 4
+extern int fgetc (FILE *__stream);
+extern int getc (FILE *__stream);
+
+
+
+
+
+extern int getchar (void);
+
+
+
+
+
+
+extern int getc_unlocked (FILE *__stream);
+extern int getchar_unlocked (void);
+# 538 "/usr/include/stdio.h" 3 4
+extern int fgetc_unlocked (FILE *__stream);
+# 549 "/usr/include/stdio.h" 3 4
+extern int fputc (int __c, FILE *__stream);
+extern int putc (int __c, FILE *__stream);
+
+
+
+
+
+extern int putchar (int __c);
+# 565 "/usr/include/stdio.h" 3 4
+extern int fputc_unlocked (int __c, FILE *__stream);
+
+
+
+
+
+
+
+extern int putc_unlocked (int __c, FILE *__stream);
+extern int putchar_unlocked (int __c);
+
+
+
+
+
+
+extern int getw (FILE *__stream);
+
+
+extern int putw (int __w, FILE *__stream);
+
+
+
+
+
+
+
+extern char *fgets (char *__restrict __s, int __n, FILE *__restrict __stream)
+     __attribute__ ((__access__ (__write_only__, 1, 2)));
+# 605 "/usr/include/stdio.h" 3 4
+extern char *gets (char *__s) __attribute__ ((__deprecated__));
+# 632 "/usr/include/stdio.h" 3 4
+extern __ssize_t __getdelim (char **__restrict __lineptr,
+                             size_t *__restrict __n, int __delimiter,
+                             FILE *__restrict __stream) ;
+extern __ssize_t getdelim (char **__restrict __lineptr,
+                           size_t *__restrict __n, int __delimiter,
+                           FILE *__restrict __stream) ;
+
+
+
+
+
+
+
+extern __ssize_t getline (char **__restrict __lineptr,
+                          size_t *__restrict __n,
+                          FILE *__restrict __stream) ;
+
+
+
+
+
+
+
+extern int fputs (const char *__restrict __s, FILE *__restrict __stream);
+
+
+
+
+
+extern int puts (const char *__s);
+
+
+
+
+
+
+extern int ungetc (int __c, FILE *__stream);
+
+
+
+
+
+
+extern size_t fread (void *__restrict __ptr, size_t __size,
+       size_t __n, FILE *__restrict __stream) ;
+
+
+
+
+extern size_t fwrite (const void *__restrict __ptr, size_t __size,
+        size_t __n, FILE *__restrict __s);
+# 702 "/usr/include/stdio.h" 3 4
+extern size_t fread_unlocked (void *__restrict __ptr, size_t __size,
+         size_t __n, FILE *__restrict __stream) ;
+extern size_t fwrite_unlocked (const void *__restrict __ptr, size_t __size,
+          size_t __n, FILE *__restrict __stream);
+
+
+
+
+
+
+
+extern int fseek (FILE *__stream, long int __off, int __whence);
+
+
+
+
+extern long int ftell (FILE *__stream) ;
+
+
+
+
+extern void rewind (FILE *__stream);
+# 744 "/usr/include/stdio.h" 3 4
+extern int fseeko (FILE *__stream, __off64_t __off, int __whence) __asm__ ("" "fseeko64")
+
+                  ;
+extern __off64_t ftello (FILE *__stream) __asm__ ("" "ftello64");
+# 768 "/usr/include/stdio.h" 3 4
+extern int fgetpos (FILE *__restrict __stream, fpos_t *__restrict __pos) __asm__ ("" "fgetpos64")
+                                          ;
+extern int fsetpos (FILE *__stream, const fpos_t *__pos) __asm__ ("" "fsetpos64")
+                                                          ;
+# 786 "/usr/include/stdio.h" 3 4
+extern void clearerr (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+extern int feof (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+extern int ferror (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+extern void clearerr_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+extern int feof_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+extern int ferror_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+
+extern void perror (const char *__s);
+
+
+
+
+extern int fileno (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int fileno_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 823 "/usr/include/stdio.h" 3 4
+extern int pclose (FILE *__stream);
+
+
+
+
+
+extern FILE *popen (const char *__command, const char *__modes)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (pclose, 1))) ;
+
+
+
+
+
+
+extern char *ctermid (char *__s) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__access__ (__write_only__, 1)));
+# 867 "/usr/include/stdio.h" 3 4
+extern void flockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ftrylockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern void funlockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+# 885 "/usr/include/stdio.h" 3 4
+extern int __uflow (FILE *);
+extern int __overflow (FILE *, int);
+# 909 "/usr/include/stdio.h" 3 4
+
+# 232 "./mpconfigport.h" 2
+
+
+
+# 1 "/usr/include/sched.h" 1 3 4
+# 29 "/usr/include/sched.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 30 "/usr/include/sched.h" 2 3 4
+# 43 "/usr/include/sched.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/sched.h" 1 3 4
+# 80 "/usr/include/x86_64-linux-gnu/bits/sched.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_sched_param.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/struct_sched_param.h" 3 4
+struct sched_param
+{
+  int sched_priority;
+};
+# 81 "/usr/include/x86_64-linux-gnu/bits/sched.h" 2 3 4
+
+
+# 102 "/usr/include/x86_64-linux-gnu/bits/sched.h" 3 4
+
+# 44 "/usr/include/sched.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h" 1 3 4
+# 32 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h" 3 4
+typedef unsigned long int __cpu_mask;
+
+
+
+
+
+
+typedef struct
+{
+  __cpu_mask __bits[1024 / (8 * sizeof (__cpu_mask))];
+} cpu_set_t;
+# 115 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h" 3 4
+
+
+extern int __sched_cpucount (size_t __setsize, const cpu_set_t *__setp)
+     __attribute__ ((__nothrow__ , __leaf__));
+extern cpu_set_t *__sched_cpualloc (size_t __count) __attribute__ ((__nothrow__ , __leaf__)) ;
+extern void __sched_cpufree (cpu_set_t *__set) __attribute__ ((__nothrow__ , __leaf__));
+
+
+# 45 "/usr/include/sched.h" 2 3 4
+
+
+
+
+
+
+
+
+
+extern int sched_setparam (__pid_t __pid, const struct sched_param *__param)
+     __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_getparam (__pid_t __pid, struct sched_param *__param) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_setscheduler (__pid_t __pid, int __policy,
+          const struct sched_param *__param) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_getscheduler (__pid_t __pid) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_yield (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_get_priority_max (int __algorithm) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_get_priority_min (int __algorithm) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int sched_rr_get_interval (__pid_t __pid, struct timespec *__t) __attribute__ ((__nothrow__ , __leaf__));
+# 138 "/usr/include/sched.h" 3 4
+
+# 236 "./mpconfigport.h" 2
+# 113 "../../py/mpconfig.h" 2
+# 207 "../../py/mpconfig.h"
+
+# 207 "../../py/mpconfig.h"
+typedef intptr_t mp_int_t;
+
+
+
+typedef size_t mp_uint_t;
+# 1060 "../../py/mpconfig.h"
+typedef double mp_float_t;
+# 1177 "../../py/mpconfig.h"
+typedef time_t mp_timestamp_t;
+# 30 "<stdin>" 2
+
+
+
+
+
+QCFG(BYTES_IN_LEN, (1))
+QCFG(BYTES_IN_HASH, (2))
+
+
+
+Q()
+Q(*)
+Q(_)
+Q(/)
+
+Q(>>> )
+Q(... )
+
+
+Q(%#o)
+Q(%#x)
+
+
+
+
+Q({:#b})
+Q( )
+Q(\n)
+Q(<module>)
+Q(<lambda>)
+Q(<listcomp>)
+Q(<dictcomp>)
+Q(<setcomp>)
+Q(<genexpr>)
+Q(<string>)
+Q(<stdin>)
+Q(utf-8)
+
+
+Q(.frozen)
+# 98 "<stdin>"
+Q( )
+
+Q(%#o)
+
+Q(%#x)
+
+Q(*)
+
+Q(*)
+
+Q(*)
+
+Q(/)
+
+Q(/)
+
+Q(/)
+
+Q(/)
+
+Q(/)
+
+Q(/)
+
+Q(/)
+
+Q(/)
+
+Q(/)
+
+Q(<dictcomp>)
+
+Q(<dictcomp>)
+
+Q(<dictcomp>)
+
+Q(<genexpr>)
+
+Q(<genexpr>)
+
+Q(<genexpr>)
+
+Q(<input>)
+
+Q(<lambda>)
+
+Q(<lambda>)
+
+Q(<lambda>)
+
+Q(<listcomp>)
+
+Q(<listcomp>)
+
+Q(<listcomp>)
+
+Q(<module>)
+
+Q(<module>)
+
+Q(<module>)
+
+Q(<setcomp>)
+
+Q(<setcomp>)
+
+Q(<setcomp>)
+
+Q(<stdin>)
+
+Q(<stdin>)
+
+Q(<stdin>)
+
+Q(<stdin>)
+
+Q(<string>)
+
+Q(A)
+
+Q(A)
+
+Q(A)
+
+Q(ABS)
+
+Q(ABS)
+
+Q(ADD_DIV)
+
+Q(ADD_DIV)
+
+Q(ADD_SUB)
+
+Q(ADD_SUB)
+
+Q(AES)
+
+Q(AES)
+
+Q(AES)
+
+Q(ATTACK)
+
+Q(ATTACK)
+
+Q(ArithmeticError)
+
+Q(ArithmeticError)
+
+Q(AssertionError)
+
+Q(AssertionError)
+
+Q(AssertionError)
+
+Q(Atkinson)
+
+Q(Atkinson)
+
+Q(AttributeError)
+
+Q(AttributeError)
+
+Q(BAND_PASS)
+
+Q(BAND_PASS)
+
+Q(BGR555)
+
+Q(BGR555)
+
+Q(BGR555_SWAPPED)
+
+Q(BGR555_SWAPPED)
+
+Q(BGR565)
+
+Q(BGR565)
+
+Q(BGR565_SWAPPED)
+
+Q(BGR565_SWAPPED)
+
+Q(BaseException)
+
+Q(BaseException)
+
+Q(BaseException)
+
+Q(BaseException)
+
+Q(BaseException)
+
+Q(Biquad)
+
+Q(Biquad)
+
+Q(Biquad)
+
+Q(Biquad)
+
+Q(Biquad)
+
+Q(Bitmap)
+
+Q(Bitmap)
+
+Q(BlendMode)
+
+Q(BlendMode)
+
+Q(BlockInput)
+
+Q(BrokenPipeError)
+
+Q(BrokenPipeError)
+
+Q(BufferedWriter)
+
+Q(BufferedWriter)
+
+Q(BytesIO)
+
+Q(BytesIO)
+
+Q(BytesIO)
+
+Q(CLIP)
+
+Q(CLIP)
+
+Q(CONSTRAINED_LERP)
+
+Q(CONSTRAINED_LERP)
+
+Q(CancelledError)
+
+Q(ChannelMixer)
+
+Q(ChannelMixer)
+
+Q(ChannelMixer)
+
+Q(ChannelMixerOffset)
+
+Q(ChannelMixerOffset)
+
+Q(ChannelMixerOffset)
+
+Q(ChannelScale)
+
+Q(ChannelScale)
+
+Q(ChannelScaleOffset)
+
+Q(ChannelScaleOffset)
+
+Q(Chorus)
+
+Q(Chorus)
+
+Q(Circle)
+
+Q(Circle)
+
+Q(ColorConverter)
+
+Q(ColorConverter)
+
+Q(ColorSpace)
+
+Q(Colorspace)
+
+Q(ConnectionError)
+
+Q(ConnectionError)
+
+Q(DEBUG)
+
+Q(DECAY)
+
+Q(DECAY)
+
+Q(DIV_ADD)
+
+Q(DIV_ADD)
+
+Q(DecompIO)
+
+Q(DecompIO)
+
+Q(Distortion)
+
+Q(Distortion)
+
+Q(DistortionMode)
+
+Q(DistortionMode)
+
+Q(DitherAlgorithm)
+
+Q(DitherAlgorithm)
+
+Q(EACCES)
+
+Q(EACCES)
+
+Q(EADDRINUSE)
+
+Q(EADDRINUSE)
+
+Q(EAGAIN)
+
+Q(EAGAIN)
+
+Q(EALREADY)
+
+Q(EALREADY)
+
+Q(EBADF)
+
+Q(EBADF)
+
+Q(ECONNABORTED)
+
+Q(ECONNABORTED)
+
+Q(ECONNREFUSED)
+
+Q(ECONNREFUSED)
+
+Q(ECONNRESET)
+
+Q(ECONNRESET)
+
+Q(EEXIST)
+
+Q(EEXIST)
+
+Q(EHOSTUNREACH)
+
+Q(EHOSTUNREACH)
+
+Q(EINPROGRESS)
+
+Q(EINPROGRESS)
+
+Q(EINVAL)
+
+Q(EINVAL)
+
+Q(EIO)
+
+Q(EIO)
+
+Q(EISDIR)
+
+Q(EISDIR)
+
+Q(ENOBUFS)
+
+Q(ENOBUFS)
+
+Q(ENODEV)
+
+Q(ENODEV)
+
+Q(ENOENT)
+
+Q(ENOENT)
+
+Q(ENOMEM)
+
+Q(ENOMEM)
+
+Q(ENOSPC)
+
+Q(ENOSPC)
+
+Q(ENOTCONN)
+
+Q(ENOTCONN)
+
+Q(EOFError)
+
+Q(EOFError)
+
+Q(EOPNOTSUPP)
+
+Q(EOPNOTSUPP)
+
+Q(EPERM)
+
+Q(EPERM)
+
+Q(EROFS)
+
+Q(EROFS)
+
+Q(ETIMEDOUT)
+
+Q(ETIMEDOUT)
+
+Q(Echo)
+
+Q(Echo)
+
+Q(Ellipsis)
+
+Q(Ellipsis)
+
+Q(Envelope)
+
+Q(Envelope)
+
+Q(EnvelopeState)
+
+Q(EnvelopeState)
+
+Q(Exception)
+
+Q(Exception)
+
+Q(FileIO)
+
+Q(FileIO)
+
+Q(Filter)
+
+Q(Filter)
+
+Q(FilterMode)
+
+Q(FilterMode)
+
+Q(Flanger)
+
+Q(Flanger)
+
+Q(FloydStenberg)
+
+Q(FloydStenberg)
+
+Q(Framebuffer)
+
+Q(Framebuffer)
+
+Q(FramebufferDisplay)
+
+Q(FramebufferDisplay)
+
+Q(Freeverb)
+
+Q(GeneratorExit)
+
+Q(GeneratorExit)
+
+Q(GranularPitchShift)
+
+Q(GranularPitchShift)
+
+Q(Group)
+
+Q(Group)
+
+Q(Group)
+
+Q(HIGH_PASS)
+
+Q(HIGH_PASS)
+
+Q(HIGH_SHELF)
+
+Q(HIGH_SHELF)
+
+Q(IOBase)
+
+Q(IOBase)
+
+Q(IV)
+
+Q(IV)
+
+Q(IV)
+
+Q(IV)
+
+Q(ImportError)
+
+Q(ImportError)
+
+Q(IndentationError)
+
+Q(IndentationError)
+
+Q(IndexError)
+
+Q(IndexError)
+
+Q(JpegDecoder)
+
+Q(JpegDecoder)
+
+Q(KeyError)
+
+Q(KeyError)
+
+Q(KeyboardInterrupt)
+
+Q(KeyboardInterrupt)
+
+Q(L8)
+
+Q(L8)
+
+Q(LERP)
+
+Q(LERP)
+
+Q(LFO)
+
+Q(LFO)
+
+Q(LOFI)
+
+Q(LOFI)
+
+Q(LOW_PASS)
+
+Q(LOW_PASS)
+
+Q(LOW_SHELF)
+
+Q(LOW_SHELF)
+
+Q(LockType)
+
+Q(LookupError)
+
+Q(LookupError)
+
+Q(MAX)
+
+Q(MAX)
+
+Q(MID)
+
+Q(MID)
+
+Q(MIN)
+
+Q(MIN)
+
+Q(MODE_CBC)
+
+Q(MODE_CTR)
+
+Q(MODE_ECB)
+
+Q(MUL_DIV)
+
+Q(MUL_DIV)
+
+Q(Math)
+
+Q(Math)
+
+Q(MathOperation)
+
+Q(MathOperation)
+
+Q(MemoryError)
+
+Q(MemoryError)
+
+Q(MidiTrack)
+
+Q(MidiTrack)
+
+Q(Mixer)
+
+Q(Mixer)
+
+Q(MixerVoice)
+
+Q(MultiTapDelay)
+
+Q(MultiTapDelay)
+
+Q(NONE)
+
+Q(NONE)
+
+Q(NOTCH)
+
+Q(NOTCH)
+
+Q(NameError)
+
+Q(NameError)
+
+Q(NativeBaseClass)
+
+Q(NativeBaseClass)
+
+Q(None)
+
+Q(None)
+
+Q(None)
+
+Q(None)
+
+Q(None)
+
+Q(NoneType)
+
+Q(NoneType)
+
+Q(Normal)
+
+Q(Normal)
+
+Q(NotImplemented)
+
+Q(NotImplemented)
+
+Q(NotImplementedError)
+
+Q(NotImplementedError)
+
+Q(Note)
+
+Q(Note)
+
+Q(Note)
+
+Q(OFFSET_SCALE)
+
+Q(OFFSET_SCALE)
+
+Q(OLDEST)
+
+Q(OLDEST)
+
+Q(OSError)
+
+Q(OSError)
+
+Q(OVERDRIVE)
+
+Q(OVERDRIVE)
+
+Q(OnDiskBitmap)
+
+Q(OnDiskBitmap)
+
+Q(OrderedDict)
+
+Q(OrderedDict)
+
+Q(OrderedDict)
+
+Q(OverflowError)
+
+Q(OverflowError)
+
+Q(PEAKING_EQ)
+
+Q(PEAKING_EQ)
+
+Q(POLLERR)
+
+Q(POLLHUP)
+
+Q(POLLIN)
+
+Q(POLLOUT)
+
+Q(PRODUCT)
+
+Q(PRODUCT)
+
+Q(Palette)
+
+Q(Palette)
+
+Q(Phaser)
+
+Q(Phaser)
+
+Q(PitchShift)
+
+Q(PitchShift)
+
+Q(Polygon)
+
+Q(Polygon)
+
+Q(Q)
+
+Q(Q)
+
+Q(Q)
+
+Q(QUIETEST)
+
+Q(QUIETEST)
+
+Q(RELEASE)
+
+Q(RELEASE)
+
+Q(RGB555)
+
+Q(RGB555)
+
+Q(RGB555_SWAPPED)
+
+Q(RGB555_SWAPPED)
+
+Q(RGB565)
+
+Q(RGB565)
+
+Q(RGB565_SWAPPED)
+
+Q(RGB565_SWAPPED)
+
+Q(RGB888)
+
+Q(RGB888)
+
+Q(RawSample)
+
+Q(RawSample)
+
+Q(ReadableBuffer)
+
+Q(ReadableBuffer)
+
+Q(Rectangle)
+
+Q(Rectangle)
+
+Q(ReloadException)
+
+Q(ReloadException)
+
+Q(RuntimeError)
+
+Q(RuntimeError)
+
+Q(SCALE_OFFSET)
+
+Q(SCALE_OFFSET)
+
+Q(SUM)
+
+Q(SUM)
+
+Q(SUSTAIN)
+
+Q(SUSTAIN)
+
+Q(ScaleMixer)
+
+Q(ScaleMixerOffset)
+
+Q(Screen)
+
+Q(Screen)
+
+Q(Sequence)
+
+Q(StopAsyncIteration)
+
+Q(StopAsyncIteration)
+
+Q(StopAsyncIteration)
+
+Q(StopIteration)
+
+Q(StopIteration)
+
+Q(StringIO)
+
+Q(StringIO)
+
+Q(SyntaxError)
+
+Q(SyntaxError)
+
+Q(Synthesizer)
+
+Q(Synthesizer)
+
+Q(SystemExit)
+
+Q(SystemExit)
+
+Q(Task)
+
+Q(Task)
+
+Q(TaskQueue)
+
+Q(TaskQueue)
+
+Q(TextIOWrapper)
+
+Q(TextIOWrapper)
+
+Q(TileGrid)
+
+Q(TileGrid)
+
+Q(TimeoutError)
+
+Q(TimeoutError)
+
+Q(True)
+
+Q(True)
+
+Q(True)
+
+Q(True)
+
+Q(TypeError)
+
+Q(TypeError)
+
+Q(UnicodeError)
+
+Q(UnicodeError)
+
+Q(ValueError)
+
+Q(ValueError)
+
+Q(VectorShape)
+
+Q(VfsFat)
+
+Q(VfsFat)
+
+Q(VfsPosix)
+
+Q(VfsPosix)
+
+Q(ViperTypeError)
+
+Q(ViperTypeError)
+
+Q(VoiceStealing)
+
+Q(VoiceStealing)
+
+Q(WAVESHAPE)
+
+Q(WAVESHAPE)
+
+Q(WaveFile)
+
+Q(WaveFile)
+
+Q(WritableBuffer)
+
+Q(ZeroDivisionError)
+
+Q(ZeroDivisionError)
+
+Q(_)
+
+Q(_0x0a_)
+
+Q(__abs__)
+
+Q(__add__)
+
+Q(__aenter__)
+
+Q(__aenter__)
+
+Q(__aexit__)
+
+Q(__aexit__)
+
+Q(__aiter__)
+
+Q(__all__)
+
+Q(__and__)
+
+Q(__anext__)
+
+Q(__await__)
+
+Q(__await__)
+
+Q(__await__)
+
+Q(__bases__)
+
+Q(__bool__)
+
+Q(__build_class__)
+
+Q(__build_class__)
+
+Q(__bytes__)
+
+Q(__call__)
+
+Q(__cause__)
+
+Q(__cause__)
+
+Q(__cause__)
+
+Q(__cause__)
+
+Q(__class__)
+
+Q(__class__)
+
+Q(__class__)
+
+Q(__class__)
+
+Q(__class__)
+
+Q(__class__)
+
+Q(__class__)
+
+Q(__code__)
+
+Q(__complex__)
+
+Q(__contains__)
+
+Q(__contains__)
+
+Q(__contains__)
+
+Q(__context__)
+
+Q(__context__)
+
+Q(__context__)
+
+Q(__context__)
+
+Q(__context__)
+
+Q(__context__)
+
+Q(__context__)
+
+Q(__del__)
+
+Q(__del__)
+
+Q(__del__)
+
+Q(__del__)
+
+Q(__delattr__)
+
+Q(__delattr__)
+
+Q(__delattr__)
+
+Q(__delattr__)
+
+Q(__delete__)
+
+Q(__delete__)
+
+Q(__delete__)
+
+Q(__delitem__)
+
+Q(__delitem__)
+
+Q(__dict__)
+
+Q(__dict__)
+
+Q(__dict__)
+
+Q(__dir__)
+
+Q(__divmod__)
+
+Q(__enter__)
+
+Q(__enter__)
+
+Q(__enter__)
+
+Q(__enter__)
+
+Q(__enter__)
+
+Q(__enter__)
+
+Q(__enter__)
+
+Q(__enter__)
+
+Q(__enter__)
+
+Q(__enter__)
+
+Q(__enter__)
+
+Q(__enter__)
+
+Q(__enter__)
+
+Q(__enter__)
+
+Q(__enter__)
+
+Q(__enter__)
+
+Q(__enter__)
+
+Q(__enter__)
+
+Q(__enter__)
+
+Q(__enter__)
+
+Q(__enter__)
+
+Q(__eq__)
+
+Q(__eq__)
+
+Q(__exit__)
+
+Q(__exit__)
+
+Q(__exit__)
+
+Q(__exit__)
+
+Q(__exit__)
+
+Q(__exit__)
+
+Q(__exit__)
+
+Q(__exit__)
+
+Q(__exit__)
+
+Q(__exit__)
+
+Q(__exit__)
+
+Q(__exit__)
+
+Q(__exit__)
+
+Q(__exit__)
+
+Q(__exit__)
+
+Q(__exit__)
+
+Q(__exit__)
+
+Q(__exit__)
+
+Q(__exit__)
+
+Q(__exit__)
+
+Q(__exit__)
+
+Q(__file__)
+
+Q(__file__)
+
+Q(__file__)
+
+Q(__file__)
+
+Q(__file__)
+
+Q(__float__)
+
+Q(__floordiv__)
+
+Q(__future__)
+
+Q(__future__)
+
+Q(__ge__)
+
+Q(__get__)
+
+Q(__get__)
+
+Q(__get__)
+
+Q(__get__)
+
+Q(__getattr__)
+
+Q(__getattr__)
+
+Q(__getattr__)
+
+Q(__getattr__)
+
+Q(__getitem__)
+
+Q(__getitem__)
+
+Q(__getitem__)
+
+Q(__getitem__)
+
+Q(__globals__)
+
+Q(__gt__)
+
+Q(__hash__)
+
+Q(__iadd__)
+
+Q(__iand__)
+
+Q(__ifloordiv__)
+
+Q(__ilshift__)
+
+Q(__imatmul__)
+
+Q(__imod__)
+
+Q(__import__)
+
+Q(__import__)
+
+Q(__imul__)
+
+Q(__init__)
+
+Q(__init__)
+
+Q(__init__)
+
+Q(__init__)
+
+Q(__init__)
+
+Q(__int__)
+
+Q(__invert__)
+
+Q(__ior__)
+
+Q(__ipow__)
+
+Q(__irshift__)
+
+Q(__isub__)
+
+Q(__iter__)
+
+Q(__itruediv__)
+
+Q(__ixor__)
+
+Q(__le__)
+
+Q(__len__)
+
+Q(__lshift__)
+
+Q(__lt__)
+
+Q(__main__)
+
+Q(__main__)
+
+Q(__main__)
+
+Q(__main__)
+
+Q(__main__)
+
+Q(__main__)
+
+Q(__main__)
+
+Q(__matmul__)
+
+Q(__mod__)
+
+Q(__module__)
+
+Q(__mul__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__ne__)
+
+Q(__neg__)
+
+Q(__new__)
+
+Q(__new__)
+
+Q(__new__)
+
+Q(__next__)
+
+Q(__next__)
+
+Q(__next__)
+
+Q(__next__)
+
+Q(__or__)
+
+Q(__path__)
+
+Q(__path__)
+
+Q(__path__)
+
+Q(__path__)
+
+Q(__path__)
+
+Q(__pos__)
+
+Q(__pow__)
+
+Q(__qualname__)
+
+Q(__radd__)
+
+Q(__rand__)
+
+Q(__repl_print__)
+
+Q(__repl_print__)
+
+Q(__repr__)
+
+Q(__repr__)
+
+Q(__reversed__)
+
+Q(__rfloordiv__)
+
+Q(__rlshift__)
+
+Q(__rmatmul__)
+
+Q(__rmod__)
+
+Q(__rmul__)
+
+Q(__ror__)
+
+Q(__rpow__)
+
+Q(__rrshift__)
+
+Q(__rshift__)
+
+Q(__rsub__)
+
+Q(__rtruediv__)
+
+Q(__rxor__)
+
+Q(__set__)
+
+Q(__set__)
+
+Q(__set__)
+
+Q(__set_name__)
+
+Q(__set_name__)
+
+Q(__setattr__)
+
+Q(__setattr__)
+
+Q(__setattr__)
+
+Q(__setattr__)
+
+Q(__setitem__)
+
+Q(__setitem__)
+
+Q(__sizeof__)
+
+Q(__str__)
+
+Q(__sub__)
+
+Q(__suppress_context__)
+
+Q(__suppress_context__)
+
+Q(__traceback__)
+
+Q(__traceback__)
+
+Q(__truediv__)
+
+Q(__xor__)
+
+Q(_asdict)
+
+Q(_asyncio)
+
+Q(_asyncio)
+
+Q(_build)
+
+Q(_dot__dot__dot_ )
+
+Q(_fill_area)
+
+Q(_gt__gt__gt_ )
+
+Q(_machine)
+
+Q(_mpy)
+
+Q(_task_queue)
+
+Q(_thread)
+
+Q(_thread)
+
+Q(_thread)
+
+Q(a)
+
+Q(a)
+
+Q(a)
+
+Q(a2b_base64)
+
+Q(abs)
+
+Q(abs_tol)
+
+Q(acos)
+
+Q(acosh)
+
+Q(acquire)
+
+Q(add)
+
+Q(add)
+
+Q(aesio)
+
+Q(aesio)
+
+Q(algorithm)
+
+Q(algorithm)
+
+Q(all)
+
+Q(allocate_lock)
+
+Q(alphablend)
+
+Q(amplitude)
+
+Q(amplitude)
+
+Q(amplitude)
+
+Q(angle)
+
+Q(annotations)
+
+Q(any)
+
+Q(append)
+
+Q(append)
+
+Q(append)
+
+Q(append)
+
+Q(append)
+
+Q(appendleft)
+
+Q(arg)
+
+Q(args)
+
+Q(argv)
+
+Q(array)
+
+Q(array)
+
+Q(array)
+
+Q(array)
+
+Q(arrayblit)
+
+Q(asin)
+
+Q(asinh)
+
+Q(atan)
+
+Q(atan2)
+
+Q(atanh)
+
+Q(atexit)
+
+Q(attack_level)
+
+Q(attack_level)
+
+Q(attack_level)
+
+Q(attack_time)
+
+Q(attack_time)
+
+Q(attack_time)
+
+Q(audiocore)
+
+Q(audiocore)
+
+Q(audiodelays)
+
+Q(audiodelays)
+
+Q(audiofilters)
+
+Q(audiofilters)
+
+Q(audiofilters)
+
+Q(audiofreeverb)
+
+Q(audiofreeverb)
+
+Q(audiomixer)
+
+Q(audiomixer)
+
+Q(auto_refresh)
+
+Q(auto_refresh)
+
+Q(b)
+
+Q(b)
+
+Q(b)
+
+Q(b)
+
+Q(b)
+
+Q(b2a_base64)
+
+Q(b_add)
+
+Q(b_add)
+
+Q(base)
+
+Q(bb)
+
+Q(bb)
+
+Q(bend)
+
+Q(bend)
+
+Q(bend)
+
+Q(bg)
+
+Q(bg)
+
+Q(big)
+
+Q(big)
+
+Q(big)
+
+Q(bin)
+
+Q(binascii)
+
+Q(binascii)
+
+Q(bit_length)
+
+Q(bitmap)
+
+Q(bitmap)
+
+Q(bitmap)
+
+Q(bitmap)
+
+Q(bitmap)
+
+Q(bitmap)
+
+Q(bitmap)
+
+Q(bitmap)
+
+Q(bitmap)
+
+Q(bitmap)
+
+Q(bitmap)
+
+Q(bitmap)
+
+Q(bitmap)
+
+Q(bitmap)
+
+Q(bitmap)
+
+Q(bitmap)
+
+Q(bitmap)
+
+Q(bitmap)
+
+Q(bitmap)
+
+Q(bitmap)
+
+Q(bitmap)
+
+Q(bitmap)
+
+Q(bitmapfilter)
+
+Q(bitmapfilter)
+
+Q(bitmaptools)
+
+Q(bitmaptools)
+
+Q(bitmaptools)
+
+Q(bitmaptools)
+
+Q(bits_per_pixel)
+
+Q(bits_per_sample)
+
+Q(bits_per_sample)
+
+Q(bits_per_sample)
+
+Q(bits_per_sample)
+
+Q(bits_per_sample)
+
+Q(bits_per_sample)
+
+Q(bits_per_sample)
+
+Q(bits_per_sample)
+
+Q(bits_per_sample)
+
+Q(bits_per_sample)
+
+Q(bits_per_sample)
+
+Q(bits_per_sample)
+
+Q(bits_per_sample)
+
+Q(bits_per_sample)
+
+Q(bits_per_sample)
+
+Q(bits_per_sample)
+
+Q(bits_per_sample)
+
+Q(bits_per_sample)
+
+Q(bits_per_sample)
+
+Q(bits_per_sample)
+
+Q(bits_per_sample)
+
+Q(bits_per_sample)
+
+Q(bits_per_sample)
+
+Q(bits_per_sample)
+
+Q(bits_per_sample)
+
+Q(bits_per_sample)
+
+Q(bits_per_sample)
+
+Q(bits_per_value)
+
+Q(blend)
+
+Q(blend_precompute)
+
+Q(blendmode)
+
+Q(blendmode)
+
+Q(blit)
+
+Q(block_size)
+
+Q(blocks)
+
+Q(bool)
+
+Q(bool)
+
+Q(bool)
+
+Q(bool)
+
+Q(bound_method)
+
+Q(boundary_fill)
+
+Q(br)
+
+Q(br)
+
+Q(brightness)
+
+Q(brightness)
+
+Q(budget_us)
+
+Q(budget_us)
+
+Q(buffer)
+
+Q(buffer)
+
+Q(buffer)
+
+Q(buffer)
+
+Q(buffer)
+
+Q(buffer)
+
+Q(buffer)
+
+Q(buffer)
+
+Q(buffer)
+
+Q(buffer)
+
+Q(buffer_size)
+
+Q(buffer_size)
+
+Q(buffer_size)
+
+Q(buffer_size)
+
+Q(buffer_size)
+
+Q(buffer_size)
+
+Q(buffer_size)
+
+Q(buffer_size)
+
+Q(buffer_size)
+
+Q(buffer_size)
+
+Q(buffer_size)
+
+Q(buffering)
+
+Q(builtins)
+
+Q(builtins)
+
+Q(bytearray)
+
+Q(bytearray)
+
+Q(bytecode)
+
+Q(byteorder)
+
+Q(byteorder)
+
+Q(byteorder)
+
+Q(byteorder)
+
+Q(bytes)
+
+Q(bytes)
+
+Q(bytes)
+
+Q(bytes)
+
+Q(c)
+
+Q(c)
+
+Q(c)
+
+Q(calcsize)
+
+Q(callable)
+
+Q(callable)
+
+Q(cancel)
+
+Q(cast)
+
+Q(ceil)
+
+Q(center)
+
+Q(chain)
+
+Q(change)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(channel_count)
+
+Q(chdir)
+
+Q(chdir)
+
+Q(chdir)
+
+Q(chdir)
+
+Q(chdir)
+
+Q(chdir)
+
+Q(chdir)
+
+Q(choice)
+
+Q(chr)
+
+Q(circuitpython)
+
+Q(classmethod)
+
+Q(classmethod)
+
+Q(clear)
+
+Q(clear)
+
+Q(clear)
+
+Q(clock)
+
+Q(close)
+
+Q(close)
+
+Q(close)
+
+Q(close)
+
+Q(close)
+
+Q(close)
+
+Q(close)
+
+Q(closure)
+
+Q(cmath)
+
+Q(cmath)
+
+Q(code)
+
+Q(codeop)
+
+Q(codeop)
+
+Q(collect)
+
+Q(collect_step)
+
+Q(collections)
+
+Q(collections)
+
+Q(color)
+
+Q(color)
+
+Q(color_count)
+
+Q(color_count)
+
+Q(color_depth)
+
+Q(color_depth)
+
+Q(color_depth)
+
+Q(color_index)
+
+Q(color_index)
+
+Q(color_index)
+
+Q(color_index)
+
+Q(color_index)
+
+Q(color_index)
+
+Q(colorspace)
+
+Q(colorspace)
+
+Q(colorwheel)
+
+Q(compile)
+
+Q(compile)
+
+Q(compile_command)
+
+Q(complex)
+
+Q(complex)
+
+Q(const)
+
+Q(const)
+
+Q(contains)
+
+Q(contains)
+
+Q(contains)
+
+Q(contains)
+
+Q(convert)
+
+Q(copy)
+
+Q(copy)
+
+Q(copy)
+
+Q(copy)
+
+Q(copysign)
+
+Q(coro)
+
+Q(coroutine)
+
+Q(coroutine)
+
+Q(coroutine)
+
+Q(cos)
+
+Q(cos)
+
+Q(cosh)
+
+Q(count)
+
+Q(count)
+
+Q(count)
+
+Q(count)
+
+Q(counter)
+
+Q(crc32)
+
+Q(ctrl)
+
+Q(cur_task)
+
+Q(cur_task)
+
+Q(damp)
+
+Q(damp)
+
+Q(damp)
+
+Q(damp)
+
+Q(data)
+
+Q(data)
+
+Q(data)
+
+Q(data_source)
+
+Q(deadbeef)
+
+Q(decay)
+
+Q(decay)
+
+Q(decay)
+
+Q(decay)
+
+Q(decay)
+
+Q(decay)
+
+Q(decay)
+
+Q(decay)
+
+Q(decay_time)
+
+Q(decay_time)
+
+Q(decay_time)
+
+Q(decode)
+
+Q(decode)
+
+Q(decode)
+
+Q(decode)
+
+Q(decompress)
+
+Q(decompress)
+
+Q(decrypt_into)
+
+Q(default)
+
+Q(default_tile)
+
+Q(degrees)
+
+Q(deinit)
+
+Q(deinit)
+
+Q(deinit)
+
+Q(deinit)
+
+Q(deinit)
+
+Q(deinit)
+
+Q(deinit)
+
+Q(deinit)
+
+Q(deinit)
+
+Q(deinit)
+
+Q(deinit)
+
+Q(deinit)
+
+Q(deinit)
+
+Q(deinit)
+
+Q(deinit)
+
+Q(deinit)
+
+Q(deinit)
+
+Q(deinit)
+
+Q(delattr)
+
+Q(delay_ms)
+
+Q(delay_ms)
+
+Q(delay_ms)
+
+Q(delay_ms)
+
+Q(delay_ms)
+
+Q(delay_ms)
+
+Q(delay_ms)
+
+Q(delay_ms)
+
+Q(delay_ms)
+
+Q(delay_ms)
+
+Q(deleter)
+
+Q(density)
+
+Q(density)
+
+Q(depth)
+
+Q(depth)
+
+Q(depth)
+
+Q(depth)
+
+Q(deque)
+
+Q(deque)
+
+Q(dest)
+
+Q(dest)
+
+Q(dest_bitmap)
+
+Q(dest_bitmap)
+
+Q(dest_bitmap)
+
+Q(dest_bitmap)
+
+Q(dest_bitmap)
+
+Q(dest_bitmap)
+
+Q(dest_bitmap)
+
+Q(dest_bitmap)
+
+Q(dest_bitmap)
+
+Q(dest_bitmap)
+
+Q(dest_bitmap)
+
+Q(dest_bitmap)
+
+Q(dest_bitmap)
+
+Q(dest_bitmap)
+
+Q(dest_bitmap)
+
+Q(dest_bitmap)
+
+Q(dest_bitmap)
+
+Q(dest_bitmap)
+
+Q(dest_clip0)
+
+Q(dest_clip1)
+
+Q(dict)
+
+Q(dict)
+
+Q(dict)
+
+Q(dict_view)
+
+Q(difference)
+
+Q(difference)
+
+Q(difference_update)
+
+Q(digest)
+
+Q(dir)
+
+Q(dirty)
+
+Q(disable)
+
+Q(discard)
+
+Q(displayio)
+
+Q(displayio)
+
+Q(displayio)
+
+Q(dither)
+
+Q(dither)
+
+Q(dither)
+
+Q(dither)
+
+Q(dither)
+
+Q(divmod)
+
+Q(doc)
+
+Q(done)
+
+Q(draw_circle)
+
+Q(draw_line)
+
+Q(draw_polygon)
+
+Q(drive)
+
+Q(drive)
+
+Q(drive)
+
+Q(drive)
+
+Q(dump)
+
+Q(dumps)
+
+Q(e)
+
+Q(e)
+
+Q(element_size)
+
+Q(enable)
+
+Q(encode)
+
+Q(encoding)
+
+Q(encrypt_into)
+
+Q(end)
+
+Q(end)
+
+Q(end)
+
+Q(endswith)
+
+Q(enumerate)
+
+Q(enumerate)
+
+Q(envelope)
+
+Q(envelope)
+
+Q(envelope)
+
+Q(envelope)
+
+Q(envelope)
+
+Q(envelope)
+
+Q(envelope)
+
+Q(envelope)
+
+Q(erf)
+
+Q(erfc)
+
+Q(errno)
+
+Q(errno)
+
+Q(errno)
+
+Q(errno)
+
+Q(errno)
+
+Q(error_location)
+
+Q(errorcode)
+
+Q(eval)
+
+Q(eval)
+
+Q(exc_info)
+
+Q(exec)
+
+Q(exec)
+
+Q(execfile)
+
+Q(executable)
+
+Q(exit)
+
+Q(exit)
+
+Q(exp)
+
+Q(exp)
+
+Q(expm1)
+
+Q(extend)
+
+Q(extend)
+
+Q(extend)
+
+Q(extend)
+
+Q(extra_coverage)
+
+Q(extra_cpp_coverage)
+
+Q(f0)
+
+Q(f0)
+
+Q(fabs)
+
+Q(factor_1)
+
+Q(factor_2)
+
+Q(factorial)
+
+Q(false_color)
+
+Q(feedback)
+
+Q(feedback)
+
+Q(feedback)
+
+Q(feedback)
+
+Q(feedback)
+
+Q(feedback)
+
+Q(feedback)
+
+Q(feedback)
+
+Q(file)
+
+Q(file)
+
+Q(file)
+
+Q(file)
+
+Q(file)
+
+Q(file)
+
+Q(file)
+
+Q(file)
+
+Q(file)
+
+Q(file)
+
+Q(file)
+
+Q(file)
+
+Q(file)
+
+Q(file)
+
+Q(filename)
+
+Q(filename)
+
+Q(filename2)
+
+Q(fileno)
+
+Q(fill)
+
+Q(fill_color_value)
+
+Q(fill_region)
+
+Q(fill_row)
+
+Q(filter)
+
+Q(filter)
+
+Q(filter)
+
+Q(filter)
+
+Q(filter)
+
+Q(filter)
+
+Q(filter)
+
+Q(filter)
+
+Q(filter)
+
+Q(filter)
+
+Q(filter)
+
+Q(find)
+
+Q(find)
+
+Q(flip_x)
+
+Q(flip_y)
+
+Q(float)
+
+Q(float)
+
+Q(float)
+
+Q(float)
+
+Q(floor)
+
+Q(flush)
+
+Q(flush)
+
+Q(flush)
+
+Q(flush)
+
+Q(flush)
+
+Q(fmod)
+
+Q(format)
+
+Q(format)
+
+Q(format_exception)
+
+Q(framebuffer)
+
+Q(framebuffer)
+
+Q(framebuffer)
+
+Q(framebufferio)
+
+Q(framebufferio)
+
+Q(freeverb)
+
+Q(freq_shift)
+
+Q(freq_shift)
+
+Q(frequency)
+
+Q(frequency)
+
+Q(frequency)
+
+Q(frequency)
+
+Q(frequency)
+
+Q(frequency)
+
+Q(frequency)
+
+Q(frequency)
+
+Q(frequency)
+
+Q(frequency)
+
+Q(frexp)
+
+Q(from_bytes)
+
+Q(from_file)
+
+Q(fromhex)
+
+Q(fromkeys)
+
+Q(frozenset)
+
+Q(frozenset)
+
+Q(function)
+
+Q(function)
+
+Q(function)
+
+Q(function)
+
+Q(function)
+
+Q(function)
+
+Q(function)
+
+Q(function)
+
+Q(function)
+
+Q(function)
+
+Q(g)
+
+Q(g)
+
+Q(g_add)
+
+Q(g_add)
+
+Q(gamma)
+
+Q(gb)
+
+Q(gb)
+
+Q(gc)
+
+Q(gc)
+
+Q(generator)
+
+Q(generator)
+
+Q(generator)
+
+Q(get)
+
+Q(get_buffer)
+
+Q(get_ident)
+
+Q(get_structure)
+
+Q(getattr)
+
+Q(getcwd)
+
+Q(getcwd)
+
+Q(getcwd)
+
+Q(getcwd)
+
+Q(getenv)
+
+Q(getlocale)
+
+Q(getrandbits)
+
+Q(getsizeof)
+
+Q(getter)
+
+Q(getvalue)
+
+Q(gg)
+
+Q(gg)
+
+Q(globals)
+
+Q(gmtime)
+
+Q(gr)
+
+Q(gr)
+
+Q(grain_size)
+
+Q(grain_size)
+
+Q(group)
+
+Q(groups)
+
+Q(hasattr)
+
+Q(hash)
+
+Q(hashlib)
+
+Q(hashlib)
+
+Q(heap_lock)
+
+Q(heap_locked)
+
+Q(heap_unlock)
+
+Q(heapify)
+
+Q(heappop)
+
+Q(heappush)
+
+Q(heapq)
+
+Q(heapq)
+
+Q(height)
+
+Q(height)
+
+Q(height)
+
+Q(height)
+
+Q(height)
+
+Q(height)
+
+Q(height)
+
+Q(height)
+
+Q(height)
+
+Q(height)
+
+Q(height)
+
+Q(height)
+
+Q(height)
+
+Q(help)
+
+Q(hex)
+
+Q(hex)
+
+Q(hex)
+
+Q(hexlify)
+
+Q(hidden)
+
+Q(hidden)
+
+Q(hidden)
+
+Q(hidden)
+
+Q(hidden)
+
+Q(i)
+
+Q(id)
+
+Q(ilistdir)
+
+Q(ilistdir)
+
+Q(ilistdir)
+
+Q(ilistdir)
+
+Q(ilistdir)
+
+Q(ilistdir)
+
+Q(imag)
+
+Q(implementation)
+
+Q(incremental)
+
+Q(index)
+
+Q(index)
+
+Q(index)
+
+Q(index)
+
+Q(index)
+
+Q(index)
+
+Q(index)
+
+Q(indices)
+
+Q(inf)
+
+Q(input)
+
+Q(input_colorspace)
+
+Q(input_colorspace)
+
+Q(insert)
+
+Q(insert)
+
+Q(int)
+
+Q(int)
+
+Q(int)
+
+Q(int)
+
+Q(int)
+
+Q(int)
+
+Q(intern)
+
+Q(interpolate)
+
+Q(interpolate)
+
+Q(intersection)
+
+Q(intersection)
+
+Q(intersection_update)
+
+Q(invert)
+
+Q(invert)
+
+Q(invert)
+
+Q(io)
+
+Q(io)
+
+Q(ioctl)
+
+Q(ioctl)
+
+Q(ioctl)
+
+Q(ipoll)
+
+Q(is_transparent)
+
+Q(isalpha)
+
+Q(isclose)
+
+Q(isdigit)
+
+Q(isdisjoint)
+
+Q(isdisjoint)
+
+Q(isenabled)
+
+Q(isfinite)
+
+Q(isinf)
+
+Q(isinstance)
+
+Q(islower)
+
+Q(isnan)
+
+Q(isspace)
+
+Q(issubclass)
+
+Q(issubset)
+
+Q(issubset)
+
+Q(issuperset)
+
+Q(issuperset)
+
+Q(isupper)
+
+Q(items)
+
+Q(items)
+
+Q(items)
+
+Q(itemsize)
+
+Q(iter)
+
+Q(iterable)
+
+Q(iterable)
+
+Q(iterable)
+
+Q(iterator)
+
+Q(iterator)
+
+Q(iterator)
+
+Q(iterator)
+
+Q(iterator)
+
+Q(iterator)
+
+Q(join)
+
+Q(jpegio)
+
+Q(jpegio)
+
+Q(json)
+
+Q(json)
+
+Q(json)
+
+Q(kbd_intr)
+
+Q(keepends)
+
+Q(key)
+
+Q(key)
+
+Q(key)
+
+Q(key)
+
+Q(key)
+
+Q(key_size)
+
+Q(keys)
+
+Q(keys)
+
+Q(label)
+
+Q(last)
+
+Q(layer)
+
+Q(ldexp)
+
+Q(len)
+
+Q(length)
+
+Q(level)
+
+Q(level)
+
+Q(level)
+
+Q(lfo_tick)
+
+Q(lfo_value)
+
+Q(lgamma)
+
+Q(libc_ver)
+
+Q(limit)
+
+Q(list)
+
+Q(list)
+
+Q(list)
+
+Q(listdir)
+
+Q(little)
+
+Q(little)
+
+Q(little)
+
+Q(little)
+
+Q(load)
+
+Q(loads)
+
+Q(locale)
+
+Q(locale)
+
+Q(locals)
+
+Q(localtime)
+
+Q(location)
+
+Q(location)
+
+Q(location)
+
+Q(location)
+
+Q(lock)
+
+Q(locked)
+
+Q(log)
+
+Q(log)
+
+Q(log10)
+
+Q(log10)
+
+Q(log2)
+
+Q(lookup)
+
+Q(lookup)
+
+Q(lookup)
+
+Q(lookup)
+
+Q(lookup)
+
+Q(lookup)
+
+Q(loop)
+
+Q(loop)
+
+Q(loop)
+
+Q(loop)
+
+Q(loop)
+
+Q(loop)
+
+Q(loop)
+
+Q(loop)
+
+Q(loop)
+
+Q(loop)
+
+Q(loop)
+
+Q(loop)
+
+Q(loop)
+
+Q(lower)
+
+Q(lstrip)
+
+Q(machine)
+
+Q(make_opaque)
+
+Q(make_opaque)
+
+Q(make_transparent)
+
+Q(make_transparent)
+
+Q(map)
+
+Q(map)
+
+Q(mask)
+
+Q(mask)
+
+Q(mask)
+
+Q(mask)
+
+Q(mask)
+
+Q(mask)
+
+Q(mask)
+
+Q(mask)
+
+Q(mask)
+
+Q(mask)
+
+Q(mask)
+
+Q(mask)
+
+Q(mask)
+
+Q(mask)
+
+Q(match)
+
+Q(match)
+
+Q(match)
+
+Q(math)
+
+Q(math)
+
+Q(math)
+
+Q(max)
+
+Q(max_delay_ms)
+
+Q(max_delay_ms)
+
+Q(max_delay_ms)
+
+Q(max_delay_ms)
+
+Q(max_delay_ms)
+
+Q(max_delay_ms)
+
+Q(max_delay_ms)
+
+Q(max_delay_ms)
+
+Q(max_polyphony)
+
+Q(max_voices)
+
+Q(max_voices)
+
+Q(max_voices)
+
+Q(maxsize)
+
+Q(mem_alloc)
+
+Q(mem_current)
+
+Q(mem_free)
+
+Q(mem_info)
+
+Q(mem_peak)
+
+Q(mem_total)
+
+Q(memoryview)
+
+Q(memoryview)
+
+Q(micropython)
+
+Q(micropython)
+
+Q(micropython)
+
+Q(midi_to_hz)
+
+Q(min)
+
+Q(min_delay_ms)
+
+Q(min_delay_ms)
+
+Q(min_delay_ms)
+
+Q(min_delay_ms)
+
+Q(minimum_frames_per_second)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mix)
+
+Q(mkdir)
+
+Q(mkdir)
+
+Q(mkdir)
+
+Q(mkdir)
+
+Q(mkdir)
+
+Q(mkfs)
+
+Q(mkfs)
+
+Q(mktime)
+
+Q(mode)
+
+Q(mode)
+
+Q(mode)
+
+Q(mode)
+
+Q(mode)
+
+Q(mode)
+
+Q(mode)
+
+Q(mode)
+
+Q(mode)
+
+Q(mode)
+
+Q(mode)
+
+Q(modf)
+
+Q(modify)
+
+Q(module)
+
+Q(modules)
+
+Q(modules)
+
+Q(morph)
+
+Q(mount)
+
+Q(mount)
+
+Q(mount)
+
+Q(mount)
+
+Q(mount)
+
+Q(move_to_end)
+
+Q(mul)
+
+Q(name)
+
+Q(namedtuple)
+
+Q(nan)
+
+Q(native)
+
+Q(new_attribute)
+
+Q(new_color)
+
+Q(newline)
+
+Q(next)
+
+Q(nframes)
+
+Q(nodename)
+
+Q(note)
+
+Q(note)
+
+Q(note)
+
+Q(note_info)
+
+Q(object)
+
+Q(object)
+
+Q(object)
+
+Q(object)
+
+Q(object)
+
+Q(object)
+
+Q(object)
+
+Q(oct)
+
+Q(offscreen)
+
+Q(offscreen)
+
+Q(offset)
+
+Q(offset)
+
+Q(offset)
+
+Q(offset)
+
+Q(offset)
+
+Q(old_color)
+
+Q(once)
+
+Q(once)
+
+Q(open)
+
+Q(open)
+
+Q(open)
+
+Q(open)
+
+Q(open)
+
+Q(open)
+
+Q(open)
+
+Q(operation)
+
+Q(operation)
+
+Q(operation)
+
+Q(opt_level)
+
+Q(ord)
+
+Q(os)
+
+Q(os)
+
+Q(overlap)
+
+Q(ox)
+
+Q(oy)
+
+Q(pack)
+
+Q(pack_into)
+
+Q(palette)
+
+Q(palette)
+
+Q(palette)
+
+Q(palette_index)
+
+Q(palette_index)
+
+Q(palette_index)
+
+Q(palette_index)
+
+Q(palette_index)
+
+Q(palette_index)
+
+Q(panning)
+
+Q(panning)
+
+Q(panning)
+
+Q(panning)
+
+Q(panning)
+
+Q(partition)
+
+Q(path)
+
+Q(peek)
+
+Q(pend_throw)
+
+Q(pend_throw)
+
+Q(ph_key)
+
+Q(phase)
+
+Q(phase)
+
+Q(phase_offset)
+
+Q(phase_offset)
+
+Q(phase_offset)
+
+Q(pi)
+
+Q(pi)
+
+Q(pixel_shader)
+
+Q(pixel_shader)
+
+Q(pixel_shader)
+
+Q(pixel_shader)
+
+Q(pixel_shader)
+
+Q(pixel_shader)
+
+Q(pixel_shader)
+
+Q(pixel_shader)
+
+Q(pixel_shader)
+
+Q(pixel_shader)
+
+Q(pixel_shader)
+
+Q(pixel_shader)
+
+Q(platform)
+
+Q(platform)
+
+Q(platform)
+
+Q(platform)
+
+Q(play)
+
+Q(play)
+
+Q(play)
+
+Q(play)
+
+Q(play)
+
+Q(play)
+
+Q(play)
+
+Q(play)
+
+Q(play)
+
+Q(play)
+
+Q(play)
+
+Q(play)
+
+Q(playing)
+
+Q(playing)
+
+Q(playing)
+
+Q(playing)
+
+Q(playing)
+
+Q(playing)
+
+Q(playing)
+
+Q(playing)
+
+Q(playing)
+
+Q(playing)
+
+Q(playing)
+
+Q(playing)
+
+Q(point)
+
+Q(point)
+
+Q(points)
+
+Q(points)
+
+Q(points)
+
+Q(polar)
+
+Q(poll)
+
+Q(poll)
+
+Q(poll)
+
+Q(pop)
+
+Q(pop)
+
+Q(pop)
+
+Q(pop)
+
+Q(pop)
+
+Q(pop)
+
+Q(popitem)
+
+Q(popleft)
+
+Q(position)
+
+Q(position)
+
+Q(post_filter)
+
+Q(post_filter)
+
+Q(post_gain)
+
+Q(post_gain)
+
+Q(post_gain)
+
+Q(post_gain)
+
+Q(pow)
+
+Q(pow)
+
+Q(pre_filter)
+
+Q(pre_filter)
+
+Q(pre_gain)
+
+Q(pre_gain)
+
+Q(pre_gain)
+
+Q(pre_gain)
+
+Q(prefetch)
+
+Q(press)
+
+Q(press)
+
+Q(pressed)
+
+Q(print)
+
+Q(print_exception)
+
+Q(print_subclass_attr)
+
+Q(property)
+
+Q(property)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_audiosample)
+
+Q(protocol_draw)
+
+Q(protocol_draw)
+
+Q(protocol_draw)
+
+Q(protocol_draw)
+
+Q(protocol_draw)
+
+Q(protocol_draw)
+
+Q(protocol_draw)
+
+Q(protocol_draw)
+
+Q(protocol_draw)
+
+Q(protocol_draw)
+
+Q(protocol_draw)
+
+Q(protocol_draw)
+
+Q(protocol_draw)
+
+Q(protocol_draw)
+
+Q(protocol_draw)
+
+Q(protocol_draw)
+
+Q(protocol_draw)
+
+Q(protocol_draw)
+
+Q(protocol_draw)
+
+Q(protocol_draw)
+
+Q(protocol_draw)
+
+Q(protocol_draw)
+
+Q(protocol_draw)
+
+Q(protocol_framebuffer)
+
+Q(protocol_framebuffer)
+
+Q(protocol_vfs)
+
+Q(ps1)
+
+Q(ps2)
+
+Q(ptr)
+
+Q(ptr)
+
+Q(ptr16)
+
+Q(ptr16)
+
+Q(ptr32)
+
+Q(ptr32)
+
+Q(ptr8)
+
+Q(ptr8)
+
+Q(push)
+
+Q(putenv)
+
+Q(px)
+
+Q(py)
+
+Q(python_compiler)
+
+Q(qstr_info)
+
+Q(r)
+
+Q(r)
+
+Q(r)
+
+Q(r_add)
+
+Q(r_add)
+
+Q(radians)
+
+Q(radius)
+
+Q(radius)
+
+Q(radius)
+
+Q(radius)
+
+Q(radius)
+
+Q(rainbowio)
+
+Q(rainbowio)
+
+Q(randint)
+
+Q(random)
+
+Q(random)
+
+Q(random)
+
+Q(randrange)
+
+Q(range)
+
+Q(range)
+
+Q(range)
+
+Q(range)
+
+Q(rate)
+
+Q(rate)
+
+Q(rate)
+
+Q(rate)
+
+Q(rate)
+
+Q(rate)
+
+Q(rate)
+
+Q(rb)
+
+Q(rb)
+
+Q(rb)
+
+Q(rb)
+
+Q(rb)
+
+Q(rb)
+
+Q(rb)
+
+Q(re)
+
+Q(re)
+
+Q(re)
+
+Q(read)
+
+Q(read)
+
+Q(read)
+
+Q(read)
+
+Q(read)
+
+Q(read)
+
+Q(read1)
+
+Q(readblocks)
+
+Q(readinto)
+
+Q(readinto)
+
+Q(readinto)
+
+Q(readinto)
+
+Q(readinto)
+
+Q(readinto)
+
+Q(readinto)
+
+Q(readinto)
+
+Q(readinto1)
+
+Q(readline)
+
+Q(readline)
+
+Q(readline)
+
+Q(readline)
+
+Q(readline)
+
+Q(readlines)
+
+Q(readlines)
+
+Q(readonly)
+
+Q(readonly)
+
+Q(real)
+
+Q(rect)
+
+Q(refresh)
+
+Q(refresh_count)
+
+Q(register)
+
+Q(rekey)
+
+Q(rel_tol)
+
+Q(release)
+
+Q(release)
+
+Q(release)
+
+Q(release)
+
+Q(release_all)
+
+Q(release_all_then_press)
+
+Q(release_displays)
+
+Q(release_then_press)
+
+Q(release_time)
+
+Q(release_time)
+
+Q(release_time)
+
+Q(remove)
+
+Q(remove)
+
+Q(remove)
+
+Q(remove)
+
+Q(remove)
+
+Q(remove)
+
+Q(remove)
+
+Q(remove)
+
+Q(remove)
+
+Q(remove)
+
+Q(rename)
+
+Q(rename)
+
+Q(rename)
+
+Q(rename)
+
+Q(rename)
+
+Q(render)
+
+Q(render_into)
+
+Q(replace)
+
+Q(replace_color)
+
+Q(replaced_color_value)
+
+Q(repr)
+
+Q(reset_buffer)
+
+Q(retrigger)
+
+Q(retrigger)
+
+Q(retrigger)
+
+Q(retrigger)
+
+Q(reverse)
+
+Q(reverse)
+
+Q(reverse_pixels_in_element)
+
+Q(reverse_rows)
+
+Q(reversed)
+
+Q(reversed)
+
+Q(rfind)
+
+Q(rfind)
+
+Q(rg)
+
+Q(rg)
+
+Q(rindex)
+
+Q(rindex)
+
+Q(ring_bend)
+
+Q(ring_bend)
+
+Q(ring_bend)
+
+Q(ring_frequency)
+
+Q(ring_frequency)
+
+Q(ring_frequency)
+
+Q(ring_waveform)
+
+Q(ring_waveform)
+
+Q(ring_waveform_loop_end)
+
+Q(ring_waveform_loop_end)
+
+Q(ring_waveform_loop_end)
+
+Q(ring_waveform_loop_start)
+
+Q(ring_waveform_loop_start)
+
+Q(ring_waveform_loop_start)
+
+Q(rmdir)
+
+Q(rmdir)
+
+Q(rmdir)
+
+Q(rmdir)
+
+Q(rmdir)
+
+Q(roomsize)
+
+Q(roomsize)
+
+Q(roomsize)
+
+Q(roomsize)
+
+Q(root_group)
+
+Q(rotation)
+
+Q(rotation)
+
+Q(rotozoom)
+
+Q(round)
+
+Q(rpartition)
+
+Q(rr)
+
+Q(rr)
+
+Q(rsplit)
+
+Q(rstrip)
+
+Q(sample)
+
+Q(sample)
+
+Q(sample)
+
+Q(sample)
+
+Q(sample)
+
+Q(sample)
+
+Q(sample)
+
+Q(sample)
+
+Q(sample)
+
+Q(sample)
+
+Q(sample)
+
+Q(sample)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(sample_rate)
+
+Q(samples_signed)
+
+Q(samples_signed)
+
+Q(samples_signed)
+
+Q(samples_signed)
+
+Q(samples_signed)
+
+Q(samples_signed)
+
+Q(samples_signed)
+
+Q(samples_signed)
+
+Q(samples_signed)
+
+Q(samples_signed)
+
+Q(samples_signed)
+
+Q(scale)
+
+Q(scale)
+
+Q(scale)
+
+Q(scale)
+
+Q(scale)
+
+Q(scale)
+
+Q(scale)
+
+Q(scale)
+
+Q(scale)
+
+Q(scale)
+
+Q(schedule)
+
+Q(search)
+
+Q(search)
+
+Q(seed)
+
+Q(seek)
+
+Q(seek)
+
+Q(seek)
+
+Q(segment_size)
+
+Q(select)
+
+Q(select)
+
+Q(self)
+
+Q(self)
+
+Q(self)
+
+Q(semitones)
+
+Q(semitones)
+
+Q(semitones)
+
+Q(semitones)
+
+Q(semitones)
+
+Q(semitones)
+
+Q(semitones)
+
+Q(semitones)
+
+Q(send)
+
+Q(send)
+
+Q(send)
+
+Q(sep)
+
+Q(sep)
+
+Q(separators)
+
+Q(set)
+
+Q(set)
+
+Q(set)
+
+Q(set_buf)
+
+Q(set_error)
+
+Q(setattr)
+
+Q(setdefault)
+
+Q(setter)
+
+Q(sha256)
+
+Q(sha256)
+
+Q(shape)
+
+Q(show)
+
+Q(signed)
+
+Q(signed)
+
+Q(signed)
+
+Q(signedness)
+
+Q(sin)
+
+Q(sin)
+
+Q(single)
+
+Q(single)
+
+Q(single_buffer)
+
+Q(sinh)
+
+Q(skip_dest_index)
+
+Q(skip_dest_index)
+
+Q(skip_index)
+
+Q(skip_index)
+
+Q(skip_source1_index)
+
+Q(skip_source2_index)
+
+Q(skip_source_index)
+
+Q(skip_source_index)
+
+Q(sleep)
+
+Q(sleep_ms)
+
+Q(sleep_us)
+
+Q(slice)
+
+Q(slice)
+
+Q(slice)
+
+Q(soft_clip)
+
+Q(soft_clip)
+
+Q(solarize)
+
+Q(sort)
+
+Q(sort)
+
+Q(sorted)
+
+Q(source)
+
+Q(source)
+
+Q(source_bitmap)
+
+Q(source_bitmap)
+
+Q(source_bitmap)
+
+Q(source_bitmap)
+
+Q(source_bitmap)
+
+Q(source_bitmap)
+
+Q(source_bitmap_1)
+
+Q(source_bitmap_1)
+
+Q(source_bitmap_2)
+
+Q(source_bitmap_2)
+
+Q(source_clip0)
+
+Q(source_clip1)
+
+Q(source_colorspace)
+
+Q(source_colorspace)
+
+Q(span)
+
+Q(split)
+
+Q(split)
+
+Q(splitlines)
+
+Q(spread)
+
+Q(spread)
+
+Q(sqrt)
+
+Q(sqrt)
+
+Q(src1)
+
+Q(src1)
+
+Q(src2)
+
+Q(src2)
+
+Q(stack_size)
+
+Q(stack_use)
+
+Q(stages)
+
+Q(stages)
+
+Q(start)
+
+Q(start)
+
+Q(start)
+
+Q(start)
+
+Q(start)
+
+Q(start_new_thread)
+
+Q(startswith)
+
+Q(stat)
+
+Q(stat)
+
+Q(stat)
+
+Q(stat)
+
+Q(stat)
+
+Q(stat)
+
+Q(state)
+
+Q(state)
+
+Q(staticmethod)
+
+Q(staticmethod)
+
+Q(statvfs)
+
+Q(statvfs)
+
+Q(statvfs)
+
+Q(statvfs)
+
+Q(statvfs)
+
+Q(stderr)
+
+Q(stdin)
+
+Q(stdout)
+
+Q(step)
+
+Q(step)
+
+Q(step)
+
+Q(stest_fileio)
+
+Q(stest_textio2)
+
+Q(stop)
+
+Q(stop)
+
+Q(stop)
+
+Q(stop)
+
+Q(stop)
+
+Q(stop)
+
+Q(stop)
+
+Q(stop)
+
+Q(stop)
+
+Q(stop)
+
+Q(stop)
+
+Q(stop)
+
+Q(stop)
+
+Q(stop)
+
+Q(stop_voice)
+
+Q(str)
+
+Q(str)
+
+Q(str)
+
+Q(str)
+
+Q(str)
+
+Q(str)
+
+Q(strerror)
+
+Q(strip)
+
+Q(struct)
+
+Q(struct)
+
+Q(sub)
+
+Q(sub)
+
+Q(sum)
+
+Q(super)
+
+Q(super)
+
+Q(super)
+
+Q(sustain_level)
+
+Q(sustain_level)
+
+Q(sustain_level)
+
+Q(swap_bytes_in_element)
+
+Q(symbol)
+
+Q(symmetric_difference)
+
+Q(symmetric_difference)
+
+Q(symmetric_difference_update)
+
+Q(sync)
+
+Q(synthio)
+
+Q(synthio)
+
+Q(synthio)
+
+Q(synthio)
+
+Q(synthio)
+
+Q(synthio)
+
+Q(synthio_block)
+
+Q(synthio_block)
+
+Q(synthio_block)
+
+Q(sys)
+
+Q(sys)
+
+Q(sys)
+
+Q(sys)
+
+Q(sysname)
+
+Q(system)
+
+Q(table)
+
+Q(table)
+
+Q(tan)
+
+Q(tanh)
+
+Q(taps)
+
+Q(taps)
+
+Q(taps)
+
+Q(taps)
+
+Q(target_frames_per_second)
+
+Q(tau)
+
+Q(tb)
+
+Q(tb)
+
+Q(tb)
+
+Q(tell)
+
+Q(tell)
+
+Q(tell)
+
+Q(tempo)
+
+Q(tempo)
+
+Q(tempo)
+
+Q(test)
+
+Q(test)
+
+Q(threshold)
+
+Q(threshold)
+
+Q(threshold)
+
+Q(throw)
+
+Q(throw)
+
+Q(throw)
+
+Q(ticks_add)
+
+Q(ticks_cpu)
+
+Q(ticks_diff)
+
+Q(ticks_ms)
+
+Q(ticks_us)
+
+Q(tile)
+
+Q(tile_height)
+
+Q(tile_height)
+
+Q(tile_width)
+
+Q(tile_width)
+
+Q(time)
+
+Q(time)
+
+Q(time)
+
+Q(time_ns)
+
+Q(to_bytes)
+
+Q(traceback)
+
+Q(traceback)
+
+Q(traceback)
+
+Q(traceback)
+
+Q(traceback)
+
+Q(tracebacklimit)
+
+Q(transpose_xy)
+
+Q(trunc)
+
+Q(tuple)
+
+Q(tuple)
+
+Q(tuple)
+
+Q(tuple)
+
+Q(tuple)
+
+Q(tuple)
+
+Q(type)
+
+Q(type)
+
+Q(uint)
+
+Q(uint)
+
+Q(umount)
+
+Q(umount)
+
+Q(umount)
+
+Q(umount)
+
+Q(uname)
+
+Q(unhexlify)
+
+Q(uniform)
+
+Q(union)
+
+Q(union)
+
+Q(unlink)
+
+Q(unpack)
+
+Q(unpack_from)
+
+Q(unregister)
+
+Q(unsafe)
+
+Q(unsetenv)
+
+Q(update)
+
+Q(update)
+
+Q(update)
+
+Q(upper)
+
+Q(urandom)
+
+Q(usys)
+
+Q(utf-8)
+
+Q(utf-8)
+
+Q(utf-8)
+
+Q(utf-8)
+
+Q(utime)
+
+Q(utime)
+
+Q(uzlib)
+
+Q(value)
+
+Q(value)
+
+Q(value)
+
+Q(value)
+
+Q(value)
+
+Q(value)
+
+Q(value)
+
+Q(value)
+
+Q(value)
+
+Q(value)
+
+Q(value)
+
+Q(value_count)
+
+Q(values)
+
+Q(values)
+
+Q(vectorio)
+
+Q(vectorio)
+
+Q(version)
+
+Q(version)
+
+Q(version)
+
+Q(version_info)
+
+Q(viper)
+
+Q(voct_to_hz)
+
+Q(voice)
+
+Q(voice)
+
+Q(voice)
+
+Q(voice)
+
+Q(voice)
+
+Q(voice)
+
+Q(voice_count)
+
+Q(voice_count)
+
+Q(voice_stealing)
+
+Q(voice_stealing)
+
+Q(voice_stealing)
+
+Q(voice_stealing)
+
+Q(voices)
+
+Q(voices)
+
+Q(voices)
+
+Q(voices)
+
+Q(waveform)
+
+Q(waveform)
+
+Q(waveform)
+
+Q(waveform)
+
+Q(waveform)
+
+Q(waveform)
+
+Q(waveform)
+
+Q(waveform)
+
+Q(waveform_loop_end)
+
+Q(waveform_loop_end)
+
+Q(waveform_loop_end)
+
+Q(waveform_loop_start)
+
+Q(waveform_loop_start)
+
+Q(waveform_loop_start)
+
+Q(waveform_max_length)
+
+Q(weights)
+
+Q(weights)
+
+Q(weights)
+
+Q(width)
+
+Q(width)
+
+Q(width)
+
+Q(width)
+
+Q(width)
+
+Q(width)
+
+Q(width)
+
+Q(width)
+
+Q(width)
+
+Q(width)
+
+Q(width)
+
+Q(width)
+
+Q(width)
+
+Q(window)
+
+Q(write)
+
+Q(write)
+
+Q(write)
+
+Q(write)
+
+Q(write)
+
+Q(write)
+
+Q(write1)
+
+Q(writeblocks)
+
+Q(x)
+
+Q(x)
+
+Q(x)
+
+Q(x)
+
+Q(x)
+
+Q(x)
+
+Q(x)
+
+Q(x)
+
+Q(x)
+
+Q(x)
+
+Q(x)
+
+Q(x)
+
+Q(x)
+
+Q(x)
+
+Q(x)
+
+Q(x)
+
+Q(x)
+
+Q(x)
+
+Q(x)
+
+Q(x)
+
+Q(x)
+
+Q(x)
+
+Q(x)
+
+Q(x)
+
+Q(x1)
+
+Q(x1)
+
+Q(x1)
+
+Q(x1)
+
+Q(x1)
+
+Q(x1)
+
+Q(x1)
+
+Q(x2)
+
+Q(x2)
+
+Q(x2)
+
+Q(x2)
+
+Q(x2)
+
+Q(x2)
+
+Q(x2)
+
+Q(xs)
+
+Q(y)
+
+Q(y)
+
+Q(y)
+
+Q(y)
+
+Q(y)
+
+Q(y)
+
+Q(y)
+
+Q(y)
+
+Q(y)
+
+Q(y)
+
+Q(y)
+
+Q(y)
+
+Q(y)
+
+Q(y)
+
+Q(y)
+
+Q(y)
+
+Q(y)
+
+Q(y)
+
+Q(y)
+
+Q(y)
+
+Q(y)
+
+Q(y)
+
+Q(y)
+
+Q(y)
+
+Q(y)
+
+Q(y1)
+
+Q(y1)
+
+Q(y1)
+
+Q(y1)
+
+Q(y1)
+
+Q(y1)
+
+Q(y1)
+
+Q(y2)
+
+Q(y2)
+
+Q(y2)
+
+Q(y2)
+
+Q(y2)
+
+Q(y2)
+
+Q(y2)
+
+Q(ys)
+
+Q(zip)
+
+Q(zip)
+
+Q(zip)
+
+Q(zlib)
+
+Q(zlib)
+
+Q(zlib)
+
+Q({_colon_#b})
+
+TRANSLATE("  File \"%q\", line %d")
+
+TRANSLATE(" is of type %q\n")
+
+TRANSLATE("%%c needs int or char")
+
+TRANSLATE("%%c needs int or char")
+
+TRANSLATE("%q in %q must be of type %q or %q, not %q")
+
+TRANSLATE("%q in %q must be of type %q, not %q")
+
+TRANSLATE("%q in %q must be of type %q, not %q")
+
+TRANSLATE("%q index out of range")
+
+TRANSLATE("%q index out of range")
+
+TRANSLATE("%q indices must be integers, not %s")
+
+TRANSLATE("%q length must be %d")
+
+TRANSLATE("%q length must be %d-%d")
+
+TRANSLATE("%q length must be <= %d")
+
+TRANSLATE("%q length must be >= %d")
+
+TRANSLATE("%q must be %d")
+
+TRANSLATE("%q must be %d-%d")
+
+TRANSLATE("%q must be %d-%d")
+
+TRANSLATE("%q must be %d-%d")
+
+TRANSLATE("%q must be %d-%d")
+
+TRANSLATE("%q must be %d-%d")
+
+TRANSLATE("%q must be %d-%d")
+
+TRANSLATE("%q must be <= %d")
+
+TRANSLATE("%q must be >= %d")
+
+TRANSLATE("%q must be >= %d")
+
+TRANSLATE("%q must be a bytearray or array of type 'h', 'H', 'b', or 'B'")
+
+TRANSLATE("%q must be array of type 'h'")
+
+TRANSLATE("%q must be of type %q or %q, not %q")
+
+TRANSLATE("%q must be of type %q or %q, not %q")
+
+TRANSLATE("%q must be of type %q or %q, not %q")
+
+TRANSLATE("%q must be of type %q or %q, not %q")
+
+TRANSLATE("%q must be of type %q or %q, not %q")
+
+TRANSLATE("%q must be of type %q or %q, not %q")
+
+TRANSLATE("%q must be of type %q or %q, not %q")
+
+TRANSLATE("%q must be of type %q or %q, not %q")
+
+TRANSLATE("%q must be of type %q, %q, or %q, not %q")
+
+TRANSLATE("%q must be of type %q, not %q")
+
+TRANSLATE("%q must be of type %q, not %q")
+
+TRANSLATE("%q must be of type %q, not %q")
+
+TRANSLATE("%q must be of type %q, not %q")
+
+TRANSLATE("%q must be of type %q, not %q")
+
+TRANSLATE("%q must be of type %q, not %q")
+
+TRANSLATE("%q must be of type %q, not %q")
+
+TRANSLATE("%q must be of type %q, not %q")
+
+TRANSLATE("%q must be of type %q, not %q")
+
+TRANSLATE("%q out of range")
+
+TRANSLATE("%q out of range")
+
+TRANSLATE("%q step cannot be zero")
+
+TRANSLATE("%q step cannot be zero")
+
+TRANSLATE("%q() takes %d positional arguments but %d were given")
+
+TRANSLATE("%q() takes %d positional arguments but %d were given")
+
+TRANSLATE("%q() without %q()")
+
+TRANSLATE("%q=%q")
+
+TRANSLATE("%s")
+
+TRANSLATE("'%q' argument required")
+
+TRANSLATE("'%q' object does not support '%q'")
+
+TRANSLATE("'%q' object isn't an iterator")
+
+TRANSLATE("'%q' object isn't an iterator")
+
+TRANSLATE("'%q' object isn't callable")
+
+TRANSLATE("'%q' object isn't callable")
+
+TRANSLATE("'%q' object isn't iterable")
+
+TRANSLATE("'%s' object doesn't support item assignment")
+
+TRANSLATE("'%s' object doesn't support item deletion")
+
+TRANSLATE("'%s' object has no attribute '%q'")
+
+TRANSLATE("'%s' object isn't subscriptable")
+
+TRANSLATE("'=' alignment not allowed in string format specifier")
+
+TRANSLATE("'S' and 'O' are not supported format types")
+
+TRANSLATE("'await' outside function")
+
+TRANSLATE("'break'/'continue' outside loop")
+
+TRANSLATE("'not' not implemented")
+
+TRANSLATE("'return' outside function")
+
+TRANSLATE("'yield from' inside async function")
+
+TRANSLATE("'yield' outside function")
+
+TRANSLATE("* arg after **")
+
+TRANSLATE("*x must be assignment target")
+
+TRANSLATE(", in %q\n")
+
+TRANSLATE(".show(x) removed. Use .root_group = x")
+
+TRANSLATE("0.0 to a complex power")
+
+TRANSLATE("An error occurred while retrieving '%s':\n")
+
+TRANSLATE("Below minimum frame rate")
+
+TRANSLATE("Bitmap size and bits per value must match")
+
+TRANSLATE("Brightness not adjustable")
+
+TRANSLATE("Brightness not adjustable")
+
+TRANSLATE("Buffer is not a bytearray.")
+
+TRANSLATE("Buffer too small")
+
+TRANSLATE("Buffer too small")
+
+TRANSLATE("Buffer too small")
+
+TRANSLATE("Buffer too small")
+
+TRANSLATE("CBC blocks must be multiples of 16 bytes")
+
+TRANSLATE("Call super().__init__() before accessing native object.")
+
+TRANSLATE("Cannot delete values")
+
+TRANSLATE("Cannot subclass slice")
+
+TRANSLATE("Coordinate arrays have different lengths")
+
+TRANSLATE("Coordinate arrays types have different sizes")
+
+TRANSLATE("Data format error (may be broken data)")
+
+TRANSLATE("Device error or wrong termination of input stream")
+
+TRANSLATE("Display must have a 16 bit colorspace.")
+
+TRANSLATE("Display rotation must be in 90 degree increments")
+
+TRANSLATE("During handling of the above exception, another exception occurred:")
+
+TRANSLATE("ECB only operates on 16 bytes at a time")
+
+TRANSLATE("Error in regex")
+
+TRANSLATE("File exists")
+
+TRANSLATE("For L8 colorspace, input bitmap must have 8 bits per pixel")
+
+TRANSLATE("For RGB colorspaces, input bitmap must have 16 bits per pixel")
+
+TRANSLATE("Format not supported")
+
+TRANSLATE("Group already used")
+
+TRANSLATE("Group already used")
+
+TRANSLATE("I/O operation on closed file")
+
+TRANSLATE("I/O operation on closed file")
+
+TRANSLATE("Input/output error")
+
+TRANSLATE("Insufficient memory pool for the image")
+
+TRANSLATE("Insufficient stream input buffer")
+
+TRANSLATE("Internal error")
+
+TRANSLATE("Interrupted by output function")
+
+TRANSLATE("Invalid %q")
+
+TRANSLATE("Invalid %q")
+
+TRANSLATE("Invalid argument")
+
+TRANSLATE("Invalid bits per value")
+
+TRANSLATE("Invalid format chunk size")
+
+TRANSLATE("Invalid format")
+
+TRANSLATE("Invalid unicode escape")
+
+TRANSLATE("Key must be 16, 24, or 32 bytes long")
+
+TRANSLATE("Key must be 16, 24, or 32 bytes long")
+
+TRANSLATE("LHS of keyword arg must be an id")
+
+TRANSLATE("Layer already in a group")
+
+TRANSLATE("Layer already in a group")
+
+TRANSLATE("Layer already in a group")
+
+TRANSLATE("Layer must be a Group or TileGrid subclass")
+
+TRANSLATE("Length of %q must be an even multiple of channel_count * type_size")
+
+TRANSLATE("Mask bitmap must have 8 bits per pixel")
+
+TRANSLATE("Mask bitmap size must match the other bitmaps")
+
+TRANSLATE("MicroPython .mpy file; use CircuitPython mpy-cross")
+
+TRANSLATE("Must be a %q subclass.")
+
+TRANSLATE("New bitmap must be same size as old bitmap")
+
+TRANSLATE("New bitmap must be same size as old bitmap")
+
+TRANSLATE("No space left on device")
+
+TRANSLATE("No such device")
+
+TRANSLATE("No such file/directory")
+
+TRANSLATE("Object has been deinitialized and can no longer be used. Create a new object.")
+
+TRANSLATE("Only Windows format, uncompressed BMP supported: given header size is %d")
+
+TRANSLATE("Only one color can be transparent at a time")
+
+TRANSLATE("Operation not permitted")
+
+TRANSLATE("Parameter error")
+
+TRANSLATE("Permission denied")
+
+TRANSLATE("Plus any modules on the filesystem\n")
+
+TRANSLATE("Polygon needs at least 3 points")
+
+TRANSLATE("RLE-compressed BMP not supported")
+
+TRANSLATE("Read-only filesystem")
+
+TRANSLATE("Read-only filesystem")
+
+TRANSLATE("Read-only")
+
+TRANSLATE("Read-only")
+
+TRANSLATE("Read-only")
+
+TRANSLATE("Read-only")
+
+TRANSLATE("Read-only")
+
+TRANSLATE("Read-only")
+
+TRANSLATE("Read-only")
+
+TRANSLATE("Requested AES mode is unsupported")
+
+TRANSLATE("Requested AES mode is unsupported")
+
+TRANSLATE("Right format but not supported")
+
+TRANSLATE("Slices not supported")
+
+TRANSLATE("Slices not supported")
+
+TRANSLATE("Slices not supported")
+
+TRANSLATE("Source and destination buffers must be the same length")
+
+TRANSLATE("Supply both or neither of %q and %q")
+
+TRANSLATE("The above exception was the direct cause of the following exception:")
+
+TRANSLATE("The sample's %q does not match")
+
+TRANSLATE("The sample's %q does not match")
+
+TRANSLATE("The sample's %q does not match")
+
+TRANSLATE("The sample's %q does not match")
+
+TRANSLATE("Tile height must exactly divide bitmap height")
+
+TRANSLATE("Tile index out of bounds")
+
+TRANSLATE("Tile index out of bounds")
+
+TRANSLATE("Tile index out of bounds")
+
+TRANSLATE("Tile width must exactly divide bitmap width")
+
+TRANSLATE("Too many displays")
+
+TRANSLATE("Traceback (most recent call last):\n")
+
+TRANSLATE("Unable to init parser")
+
+TRANSLATE("Unable to read color palette data")
+
+TRANSLATE("Unsupported JPEG (may be progressive)")
+
+TRANSLATE("Unsupported colorspace")
+
+TRANSLATE("Welcome to Adafruit CircuitPython %s!\n\nVisit circuitpython.org for more information.\n\nTo list built-in modules type `help(\"modules\")`.\n")
+
+TRANSLATE("__init__() should return None, not '%s'")
+
+TRANSLATE("__new__ arg must be a user-type")
+
+TRANSLATE("a bytes-like object is required")
+
+TRANSLATE("a bytes-like object is required")
+
+TRANSLATE("abort() called")
+
+TRANSLATE("annotation must be an identifier")
+
+TRANSLATE("arg is an empty sequence")
+
+TRANSLATE("arg must be user-type")
+
+TRANSLATE("arg must be user-type")
+
+TRANSLATE("argument name reused")
+
+TRANSLATE("array/bytes required on right side")
+
+TRANSLATE("async for/with outside async function")
+
+TRANSLATE("attributes not supported")
+
+TRANSLATE("background value out of range of target")
+
+TRANSLATE("bad compile mode")
+
+TRANSLATE("bad typecode")
+
+TRANSLATE("bad typecode")
+
+TRANSLATE("binary op %q not implemented")
+
+TRANSLATE("bitmap size and depth must match")
+
+TRANSLATE("bitmap sizes must match")
+
+TRANSLATE("bits must be 32 or less")
+
+TRANSLATE("bits_per_sample must be 16")
+
+TRANSLATE("bits_per_sample must be 8 or 16")
+
+TRANSLATE("bits_per_sample must be 8 or 16")
+
+TRANSLATE("bits_per_sample must be 8 or 16")
+
+TRANSLATE("bits_per_sample must be 8 or 16")
+
+TRANSLATE("bits_per_sample must be 8 or 16")
+
+TRANSLATE("bits_per_sample must be 8 or 16")
+
+TRANSLATE("bits_per_sample must be 8 or 16")
+
+TRANSLATE("bits_per_sample must be 8 or 16")
+
+TRANSLATE("bits_per_sample must be 8 or 16")
+
+TRANSLATE("bits_per_sample must be 8 or 16")
+
+TRANSLATE("buffer size must match format")
+
+TRANSLATE("buffer too small")
+
+TRANSLATE("bytecode overflow")
+
+TRANSLATE("bytes length not a multiple of item size")
+
+TRANSLATE("bytes value out of range")
+
+TRANSLATE("can only have one parent")
+
+TRANSLATE("can only have one parent")
+
+TRANSLATE("can only have one parent")
+
+TRANSLATE("can't add special method to already-subclassed class")
+
+TRANSLATE("can't assign to expression")
+
+TRANSLATE("can't assign to expression")
+
+TRANSLATE("can't assign to expression")
+
+TRANSLATE("can't cancel self")
+
+TRANSLATE("can't convert %q to %q")
+
+TRANSLATE("can't convert %s to complex")
+
+TRANSLATE("can't convert %s to float")
+
+TRANSLATE("can't convert %s to int")
+
+TRANSLATE("can't convert %s to int")
+
+TRANSLATE("can't convert %s to int")
+
+TRANSLATE("can't convert '%q' object to %q implicitly")
+
+TRANSLATE("can't create '%q' instances")
+
+TRANSLATE("can't declare nonlocal in outer code")
+
+TRANSLATE("can't delete expression")
+
+TRANSLATE("can't do binary op between '%q' and '%q'")
+
+TRANSLATE("can't do unary op of '%q'")
+
+TRANSLATE("can't implicitly convert '%q' to 'bool'")
+
+TRANSLATE("can't import name %q")
+
+TRANSLATE("can't load from '%q'")
+
+TRANSLATE("can't load from '%q'")
+
+TRANSLATE("can't load with '%q' index")
+
+TRANSLATE("can't perform relative import")
+
+TRANSLATE("can't send non-None value to a just-started generator")
+
+TRANSLATE("can't set attribute '%q'")
+
+TRANSLATE("can't set attribute")
+
+TRANSLATE("can't store '%q'")
+
+TRANSLATE("can't store '%q'")
+
+TRANSLATE("can't store to '%q'")
+
+TRANSLATE("can't store to '%q'")
+
+TRANSLATE("can't store with '%q' index")
+
+TRANSLATE("can't switch from automatic field numbering to manual field specification")
+
+TRANSLATE("can't switch from manual field specification to automatic field numbering")
+
+TRANSLATE("can't truncate-divide a complex number")
+
+TRANSLATE("can't wait")
+
+TRANSLATE("cannot emit native code for this architecture")
+
+TRANSLATE("casting")
+
+TRANSLATE("chr() arg not in range(0x110000)")
+
+TRANSLATE("clip point must be (x,y) tuple")
+
+TRANSLATE("color buffer must be 3 bytes (RGB) or 4 bytes (RGB + pad byte)")
+
+TRANSLATE("color buffer must be a buffer, tuple, list, or int")
+
+TRANSLATE("color buffer must be a bytearray or array of type 'b' or 'B'")
+
+TRANSLATE("color must be between 0x000000 and 0xffffff")
+
+TRANSLATE("comparison of int and uint")
+
+TRANSLATE("complex divide by zero")
+
+TRANSLATE("compression header")
+
+TRANSLATE("conversion to object")
+
+TRANSLATE("default 'except' must be last")
+
+TRANSLATE("dict update sequence has wrong length")
+
+TRANSLATE("div/mod not implemented for uint")
+
+TRANSLATE("divide by zero")
+
+TRANSLATE("division by zero")
+
+TRANSLATE("empty heap")
+
+TRANSLATE("empty heap")
+
+TRANSLATE("empty separator")
+
+TRANSLATE("empty separator")
+
+TRANSLATE("empty separator")
+
+TRANSLATE("empty")
+
+TRANSLATE("empty")
+
+TRANSLATE("en_US")
+
+TRANSLATE("end of format while looking for conversion specifier")
+
+TRANSLATE("exceptions must derive from BaseException")
+
+TRANSLATE("expected ':' after format specifier")
+
+TRANSLATE("expecting a dict for keyword args")
+
+TRANSLATE("expecting just a value for set")
+
+TRANSLATE("expecting key:value for dict")
+
+TRANSLATE("extra keyword arguments given")
+
+TRANSLATE("extra positional arguments given")
+
+TRANSLATE("file must be a file opened in byte mode")
+
+TRANSLATE("file must be a file opened in byte mode")
+
+TRANSLATE("file must be a file opened in byte mode")
+
+TRANSLATE("first argument to super() must be type")
+
+TRANSLATE("format needs a dict")
+
+TRANSLATE("format string didn't convert all arguments")
+
+TRANSLATE("format string needs more arguments")
+
+TRANSLATE("full")
+
+TRANSLATE("full")
+
+TRANSLATE("function doesn't take keyword arguments")
+
+TRANSLATE("function expected at most %d arguments, got %d")
+
+TRANSLATE("function got multiple values for argument '%q'")
+
+TRANSLATE("function got multiple values for argument '%q'")
+
+TRANSLATE("function missing %d required positional arguments")
+
+TRANSLATE("function missing keyword-only argument")
+
+TRANSLATE("function missing required keyword argument '%q'")
+
+TRANSLATE("function missing required positional argument #%d")
+
+TRANSLATE("function takes %d positional arguments but %d were given")
+
+TRANSLATE("generator already executing")
+
+TRANSLATE("generator already executing")
+
+TRANSLATE("generator ignored GeneratorExit")
+
+TRANSLATE("generator raised StopIteration")
+
+TRANSLATE("generator raised StopIteration")
+
+TRANSLATE("heap must be a list")
+
+TRANSLATE("identifier redefined as global")
+
+TRANSLATE("identifier redefined as nonlocal")
+
+TRANSLATE("import * not at module level")
+
+TRANSLATE("incompatible .mpy arch")
+
+TRANSLATE("incompatible .mpy file")
+
+TRANSLATE("incompatible .mpy file")
+
+TRANSLATE("incomplete format key")
+
+TRANSLATE("incomplete format")
+
+TRANSLATE("incorrect padding")
+
+TRANSLATE("index out of range")
+
+TRANSLATE("invalid bits_per_pixel %d, must be, 1, 2, 4, 8, 16, 24, or 32")
+
+TRANSLATE("invalid element size %d for bits_per_pixel %d\n")
+
+TRANSLATE("invalid element_size %d, must be, 1, 2, or 4")
+
+TRANSLATE("invalid exception")
+
+TRANSLATE("invalid format specifier")
+
+TRANSLATE("invalid micropython decorator")
+
+TRANSLATE("invalid micropython decorator")
+
+TRANSLATE("invalid mktime usage")
+
+TRANSLATE("invalid syntax for number")
+
+TRANSLATE("invalid syntax")
+
+TRANSLATE("invalid syntax")
+
+TRANSLATE("invalid syntax")
+
+TRANSLATE("issubclass() arg 1 must be a class")
+
+TRANSLATE("issubclass() arg 2 must be a class or a tuple of classes")
+
+TRANSLATE("join expects a list of str/bytes objects consistent with self object")
+
+TRANSLATE("keyword argument(s) not implemented - use normal args instead")
+
+TRANSLATE("lhs and rhs should be compatible")
+
+TRANSLATE("local '%q' has type '%q' but source is '%q'")
+
+TRANSLATE("local '%q' used before type known")
+
+TRANSLATE("local variable referenced before assignment")
+
+TRANSLATE("malformed f-string")
+
+TRANSLATE("math domain error")
+
+TRANSLATE("maximum recursion depth exceeded")
+
+TRANSLATE("memory allocation failed, allocating %u bytes")
+
+TRANSLATE("memory allocation failed, heap is locked")
+
+TRANSLATE("memoryview offset too large")
+
+TRANSLATE("memoryview: length is not a multiple of itemsize")
+
+TRANSLATE("mktime needs a tuple of length 8 or 9")
+
+TRANSLATE("module '%q' has no attribute '%q'")
+
+TRANSLATE("multiple *x in assignment")
+
+TRANSLATE("multiple bases have instance lay-out conflict")
+
+TRANSLATE("must raise an object")
+
+TRANSLATE("must use keyword argument for key function")
+
+TRANSLATE("name '%q' isn't defined")
+
+TRANSLATE("name too long")
+
+TRANSLATE("native code in .mpy unsupported")
+
+TRANSLATE("native yield")
+
+TRANSLATE("need more than %d values to unpack")
+
+TRANSLATE("need more than %d values to unpack")
+
+TRANSLATE("negative factorial")
+
+TRANSLATE("negative shift count")
+
+TRANSLATE("negative shift count")
+
+TRANSLATE("negative shift count")
+
+TRANSLATE("no active exception to reraise")
+
+TRANSLATE("no binding for nonlocal found")
+
+TRANSLATE("no module named '%q'")
+
+TRANSLATE("no such attribute")
+
+TRANSLATE("non-default argument follows default argument")
+
+TRANSLATE("non-hex digit")
+
+TRANSLATE("not a constant")
+
+TRANSLATE("object ")
+
+TRANSLATE("object '%s' isn't a tuple or list")
+
+TRANSLATE("object not in sequence")
+
+TRANSLATE("object not in sequence")
+
+TRANSLATE("object of type '%s' has no len()")
+
+TRANSLATE("object with buffer protocol required")
+
+TRANSLATE("only slices with step=1 (aka None) are supported")
+
+TRANSLATE("only slices with step=1 (aka None) are supported")
+
+TRANSLATE("only slices with step=1 (aka None) are supported")
+
+TRANSLATE("only slices with step=1 (aka None) are supported")
+
+TRANSLATE("opcode")
+
+TRANSLATE("ord() expected a character, but string of length %d found")
+
+TRANSLATE("out of range of target")
+
+TRANSLATE("out of range of target")
+
+TRANSLATE("out of range of target")
+
+TRANSLATE("out of range of target")
+
+TRANSLATE("out of range of target")
+
+TRANSLATE("out of range of target")
+
+TRANSLATE("overflow converting long int to machine word")
+
+TRANSLATE("overflow converting long int to machine word")
+
+TRANSLATE("pop from empty %q")
+
+TRANSLATE("pop from empty %q")
+
+TRANSLATE("pop from empty %q")
+
+TRANSLATE("positional arg after **")
+
+TRANSLATE("positional arg after keyword arg")
+
+TRANSLATE("pow() 3rd argument cannot be 0")
+
+TRANSLATE("pow() with 3 arguments requires integers")
+
+TRANSLATE("regex too complex")
+
+TRANSLATE("requested length %d but object has length %d")
+
+TRANSLATE("return expected '%q' but got '%q'")
+
+TRANSLATE("rsplit(None,n)")
+
+TRANSLATE("samples_signed must be true")
+
+TRANSLATE("schedule queue full")
+
+TRANSLATE("sign not allowed in string format specifier")
+
+TRANSLATE("sign not allowed with integer format specifier 'c'")
+
+TRANSLATE("small int overflow")
+
+TRANSLATE("source palette too large")
+
+TRANSLATE("source palette too large")
+
+TRANSLATE("source_bitmap must have value_count of 2 or 65536")
+
+TRANSLATE("source_bitmap must have value_count of 65536")
+
+TRANSLATE("source_bitmap must have value_count of 8")
+
+TRANSLATE("splitting with sub-captures")
+
+TRANSLATE("stream operation not supported")
+
+TRANSLATE("string argument without an encoding")
+
+TRANSLATE("string argument without an encoding")
+
+TRANSLATE("string index out of range")
+
+TRANSLATE("string index out of range")
+
+TRANSLATE("string indices must be integers, not %s")
+
+TRANSLATE("substring not found")
+
+TRANSLATE("substring not found")
+
+TRANSLATE("super() can't find self")
+
+TRANSLATE("syntax error in JSON")
+
+TRANSLATE("ticks interval overflow")
+
+TRANSLATE("too many args")
+
+TRANSLATE("too many values to unpack (expected %d)")
+
+TRANSLATE("type '%q' isn't an acceptable base type")
+
+TRANSLATE("type object '%q' has no attribute '%q'")
+
+TRANSLATE("type takes 1 or 3 arguments")
+
+TRANSLATE("unexpected indent")
+
+TRANSLATE("unexpected keyword argument '%q'")
+
+TRANSLATE("unexpected keyword argument '%q'")
+
+TRANSLATE("unexpected keyword argument '%q'")
+
+TRANSLATE("unicode name escapes")
+
+TRANSLATE("unindent doesn't match any outer indent level")
+
+TRANSLATE("unknown conversion specifier %c")
+
+TRANSLATE("unknown format code '%c' for object of type '%q'")
+
+TRANSLATE("unknown format code '%c' for object of type '%q'")
+
+TRANSLATE("unknown format code '%c' for object of type '%q'")
+
+TRANSLATE("unknown type '%q'")
+
+TRANSLATE("unmatched '%c' in format")
+
+TRANSLATE("unmatched '%c' in format")
+
+TRANSLATE("unreadable attribute")
+
+TRANSLATE("unreadable attribute")
+
+TRANSLATE("unreadable attribute")
+
+TRANSLATE("unsupported %q type")
+
+TRANSLATE("unsupported %q type")
+
+TRANSLATE("unsupported %q type")
+
+TRANSLATE("unsupported %q type")
+
+TRANSLATE("unsupported %q type")
+
+TRANSLATE("unsupported %q type")
+
+TRANSLATE("unsupported %q type")
+
+TRANSLATE("unsupported bitmap depth")
+
+TRANSLATE("unsupported bitmap depth")
+
+TRANSLATE("unsupported bitmap depth")
+
+TRANSLATE("unsupported bitmap depth")
+
+TRANSLATE("unsupported bitmap depth")
+
+TRANSLATE("unsupported bitmap depth")
+
+TRANSLATE("unsupported colorspace for dither")
+
+TRANSLATE("unsupported format character '%c' (0x%x) at index %d")
+
+TRANSLATE("unsupported type for %q: '%s'")
+
+TRANSLATE("unsupported types for %q: '%q', '%q'")
+
+TRANSLATE("value must fit in %d byte(s)")
+
+TRANSLATE("value must fit in %d byte(s)")
+
+TRANSLATE("value out of range of target")
+
+TRANSLATE("weights must be a sequence with an odd square number of elements (usually 9 or 25)")
+
+TRANSLATE("weights must be an object of type %q, %q, %q, or %q, not %q ")
+
+TRANSLATE("wrong number of arguments")
+
+TRANSLATE("wrong number of arguments")
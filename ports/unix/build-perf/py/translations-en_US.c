@@ -0,0 +1,348 @@
+// This file was automatically generated by maketranslatedata.py
+#include "supervisor/shared/translate/compressed_string.h"
+
+const struct compressed_string translation0 = { .data = 20, .tail = { 3, 250, 165, 140, 127, 166, 157, 127, 211, 208, 89, 20, 198, 149 } }; //   File \"%q\", line %d
+const struct compressed_string translation1 = { .data = 16, .tail = { 9, 1, 183, 19, 206, 12, 105, 215, 231, 249, 128 } }; //  is of type %q\n
+const struct compressed_string translation2 = { .data = 21, .tail = { 211, 74, 5, 51, 172, 4, 89, 12, 226, 157, 9, 192 } }; // %%c needs int or char
+const struct compressed_string translation3 = { .data = 41, .tail = { 211, 168, 69, 26, 117, 23, 204, 72, 216, 195, 110, 39, 156, 24, 211, 168, 103, 26, 117, 244, 10, 210, 52, 234 } }; // %q in %q must be of type %q or %q, not %q
+const struct compressed_string translation4 = { .data = 35, .tail = { 211, 168, 69, 26, 117, 23, 204, 72, 216, 195, 110, 39, 156, 24, 211, 175, 160, 86, 145, 167, 80 } }; // %q in %q must be of type %q, not %q
+const struct compressed_string translation5 = { .data = 21, .tail = { 211, 168, 69, 169, 248, 13, 153, 13, 184, 114, 94, 12 } }; // %q index out of range
+const struct compressed_string translation6 = { .data = 35, .tail = { 211, 168, 69, 170, 80, 224, 95, 49, 35, 99, 8, 178, 124, 27, 199, 160, 86, 145, 164, 0 } }; // %q indices must be integers, not %s
+const struct compressed_string translation7 = { .data = 20, .tail = { 211, 168, 177, 175, 19, 208, 95, 49, 35, 99, 26, 84 } }; // %q length must be %d
+const struct compressed_string translation8 = { .data = 23, .tail = { 211, 168, 177, 175, 19, 208, 95, 49, 35, 99, 26, 87, 221, 165, 64 } }; // %q length must be %d-%d
+const struct compressed_string translation9 = { .data = 23, .tail = { 211, 168, 177, 175, 19, 208, 95, 49, 35, 99, 31, 237, 252, 134, 149 } }; // %q length must be <= %d
+const struct compressed_string translation10 = { .data = 23, .tail = { 211, 168, 177, 175, 19, 208, 95, 49, 35, 99, 31, 239, 252, 134, 149 } }; // %q length must be >= %d
+const struct compressed_string translation11 = { .data = 13, .tail = { 211, 168, 190, 98, 70, 198, 52, 168 } }; // %q must be %d
+const struct compressed_string translation12 = { .data = 16, .tail = { 211, 168, 190, 98, 70, 198, 52, 175, 187, 74, 128 } }; // %q must be %d-%d
+const struct compressed_string translation13 = { .data = 16, .tail = { 211, 168, 190, 98, 70, 198, 63, 219, 249, 13, 42 } }; // %q must be <= %d
+const struct compressed_string translation14 = { .data = 16, .tail = { 211, 168, 190, 98, 70, 198, 63, 223, 249, 13, 42 } }; // %q must be >= %d
+const struct compressed_string translation15 = { .data = 61, .tail = { 211, 168, 190, 98, 70, 198, 8, 109, 204, 153, 59, 151, 33, 156, 19, 185, 114, 27, 113, 60, 224, 198, 189, 53, 244, 26, 255, 206, 190, 131, 93, 181, 244, 12, 227, 95, 187, 80 } }; // %q must be a bytearray or array of type 'h', 'H', 'b', or 'B'
+const struct compressed_string translation16 = { .data = 28, .tail = { 211, 168, 190, 98, 70, 198, 9, 220, 185, 13, 184, 158, 112, 99, 94, 154, 128 } }; // %q must be array of type 'h'
+const struct compressed_string translation17 = { .data = 35, .tail = { 211, 168, 190, 98, 70, 198, 27, 113, 60, 224, 198, 157, 67, 56, 211, 175, 160, 86, 145, 167, 80 } }; // %q must be of type %q or %q, not %q
+const struct compressed_string translation18 = { .data = 40, .tail = { 211, 168, 190, 98, 70, 198, 27, 113, 60, 224, 198, 157, 125, 6, 157, 125, 3, 56, 211, 175, 160, 86, 145, 167, 80 } }; // %q must be of type %q, %q, or %q, not %q
+const struct compressed_string translation19 = { .data = 29, .tail = { 211, 168, 190, 98, 70, 198, 27, 113, 60, 224, 198, 157, 125, 2, 180, 141, 58, 128 } }; // %q must be of type %q, not %q
+const struct compressed_string translation20 = { .data = 15, .tail = { 211, 168, 108, 200, 109, 195, 146, 240, 96 } }; // %q out of range
+const struct compressed_string translation21 = { .data = 22, .tail = { 211, 168, 137, 60, 10, 18, 171, 72, 216, 199, 200, 221, 128 } }; // %q step cannot be zero
+const struct compressed_string translation22 = { .data = 52, .tail = { 211, 175, 151, 152, 146, 246, 56, 26, 84, 97, 161, 37, 25, 74, 192, 159, 140, 220, 214, 96, 109, 153, 26, 84, 119, 55, 49, 194, 118, 53 } }; // %q() takes %d positional arguments but %d were given
+const struct compressed_string translation23 = { .data = 17, .tail = { 211, 175, 151, 152, 238, 147, 209, 179, 35, 78, 190, 94, 96 } }; // %q() without %q()
+const struct compressed_string translation24 = { .data = 5, .tail = { 211, 175, 242, 211, 168 } }; // %q=%q
+const struct compressed_string translation25 = { .data = 2, .tail = { 210, 0 } }; // %s
+const struct compressed_string translation26 = { .data = 22, .tail = { 215, 78, 186, 130, 126, 51, 115, 89, 14, 125, 114, 142, 117 } }; // '%q' argument required
+const struct compressed_string translation27 = { .data = 33, .tail = { 215, 78, 186, 134, 219, 226, 116, 145, 86, 56, 10, 210, 35, 56, 195, 60, 141, 116, 235, 168 } }; // '%q' object does not support '%q'
+const struct compressed_string translation28 = { .data = 29, .tail = { 215, 78, 186, 134, 219, 226, 116, 144, 144, 186, 200, 37, 9, 38, 229, 44, 224 } }; // '%q' object isn't an iterator
+const struct compressed_string translation29 = { .data = 26, .tail = { 215, 78, 186, 134, 219, 226, 116, 144, 144, 186, 200, 161, 90, 197, 181, 140 } }; // '%q' object isn't callable
+const struct compressed_string translation30 = { .data = 26, .tail = { 215, 78, 186, 134, 219, 226, 116, 144, 144, 186, 200, 73, 55, 45, 172, 96 } }; // '%q' object isn't iterable
+const struct compressed_string translation31 = { .data = 43, .tail = { 215, 72, 212, 54, 223, 19, 164, 138, 177, 194, 235, 34, 51, 140, 51, 200, 73, 59, 130, 136, 78, 22, 230, 178 } }; // '%s' object doesn't support item assignment
+const struct compressed_string translation32 = { .data = 41, .tail = { 215, 72, 212, 54, 223, 19, 164, 138, 177, 194, 235, 34, 51, 140, 51, 200, 73, 59, 138, 157, 142, 81, 148 } }; // '%s' object doesn't support item deletion
+const struct compressed_string translation33 = { .data = 33, .tail = { 215, 72, 212, 54, 223, 19, 164, 142, 133, 1, 88, 20, 203, 166, 217, 147, 26, 233, 215, 80 } }; // '%s' object has no attribute '%q'
+const struct compressed_string translation34 = { .data = 31, .tail = { 215, 72, 212, 54, 223, 19, 164, 132, 133, 214, 68, 103, 104, 163, 166, 36, 182, 177, 128 } }; // '%s' object isn't subscriptable
+const struct compressed_string translation35 = { .data = 52, .tail = { 215, 249, 106, 10, 201, 194, 220, 214, 66, 180, 130, 181, 155, 185, 212, 34, 136, 151, 69, 224, 110, 207, 114, 145, 24, 58, 38, 232, 110 } }; // '=' alignment not allowed in string format specifier
+const struct compressed_string translation36 = { .data = 42, .tail = { 215, 245, 212, 18, 212, 107, 254, 53, 4, 230, 21, 164, 70, 113, 134, 121, 58, 141, 217, 238, 82, 39, 156, 28, 0 } }; // 'S' and 'O' are not supported format types
+const struct compressed_string translation37 = { .data = 24, .tail = { 212, 187, 146, 78, 161, 179, 48, 149, 49, 190, 86, 146, 140, 160 } }; // 'await' outside function
+const struct compressed_string translation38 = { .data = 31, .tail = { 215, 103, 50, 246, 215, 247, 107, 70, 89, 69, 201, 234, 27, 51, 9, 83, 22, 102, 192 } }; // 'break'/'continue' outside loop
+const struct compressed_string translation39 = { .data = 21, .tail = { 213, 90, 117, 10, 210, 18, 248, 177, 220, 214, 78, 160 } }; // 'not' not implemented
+const struct compressed_string translation40 = { .data = 25, .tail = { 213, 206, 114, 235, 168, 108, 204, 37, 76, 111, 149, 164, 163, 40 } }; // 'return' outside function
+const struct compressed_string translation41 = { .data = 34, .tail = { 215, 148, 59, 84, 110, 237, 125, 66, 44, 37, 76, 20, 114, 180, 27, 229, 105, 40, 202 } }; // 'yield from' inside async function
+const struct compressed_string translation42 = { .data = 24, .tail = { 215, 148, 59, 87, 80, 217, 152, 74, 152, 223, 43, 73, 70, 80 } }; // 'yield' outside function
+const struct compressed_string translation43 = { .data = 14, .tail = { 250, 1, 63, 0, 183, 147, 113, 244, 125, 0 } }; // * arg after **
+const struct compressed_string translation44 = { .data = 28, .tail = { 250, 60, 11, 230, 36, 108, 96, 162, 19, 133, 185, 172, 137, 39, 224, 228 } }; // *x must be assignment target
+const struct compressed_string translation45 = { .data = 9, .tail = { 244, 8, 163, 78, 191, 63, 204 } }; // , in %q\n
+const struct compressed_string translation46 = { .data = 37, .tail = { 247, 199, 70, 239, 229, 227, 204, 57, 221, 187, 29, 125, 227, 252, 193, 143, 123, 179, 79, 175, 14, 217, 192, 254, 67, 192 } }; // .show(x) removed. Use .root_group = x
+const struct compressed_string translation47 = { .data = 22, .tail = { 248, 123, 254, 2, 88, 16, 163, 95, 22, 63, 3, 13, 220, 220 } }; // 0.0 to a complex power
+const struct compressed_string translation48 = { .data = 42, .tail = { 255, 133, 6, 238, 206, 26, 148, 203, 185, 212, 119, 232, 150, 48, 231, 46, 135, 217, 23, 129, 174, 145, 175, 219, 243, 252, 192 } }; // An error occurred while retrieving '%s':\n
+const struct compressed_string translation49 = { .data = 24, .tail = { 251, 142, 205, 220, 93, 21, 47, 155, 141, 220, 174, 97, 202, 76 } }; // Below minimum frame rate
+const struct compressed_string translation50 = { .data = 41, .tail = { 251, 146, 110, 88, 16, 159, 35, 4, 181, 27, 36, 192, 193, 184, 236, 86, 201, 139, 230, 36, 92, 166, 157, 0 } }; // Bitmap size and bits per value must match
+const struct compressed_string translation51 = { .data = 25, .tail = { 251, 157, 56, 233, 42, 113, 1, 90, 65, 87, 227, 152, 146, 218, 198 } }; // Brightness not adjustable
+const struct compressed_string translation52 = { .data = 26, .tail = { 251, 179, 190, 230, 225, 32, 43, 72, 33, 183, 50, 100, 238, 92, 251, 192 } }; // Buffer is not a bytearray.
+const struct compressed_string translation53 = { .data = 16, .tail = { 251, 179, 190, 230, 226, 89, 132, 92, 173, 96 } }; // Buffer too small
+const struct compressed_string translation54 = { .data = 40, .tail = { 251, 254, 239, 188, 109, 102, 167, 180, 11, 230, 36, 108, 98, 249, 180, 166, 44, 112, 27, 113, 244, 253, 131, 110, 100, 224 } }; // CBC blocks must be multiples of 16 bytes
+const struct compressed_string translation55 = { .data = 55, .tail = { 251, 202, 214, 17, 156, 27, 249, 121, 251, 253, 125, 81, 82, 125, 125, 124, 188, 198, 199, 187, 57, 130, 165, 14, 33, 23, 128, 165, 41, 216, 195, 109, 241, 58, 79, 188 } }; // Call super().__init__() before accessing native object.
+const struct compressed_string translation56 = { .data = 20, .tail = { 251, 201, 85, 164, 84, 236, 114, 99, 177, 91, 39, 0 } }; // Cannot delete values
+const struct compressed_string translation57 = { .data = 21, .tail = { 251, 201, 85, 164, 70, 118, 165, 138, 32, 69, 146, 134 } }; // Cannot subclass slice
+const struct compressed_string translation58 = { .data = 40, .tail = { 251, 217, 158, 168, 165, 38, 9, 220, 185, 129, 208, 187, 24, 170, 111, 185, 185, 172, 139, 26, 241, 61, 32 } }; // Coordinate arrays have different lengths
+const struct compressed_string translation59 = { .data = 44, .tail = { 251, 217, 158, 168, 165, 38, 9, 220, 185, 129, 60, 224, 224, 116, 46, 198, 42, 155, 238, 110, 107, 34, 19, 228, 112 } }; // Coordinate arrays types have different sizes
+const struct compressed_string translation60 = { .data = 38, .tail = { 254, 101, 36, 55, 103, 185, 72, 55, 118, 113, 229, 114, 228, 108, 99, 103, 111, 99, 81, 82, 146, 243 } }; // Data format error (may be broken data)
+const struct compressed_string translation61 = { .data = 49, .tail = { 254, 103, 217, 40, 96, 221, 217, 195, 56, 238, 236, 188, 9, 55, 186, 41, 74, 50, 134, 220, 34, 227, 50, 34, 92, 202, 224 } }; // Device error or wrong termination of input stream
+const struct compressed_string translation62 = { .data = 38, .tail = { 254, 105, 24, 177, 114, 47, 152, 145, 208, 187, 24, 33, 244, 253, 131, 100, 145, 70, 179, 60, 96, 168, 126, 240 } }; // Display must have a 16 bit colorspace.
+const struct compressed_string translation63 = { .data = 48, .tail = { 254, 105, 24, 177, 114, 29, 164, 165, 25, 69, 243, 18, 54, 48, 138, 63, 215, 224, 42, 124, 57, 152, 69, 163, 157, 205, 102, 0 } }; // Display rotation must be in 90 degree increments
+const struct compressed_string translation64 = { .data = 67, .tail = { 254, 121, 116, 94, 7, 66, 90, 217, 23, 128, 219, 137, 232, 96, 182, 110, 198, 15, 197, 15, 18, 140, 190, 128, 149, 167, 161, 184, 63, 20, 60, 74, 50, 134, 165, 50, 238, 117, 251, 64 } }; // During handling of the above exception, another exception occurred:
+const struct compressed_string translation65 = { .data = 39, .tail = { 254, 159, 127, 220, 25, 109, 200, 108, 27, 148, 156, 6, 81, 244, 253, 131, 110, 100, 224, 20, 130, 18, 151, 48 } }; // ECB only operates on 16 bytes at a time
+const struct compressed_string translation66 = { .data = 14, .tail = { 254, 142, 236, 225, 20, 57, 240, 126, 0 } }; // Error in regex
+const struct compressed_string translation67 = { .data = 11, .tail = { 254, 169, 99, 7, 225, 34, 96 } }; // File exists
+const struct compressed_string translation68 = { .data = 58, .tail = { 254, 172, 227, 251, 127, 17, 70, 179, 60, 96, 168, 126, 129, 23, 25, 145, 178, 77, 203, 2, 249, 137, 29, 11, 177, 143, 226, 54, 73, 129, 131, 113, 132, 240, 118 } }; // For L8 colorspace, input bitmap must have 8 bits per pixel
+const struct compressed_string translation69 = { .data = 61, .tail = { 254, 172, 227, 244, 252, 62, 225, 70, 179, 60, 96, 168, 113, 232, 17, 113, 153, 27, 36, 220, 176, 47, 152, 145, 208, 187, 24, 250, 126, 193, 178, 76, 12, 27, 140, 39, 131, 176 } }; // For RGB colorspaces, input bitmap must have 16 bits per pixel
+const struct compressed_string translation70 = { .data = 20, .tail = { 254, 172, 247, 41, 10, 210, 35, 56, 195, 60, 157, 64 } }; // Format not supported
+const struct compressed_string translation71 = { .data = 18, .tail = { 252, 29, 179, 128, 86, 115, 42, 242, 51, 7, 80 } }; // Group already used
+const struct compressed_string translation72 = { .data = 28, .tail = { 252, 127, 119, 248, 13, 131, 114, 148, 101, 12, 162, 150, 104, 58, 141, 210, 198 } }; // I/O operation on closed file
+const struct compressed_string translation73 = { .data = 18, .tail = { 252, 87, 25, 159, 220, 217, 156, 102, 65, 187, 179, 128 } }; // Input/output error
+const struct compressed_string translation74 = { .data = 38, .tail = { 252, 86, 51, 190, 233, 68, 53, 145, 115, 187, 63, 35, 12, 214, 27, 179, 137, 232, 97, 46, 92, 24 } }; // Insufficient memory pool for the image
+const struct compressed_string translation75 = { .data = 32, .tail = { 252, 86, 51, 190, 233, 68, 53, 145, 18, 230, 87, 8, 184, 204, 141, 179, 190, 230, 224 } }; // Insufficient stream input buffer
+const struct compressed_string translation76 = { .data = 14, .tail = { 252, 86, 77, 212, 172, 13, 221, 156 } }; // Internal error
+const struct compressed_string translation77 = { .data = 30, .tail = { 252, 86, 77, 223, 56, 147, 168, 219, 144, 217, 156, 102, 70, 249, 90, 74, 50, 128 } }; // Interrupted by output function
+const struct compressed_string translation78 = { .data = 10, .tail = { 252, 87, 177, 89, 42, 52, 234 } }; // Invalid %q
+const struct compressed_string translation79 = { .data = 16, .tail = { 252, 87, 177, 89, 42, 9, 248, 205, 205, 100 } }; // Invalid argument
+const struct compressed_string translation80 = { .data = 22, .tail = { 252, 87, 177, 89, 42, 54, 73, 129, 131, 113, 216, 173, 147 } }; // Invalid bits per value
+const struct compressed_string translation81 = { .data = 14, .tail = { 252, 87, 177, 89, 42, 55, 103, 185, 72 } }; // Invalid format
+const struct compressed_string translation82 = { .data = 25, .tail = { 252, 87, 177, 89, 42, 55, 103, 185, 72, 167, 76, 175, 176, 132, 249, 24 } }; // Invalid format chunk size
+const struct compressed_string translation83 = { .data = 22, .tail = { 252, 87, 177, 89, 42, 50, 169, 70, 169, 131, 138, 22, 12 } }; // Invalid unicode escape
+const struct compressed_string translation84 = { .data = 36, .tail = { 255, 241, 242, 47, 152, 145, 177, 143, 167, 236, 244, 31, 87, 239, 244, 12, 227, 235, 250, 134, 220, 201, 192, 179, 47, 0 } }; // Key must be 16, 24, or 32 bytes long
+const struct compressed_string translation85 = { .data = 32, .tail = { 254, 223, 243, 250, 134, 220, 123, 31, 61, 217, 234, 9, 248, 23, 204, 72, 216, 193, 40, 74, 128 } }; // LHS of keyword arg must be an id
+const struct compressed_string translation86 = { .data = 24, .tail = { 254, 197, 201, 184, 43, 57, 149, 121, 8, 160, 135, 14, 217, 192 } }; // Layer already in a group
+const struct compressed_string translation87 = { .data = 42, .tail = { 254, 197, 201, 184, 190, 98, 70, 198, 8, 126, 14, 217, 192, 103, 31, 178, 88, 255, 7, 74, 136, 206, 212, 177, 68, 0 } }; // Layer must be a Group or TileGrid subclass
+const struct compressed_string translation88 = { .data = 66, .tail = { 254, 198, 188, 79, 64, 219, 141, 58, 139, 230, 36, 108, 96, 148, 31, 99, 81, 124, 218, 83, 22, 48, 219, 138, 116, 37, 83, 183, 173, 27, 43, 35, 232, 19, 206, 15, 214, 19, 228, 96 } }; // Length of %q must be an even multiple of channel_count * type_size
+const struct compressed_string translation89 = { .data = 38, .tail = { 254, 229, 30, 195, 100, 155, 150, 5, 243, 18, 58, 23, 99, 31, 196, 108, 147, 3, 6, 227, 9, 224, 236 } }; // Mask bitmap must have 8 bits per pixel
+const struct compressed_string translation90 = { .data = 45, .tail = { 254, 229, 30, 195, 100, 155, 150, 4, 39, 200, 197, 243, 18, 46, 83, 78, 130, 122, 24, 105, 232, 110, 54, 73, 185, 98, 0 } }; // Mask bitmap size must match the other bitmaps
+const struct compressed_string translation91 = { .data = 50, .tail = { 254, 233, 71, 111, 207, 153, 232, 202, 61, 247, 199, 35, 116, 177, 255, 244, 102, 12, 125, 232, 244, 202, 79, 231, 204, 244, 101, 23, 199, 62, 234, 59, 68, 0 } }; // MicroPython .mpy file; use CircuitPython mpy-cross
+const struct compressed_string translation92 = { .data = 22, .tail = { 254, 249, 137, 27, 24, 33, 167, 81, 25, 218, 150, 40, 143, 120 } }; // Must be a %q subclass.
+const struct compressed_string translation93 = { .data = 42, .tail = { 252, 143, 184, 217, 38, 229, 129, 124, 196, 141, 140, 65, 92, 196, 39, 200, 193, 64, 107, 84, 108, 147, 114, 192 } }; // New bitmap must be same size as old bitmap
+const struct compressed_string translation94 = { .data = 23, .tail = { 252, 152, 70, 10, 134, 44, 123, 200, 101, 21, 62, 201, 67 } }; // No space left on device
+const struct compressed_string translation95 = { .data = 14, .tail = { 252, 152, 70, 105, 208, 84, 251, 37, 12 } }; // No such device
+const struct compressed_string translation96 = { .data = 22, .tail = { 252, 152, 70, 105, 208, 110, 150, 63, 221, 84, 115, 164, 179, 242 } }; // No such file/directory
+const struct compressed_string translation97 = { .data = 77, .tail = { 255, 27, 124, 78, 146, 58, 20, 13, 140, 212, 84, 209, 82, 80, 172, 159, 35, 168, 37, 168, 161, 40, 86, 22, 101, 224, 220, 108, 99, 48, 117, 247, 143, 189, 204, 164, 193, 5, 62, 225, 182, 248, 157, 39, 222 } }; // Object has been deinitialized and can no longer be used. Create a new object.
+const struct compressed_string translation98 = { .data = 72, .tail = { 255, 11, 110, 71, 253, 162, 213, 187, 192, 221, 158, 229, 62, 131, 43, 70, 190, 28, 226, 14, 163, 238, 254, 255, 152, 140, 227, 12, 242, 117, 251, 71, 9, 216, 212, 116, 50, 169, 184, 132, 249, 24, 72, 26, 84 } }; // Only Windows format, uncompressed BMP supported: given header size is %d
+const struct compressed_string translation99 = { .data = 43, .tail = { 255, 11, 110, 67, 41, 138, 53, 153, 197, 9, 70, 198, 37, 201, 99, 4, 230, 178, 10, 65, 9, 75, 152 } }; // Only one color can be transparent at a time
+const struct compressed_string translation100 = { .data = 23, .tail = { 255, 24, 55, 41, 70, 80, 173, 35, 6, 247, 73, 147, 168 } }; // Operation not permitted
+const struct compressed_string translation101 = { .data = 15, .tail = { 252, 201, 202, 231, 38, 224, 221, 217, 192 } }; // Parameter error
+const struct compressed_string translation102 = { .data = 17, .tail = { 252, 205, 238, 145, 8, 202, 42, 106, 135, 80 } }; // Permission denied
+const struct compressed_string translation103 = { .data = 36, .tail = { 252, 237, 152, 4, 188, 139, 181, 115, 99, 128, 202, 39, 161, 141, 210, 199, 28, 196, 157, 254, 127, 152 } }; // Plus any modules on the filesystem\n
+const struct compressed_string translation104 = { .data = 31, .tail = { 252, 218, 220, 240, 202, 20, 206, 176, 10, 69, 140, 162, 71, 214, 48, 200, 179, 0 } }; // Polygon needs at least 3 points
+const struct compressed_string translation105 = { .data = 32, .tail = { 253, 63, 183, 244, 247, 81, 175, 135, 56, 131, 168, 251, 191, 191, 230, 21, 164, 70, 113, 134, 121, 58, 128 } }; // RLE-compressed BMP not supported
+const struct compressed_string translation106 = { .data = 9, .tail = { 253, 12, 171, 238, 101, 183, 32 } }; // Read-only
+const struct compressed_string translation107 = { .data = 20, .tail = { 253, 12, 171, 238, 101, 183, 35, 116, 177, 199, 49, 39, 112 } }; // Read-only filesystem
+const struct compressed_string translation108 = { .data = 33, .tail = { 253, 15, 174, 78, 36, 234, 63, 227, 250, 126, 162, 237, 83, 9, 3, 43, 25, 198, 25, 228, 234 } }; // Requested AES mode is unsupported
+const struct compressed_string translation109 = { .data = 30, .tail = { 253, 19, 142, 146, 55, 103, 185, 72, 219, 50, 21, 164, 70, 113, 134, 121, 58, 128 } }; // Right format but not supported
+const struct compressed_string translation110 = { .data = 20, .tail = { 253, 108, 148, 56, 10, 210, 35, 56, 195, 60, 157, 64 } }; // Slices not supported
+const struct compressed_string translation111 = { .data = 54, .tail = { 253, 91, 47, 67, 4, 181, 21, 56, 148, 82, 148, 101, 27, 103, 125, 205, 224, 95, 49, 35, 99, 19, 208, 196, 21, 204, 88, 215, 137, 232 } }; // Source and destination buffers must be the same length
+const struct compressed_string translation112 = { .data = 35, .tail = { 253, 115, 140, 91, 145, 179, 79, 64, 206, 20, 210, 122, 27, 134, 220, 105, 212, 18, 212, 105, 212 } }; // Supply both or neither of %q and %q
+const struct compressed_string translation113 = { .data = 68, .tail = { 253, 186, 24, 45, 155, 177, 131, 241, 67, 196, 163, 40, 238, 80, 39, 161, 138, 163, 157, 36, 80, 179, 6, 27, 113, 61, 12, 110, 214, 179, 119, 69, 224, 31, 138, 30, 37, 25, 126, 208 } }; // The above exception was the direct cause of the following exception:
+const struct compressed_string translation114 = { .data = 30, .tail = { 253, 186, 24, 130, 190, 44, 122, 192, 211, 168, 171, 28, 5, 105, 23, 41, 167, 64 } }; // The sample's %q does not match
+const struct compressed_string translation115 = { .data = 45, .tail = { 253, 146, 198, 58, 26, 113, 210, 69, 243, 18, 15, 193, 82, 109, 200, 170, 118, 74, 152, 217, 38, 229, 129, 208, 211, 142, 146 } }; // Tile height must exactly divide bitmap height
+const struct compressed_string translation116 = { .data = 24, .tail = { 253, 146, 198, 17, 106, 126, 3, 102, 67, 110, 54, 108, 173, 96 } }; // Tile index out of bounds
+const struct compressed_string translation117 = { .data = 43, .tail = { 253, 146, 198, 59, 165, 103, 160, 190, 98, 65, 248, 42, 77, 185, 21, 78, 201, 83, 27, 36, 220, 176, 59, 165, 103, 160 } }; // Tile width must exactly divide bitmap width
+const struct compressed_string translation118 = { .data = 17, .tail = { 253, 153, 133, 201, 121, 21, 72, 197, 139, 152 } }; // Too many displays
+const struct compressed_string translation119 = { .data = 36, .tail = { 253, 156, 168, 123, 21, 61, 135, 149, 218, 36, 57, 208, 214, 69, 10, 214, 22, 40, 159, 63, 183, 231, 249, 128 } }; // Traceback (most recent call last):\n
+const struct compressed_string translation120 = { .data = 21, .tail = { 255, 42, 91, 88, 196, 176, 69, 73, 24, 39, 131, 112 } }; // Unable to init parser
+const struct compressed_string translation121 = { .data = 33, .tail = { 255, 42, 91, 88, 196, 176, 115, 42, 138, 53, 153, 198, 10, 199, 50, 98, 165, 36 } }; // Unable to read color palette data
+const struct compressed_string translation122 = { .data = 37, .tail = { 255, 43, 25, 198, 25, 228, 234, 63, 235, 243, 254, 159, 128, 242, 185, 114, 54, 49, 135, 110, 28, 226, 19, 177, 249, 128 } }; // Unsupported JPEG (may be progressive)
+const struct compressed_string translation123 = { .data = 22, .tail = { 255, 43, 25, 198, 25, 228, 234, 40, 214, 103, 140, 21, 12 } }; // Unsupported colorspace
+const struct compressed_string translation124 = { .data = 140, .tail = { 255, 179, 181, 26, 230, 37, 135, 252, 84, 183, 124, 164, 143, 189, 30, 153, 73, 252, 249, 158, 140, 163, 72, 255, 215, 207, 243, 124, 255, 55, 255, 210, 18, 69, 17, 233, 148, 156, 115, 61, 25, 125, 236, 252, 13, 217, 197, 217, 204, 34, 238, 207, 114, 148, 101, 247, 252, 255, 55, 207, 243, 126, 204, 44, 145, 35, 108, 165, 167, 220, 138, 46, 213, 205, 142, 4, 243, 131, 31, 249, 208, 237, 143, 47, 244, 187, 87, 54, 56, 255, 79, 63, 252, 247, 252, 255, 48 } }; // Welcome to Adafruit CircuitPython %s!\n\nVisit circuitpython.org for more information.\n\nTo list built-in modules type `help(\"modules\")`.\n
+const struct compressed_string translation125 = { .data = 39, .tail = { 245, 245, 69, 73, 245, 245, 242, 243, 17, 209, 179, 106, 135, 57, 203, 168, 252, 153, 79, 208, 43, 72, 215, 72, 212 } }; // __init__() should return None, not '%s'
+const struct compressed_string translation126 = { .data = 31, .tail = { 245, 245, 83, 239, 235, 234, 9, 248, 23, 204, 72, 216, 193, 12, 193, 191, 186, 121, 193, 128 } }; // __new__ arg must be a user-type
+const struct compressed_string translation127 = { .data = 31, .tail = { 33, 183, 50, 113, 238, 178, 123, 24, 109, 190, 39, 73, 9, 1, 207, 174, 81, 206, 160 } }; // a bytes-like object is required
+const struct compressed_string translation128 = { .data = 14, .tail = { 45, 153, 231, 203, 204, 80, 173, 99, 168 } }; // abort() called
+const struct compressed_string translation129 = { .data = 32, .tail = { 37, 86, 146, 148, 101, 23, 204, 72, 216, 193, 40, 74, 154, 202, 110, 134, 224 } }; // annotation must be an identifier
+const struct compressed_string translation130 = { .data = 24, .tail = { 39, 224, 36, 2, 80, 119, 196, 242, 32, 250, 228, 214, 134 } }; // arg is an empty sequence
+const struct compressed_string translation131 = { .data = 21, .tail = { 39, 224, 95, 49, 35, 99, 25, 131, 127, 116, 243, 131 } }; // arg must be user-type
+const struct compressed_string translation132 = { .data = 20, .tail = { 39, 227, 55, 53, 144, 165, 115, 14, 121, 131, 168 } }; // argument name reused
+const struct compressed_string translation133 = { .data = 34, .tail = { 39, 114, 231, 247, 109, 204, 156, 7, 62, 185, 71, 58, 134, 80, 233, 199, 73, 16, 149, 48 } }; // array/bytes required on right side
+const struct compressed_string translation134 = { .data = 37, .tail = { 40, 229, 104, 55, 103, 253, 221, 210, 122, 6, 204, 194, 84, 193, 71, 43, 65, 190, 86, 146, 140, 160 } }; // async for/with outside async function
+const struct compressed_string translation135 = { .data = 24, .tail = { 41, 151, 77, 179, 39, 1, 90, 68, 103, 24, 103, 147, 168 } }; // attributes not supported
+const struct compressed_string translation136 = { .data = 39, .tail = { 216, 169, 237, 195, 182, 86, 163, 177, 91, 38, 27, 50, 27, 112, 228, 188, 24, 109, 196, 147, 240, 114 } }; // background value out of range of target
+const struct compressed_string translation137 = { .data = 16, .tail = { 216, 170, 40, 215, 194, 88, 197, 218, 166 } }; // bad compile mode
+const struct compressed_string translation138 = { .data = 12, .tail = { 216, 170, 39, 156, 29, 26, 166 } }; // bad typecode
+const struct compressed_string translation139 = { .data = 28, .tail = { 217, 20, 159, 144, 216, 26, 117, 10, 210, 18, 248, 177, 220, 214, 78, 160 } }; // binary op %q not implemented
+const struct compressed_string translation140 = { .data = 32, .tail = { 217, 38, 229, 129, 9, 242, 48, 75, 81, 83, 196, 244, 23, 204, 72, 185, 77, 58, 0 } }; // bitmap size and depth must match
+const struct compressed_string translation141 = { .data = 23, .tail = { 217, 38, 229, 129, 9, 242, 56, 23, 204, 72, 185, 77, 58, 0 } }; // bitmap sizes must match
+const struct compressed_string translation142 = { .data = 23, .tail = { 217, 38, 5, 243, 18, 54, 49, 245, 253, 65, 156, 88, 226, 0 } }; // bits must be 32 or less
+const struct compressed_string translation143 = { .data = 26, .tail = { 217, 38, 61, 112, 111, 235, 5, 124, 88, 197, 243, 18, 54, 49, 244, 253, 128 } }; // bits_per_sample must be 16
+const struct compressed_string translation144 = { .data = 31, .tail = { 217, 38, 61, 112, 111, 235, 5, 124, 88, 197, 243, 18, 54, 49, 252, 67, 56, 250, 126, 192 } }; // bits_per_sample must be 8 or 16
+const struct compressed_string translation145 = { .data = 29, .tail = { 219, 59, 238, 110, 33, 62, 70, 47, 152, 145, 114, 154, 116, 27, 179, 220, 164 } }; // buffer size must match format
+const struct compressed_string translation146 = { .data = 16, .tail = { 219, 59, 238, 110, 37, 152, 69, 202, 214 } }; // buffer too small
+const struct compressed_string translation147 = { .data = 17, .tail = { 219, 153, 58, 53, 76, 55, 99, 125, 236, 221, 192 } }; // bytecode overflow
+const struct compressed_string translation148 = { .data = 40, .tail = { 219, 153, 56, 22, 53, 226, 122, 5, 105, 4, 47, 155, 74, 98, 198, 27, 112, 146, 119, 16, 159, 35 } }; // bytes length not a multiple of item size
+const struct compressed_string translation149 = { .data = 24, .tail = { 219, 153, 56, 29, 138, 217, 48, 217, 144, 219, 135, 37, 224, 192 } }; // bytes value out of range
+const struct compressed_string translation150 = { .data = 24, .tail = { 161, 40, 101, 183, 35, 161, 118, 48, 202, 99, 4, 230, 178 } }; // can only have one parent
+const struct compressed_string translation151 = { .data = 52, .tail = { 161, 46, 178, 10, 181, 17, 131, 162, 21, 133, 206, 122, 53, 68, 176, 43, 57, 149, 121, 247, 70, 118, 165, 138, 32, 234, 41, 98, 136 } }; // can't add special method to already-subclassed class
+const struct compressed_string translation152 = { .data = 26, .tail = { 161, 46, 178, 10, 33, 56, 81, 44, 15, 198, 28, 226, 17, 148 } }; // can't assign to expression
+const struct compressed_string translation153 = { .data = 17, .tail = { 161, 46, 178, 40, 75, 67, 176, 131, 182, 224 } }; // can't cancel self
+const struct compressed_string translation154 = { .data = 22, .tail = { 161, 46, 178, 40, 203, 216, 222, 70, 157, 68, 176, 211, 168 } }; // can't convert %q to %q
+const struct compressed_string translation155 = { .data = 27, .tail = { 161, 46, 178, 40, 203, 216, 222, 70, 144, 37, 133, 26, 248, 177, 248 } }; // can't convert %s to complex
+const struct compressed_string translation156 = { .data = 25, .tail = { 161, 46, 178, 40, 203, 216, 222, 70, 144, 37, 134, 246, 98, 144 } }; // can't convert %s to float
+const struct compressed_string translation157 = { .data = 23, .tail = { 161, 46, 178, 40, 203, 216, 222, 70, 144, 37, 130, 44, 128 } }; // can't convert %s to int
+const struct compressed_string translation158 = { .data = 42, .tail = { 161, 46, 178, 40, 203, 216, 222, 70, 186, 117, 212, 54, 223, 19, 164, 137, 97, 167, 80, 151, 197, 146, 137, 54, 228 } }; // can't convert '%q' object to %q implicitly
+const struct compressed_string translation159 = { .data = 27, .tail = { 161, 46, 178, 40, 230, 82, 99, 93, 58, 234, 17, 98, 73, 104, 112 } }; // can't create '%q' instances
+const struct compressed_string translation160 = { .data = 36, .tail = { 161, 46, 178, 42, 116, 177, 57, 133, 101, 179, 80, 172, 17, 67, 102, 77, 197, 26, 166 } }; // can't declare nonlocal in outer code
+const struct compressed_string translation161 = { .data = 23, .tail = { 161, 46, 178, 42, 118, 57, 48, 126, 48, 231, 16, 140, 160 } }; // can't delete expression
+const struct compressed_string translation162 = { .data = 40, .tail = { 161, 46, 178, 42, 195, 100, 82, 126, 67, 96, 108, 115, 220, 205, 70, 186, 117, 212, 18, 212, 107, 167, 93, 64 } }; // can't do binary op between '%q' and '%q'
+const struct compressed_string translation163 = { .data = 25, .tail = { 161, 46, 178, 42, 195, 42, 79, 200, 108, 6, 220, 107, 167, 93, 64 } }; // can't do unary op of '%q'
+const struct compressed_string translation164 = { .data = 39, .tail = { 161, 46, 178, 18, 248, 178, 81, 38, 220, 138, 50, 246, 55, 145, 174, 157, 117, 18, 195, 93, 153, 173, 168 } }; // can't implicitly convert '%q' to 'bool'
+const struct compressed_string translation165 = { .data = 20, .tail = { 161, 46, 178, 18, 248, 103, 144, 165, 115, 26, 117 } }; // can't import name %q
+const struct compressed_string translation166 = { .data = 20, .tail = { 161, 46, 178, 44, 197, 81, 187, 181, 198, 186, 117, 212 } }; // can't load from '%q'
+const struct compressed_string translation167 = { .data = 26, .tail = { 161, 46, 178, 44, 197, 81, 221, 39, 160, 215, 78, 186, 132, 90, 159, 128 } }; // can't load with '%q' index
+const struct compressed_string translation168 = { .data = 29, .tail = { 161, 46, 178, 48, 111, 187, 61, 195, 157, 138, 83, 177, 132, 190, 25, 228 } }; // can't perform relative import
+const struct compressed_string translation169 = { .data = 53, .tail = { 161, 46, 178, 32, 214, 161, 89, 125, 223, 147, 41, 142, 197, 108, 152, 150, 4, 62, 57, 137, 247, 68, 147, 201, 212, 112, 106, 110, 82, 206 } }; // can't send non-None value to a just-started generator
+const struct compressed_string translation170 = { .data = 19, .tail = { 161, 46, 178, 32, 228, 20, 203, 166, 217, 147 } }; // can't set attribute
+const struct compressed_string translation171 = { .data = 24, .tail = { 161, 46, 178, 32, 228, 20, 203, 166, 217, 147, 26, 233, 215, 80 } }; // can't set attribute '%q'
+const struct compressed_string translation172 = { .data = 16, .tail = { 161, 46, 178, 34, 89, 204, 107, 167, 93, 64 } }; // can't store '%q'
+const struct compressed_string translation173 = { .data = 19, .tail = { 161, 46, 178, 34, 89, 204, 75, 13, 116, 235, 168 } }; // can't store to '%q'
+const struct compressed_string translation174 = { .data = 27, .tail = { 161, 46, 178, 34, 89, 204, 119, 73, 232, 53, 211, 174, 161, 22, 167, 224 } }; // can't store with '%q' index
+const struct compressed_string translation175 = { .data = 73, .tail = { 161, 46, 178, 35, 186, 77, 58, 13, 221, 174, 11, 50, 215, 41, 74, 13, 208, 237, 80, 185, 190, 198, 232, 188, 9, 97, 114, 92, 149, 134, 232, 118, 168, 140, 29, 19, 116, 161, 74, 50, 128 } }; // can't switch from automatic field numbering to manual field specification
+const struct compressed_string translation176 = { .data = 73, .tail = { 161, 46, 178, 35, 186, 77, 58, 13, 221, 174, 46, 75, 146, 176, 221, 14, 213, 17, 131, 162, 110, 148, 41, 70, 81, 44, 11, 50, 215, 41, 74, 13, 208, 237, 80, 185, 190, 198, 232, 188, 0 } }; // can't switch from manual field specification to automatic field numbering
+const struct compressed_string translation177 = { .data = 38, .tail = { 161, 46, 178, 37, 242, 180, 41, 63, 117, 83, 178, 84, 193, 10, 53, 241, 99, 240, 23, 55, 216, 220 } }; // can't truncate-divide a complex number
+const struct compressed_string translation178 = { .data = 10, .tail = { 161, 46, 178, 59, 146, 72 } }; // can't wait
+const struct compressed_string translation179 = { .data = 45, .tail = { 161, 42, 180, 131, 186, 72, 82, 148, 236, 98, 141, 83, 27, 179, 137, 232, 144, 9, 233, 209, 36, 233, 57, 115 } }; // cannot emit native code for this architecture
+const struct compressed_string translation180 = { .data = 7, .tail = { 161, 68, 162, 240 } }; // casting
+const struct compressed_string translation181 = { .data = 32, .tail = { 167, 71, 242, 243, 4, 252, 5, 105, 8, 161, 201, 120, 63, 47, 135, 143, 167, 233, 248, 124, 62, 31, 15, 48 } }; // chr() arg not in range(0x110000)
+const struct compressed_string translation182 = { .data = 30, .tail = { 165, 147, 3, 12, 139, 34, 249, 137, 27, 24, 242, 241, 233, 207, 152, 156, 226, 198 } }; // clip point must be (x,y) tuple
+const struct compressed_string translation183 = { .data = 62, .tail = { 163, 89, 156, 109, 157, 247, 55, 23, 204, 72, 216, 199, 214, 54, 230, 78, 7, 151, 233, 248, 125, 222, 97, 156, 126, 241, 183, 50, 112, 60, 191, 79, 195, 238, 31, 252, 24, 42, 141, 185, 147, 243 } }; // color buffer must be 3 bytes (RGB) or 4 bytes (RGB + pad byte)
+const struct compressed_string translation184 = { .data = 50, .tail = { 163, 89, 156, 109, 157, 247, 55, 23, 204, 72, 216, 193, 13, 179, 190, 230, 254, 130, 115, 139, 31, 160, 178, 68, 250, 6, 112, 139, 32 } }; // color buffer must be a buffer, tuple, list, or int
+const struct compressed_string translation185 = { .data = 60, .tail = { 163, 89, 156, 109, 157, 247, 55, 23, 204, 72, 216, 193, 13, 185, 147, 39, 114, 228, 51, 130, 119, 46, 67, 110, 39, 156, 24, 215, 109, 67, 56, 215, 238, 212 } }; // color buffer must be a bytearray or array of type 'b' or 'B'
+const struct compressed_string translation186 = { .data = 43, .tail = { 163, 89, 156, 95, 49, 35, 99, 27, 28, 247, 51, 81, 240, 241, 240, 248, 124, 62, 31, 15, 128, 37, 168, 248, 120, 223, 125, 247, 223, 112 } }; // color must be between 0x000000 and 0xffffff
+const struct compressed_string translation187 = { .data = 26, .tail = { 163, 95, 4, 233, 12, 161, 183, 8, 178, 9, 106, 50, 139, 32 } }; // comparison of int and uint
+const struct compressed_string translation188 = { .data = 22, .tail = { 163, 95, 22, 63, 2, 169, 217, 42, 99, 110, 71, 200, 221, 128 } }; // complex divide by zero
+const struct compressed_string translation189 = { .data = 18, .tail = { 163, 95, 14, 113, 8, 202, 58, 25, 84, 220 } }; // compression header
+const struct compressed_string translation190 = { .data = 20, .tail = { 163, 47, 99, 120, 70, 81, 44, 27, 111, 137, 210, 64 } }; // conversion to object
+const struct compressed_string translation191 = { .data = 29, .tail = { 169, 238, 89, 180, 141, 79, 197, 15, 19, 168, 190, 98, 70, 198, 44, 81, 32 } }; // default 'except' must be last
+const struct compressed_string translation192 = { .data = 37, .tail = { 170, 82, 70, 113, 82, 147, 16, 125, 114, 107, 67, 29, 10, 7, 119, 101, 224, 88, 215, 137, 232 } }; // dict update sequence has wrong length
+const struct compressed_string translation193 = { .data = 32, .tail = { 170, 118, 253, 215, 106, 133, 105, 9, 124, 88, 238, 107, 39, 81, 187, 56, 202, 44, 128 } }; // div/mod not implemented for uint
+const struct compressed_string translation194 = { .data = 14, .tail = { 170, 118, 74, 152, 219, 145, 242, 55, 96 } }; // divide by zero
+const struct compressed_string translation195 = { .data = 16, .tail = { 170, 118, 72, 70, 81, 183, 35, 228, 110, 192 } }; // division by zero
+const struct compressed_string translation196 = { .data = 5, .tail = { 59, 226, 121 } }; // empty
+const struct compressed_string translation197 = { .data = 10, .tail = { 59, 226, 121, 29, 12, 176 } }; // empty heap
+const struct compressed_string translation198 = { .data = 15, .tail = { 59, 226, 121, 16, 120, 39, 41, 103 } }; // empty separator
+const struct compressed_string translation199 = { .data = 5, .tail = { 53, 245, 255, 63, 168 } }; // en_US
+const struct compressed_string translation200 = { .data = 52, .tail = { 53, 168, 109, 198, 236, 247, 41, 29, 250, 37, 140, 89, 155, 217, 23, 129, 187, 56, 163, 47, 99, 120, 70, 81, 24, 58, 38, 232, 110 } }; // end of format while looking for conversion specifier
+const struct compressed_string translation201 = { .data = 41, .tail = { 63, 20, 60, 74, 50, 192, 190, 98, 69, 77, 211, 177, 141, 221, 174, 62, 226, 131, 254, 158, 40, 120, 148, 101 } }; // exceptions must derive from BaseException
+const struct compressed_string translation202 = { .data = 35, .tail = { 63, 24, 58, 73, 212, 107, 246, 234, 11, 121, 55, 27, 179, 220, 164, 70, 14, 137, 186, 27, 128 } }; // expected ':' after format specifier
+const struct compressed_string translation203 = { .data = 33, .tail = { 63, 24, 58, 74, 47, 0, 133, 82, 146, 55, 103, 30, 199, 207, 118, 122, 130, 126, 32 } }; // expecting a dict for keyword args
+const struct compressed_string translation204 = { .data = 30, .tail = { 63, 24, 58, 74, 47, 3, 227, 152, 144, 67, 177, 91, 38, 55, 103, 16, 114 } }; // expecting just a value for set
+const struct compressed_string translation205 = { .data = 28, .tail = { 63, 24, 58, 74, 47, 3, 216, 249, 251, 123, 21, 178, 99, 118, 113, 84, 164, 128 } }; // expecting key:value for dict
+const struct compressed_string translation206 = { .data = 29, .tail = { 63, 18, 228, 61, 143, 158, 236, 245, 4, 252, 102, 230, 179, 3, 132, 236, 106 } }; // extra keyword arguments given
+const struct compressed_string translation207 = { .data = 32, .tail = { 63, 18, 228, 48, 208, 146, 140, 165, 96, 79, 198, 110, 107, 48, 56, 78, 198, 160 } }; // extra positional arguments given
+const struct compressed_string translation208 = { .data = 39, .tail = { 221, 44, 98, 249, 137, 27, 24, 33, 186, 88, 195, 96, 212, 234, 17, 70, 220, 201, 139, 181, 76 } }; // file must be a file opened in byte mode
+const struct compressed_string translation209 = { .data = 38, .tail = { 221, 30, 36, 19, 241, 155, 154, 200, 150, 17, 156, 27, 249, 121, 139, 230, 36, 108, 98, 121, 193, 128 } }; // first argument to super() must be type
+const struct compressed_string translation210 = { .data = 19, .tail = { 221, 158, 229, 33, 76, 235, 0, 133, 82, 146 } }; // format needs a dict
+const struct compressed_string translation211 = { .data = 42, .tail = { 221, 158, 229, 34, 37, 209, 120, 21, 74, 174, 178, 40, 203, 216, 222, 65, 90, 192, 159, 140, 220, 214, 96 } }; // format string didn't convert all arguments
+const struct compressed_string translation212 = { .data = 34, .tail = { 221, 158, 229, 34, 37, 209, 120, 10, 103, 88, 23, 103, 48, 79, 198, 110, 107, 48 } }; // format string needs more arguments
+const struct compressed_string translation213 = { .data = 4, .tail = { 223, 54, 176 } }; // full
+const struct compressed_string translation214 = { .data = 39, .tail = { 223, 43, 73, 70, 81, 86, 56, 93, 100, 73, 123, 24, 246, 62, 123, 179, 212, 19, 241, 155, 154, 204, 0 } }; // function doesn't take keyword arguments
+const struct compressed_string translation215 = { .data = 46, .tail = { 223, 43, 73, 70, 80, 126, 48, 116, 147, 168, 41, 23, 104, 145, 165, 65, 63, 25, 185, 172, 199, 160, 225, 164, 105, 80 } }; // function expected at most %d arguments, got %d
+const struct compressed_string translation216 = { .data = 46, .tail = { 223, 43, 73, 70, 81, 195, 72, 190, 109, 41, 139, 24, 236, 86, 201, 192, 221, 156, 19, 241, 155, 154, 200, 215, 78, 186, 128 } }; // function got multiple values for argument '%q'
+const struct compressed_string translation217 = { .data = 49, .tail = { 223, 43, 73, 70, 81, 116, 136, 69, 224, 105, 80, 231, 215, 40, 231, 81, 134, 132, 148, 101, 43, 2, 126, 51, 115, 89, 128 } }; // function missing %d required positional arguments
+const struct compressed_string translation218 = { .data = 38, .tail = { 223, 43, 73, 70, 81, 116, 136, 69, 224, 123, 31, 61, 217, 235, 238, 101, 183, 32, 159, 140, 220, 214, 64 } }; // function missing keyword-only argument
+const struct compressed_string translation219 = { .data = 47, .tail = { 223, 43, 73, 70, 81, 116, 136, 69, 224, 57, 245, 202, 57, 212, 123, 31, 61, 217, 234, 9, 248, 205, 205, 100, 107, 167, 93, 64 } }; // function missing required keyword argument '%q'
+const struct compressed_string translation220 = { .data = 49, .tail = { 223, 43, 73, 70, 81, 116, 136, 69, 224, 57, 245, 202, 57, 212, 97, 161, 37, 25, 74, 192, 159, 140, 220, 214, 71, 254, 244, 168 } }; // function missing required positional argument #%d
+const struct compressed_string translation221 = { .data = 56, .tail = { 223, 43, 73, 70, 81, 37, 236, 112, 52, 168, 195, 66, 74, 50, 149, 129, 63, 25, 185, 172, 192, 219, 50, 52, 168, 238, 110, 99, 132, 236, 106 } }; // function takes %d positional arguments but %d were given
+const struct compressed_string translation222 = { .data = 27, .tail = { 224, 212, 220, 165, 156, 21, 156, 202, 188, 131, 240, 116, 204, 162, 240 } }; // generator already executing
+const struct compressed_string translation223 = { .data = 31, .tail = { 224, 212, 220, 165, 156, 39, 10, 206, 117, 31, 129, 169, 185, 75, 63, 244, 240, 146 } }; // generator ignored GeneratorExit
+const struct compressed_string translation224 = { .data = 30, .tail = { 224, 212, 220, 165, 156, 57, 36, 29, 71, 235, 45, 143, 198, 77, 202, 81, 148 } }; // generator raised StopIteration
+const struct compressed_string translation225 = { .data = 19, .tail = { 232, 101, 129, 124, 196, 141, 140, 16, 178, 68, 128 } }; // heap must be a list
+const struct compressed_string translation226 = { .data = 30, .tail = { 74, 154, 202, 110, 134, 225, 206, 167, 186, 41, 212, 20, 14, 44, 219, 21, 128 } }; // identifier redefined as global
+const struct compressed_string translation227 = { .data = 32, .tail = { 74, 154, 202, 110, 134, 225, 206, 167, 186, 41, 212, 20, 5, 101, 179, 80, 172 } }; // identifier redefined as nonlocal
+const struct compressed_string translation228 = { .data = 28, .tail = { 75, 225, 158, 71, 208, 21, 164, 20, 139, 181, 115, 99, 22, 62, 199, 96 } }; // import * not at module level
+const struct compressed_string translation229 = { .data = 22, .tail = { 69, 163, 95, 5, 41, 181, 140, 123, 239, 142, 65, 61, 58, 0 } }; // incompatible .mpy arch
+const struct compressed_string translation230 = { .data = 22, .tail = { 69, 163, 95, 5, 41, 181, 140, 123, 239, 142, 70, 233, 99 } }; // incompatible .mpy file
+const struct compressed_string translation231 = { .data = 17, .tail = { 69, 163, 95, 22, 57, 49, 187, 61, 202, 64 } }; // incomplete format
+const struct compressed_string translation232 = { .data = 21, .tail = { 69, 163, 95, 22, 57, 49, 187, 61, 202, 71, 177, 242 } }; // incomplete format key
+const struct compressed_string translation233 = { .data = 17, .tail = { 69, 163, 59, 157, 36, 96, 171, 84, 94, 0 } }; // incorrect padding
+const struct compressed_string translation234 = { .data = 18, .tail = { 69, 169, 248, 13, 153, 13, 184, 114, 94, 12 } }; // index out of range
+const struct compressed_string translation235 = { .data = 61, .tail = { 69, 236, 86, 74, 141, 146, 99, 215, 6, 254, 184, 79, 7, 97, 165, 125, 5, 243, 18, 54, 63, 65, 244, 250, 15, 171, 208, 126, 255, 65, 252, 125, 7, 211, 246, 122, 15, 171, 247, 250, 6, 113, 245, 253, 64 } }; // invalid bits_per_pixel %d, must be, 1, 2, 4, 8, 16, 24, or 32
+const struct compressed_string translation236 = { .data = 47, .tail = { 69, 236, 86, 74, 131, 177, 220, 214, 68, 39, 200, 198, 149, 27, 179, 141, 146, 99, 215, 6, 254, 184, 79, 7, 97, 165, 126, 127, 152 } }; // invalid element size %d for bits_per_pixel %d\n
+const struct compressed_string translation237 = { .data = 44, .tail = { 69, 236, 86, 74, 131, 177, 220, 214, 125, 97, 62, 70, 52, 175, 160, 190, 98, 70, 199, 232, 62, 159, 65, 245, 122, 6, 113, 251, 192 } }; // invalid element_size %d, must be, 1, 2, or 4
+const struct compressed_string translation238 = { .data = 17, .tail = { 69, 236, 86, 74, 131, 241, 67, 196, 163, 40 } }; // invalid exception
+const struct compressed_string translation239 = { .data = 24, .tail = { 69, 236, 86, 74, 141, 217, 238, 82, 35, 7, 68, 221, 13, 192 } }; // invalid format specifier
+const struct compressed_string translation240 = { .data = 29, .tail = { 69, 236, 86, 74, 139, 165, 29, 177, 204, 244, 101, 21, 58, 51, 148, 179, 128 } }; // invalid micropython decorator
+const struct compressed_string translation241 = { .data = 20, .tail = { 69, 236, 86, 74, 139, 251, 74, 92, 198, 96, 184, 48 } }; // invalid mktime usage
+const struct compressed_string translation242 = { .data = 14, .tail = { 69, 236, 86, 74, 136, 229, 100, 188, 0 } }; // invalid syntax
+const struct compressed_string translation243 = { .data = 25, .tail = { 69, 236, 86, 74, 136, 229, 100, 188, 13, 217, 194, 230, 251, 27, 128 } }; // invalid syntax for number
+const struct compressed_string translation244 = { .data = 34, .tail = { 72, 140, 237, 75, 20, 71, 151, 152, 39, 224, 125, 34, 249, 137, 27, 24, 33, 75, 20, 64 } }; // issubclass() arg 1 must be a class
+const struct compressed_string translation245 = { .data = 56, .tail = { 72, 140, 237, 75, 20, 71, 151, 152, 39, 224, 125, 66, 249, 137, 27, 24, 33, 75, 20, 64, 103, 4, 39, 56, 177, 134, 220, 82, 197, 16, 112 } }; // issubclass() arg 2 must be a class or a tuple of classes
+const struct compressed_string translation246 = { .data = 68, .tail = { 248, 178, 40, 63, 24, 58, 76, 2, 22, 72, 144, 219, 136, 151, 253, 219, 115, 39, 1, 182, 248, 157, 38, 5, 25, 97, 34, 77, 100, 119, 73, 232, 32, 237, 184, 109, 190, 39, 73 } }; // join expects a list of str/bytes objects consistent with self object
+const struct compressed_string translation247 = { .data = 61, .tail = { 246, 62, 123, 179, 212, 19, 241, 155, 154, 207, 148, 121, 133, 105, 9, 124, 88, 238, 107, 39, 81, 238, 25, 131, 10, 207, 114, 176, 39, 226, 2, 44, 73, 149, 64 } }; // keyword argument(s) not implemented - use normal args instead
+const struct compressed_string translation248 = { .data = 32, .tail = { 183, 72, 4, 181, 15, 210, 4, 116, 108, 218, 163, 99, 20, 107, 224, 165, 54, 177, 128 } }; // lhs and rhs should be compatible
+const struct compressed_string translation249 = { .data = 43, .tail = { 179, 80, 172, 53, 211, 174, 163, 161, 64, 158, 112, 99, 93, 58, 234, 54, 204, 136, 108, 189, 12, 36, 13, 116, 235, 168 } }; // local '%q' has type '%q' but source is '%q'
+const struct compressed_string translation250 = { .data = 33, .tail = { 179, 80, 172, 53, 211, 174, 163, 48, 117, 27, 30, 236, 230, 39, 156, 24, 246, 86, 238, 160 } }; // local '%q' used before type known
+const struct compressed_string translation251 = { .data = 43, .tail = { 179, 80, 172, 59, 19, 161, 109, 99, 14, 123, 155, 154, 208, 234, 54, 61, 217, 204, 20, 66, 112, 183, 53, 144 } }; // local variable referenced before assignment
+const struct compressed_string translation252 = { .data = 18, .tail = { 185, 91, 118, 123, 157, 70, 254, 232, 151, 69, 224 } }; // malformed f-string
+const struct compressed_string translation253 = { .data = 17, .tail = { 185, 79, 65, 86, 185, 34, 131, 119, 103 } }; // math domain error
+const struct compressed_string translation254 = { .data = 32, .tail = { 185, 120, 75, 230, 225, 206, 153, 120, 70, 81, 83, 196, 244, 7, 226, 134, 117, 58, 128 } }; // maximum recursion depth exceeded
+const struct compressed_string translation255 = { .data = 45, .tail = { 185, 221, 159, 144, 86, 179, 80, 165, 25, 70, 228, 150, 58, 250, 2, 181, 154, 133, 40, 188, 13, 50, 54, 230, 78, 0 } }; // memory allocation failed, allocating %u bytes
+const struct compressed_string translation256 = { .data = 40, .tail = { 185, 221, 159, 144, 86, 179, 80, 165, 25, 70, 228, 150, 58, 250, 14, 134, 88, 9, 2, 205, 79, 99, 168 } }; // memory allocation failed, heap is locked
+const struct compressed_string translation257 = { .data = 27, .tail = { 185, 221, 159, 158, 200, 125, 195, 111, 188, 28, 137, 102, 22, 39, 224, 192 } }; // memoryview offset too large
+const struct compressed_string translation258 = { .data = 48, .tail = { 185, 221, 159, 158, 200, 125, 254, 209, 99, 94, 39, 160, 72, 10, 210, 8, 95, 54, 148, 197, 140, 54, 225, 36, 239, 9, 242, 48 } }; // memoryview: length is not a multiple of itemsize
+const struct compressed_string translation259 = { .data = 37, .tail = { 191, 180, 165, 204, 41, 157, 96, 16, 156, 226, 198, 27, 113, 99, 94, 39, 160, 254, 33, 156, 127, 168 } }; // mktime needs a tuple of length 8 or 9
+const struct compressed_string translation260 = { .data = 33, .tail = { 187, 87, 54, 49, 174, 157, 117, 29, 10, 2, 176, 41, 151, 77, 179, 38, 53, 211, 174, 160 } }; // module '%q' has no attribute '%q'
+const struct compressed_string translation261 = { .data = 25, .tail = { 190, 109, 41, 139, 24, 250, 60, 4, 80, 81, 9, 194, 220, 214, 64 } }; // multiple *x in assignment
+const struct compressed_string translation262 = { .data = 45, .tail = { 190, 109, 41, 139, 24, 216, 160, 224, 116, 46, 198, 17, 98, 73, 104, 98, 197, 207, 185, 179, 34, 140, 187, 217, 41, 32 } }; // multiple bases have instance lay-out conflict
+const struct compressed_string translation263 = { .data = 20, .tail = { 190, 98, 67, 146, 65, 130, 80, 219, 124, 78, 146 } }; // must raise an object
+const struct compressed_string translation264 = { .data = 42, .tail = { 190, 98, 70, 96, 199, 177, 243, 221, 158, 160, 159, 140, 220, 214, 70, 236, 227, 216, 249, 27, 229, 105, 40, 202 } }; // must use keyword argument for key function
+const struct compressed_string translation265 = { .data = 23, .tail = { 82, 185, 141, 116, 235, 168, 72, 93, 100, 84, 247, 69, 58, 128 } }; // name '%q' isn't defined
+const struct compressed_string translation266 = { .data = 13, .tail = { 82, 185, 137, 102, 22, 101, 224 } }; // name too long
+const struct compressed_string translation267 = { .data = 31, .tail = { 82, 148, 236, 98, 141, 83, 8, 163, 223, 124, 114, 50, 177, 156, 97, 158, 78, 160 } }; // native code in .mpy unsupported
+const struct compressed_string translation268 = { .data = 12, .tail = { 82, 148, 236, 99, 148, 59, 84 } }; // native yield
+const struct compressed_string translation269 = { .data = 34, .tail = { 83, 58, 139, 179, 152, 158, 132, 163, 74, 142, 197, 108, 156, 9, 97, 149, 193, 83, 216 } }; // need more than %d values to unpack
+const struct compressed_string translation270 = { .data = 18, .tail = { 83, 224, 165, 59, 24, 220, 169, 44, 232, 86 } }; // negative factorial
+const struct compressed_string translation271 = { .data = 20, .tail = { 83, 224, 165, 59, 24, 142, 137, 188, 138, 54, 86, 64 } }; // negative shift count
+const struct compressed_string translation272 = { .data = 30, .tail = { 86, 5, 73, 78, 198, 15, 197, 15, 18, 140, 162, 88, 57, 185, 36, 24 } }; // no active exception to reraise
+const struct compressed_string translation273 = { .data = 29, .tail = { 86, 27, 34, 213, 23, 129, 187, 56, 86, 91, 53, 10, 195, 118, 202, 212 } }; // no binding for nonlocal found
+const struct compressed_string translation274 = { .data = 20, .tail = { 86, 23, 106, 230, 198, 20, 174, 117, 26, 233, 215, 80 } }; // no module named '%q'
+const struct compressed_string translation275 = { .data = 17, .tail = { 86, 17, 154, 116, 5, 50, 233, 182, 100, 192 } }; // no such attribute
+const struct compressed_string translation276 = { .data = 45, .tail = { 86, 95, 117, 79, 114, 205, 164, 19, 241, 155, 154, 200, 221, 173, 102, 239, 2, 167, 185, 102, 210, 9, 248, 205, 205, 100 } }; // non-default argument follows default argument
+const struct compressed_string translation277 = { .data = 13, .tail = { 86, 95, 119, 67, 240, 42, 156, 36, 128 } }; // non-hex digit
+const struct compressed_string translation278 = { .data = 14, .tail = { 86, 144, 66, 140, 177, 36, 178 } }; // not a constant
+const struct compressed_string translation279 = { .data = 7, .tail = { 109, 190, 39, 73, 0 } }; // object 
+const struct compressed_string translation280 = { .data = 33, .tail = { 109, 190, 39, 73, 26, 233, 26, 132, 133, 214, 65, 9, 206, 44, 97, 156, 89, 34, 64 } }; // object '%s' isn't a tuple or list
+const struct compressed_string translation281 = { .data = 22, .tail = { 109, 190, 39, 73, 10, 210, 17, 68, 31, 92, 154, 208, 192 } }; // object not in sequence
+const struct compressed_string translation282 = { .data = 32, .tail = { 109, 190, 39, 73, 13, 184, 158, 112, 99, 93, 35, 81, 208, 160, 43, 11, 26, 249, 121, 128 } }; // object of type '%s' has no len()
+const struct compressed_string translation283 = { .data = 36, .tail = { 109, 190, 39, 73, 29, 210, 122, 13, 179, 190, 230, 227, 14, 210, 212, 107, 7, 62, 185, 71, 58, 128 } }; // object with buffer protocol required
+const struct compressed_string translation284 = { .data = 48, .tail = { 101, 183, 34, 44, 148, 56, 29, 210, 122, 8, 147, 199, 242, 250, 71, 145, 123, 16, 252, 153, 79, 204, 19, 152, 140, 227, 12, 242, 117 } }; // only slices with step=1 (aka None) are supported
+const struct compressed_string translation285 = { .data = 6, .tail = { 108, 81, 170, 96 } }; // opcode
+const struct compressed_string translation286 = { .data = 57, .tail = { 103, 175, 151, 152, 63, 24, 58, 73, 212, 16, 167, 66, 114, 164, 155, 250, 13, 179, 34, 37, 209, 120, 13, 184, 177, 175, 19, 208, 105, 81, 187, 101, 106 } }; // ord() expected a character, but string of length %d found
+const struct compressed_string translation287 = { .data = 22, .tail = { 108, 200, 109, 195, 146, 240, 97, 183, 18, 79, 193, 200 } }; // out of range of target
+const struct compressed_string translation288 = { .data = 44, .tail = { 110, 198, 251, 217, 187, 138, 50, 246, 55, 148, 94, 5, 153, 120, 8, 178, 37, 133, 202, 157, 17, 76, 119, 103, 168 } }; // overflow converting long int to machine word
+const struct compressed_string translation289 = { .data = 17, .tail = { 195, 96, 110, 237, 112, 119, 196, 242, 52, 234 } }; // pop from empty %q
+const struct compressed_string translation290 = { .data = 23, .tail = { 195, 66, 74, 50, 149, 129, 63, 0, 183, 147, 113, 244, 125, 0 } }; // positional arg after **
+const struct compressed_string translation291 = { .data = 32, .tail = { 195, 66, 74, 50, 149, 129, 63, 0, 183, 147, 113, 236, 124, 247, 103, 168, 39, 224 } }; // positional arg after keyword arg
+const struct compressed_string translation292 = { .data = 30, .tail = { 195, 119, 242, 243, 31, 91, 212, 19, 241, 155, 154, 200, 161, 42, 180, 141, 140, 124, 0 } }; // pow() 3rd argument cannot be 0
+const struct compressed_string translation293 = { .data = 40, .tail = { 195, 119, 242, 243, 29, 210, 122, 15, 172, 19, 241, 155, 154, 204, 7, 62, 185, 71, 56, 8, 178, 124, 27, 192 } }; // pow() with 3 arguments requires integers
+const struct compressed_string translation294 = { .data = 17, .tail = { 115, 224, 252, 9, 102, 20, 107, 226, 199, 224 } }; // regex too complex
+const struct compressed_string translation295 = { .data = 44, .tail = { 115, 235, 147, 137, 58, 139, 26, 241, 61, 6, 149, 27, 102, 67, 109, 241, 58, 72, 232, 80, 44, 107, 196, 244, 26, 84 } }; // requested length %d but object has length %d
+const struct compressed_string translation296 = { .data = 33, .tail = { 115, 156, 186, 131, 241, 131, 164, 157, 70, 186, 117, 212, 109, 153, 28, 52, 141, 116, 235, 168 } }; // return expected '%q' but got '%q'
+const struct compressed_string translation297 = { .data = 14, .tail = { 120, 197, 146, 124, 191, 38, 83, 244, 95, 48 } }; // rsplit(None,n)
+const struct compressed_string translation298 = { .data = 27, .tail = { 130, 190, 44, 113, 235, 9, 194, 157, 69, 243, 18, 54, 49, 47, 147 } }; // samples_signed must be true
+const struct compressed_string translation299 = { .data = 19, .tail = { 138, 116, 58, 230, 198, 58, 228, 242, 99, 124, 218, 192 } }; // schedule queue full
+const struct compressed_string translation300 = { .data = 43, .tail = { 132, 225, 66, 180, 130, 181, 155, 185, 212, 34, 136, 151, 69, 224, 110, 207, 114, 145, 24, 58, 38, 232, 110 } }; // sign not allowed in string format specifier
+const struct compressed_string translation301 = { .data = 50, .tail = { 132, 225, 66, 180, 130, 181, 155, 185, 212, 119, 73, 232, 17, 100, 248, 55, 27, 179, 220, 164, 70, 14, 137, 186, 27, 141, 105, 168 } }; // sign not allowed with integer format specifier 'c'
+const struct compressed_string translation302 = { .data = 18, .tail = { 139, 149, 172, 17, 100, 55, 99, 125, 236, 221, 192 } }; // small int overflow
+const struct compressed_string translation303 = { .data = 24, .tail = { 134, 203, 208, 198, 10, 199, 50, 98, 89, 133, 137, 248, 48 } }; // source palette too large
+const struct compressed_string translation304 = { .data = 49, .tail = { 134, 203, 208, 253, 118, 73, 185, 96, 95, 49, 35, 161, 118, 49, 216, 173, 147, 245, 163, 101, 100, 54, 227, 234, 12, 227, 236, 254, 31, 195, 235, 251, 0 } }; // source_bitmap must have value_count of 2 or 65536
+const struct compressed_string translation305 = { .data = 44, .tail = { 134, 203, 208, 253, 118, 73, 185, 96, 95, 49, 35, 161, 118, 49, 216, 173, 147, 245, 163, 101, 100, 54, 227, 236, 254, 31, 195, 235, 251, 0 } }; // source_bitmap must have value_count of 65536
+const struct compressed_string translation306 = { .data = 40, .tail = { 134, 203, 208, 253, 118, 73, 185, 96, 95, 49, 35, 161, 118, 49, 216, 173, 147, 245, 163, 101, 100, 54, 227, 248, 128 } }; // source_bitmap must have value_count of 8
+const struct compressed_string translation307 = { .data = 27, .tail = { 140, 89, 38, 81, 120, 29, 210, 122, 8, 206, 222, 234, 22, 39, 46, 112 } }; // splitting with sub-captures
+const struct compressed_string translation308 = { .data = 30, .tail = { 137, 115, 43, 134, 193, 185, 74, 50, 133, 105, 17, 156, 97, 158, 78, 160 } }; // stream operation not supported
+const struct compressed_string translation309 = { .data = 35, .tail = { 137, 116, 94, 1, 63, 25, 185, 172, 142, 233, 61, 27, 50, 9, 65, 173, 26, 168, 188, 0 } }; // string argument without an encoding
+const struct compressed_string translation310 = { .data = 25, .tail = { 137, 116, 94, 2, 45, 79, 192, 108, 200, 109, 195, 146, 240, 96 } }; // string index out of range
+const struct compressed_string translation311 = { .data = 39, .tail = { 137, 116, 94, 2, 45, 82, 135, 2, 249, 137, 27, 24, 69, 147, 224, 222, 61, 2, 180, 141, 32 } }; // string indices must be integers, not %s
+const struct compressed_string translation312 = { .data = 19, .tail = { 140, 237, 18, 232, 188, 5, 105, 27, 182, 86, 160 } }; // substring not found
+const struct compressed_string translation313 = { .data = 23, .tail = { 140, 224, 223, 203, 204, 80, 151, 89, 27, 162, 212, 65, 219, 112 } }; // super() can't find self
+const struct compressed_string translation314 = { .data = 20, .tail = { 142, 86, 75, 192, 55, 118, 112, 138, 63, 235, 245, 255, 31, 144 } }; // syntax error in JSON
+const struct compressed_string translation315 = { .data = 23, .tail = { 148, 167, 180, 4, 89, 55, 236, 86, 13, 216, 223, 123, 55, 112 } }; // ticks interval overflow
+const struct compressed_string translation316 = { .data = 13, .tail = { 150, 97, 114, 94, 65, 63, 16 } }; // too many args
+const struct compressed_string translation317 = { .data = 39, .tail = { 150, 97, 114, 94, 71, 98, 182, 78, 4, 176, 202, 224, 169, 236, 60, 143, 198, 14, 146, 117, 26, 87, 204 } }; // too many values to unpack (expected %d)
+const struct compressed_string translation318 = { .data = 39, .tail = { 158, 112, 99, 93, 58, 234, 18, 23, 89, 4, 160, 169, 67, 196, 150, 214, 49, 177, 65, 137, 231, 6 } }; // type '%q' isn't an acceptable base type
+const struct compressed_string translation319 = { .data = 38, .tail = { 158, 112, 97, 182, 248, 157, 36, 107, 167, 93, 71, 66, 128, 172, 10, 101, 211, 108, 201, 141, 116, 235, 168 } }; // type object '%q' has no attribute '%q'
+const struct compressed_string translation320 = { .data = 27, .tail = { 158, 112, 98, 75, 216, 224, 125, 33, 156, 125, 96, 159, 140, 220, 214, 96 } }; // type takes 1 or 3 arguments
+const struct compressed_string translation321 = { .data = 17, .tail = { 202, 159, 140, 29, 36, 234, 17, 106, 107, 32 } }; // unexpected indent
+const struct compressed_string translation322 = { .data = 32, .tail = { 202, 159, 140, 29, 36, 234, 61, 143, 158, 236, 245, 4, 252, 102, 230, 178, 53, 211, 174, 160 } }; // unexpected keyword argument '%q'
+const struct compressed_string translation323 = { .data = 20, .tail = { 202, 165, 26, 166, 20, 174, 96, 226, 133, 131, 128 } }; // unicode name escapes
+const struct compressed_string translation324 = { .data = 45, .tail = { 202, 162, 212, 214, 69, 88, 225, 117, 145, 114, 154, 116, 4, 188, 134, 204, 155, 132, 90, 154, 200, 177, 246, 59, 0 } }; // unindent doesn't match any outer indent level
+const struct compressed_string translation325 = { .data = 31, .tail = { 202, 251, 43, 119, 81, 70, 94, 198, 240, 140, 162, 48, 116, 77, 208, 220, 105, 64 } }; // unknown conversion specifier %c
+const struct compressed_string translation326 = { .data = 48, .tail = { 202, 251, 43, 119, 81, 187, 61, 202, 69, 26, 166, 53, 210, 154, 141, 217, 195, 109, 241, 58, 72, 109, 196, 243, 131, 26, 233, 215, 80 } }; // unknown format code '%c' for object of type '%q'
+const struct compressed_string translation327 = { .data = 17, .tail = { 202, 251, 43, 119, 81, 60, 224, 198, 186, 117, 212 } }; // unknown type '%q'
+const struct compressed_string translation328 = { .data = 24, .tail = { 202, 220, 166, 157, 14, 163, 93, 41, 168, 69, 27, 179, 220, 164 } }; // unmatched '%c' in format
+const struct compressed_string translation329 = { .data = 20, .tail = { 202, 185, 149, 75, 107, 24, 41, 151, 77, 179, 38 } }; // unreadable attribute
+const struct compressed_string translation330 = { .data = 19, .tail = { 202, 198, 113, 134, 121, 58, 141, 58, 137, 231, 6 } }; // unsupported %q type
+const struct compressed_string translation331 = { .data = 24, .tail = { 202, 198, 113, 134, 121, 58, 141, 146, 110, 88, 21, 60, 79, 64 } }; // unsupported bitmap depth
+const struct compressed_string translation332 = { .data = 33, .tail = { 202, 198, 113, 134, 121, 58, 138, 53, 153, 227, 5, 67, 27, 179, 138, 164, 244, 55 } }; // unsupported colorspace for dither
+const struct compressed_string translation333 = { .data = 52, .tail = { 202, 198, 113, 134, 121, 58, 141, 217, 238, 82, 41, 208, 156, 169, 38, 227, 93, 41, 168, 242, 248, 120, 211, 199, 152, 41, 8, 181, 63, 3, 74, 128 } }; // unsupported format character '%c' (0x%x) at index %d
+const struct compressed_string translation334 = { .data = 29, .tail = { 202, 198, 113, 134, 121, 58, 137, 231, 6, 55, 103, 26, 117, 251, 70, 186, 70, 160 } }; // unsupported type for %q: '%s'
+const struct compressed_string translation335 = { .data = 36, .tail = { 202, 198, 113, 134, 121, 58, 137, 231, 7, 3, 118, 113, 167, 95, 180, 107, 167, 93, 125, 6, 186, 117, 212 } }; // unsupported types for %q: '%q', '%q'
+const struct compressed_string translation336 = { .data = 28, .tail = { 236, 86, 201, 139, 230, 36, 110, 146, 17, 70, 149, 27, 115, 39, 229, 30, 96 } }; // value must fit in %d byte(s)
+const struct compressed_string translation337 = { .data = 28, .tail = { 236, 86, 201, 134, 204, 134, 220, 57, 47, 6, 27, 113, 36, 252, 28, 128 } }; // value out of range of target
+const struct compressed_string translation338 = { .data = 82, .tail = { 238, 105, 199, 73, 129, 124, 196, 141, 140, 16, 131, 235, 147, 90, 24, 238, 147, 208, 18, 134, 173, 68, 117, 201, 57, 133, 205, 246, 55, 13, 184, 59, 29, 205, 102, 7, 150, 99, 37, 107, 114, 63, 212, 51, 143, 171, 248, 121, 128 } }; // weights must be a sequence with an odd square number of elements (usually 9 or 25)
+const struct compressed_string translation339 = { .data = 60, .tail = { 238, 105, 199, 73, 129, 124, 196, 141, 140, 18, 134, 219, 226, 116, 144, 219, 137, 231, 6, 52, 235, 232, 52, 235, 232, 52, 235, 232, 25, 198, 157, 125, 2, 180, 141, 58, 128 } }; // weights must be an object of type %q, %q, %q, or %q, not %q 
+const struct compressed_string translation340 = { .data = 25, .tail = { 238, 236, 188, 5, 205, 246, 55, 13, 184, 39, 227, 55, 53, 152 } }; // wrong number of arguments
+
+// 10548 bytes worth of translations
+// 6640 bytes worth of translations compressed
+// 3908 bytes saved
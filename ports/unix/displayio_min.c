@@ -4,14 +4,28 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <string.h>
+
 #include "py/enum.h"
+#include "py/gc.h"
+#include "py/mphal.h"
 #include "py/obj.h"
 #include "py/runtime.h"
 
 #include "shared-bindings/displayio/__init__.h"
 #include "shared-bindings/displayio/Bitmap.h"
 #include "shared-bindings/displayio/ColorConverter.h"
+#include "shared-bindings/displayio/Group.h"
+#include "shared-bindings/displayio/OnDiskBitmap.h"
 #include "shared-bindings/displayio/Palette.h"
+#include "shared-bindings/displayio/TileGrid.h"
+#if CIRCUITPY_VECTORIO
+#include "shared-bindings/vectorio/__init__.h"
+#endif
+#include "shared-module/displayio/__init__.h"
+#include "shared-module/displayio/area.h"
+#include "supervisor/shared/display.h"
+#include "supervisor/shared/tick.h"
 
 MAKE_ENUM_VALUE(displayio_colorspace_type, displayio_colorspace, RGB888, DISPLAYIO_COLORSPACE_RGB888);
 MAKE_ENUM_VALUE(displayio_colorspace_type, displayio_colorspace, RGB565, DISPLAYIO_COLORSPACE_RGB565);
@@ -59,12 +73,176 @@ static MP_DEFINE_CONST_DICT(displayio_colorspace_locals_dict, displayio_colorspa
 MAKE_PRINTER(displayio, displayio_colorspace);
 MAKE_ENUM_TYPE(displayio, ColorSpace, displayio_colorspace);
 
+#if CIRCUITPY_FRAMEBUFFERIO
+primary_display_t displays[CIRCUITPY_DISPLAY_LIMIT];
+
+static mp_obj_t splash_members[] = {};
+static mp_obj_list_t splash_children = {
+    .base = {.type = &mp_type_list },
+    .alloc = 0,
+    .len = 0,
+    .items = splash_members,
+};
+
+// There is no terminal on the unix port, so new displays start out showing an empty group.
+displayio_group_t circuitpython_splash = {
+    .base = {.type = &displayio_group_type },
+    .x = 0,
+    .y = 0,
+    .scale = 1,
+    .members = &splash_children,
+    .item_removed = false,
+    .in_group = false,
+    .hidden = false,
+    .hidden_by_parent = false,
+    .readonly = true,
+};
+
+primary_display_t *allocate_display_or_raise(void) {
+    for (uint8_t i = 0; i < CIRCUITPY_DISPLAY_LIMIT; i++) {
+        mp_const_obj_t display_type = displays[i].display_base.type;
+        if (display_type == NULL || display_type == &mp_type_NoneType) {
+            // Clear this memory so it is in a known state before init.
+            memset(&displays[i], 0, sizeof(displays[i]));
+            displays[i].display_base.type = &mp_type_NoneType;
+            return &displays[i];
+        }
+    }
+    mp_raise_RuntimeError(MP_ERROR_TEXT("Too many displays"));
+}
+
+void common_hal_displayio_release_displays(void) {
+    for (uint8_t i = 0; i < CIRCUITPY_DISPLAY_LIMIT; i++) {
+        if (displays[i].display_base.type == &framebufferio_framebufferdisplay_type) {
+            release_framebufferdisplay(&displays[i].framebuffer_display);
+        }
+        displays[i].display_base.type = &mp_type_NoneType;
+    }
+}
+
+// Displays live outside the heap, so gc_collect() marks what they point to.
+void displayio_gc_collect(void) {
+    for (uint8_t i = 0; i < CIRCUITPY_DISPLAY_LIMIT; i++) {
+        if (displays[i].display_base.type == &framebufferio_framebufferdisplay_type) {
+            framebufferio_framebufferdisplay_collect_ptrs(&displays[i].framebuffer_display);
+        }
+    }
+}
+
+// The unix port has no supervisor. Displays are refreshed explicitly, so ticks only time refreshes
+// and there is no terminal to show.
+uint64_t supervisor_ticks_ms64(void) {
+    return mp_hal_ticks_ms();
+}
+
+void supervisor_enable_tick(void) {
+}
+
+void supervisor_disable_tick(void) {
+}
+
+void supervisor_start_terminal(uint16_t width_px, uint16_t height_px) {
+    (void)width_px;
+    (void)height_px;
+}
+
+void supervisor_stop_terminal(void) {
+}
+
+//| def release_displays() -> None:
+//|     """Releases any actively used displays so new ones can be created."""
+//|     ...
+//|
+static mp_obj_t displayio_release_displays(void) {
+    common_hal_displayio_release_displays();
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_0(displayio_release_displays_obj, displayio_release_displays);
+#endif
+
+static bool _layer_fill_area(mp_obj_t layer_obj, const _displayio_colorspace_t *colorspace, const displayio_area_t *area, uint32_t *mask, uint32_t *buffer) {
+    #if CIRCUITPY_VECTORIO
+    const vectorio_draw_protocol_t *draw_protocol = mp_proto_get(MP_QSTR_protocol_draw, layer_obj);
+    if (draw_protocol != NULL) {
+        mp_obj_t layer = draw_protocol->draw_get_protocol_self(layer_obj);
+        return draw_protocol->draw_protocol_impl->draw_fill_area(layer, colorspace, area, mask, buffer);
+    }
+    #endif
+    displayio_tilegrid_t *tilegrid = mp_obj_cast_to_native_base(layer_obj, &displayio_tilegrid_type);
+    if (tilegrid != MP_OBJ_NULL) {
+        return displayio_tilegrid_fill_area(tilegrid, colorspace, area, mask, buffer);
+    }
+    displayio_group_t *group = mp_obj_cast_to_native_base(layer_obj, &displayio_group_type);
+    if (group != MP_OBJ_NULL) {
+        return displayio_group_fill_area(group, colorspace, area, mask, buffer);
+    }
+    mp_raise_TypeError_varg(MP_ERROR_TEXT("unsupported %q type"), MP_QSTR_layer);
+}
+
+//| def _fill_area(
+//|     layer: Union[TileGrid, Group, vectorio.Circle, vectorio.Rectangle, vectorio.Polygon],
+//|     buffer: WriteableBuffer,
+//|     width: int,
+//|     height: int,
+//| ) -> bool:
+//|     """Render ``layer`` alone into ``buffer`` as an RGB565 area of ``width`` by ``height`` pixels
+//|     at the origin. Like a display refresh, the area is filled in bands of rows that each fit in
+//|     a 512 byte area buffer. A layer shown on a display is placed as on that display. Returns True
+//|     when the layer covered every pixel of the area. Only available on the unix port, for tests
+//|     and benchmarks."""
+//|
+static mp_obj_t displayio__fill_area(size_t n_args, const mp_obj_t *args) {
+    mp_obj_t layer = args[0];
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[1], &bufinfo, MP_BUFFER_WRITE);
+    mp_int_t width = mp_arg_validate_int_range(mp_obj_get_int(args[2]), 1, 32767, MP_QSTR_width);
+    mp_int_t height = mp_arg_validate_int_range(mp_obj_get_int(args[3]), 1, 32767, MP_QSTR_height);
+    mp_arg_validate_length_min(bufinfo.len, width * height * sizeof(uint16_t), MP_QSTR_buffer);
+
+    displayio_tilegrid_t *tilegrid = mp_obj_cast_to_native_base(layer, &displayio_tilegrid_type);
+    if (tilegrid != MP_OBJ_NULL && tilegrid->absolute_transform == NULL) {
+        displayio_tilegrid_update_transform(tilegrid, &null_transform);
+        // Rendering on its own doesn't put the layer in a Group.
+        tilegrid->in_group = false;
+    }
+    displayio_group_t *group = mp_obj_cast_to_native_base(layer, &displayio_group_type);
+    if (group != MP_OBJ_NULL && !group->in_group) {
+        displayio_group_update_transform(group, &null_transform);
+        group->in_group = false;
+    }
+
+    _displayio_colorspace_t colorspace = {
+        .depth = 16,
+        .bytes_per_cell = 1,
+    };
+    mp_int_t rows_per_band = MAX(1, 256 / width);
+    size_t mask_length = (rows_per_band * width + 31) / 32;
+    uint32_t *mask = m_new(uint32_t, mask_length);
+    bool full_coverage = true;
+    for (mp_int_t y = 0; y < height; y += rows_per_band) {
+        displayio_area_t band = {0, y, width, MIN(y + rows_per_band, height), NULL};
+        memset(mask, 0, mask_length * sizeof(uint32_t));
+        uint16_t *pixels = (uint16_t *)bufinfo.buf + y * width;
+        full_coverage &= _layer_fill_area(layer, &colorspace, &band, mask, (uint32_t *)pixels);
+    }
+    m_del(uint32_t, mask, mask_length);
+    return mp_obj_new_bool(full_coverage);
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(displayio__fill_area_obj, 4, 4, displayio__fill_area);
+
 static const mp_rom_map_elem_t displayio_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_displayio) },
     { MP_ROM_QSTR(MP_QSTR_Bitmap), MP_ROM_PTR(&displayio_bitmap_type) },
     { MP_ROM_QSTR(MP_QSTR_Colorspace), MP_ROM_PTR(&displayio_colorspace_type) },
     { MP_ROM_QSTR(MP_QSTR_ColorConverter), MP_ROM_PTR(&displayio_colorconverter_type) },
+    { MP_ROM_QSTR(MP_QSTR_Group), MP_ROM_PTR(&displayio_group_type) },
+    { MP_ROM_QSTR(MP_QSTR_OnDiskBitmap), MP_ROM_PTR(&displayio_ondiskbitmap_type) },
     { MP_ROM_QSTR(MP_QSTR_Palette), MP_ROM_PTR(&displayio_palette_type) },
+    { MP_ROM_QSTR(MP_QSTR_TileGrid), MP_ROM_PTR(&displayio_tilegrid_type) },
+    #if CIRCUITPY_FRAMEBUFFERIO
+    { MP_ROM_QSTR(MP_QSTR_release_displays), MP_ROM_PTR(&displayio_release_displays_obj) },
+    #endif
+    { MP_ROM_QSTR(MP_QSTR__fill_area), MP_ROM_PTR(&displayio__fill_area_obj) },
 };
 static MP_DEFINE_CONST_DICT(displayio_module_globals, displayio_module_globals_table);
 
@@ -31,6 +31,11 @@
 
 #include "shared/runtime/gchelper.h"
 
+// CIRCUITPY-CHANGE: displays are not on the heap
+#if CIRCUITPY_FRAMEBUFFERIO
+#include "shared-module/displayio/__init__.h"
+#endif
+
 #if MICROPY_ENABLE_GC
 
 void gc_collect(void) {
@@ -39,6 +44,10 @@ void gc_collect(void) {
     #if MICROPY_PY_THREAD
     mp_thread_gc_others();
     #endif
+    // CIRCUITPY-CHANGE: mark the objects that displays refer to
+    #if CIRCUITPY_FRAMEBUFFERIO
+    displayio_gc_collect();
+    #endif
     gc_collect_end();
 }
 
@@ -0,0 +1,246 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <string.h>
+
+#include "py/obj.h"
+#include "py/objproperty.h"
+#include "py/runtime.h"
+
+#include "shared-bindings/util.h"
+#include "shared-module/framebufferio/FramebufferDisplay.h"
+
+#if CIRCUITPY_FRAMEBUFFERIO
+
+typedef struct {
+    mp_obj_base_t base;
+    uint8_t *pixels;
+    size_t len;
+    uint16_t width;
+    uint16_t height;
+    uint8_t color_depth;
+    mp_uint_t refresh_count;
+} offscreen_framebuffer_obj_t;
+
+//| """Render displays into memory
+//|
+//| The `offscreen` module provides a framebuffer that lives in RAM, so a
+//| `framebufferio.FramebufferDisplay` can render a whole `displayio.Group` tree without
+//| any display hardware. Only available on the unix port, for tests and benchmarks."""
+//|
+//| class Framebuffer:
+//|     """A framebuffer in RAM. Its pixels can be read with the buffer protocol."""
+//|
+//|     def __init__(self, width: int, height: int, *, color_depth: int = 16) -> None:
+//|         """Create a Framebuffer object
+//|
+//|         :param int width: the width of the framebuffer in pixels
+//|         :param int height: the height of the framebuffer in pixels
+//|         :param int color_depth: the color depth in bits per pixel: 1, 2, 4, 8, 16 or 32.
+//|             Depths below 8 are grayscale, 8 is RGB332, 16 is RGB565 and 32 is RGB888.
+//|         """
+//|
+static mp_obj_t offscreen_framebuffer_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_width, ARG_height, ARG_color_depth };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_width, MP_ARG_INT | MP_ARG_REQUIRED },
+        { MP_QSTR_height, MP_ARG_INT | MP_ARG_REQUIRED },
+        { MP_QSTR_color_depth, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 16} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_uint_t width = (mp_uint_t)mp_arg_validate_int_range(args[ARG_width].u_int, 1, 32767, MP_QSTR_width);
+    mp_uint_t height = (mp_uint_t)mp_arg_validate_int_range(args[ARG_height].u_int, 1, 32767, MP_QSTR_height);
+    mp_uint_t color_depth = args[ARG_color_depth].u_int;
+    if (color_depth != 1 && color_depth != 2 && color_depth != 4 && color_depth != 8 && color_depth != 16 && color_depth != 32) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("Invalid %q"), MP_QSTR_color_depth);
+    }
+
+    offscreen_framebuffer_obj_t *self = mp_obj_malloc(offscreen_framebuffer_obj_t, type);
+    self->width = width;
+    self->height = height;
+    self->color_depth = color_depth;
+    // Rows start on a byte boundary.
+    self->len = (width * color_depth + 7) / 8 * height;
+    self->pixels = m_malloc(self->len);
+    memset(self->pixels, 0, self->len);
+    self->refresh_count = 0;
+    return MP_OBJ_FROM_PTR(self);
+}
+
+static void check_for_deinit(offscreen_framebuffer_obj_t *self) {
+    if (self->pixels == NULL) {
+        raise_deinited_error();
+    }
+}
+
+//|     def deinit(self) -> None:
+//|         """Free the pixel memory. After deinitialization, no further operations may be performed."""
+//|         ...
+//|
+static void offscreen_framebuffer_deinit_proto(mp_obj_t self_in) {
+    offscreen_framebuffer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    self->pixels = NULL;
+    self->len = 0;
+}
+
+static mp_obj_t offscreen_framebuffer_deinit(mp_obj_t self_in) {
+    offscreen_framebuffer_deinit_proto(self_in);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(offscreen_framebuffer_deinit_obj, offscreen_framebuffer_deinit);
+
+//|     width: int
+//|     """The width of the framebuffer, in pixels."""
+static mp_obj_t offscreen_framebuffer_get_width(mp_obj_t self_in) {
+    offscreen_framebuffer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return MP_OBJ_NEW_SMALL_INT(self->width);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(offscreen_framebuffer_get_width_obj, offscreen_framebuffer_get_width);
+MP_PROPERTY_GETTER(offscreen_framebuffer_width_obj,
+    (mp_obj_t)&offscreen_framebuffer_get_width_obj);
+
+//|     height: int
+//|     """The height of the framebuffer, in pixels."""
+static mp_obj_t offscreen_framebuffer_get_height(mp_obj_t self_in) {
+    offscreen_framebuffer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return MP_OBJ_NEW_SMALL_INT(self->height);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(offscreen_framebuffer_get_height_obj, offscreen_framebuffer_get_height);
+MP_PROPERTY_GETTER(offscreen_framebuffer_height_obj,
+    (mp_obj_t)&offscreen_framebuffer_get_height_obj);
+
+//|     color_depth: int
+//|     """The color depth of the framebuffer, in bits per pixel."""
+static mp_obj_t offscreen_framebuffer_get_color_depth(mp_obj_t self_in) {
+    offscreen_framebuffer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return MP_OBJ_NEW_SMALL_INT(self->color_depth);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(offscreen_framebuffer_get_color_depth_obj, offscreen_framebuffer_get_color_depth);
+MP_PROPERTY_GETTER(offscreen_framebuffer_color_depth_obj,
+    (mp_obj_t)&offscreen_framebuffer_get_color_depth_obj);
+
+//|     refresh_count: int
+//|     """The number of refreshes that have changed pixels in the framebuffer."""
+//|
+//|
+static mp_obj_t offscreen_framebuffer_get_refresh_count(mp_obj_t self_in) {
+    offscreen_framebuffer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_int_from_uint(self->refresh_count);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(offscreen_framebuffer_get_refresh_count_obj, offscreen_framebuffer_get_refresh_count);
+MP_PROPERTY_GETTER(offscreen_framebuffer_refresh_count_obj,
+    (mp_obj_t)&offscreen_framebuffer_get_refresh_count_obj);
+
+static const mp_rom_map_elem_t offscreen_framebuffer_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&offscreen_framebuffer_deinit_obj) },
+
+    { MP_ROM_QSTR(MP_QSTR_width), MP_ROM_PTR(&offscreen_framebuffer_width_obj) },
+    { MP_ROM_QSTR(MP_QSTR_height), MP_ROM_PTR(&offscreen_framebuffer_height_obj) },
+    { MP_ROM_QSTR(MP_QSTR_color_depth), MP_ROM_PTR(&offscreen_framebuffer_color_depth_obj) },
+    { MP_ROM_QSTR(MP_QSTR_refresh_count), MP_ROM_PTR(&offscreen_framebuffer_refresh_count_obj) },
+};
+static MP_DEFINE_CONST_DICT(offscreen_framebuffer_locals_dict, offscreen_framebuffer_locals_dict_table);
+
+static mp_int_t offscreen_framebuffer_get_buffer(mp_obj_t self_in, mp_buffer_info_t *bufinfo, mp_uint_t flags) {
+    offscreen_framebuffer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    (void)flags;
+    if (self->pixels == NULL) {
+        return 1;
+    }
+    bufinfo->buf = self->pixels;
+    bufinfo->len = self->len;
+    bufinfo->typecode = 'B';
+    return 0;
+}
+
+static void offscreen_framebuffer_get_bufinfo(mp_obj_t self_in, mp_buffer_info_t *bufinfo) {
+    offscreen_framebuffer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (offscreen_framebuffer_get_buffer(self_in, bufinfo, MP_BUFFER_RW) != 0) {
+        // A NULL buffer makes the display skip the refresh.
+        bufinfo->buf = NULL;
+        bufinfo->len = self->len;
+    }
+}
+
+static void offscreen_framebuffer_swapbuffers(mp_obj_t self_in, uint8_t *dirty_row_bitmask) {
+    offscreen_framebuffer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    (void)dirty_row_bitmask;
+    self->refresh_count++;
+}
+
+static int offscreen_framebuffer_get_width_proto(mp_obj_t self_in) {
+    offscreen_framebuffer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return self->width;
+}
+
+static int offscreen_framebuffer_get_height_proto(mp_obj_t self_in) {
+    offscreen_framebuffer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return self->height;
+}
+
+static int offscreen_framebuffer_get_color_depth_proto(mp_obj_t self_in) {
+    offscreen_framebuffer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return self->color_depth;
+}
+
+static int offscreen_framebuffer_get_row_stride_proto(mp_obj_t self_in) {
+    offscreen_framebuffer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return (self->width * self->color_depth + 7) / 8;
+}
+
+static int offscreen_framebuffer_get_bytes_per_cell_proto(mp_obj_t self_in) {
+    (void)self_in;
+    return 1;
+}
+
+static bool offscreen_framebuffer_get_pixels_in_byte_share_row_proto(mp_obj_t self_in) {
+    (void)self_in;
+    return true;
+}
+
+static const framebuffer_p_t offscreen_framebuffer_proto = {
+    MP_PROTO_IMPLEMENT(MP_QSTR_protocol_framebuffer)
+    .get_bufinfo = offscreen_framebuffer_get_bufinfo,
+    .get_width = offscreen_framebuffer_get_width_proto,
+    .get_height = offscreen_framebuffer_get_height_proto,
+    .get_color_depth = offscreen_framebuffer_get_color_depth_proto,
+    .get_bytes_per_cell = offscreen_framebuffer_get_bytes_per_cell_proto,
+    .get_pixels_in_byte_share_row = offscreen_framebuffer_get_pixels_in_byte_share_row_proto,
+    .get_row_stride = offscreen_framebuffer_get_row_stride_proto,
+    .swapbuffers = offscreen_framebuffer_swapbuffers,
+    .deinit = offscreen_framebuffer_deinit_proto,
+};
+
+static MP_DEFINE_CONST_OBJ_TYPE(
+    offscreen_framebuffer_type,
+    MP_QSTR_Framebuffer,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    locals_dict, &offscreen_framebuffer_locals_dict,
+    make_new, offscreen_framebuffer_make_new,
+    buffer, offscreen_framebuffer_get_buffer,
+    protocol, &offscreen_framebuffer_proto
+    );
+
+static const mp_rom_map_elem_t offscreen_module_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_offscreen) },
+    { MP_ROM_QSTR(MP_QSTR_Framebuffer), MP_ROM_PTR(&offscreen_framebuffer_type) },
+};
+static MP_DEFINE_CONST_DICT(offscreen_module_globals, offscreen_module_globals_table);
+
+const mp_obj_module_t offscreen_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&offscreen_module_globals,
+};
+
+MP_REGISTER_MODULE(MP_QSTR_offscreen, offscreen_module);
+
+#endif // CIRCUITPY_FRAMEBUFFERIO
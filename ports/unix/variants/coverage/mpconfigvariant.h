@@ -37,6 +37,12 @@
 #define MICROPY_GC_SPLIT_HEAP          (1)
 #define MICROPY_GC_SPLIT_HEAP_N_HEAPS  (4)
 
+// Enable the GC free summary so it is exercised by the tests.
+#define MICROPY_GC_FREE_RUN_INDEX      (1)
+
+// Use the Robin Hood map layout so it is exercised by the tests.
+#define MICROPY_MAP_ROBIN_HOOD         (1)
+
 // Enable additional features.
 #define MICROPY_DEBUG_PARSE_RULE_NAME  (1)
 // CIRCUITPY-CHANGE: off
@@ -65,3 +71,11 @@
 #define MICROPY_PY_STRUCT              (0)
 #undef MICROPY_VFS_ROM_IOCTL
 #define MICROPY_VFS_ROM_IOCTL          (0)
+
+// CIRCUITPY-CHANGE: displayio.OnDiskBitmap reads its file through the FAT filesystem.
+#define mp_type_fileio mp_type_vfs_fat_fileio
+
+// CIRCUITPY-CHANGE: displayio settings that circuitpy_mpconfig.h sets on other ports.
+#define CIRCUITPY_DISPLAY_LIMIT        (1)
+#define CIRCUITPY_DISPLAY_AREA_BUFFER_SIZE (512)
+#define CIRCUITPY_DISPLAY_REFRESH_PLAN_LENGTH (8)
@@ -28,6 +28,7 @@ $(BUILD)/lib/tjpgd/src/tjpgd.o: CFLAGS += -Wno-shadow -Wno-cast-align
 SRC_BITMAP := \
 	shared/runtime/context_manager_helpers.c \
 	displayio_min.c \
+	modoffscreen.c \
 	shared-bindings/__future__/__init__.c \
 	shared-bindings/aesio/aes.c \
 	shared-bindings/aesio/__init__.c \
@@ -57,8 +58,13 @@ SRC_BITMAP := \
 	shared-bindings/codeop/__init__.c \
 	shared-bindings/displayio/Bitmap.c \
 	shared-bindings/displayio/ColorConverter.c \
+	shared-bindings/displayio/Group.c \
+	shared-bindings/displayio/OnDiskBitmap.c \
 	shared-bindings/displayio/Palette.c \
+	shared-bindings/displayio/TileGrid.c \
 	shared-bindings/floppyio/__init__.c \
+	shared-bindings/framebufferio/__init__.c \
+	shared-bindings/framebufferio/FramebufferDisplay.c \
 	shared-bindings/jpegio/__init__.c \
 	shared-bindings/jpegio/JpegDecoder.c \
 	shared-bindings/locale/__init__.c \
@@ -106,8 +112,14 @@ SRC_BITMAP := \
 	shared-module/displayio/area.c \
 	shared-module/displayio/Bitmap.c \
 	shared-module/displayio/ColorConverter.c \
+	shared-module/displayio/display_core.c \
+	shared-module/displayio/Group.c \
+	shared-module/displayio/OnDiskBitmap.c \
 	shared-module/displayio/Palette.c \
+	shared-module/displayio/TileGrid.c \
 	shared-module/floppyio/__init__.c \
+	shared-module/framebufferio/__init__.c \
+	shared-module/framebufferio/FramebufferDisplay.c \
 	shared-module/jpegio/__init__.c \
 	shared-module/jpegio/JpegDecoder.c \
 	shared-module/rainbowio/__init__.c \
@@ -163,6 +175,7 @@ CFLAGS += \
 	-DCIRCUITPY_CODEOP=1 \
 	-DCIRCUITPY_DISPLAYIO_UNIX=1 \
 	-DCIRCUITPY_FLOPPYIO=1 \
+	-DCIRCUITPY_FRAMEBUFFERIO=1 \
 	-DCIRCUITPY_FUTURE=1 \
 	-DCIRCUITPY_GIFIO=1 \
 	-DCIRCUITPY_JPEGIO=1 \
@@ -87,6 +87,8 @@ extern void common_hal_mcu_enable_interrupts(void);
 #define MICROPY_FLOAT_HIGH_QUALITY_HASH  (0)
 #define MICROPY_FLOAT_IMPL               (MICROPY_FLOAT_IMPL_FLOAT)
 #define MICROPY_GC_ALLOC_THRESHOLD       (0)
+#define MICROPY_GC_FREE_RUN_INDEX        (1)
+#define MICROPY_GC_INCREMENTAL_TICKS_US() supervisor_ticks_us32()
 #define MICROPY_GC_SPLIT_HEAP            (1)
 #define MICROPY_GC_SPLIT_HEAP_AUTO       (1)
 #define MP_PLAT_ALLOC_HEAP(size) port_malloc(size, false)
@@ -164,6 +166,7 @@ extern void common_hal_mcu_enable_interrupts(void);
 #else
 #define MICROPY_QSTR_BYTES_IN_HASH       (0)
 #endif
+#define MICROPY_QSTR_RUNTIME_INDEX       (CIRCUITPY_FULL_BUILD)
 #define MICROPY_REPL_AUTO_INDENT         (1)
 #define MICROPY_REPL_EVENT_DRIVEN        (0)
 #define MICROPY_STACK_CHECK              (1)
@@ -398,6 +401,11 @@ typedef long mp_off_t;
 #define CIRCUITPY_DISPLAY_AREA_BUFFER_SIZE (512)
 #endif
 
+// Maximum number of rectangles the dirty areas of one refresh are coalesced into.
+#ifndef CIRCUITPY_DISPLAY_REFRESH_PLAN_LENGTH
+#define CIRCUITPY_DISPLAY_REFRESH_PLAN_LENGTH (8)
+#endif
+
 #else
 #define CIRCUITPY_DISPLAY_LIMIT (0)
 #define CIRCUITPY_DISPLAY_AREA_BUFFER_SIZE (0)
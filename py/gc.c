@@ -51,6 +51,11 @@
 #include "shared-module/memorymonitor/__init__.h"
 #endif
 
+#if MICROPY_GC_INCREMENTAL
+#include "py/mphal.h"
+#include "supervisor/shared/tick.h"
+#endif
+
 #if defined(__ZEPHYR__) && defined(CONFIG_TRACING_PERFETTO) && defined(CONFIG_BOARD_NATIVE_SIM)
 #include "perfetto_encoder.h"
 #define CIRCUITPY_PERFETTO_VM_HEAP_USED_UUID 0x3001ULL
@@ -117,6 +122,37 @@
 #define ATB_HEAD_TO_MARK(area, block) do { area->gc_alloc_table_start[(block) / BLOCKS_PER_ATB] |= (AT_MARK << BLOCK_SHIFT(block)); } while (0)
 #define ATB_MARK_TO_HEAD(area, block) do { area->gc_alloc_table_start[(block) / BLOCKS_PER_ATB] &= (~(AT_TAIL << BLOCK_SHIFT(block))); } while (0)
 
+// CIRCUITPY-CHANGE: Access the ATB a word at a time where possible
+// On little-endian targets the entry for block n of a word is in bits 2n and
+// 2n+1, so whole words can be tested and updated with bitwise operations.
+#define ATB_WORD_ACCESS (MP_ENDIANNESS_LITTLE)
+
+#if ATB_WORD_ACCESS
+typedef unsigned long atb_word_t;
+
+#define ATBS_PER_WORD (sizeof(atb_word_t))
+#define BLOCKS_PER_ATB_WORD (ATBS_PER_WORD * BLOCKS_PER_ATB)
+#define ATB_WORD_LOW_BITS ((atb_word_t)-1 / 3) // 0b0101...01
+#define ATB_WORD_ALL_TAIL (ATB_WORD_LOW_BITS << 1)
+
+// A bit set in bit 2n of these for each block n of the given kind
+#define ATB_WORD_FREE(w) (~((w) | ((w) >> 1)) & ATB_WORD_LOW_BITS)
+#define ATB_WORD_HEAD(w) ((w) & ~((w) >> 1) & ATB_WORD_LOW_BITS)
+#define ATB_WORD_MARK(w) ((w) & ((w) >> 1) & ATB_WORD_LOW_BITS)
+#define ATB_WORD_USED(w) (((w) | ((w) >> 1)) & ATB_WORD_LOW_BITS)
+
+// Index of the last block in the word that has its bit set in the given mask
+#define ATB_WORD_LAST_BLOCK(mask) ((MP_BITS_PER_BYTE * sizeof(atb_word_t) - 1 - mp_clzl(mask)) / 2)
+
+#define ATB_WORD_GET(area, atb) (*(atb_word_t *)(void *)&(area)->gc_alloc_table_start[atb])
+#define ATB_WORD_SET(area, atb, w) do { *(atb_word_t *)(void *)&(area)->gc_alloc_table_start[atb] = (w); } while (0)
+
+// True if a whole, aligned, word of the ATB starts at the given ATB index
+#define ATB_WORD_STARTS_AT(area, atb) \
+    ((((uintptr_t)&(area)->gc_alloc_table_start[atb]) & (ATBS_PER_WORD - 1)) == 0 \
+    && (atb) + ATBS_PER_WORD <= (area)->gc_alloc_table_byte_len)
+#endif
+
 #define BLOCK_FROM_PTR(area, ptr) (((byte *)(ptr) - area->gc_pool_start) / BYTES_PER_BLOCK)
 #define PTR_FROM_BLOCK(area, block) (((block) * BYTES_PER_BLOCK + (uintptr_t)area->gc_pool_start))
 
@@ -147,6 +183,22 @@
 #define CTB_SET(area, block) do { area->gc_collect_table_start[(block) / BLOCKS_PER_CTB] |= (1 << ((block) & 7)); } while (0)
 #define CTB_CLEAR(area, block) do { area->gc_collect_table_start[(block) / BLOCKS_PER_CTB] &= (~(1 << ((block) & 7))); } while (0)
 
+// CIRCUITPY-CHANGE: Add free summary table to find long runs of free blocks quickly
+#if MICROPY_GC_FREE_RUN_INDEX
+// FSB = free summary byte
+// one bit per ATB; if set, then all the blocks of the corresponding ATB are free
+
+#define ATBS_PER_FSB (8)
+
+#define FSB_GET(area, atb) ((area->gc_free_summary_start[(atb) / ATBS_PER_FSB] >> ((atb) & 7)) & 1)
+#define FSB_SET(area, atb) do { area->gc_free_summary_start[(atb) / ATBS_PER_FSB] |= (1 << ((atb) & 7)); } while (0)
+#define FSB_CLEAR(area, atb) do { area->gc_free_summary_start[(atb) / ATBS_PER_FSB] &= (~(1 << ((atb) & 7))); } while (0)
+
+// Any run of at least this many free blocks must contain a whole free ATB, so
+// it can be found by looking at the free summary alone.
+#define FSB_MIN_BLOCKS (2 * BLOCKS_PER_ATB - 1)
+#endif
+
 #if MICROPY_PY_THREAD && !MICROPY_PY_THREAD_GIL
 #define GC_MUTEX_INIT() mp_thread_recursive_mutex_init(&MP_STATE_MEM(gc_mutex))
 #define GC_ENTER() mp_thread_recursive_mutex_lock(&MP_STATE_MEM(gc_mutex), 1)
@@ -204,9 +256,17 @@ static void gc_mark_subtree(mp_state_mem_area_t *area, size_t block);
 #else
 static void gc_mark_subtree(size_t block);
 #endif
+static inline size_t gc_mark_children(mp_state_mem_area_t *area, size_t block, size_t sp);
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_INCREMENTAL && MICROPY_EMIT_MACHINE_CODE
+static void gc_inc_rescan_cells(void);
+#endif
 static void gc_deal_with_stack_overflow(void);
 static void gc_sweep_run_finalisers(void);
 static void gc_sweep_free_blocks(void);
+#if MICROPY_GC_FREE_RUN_INDEX
+static void gc_free_summary_update(mp_state_mem_area_t *area, size_t start_block, size_t end_block);
+#endif
 
 // TODO waste less memory; currently requires that all entries in alloc_table have a corresponding block in pool
 static void gc_setup_area(mp_state_mem_area_t *area, void *start, void *end) {
@@ -234,7 +294,12 @@ static void gc_setup_area(mp_state_mem_area_t *area, void *start, void *end) {
 
     // Calculate the allocation table size
     size_t available_bits = (total_byte_len - ALLOC_TABLE_GAP_BYTE) * MP_BITS_PER_BYTE;
+    #if MICROPY_GC_FREE_RUN_INDEX
+    // The FSB needs less than a bit per block, so count in units of 1/BLOCKS_PER_ATB bits.
+    size_t blocks = available_bits * BLOCKS_PER_ATB / (bits_per_block * BLOCKS_PER_ATB + 1);
+    #else
     size_t blocks = available_bits / bits_per_block;
+    #endif
     area->gc_alloc_table_byte_len = blocks / BLOCKS_PER_ATB;
 
     // Set up all the table pointers
@@ -257,6 +322,12 @@ static void gc_setup_area(mp_state_mem_area_t *area, void *start, void *end) {
     next_table += gc_collect_table_byte_len;
     #endif
 
+    #if MICROPY_GC_FREE_RUN_INDEX
+    size_t gc_free_summary_byte_len = (area->gc_alloc_table_byte_len + ATBS_PER_FSB - 1) / ATBS_PER_FSB;
+    area->gc_free_summary_start = next_table;
+    next_table += gc_free_summary_byte_len;
+    #endif
+
     // Set pool pointers
     area->gc_pool_start = (byte *)end - gc_pool_block_len * BYTES_PER_BLOCK;
     area->gc_pool_end = end;
@@ -268,6 +339,11 @@ static void gc_setup_area(mp_state_mem_area_t *area, void *start, void *end) {
     size_t tables_size = next_table - area->gc_alloc_table_start;
     memset(area->gc_alloc_table_start, 0, tables_size);
 
+    #if MICROPY_GC_FREE_RUN_INDEX
+    // The whole pool starts out free
+    gc_free_summary_update(area, 0, gc_pool_block_len - 1);
+    #endif
+
     area->gc_last_free_atb_index = 0;
     area->gc_last_used_block = 0;
 
@@ -292,6 +368,10 @@ static void gc_setup_area(mp_state_mem_area_t *area, void *start, void *end) {
         gc_collect_table_byte_len,
         gc_collect_table_byte_len * BLOCKS_PER_CTB);
     #endif
+    #if MICROPY_GC_FREE_RUN_INDEX
+    DEBUG_printf("  free summary at %p, length " UINT_FMT " bytes\n",
+        area->gc_free_summary_start, gc_free_summary_byte_len);
+    #endif
     DEBUG_printf("  pool at %p, length " UINT_FMT " bytes, "
         UINT_FMT " blocks\n", area->gc_pool_start,
         gc_pool_block_len * BYTES_PER_BLOCK, gc_pool_block_len);
@@ -321,6 +401,15 @@ void gc_init(void *start, void *end) {
     MP_STATE_MEM(gc_alloc_amount) = 0;
     #endif
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_INCREMENTAL
+    MP_STATE_MEM(gc_inc_phase) = GC_INC_IDLE;
+    MP_STATE_MEM(gc_inc_sp) = 0;
+    MP_STATE_MEM(gc_inc_rescan_area) = NULL;
+    MP_STATE_MEM(gc_inc_auto_budget_us) = MICROPY_GC_INCREMENTAL_AUTO_BUDGET_US;
+    MP_STATE_MEM(gc_inc_alloc_amount) = 0;
+    #endif
+
     GC_MUTEX_INIT();
     gc_perfetto_emit_heap_stats();
 }
@@ -356,12 +445,16 @@ static size_t compute_heap_size(size_t total_blocks) {
     size_t atb_bytes = (total_blocks + BLOCKS_PER_ATB - 1) / BLOCKS_PER_ATB;
     size_t ftb_bytes = 0;
     size_t ctb_bytes = 0;
+    size_t fsb_bytes = 0;
     #if MICROPY_ENABLE_FINALISER
     ftb_bytes = (total_blocks + BLOCKS_PER_FTB - 1) / BLOCKS_PER_FTB;
     #endif
     #if MICROPY_ENABLE_SELECTIVE_COLLECT
     ctb_bytes = (total_blocks + BLOCKS_PER_CTB - 1) / BLOCKS_PER_CTB;
     #endif
+    #if MICROPY_GC_FREE_RUN_INDEX
+    fsb_bytes = (atb_bytes + ATBS_PER_FSB - 1) / ATBS_PER_FSB;
+    #endif
     size_t pool_bytes = total_blocks * BYTES_PER_BLOCK;
 
     // Compute bytes needed to build a heap with total_blocks blocks.
@@ -371,6 +464,7 @@ static size_t compute_heap_size(size_t total_blocks) {
         + ALLOC_TABLE_GAP_BYTE
         + ftb_bytes
         + ctb_bytes
+        + fsb_bytes
         + pool_bytes
         + BYTES_PER_BLOCK; // Extra block of bytes to account for end pointer alignment
 
@@ -530,6 +624,31 @@ static inline mp_state_mem_area_t *gc_get_ptr_area(const void *ptr) {
 
 void gc_collect_start(void) {
     gc_collect_start_common();
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_INCREMENTAL
+    if (MP_STATE_MEM(gc_inc_phase) == GC_INC_MARK) {
+        // Finish the incremental collection in progress: keep its marks and
+        // check the children of the blocks still on the stack.
+        MP_STATE_MEM(gc_inc_phase) = GC_INC_FINISH;
+        if (MP_STATE_MEM(gc_inc_rescan_area) != NULL) {
+            // An interrupted rescan is redone in full at the end.
+            MP_STATE_MEM(gc_stack_overflow) = 1;
+        }
+        for (size_t sp = MP_STATE_MEM(gc_inc_sp); sp > 0;) {
+            sp -= 1;
+            #if MICROPY_GC_SPLIT_HEAP
+            mp_state_mem_area_t *area = MP_STATE_MEM(gc_area_stack)[sp];
+            #else
+            mp_state_mem_area_t *area = &MP_STATE_MEM(area);
+            #endif
+            sp = gc_mark_children(area, MP_STATE_MEM(gc_block_stack)[sp], sp);
+        }
+        MP_STATE_MEM(gc_inc_sp) = 0;
+        #if MICROPY_EMIT_MACHINE_CODE
+        gc_inc_rescan_cells();
+        #endif
+    }
+    #endif
     #if MICROPY_GC_ALLOC_THRESHOLD
     MP_STATE_MEM(gc_alloc_amount) = 0;
     #endif
@@ -553,6 +672,13 @@ static void gc_collect_start_common(void) {
     GC_ENTER();
     assert((MP_STATE_THREAD(gc_lock_depth) & GC_COLLECT_FLAG) == 0);
     MP_STATE_THREAD(gc_lock_depth) |= GC_COLLECT_FLAG;
+    // CIRCUITPY-CHANGE: an incremental collection being finished keeps its
+    // pending stack overflow
+    #if MICROPY_GC_INCREMENTAL
+    if (MP_STATE_MEM(gc_inc_phase) == GC_INC_MARK) {
+        return;
+    }
+    #endif
     MP_STATE_MEM(gc_stack_overflow) = 0;
 }
 
@@ -583,9 +709,86 @@ void gc_collect_root(void **ptrs, size_t len) {
             gc_mark_subtree(block);
             #endif
         }
+        // CIRCUITPY-CHANGE
+        #if MICROPY_GC_INCREMENTAL
+        else if (MP_STATE_MEM(gc_inc_phase) == GC_INC_FINISH && ATB_GET_KIND(area, block) == AT_MARK) {
+            // Marked by an earlier step, but roots can be written to
+            // without a barrier, so check its children again.
+            #if MICROPY_GC_SPLIT_HEAP
+            gc_mark_subtree(area, block);
+            #else
+            gc_mark_subtree(block);
+            #endif
+        }
+        #endif
     }
 }
 
+// Check all the children of the given block: mark the unmarked child blocks
+// and push those newly marked blocks on the stack, starting at index sp.
+// Returns the new stack pointer.
+// CIRCUITPY-CHANGE: Split out of gc_mark_subtree so incremental marking can share it.
+static inline MP_ALWAYSINLINE size_t gc_mark_children(mp_state_mem_area_t *area, size_t block, size_t sp) {
+    // work out number of consecutive blocks in the chain starting with this one
+    size_t n_blocks = 0;
+    do {
+        n_blocks += 1;
+    } while (ATB_GET_KIND(area, block + n_blocks) == AT_TAIL);
+
+    // check that the consecutive blocks didn't overflow past the end of the area
+    assert(area->gc_pool_start + (block + n_blocks) * BYTES_PER_BLOCK <= area->gc_pool_end);
+
+    // CIRCUITPY-CHANGE
+    // check if this block should be collected
+    #if MICROPY_ENABLE_SELECTIVE_COLLECT
+    bool should_scan = CTB_GET(area, block);
+    #else
+    bool should_scan = true;
+    #endif
+
+    // Only scan the block's children if it's not a leaf
+    if (should_scan) {
+        // check this block's children
+        void **ptrs = (void **)PTR_FROM_BLOCK(area, block);
+        for (size_t i = n_blocks * BYTES_PER_BLOCK / sizeof(void *); i > 0; i--, ptrs++) {
+            MICROPY_GC_HOOK_LOOP(i);
+            void *ptr = *ptrs;
+            // If this is a heap pointer that hasn't been marked, mark it and push
+            // it's children to the stack.
+            #if MICROPY_GC_SPLIT_HEAP
+            mp_state_mem_area_t *ptr_area = gc_get_ptr_area(ptr);
+            if (!ptr_area) {
+                // Not a heap-allocated pointer (might even be random data).
+                continue;
+            }
+            #else
+            if (!VERIFY_PTR(ptr)) {
+                continue;
+            }
+            mp_state_mem_area_t *ptr_area = area;
+            #endif
+            size_t ptr_block = BLOCK_FROM_PTR(ptr_area, ptr);
+            if (ATB_GET_KIND(ptr_area, ptr_block) != AT_HEAD) {
+                // This block is already marked.
+                continue;
+            }
+            // An unmarked head. Mark it, and push it on gc stack.
+            TRACE_MARK(ptr_block, ptr);
+            ATB_HEAD_TO_MARK(ptr_area, ptr_block);
+            if (sp < MICROPY_ALLOC_GC_STACK_SIZE) {
+                MP_STATE_MEM(gc_block_stack)[sp] = ptr_block;
+                #if MICROPY_GC_SPLIT_HEAP
+                MP_STATE_MEM(gc_area_stack)[sp] = ptr_area;
+                #endif
+                sp += 1;
+            } else {
+                MP_STATE_MEM(gc_stack_overflow) = 1;
+            }
+        }
+    }
+    return sp;
+}
+
 // Take the given block as the topmost block on the stack. Check all it's
 // children: mark the unmarked child blocks and put those newly marked
 // blocks on the stack. When all children have been checked, pop off the
@@ -598,70 +801,14 @@ static void MP_NO_INSTRUMENT PLACE_IN_ITCM(gc_mark_subtree)(mp_state_mem_area_t
 static void MP_NO_INSTRUMENT PLACE_IN_ITCM(gc_mark_subtree)(size_t block)
 #endif
 {
+    #if !MICROPY_GC_SPLIT_HEAP
+    mp_state_mem_area_t *area = &MP_STATE_MEM(area);
+    #endif
+
     // Start with the block passed in the argument.
     size_t sp = 0;
     for (;;) {
-        #if !MICROPY_GC_SPLIT_HEAP
-        mp_state_mem_area_t *area = &MP_STATE_MEM(area);
-        #endif
-
-        // work out number of consecutive blocks in the chain starting with this one
-        size_t n_blocks = 0;
-        do {
-            n_blocks += 1;
-        } while (ATB_GET_KIND(area, block + n_blocks) == AT_TAIL);
-
-        // check that the consecutive blocks didn't overflow past the end of the area
-        assert(area->gc_pool_start + (block + n_blocks) * BYTES_PER_BLOCK <= area->gc_pool_end);
-
-        // CIRCUITPY-CHANGE
-        // check if this block should be collected
-        #if MICROPY_ENABLE_SELECTIVE_COLLECT
-        bool should_scan = CTB_GET(area, block);
-        #else
-        bool should_scan = true;
-        #endif
-
-        // Only scan the block's children if it's not a leaf
-        if (should_scan) {
-            // check this block's children
-            void **ptrs = (void **)PTR_FROM_BLOCK(area, block);
-            for (size_t i = n_blocks * BYTES_PER_BLOCK / sizeof(void *); i > 0; i--, ptrs++) {
-                MICROPY_GC_HOOK_LOOP(i);
-                void *ptr = *ptrs;
-                // If this is a heap pointer that hasn't been marked, mark it and push
-                // it's children to the stack.
-                #if MICROPY_GC_SPLIT_HEAP
-                mp_state_mem_area_t *ptr_area = gc_get_ptr_area(ptr);
-                if (!ptr_area) {
-                    // Not a heap-allocated pointer (might even be random data).
-                    continue;
-                }
-                #else
-                if (!VERIFY_PTR(ptr)) {
-                    continue;
-                }
-                mp_state_mem_area_t *ptr_area = area;
-                #endif
-                size_t ptr_block = BLOCK_FROM_PTR(ptr_area, ptr);
-                if (ATB_GET_KIND(ptr_area, ptr_block) != AT_HEAD) {
-                    // This block is already marked.
-                    continue;
-                }
-                // An unmarked head. Mark it, and push it on gc stack.
-                TRACE_MARK(ptr_block, ptr);
-                ATB_HEAD_TO_MARK(ptr_area, ptr_block);
-                if (sp < MICROPY_ALLOC_GC_STACK_SIZE) {
-                    MP_STATE_MEM(gc_block_stack)[sp] = ptr_block;
-                    #if MICROPY_GC_SPLIT_HEAP
-                    MP_STATE_MEM(gc_area_stack)[sp] = ptr_area;
-                    #endif
-                    sp += 1;
-                } else {
-                    MP_STATE_MEM(gc_stack_overflow) = 1;
-                }
-            }
-        }
+        sp = gc_mark_children(area, block, sp);
 
         // Are there any blocks on the stack?
         if (sp == 0) {
@@ -677,13 +824,261 @@ static void MP_NO_INSTRUMENT PLACE_IN_ITCM(gc_mark_subtree)(size_t block)
     }
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_INCREMENTAL
+
+// Incremental collection marks the heap a bounded amount at a time between
+// which the program keeps running.  The roots are marked first, then the
+// marked blocks are popped off gc_block_stack and their children checked,
+// as gc_mark_subtree does.  Blocks allocated while marking start unmarked.
+// Stores into the heap go through gc_write_barrier(), which marks the block
+// and pushes it (again) so its children are checked.  The final step is a
+// normal gc_collect(): it drains the stack, then rescans the roots, checking
+// the children of already-marked roots too because those can change without
+// a barrier (eg locals of a running generator), and sweeps.
+
+// Number of blocks to mark between checks of the step time budget.
+#define GC_INC_BLOCKS_PER_CHECK (16)
+
+// Mark the head block ptr, if unmarked, and push it so its children are
+// (re)checked.  Returns false if there was no room on the stack.
+static bool gc_inc_shade(const void *ptr) {
+    #if MICROPY_GC_SPLIT_HEAP
+    mp_state_mem_area_t *area = gc_get_ptr_area(ptr);
+    if (!area) {
+        return true;
+    }
+    #else
+    mp_state_mem_area_t *area = &MP_STATE_MEM(area);
+    if (!VERIFY_PTR(ptr)) {
+        return true;
+    }
+    #endif
+    size_t block = BLOCK_FROM_PTR(area, ptr);
+    switch (ATB_GET_KIND(area, block)) {
+        case AT_HEAD:
+            TRACE_MARK(block, ptr);
+            ATB_HEAD_TO_MARK(area, block);
+            break;
+        case AT_MARK:
+            break;
+        default:
+            return true;
+    }
+    size_t sp = MP_STATE_MEM(gc_inc_sp);
+    if (sp > 0 && MP_STATE_MEM(gc_block_stack)[sp - 1] == block
+        #if MICROPY_GC_SPLIT_HEAP
+        && MP_STATE_MEM(gc_area_stack)[sp - 1] == area
+        #endif
+        ) {
+        // Repeated stores into the same block only need it pushed once.
+        return true;
+    }
+    if (sp == MICROPY_ALLOC_GC_STACK_SIZE) {
+        MP_STATE_MEM(gc_stack_overflow) = 1;
+        return false;
+    }
+    MP_STATE_MEM(gc_block_stack)[sp] = block;
+    #if MICROPY_GC_SPLIT_HEAP
+    MP_STATE_MEM(gc_area_stack)[sp] = area;
+    #endif
+    MP_STATE_MEM(gc_inc_sp) = sp + 1;
+    return true;
+}
+
+void gc_write_barrier(const void *ptr) {
+    GC_ENTER();
+    if (MP_STATE_MEM(gc_inc_phase) == GC_INC_MARK) {
+        gc_inc_shade(ptr);
+    }
+    GC_EXIT();
+}
+
+#if MICROPY_EMIT_MACHINE_CODE
+// Native code stores into closure cells directly, without the barrier in
+// mp_obj_cell_set(), so check the contents of every cell marked by an
+// earlier step again when finishing.
+static void gc_inc_rescan_cells(void) {
+    for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
+        for (size_t block = 0; block < area->gc_alloc_table_byte_len * BLOCKS_PER_ATB; block++) {
+            MICROPY_GC_HOOK_LOOP(block);
+            #if ATB_WORD_ACCESS
+            if ((block & (BLOCKS_PER_ATB - 1)) == 0 && ATB_WORD_STARTS_AT(area, block / BLOCKS_PER_ATB)
+                && ATB_WORD_MARK(ATB_WORD_GET(area, block / BLOCKS_PER_ATB)) == 0) {
+                block += BLOCKS_PER_ATB_WORD - 1;
+                continue;
+            }
+            #endif
+            if (ATB_GET_KIND(area, block) == AT_MARK) {
+                mp_obj_cell_t *cell = (mp_obj_cell_t *)PTR_FROM_BLOCK(area, block);
+                if (cell->base.type == &mp_type_cell) {
+                    gc_collect_root((void **)&cell->obj, 1);
+                }
+            }
+        }
+    }
+}
+#endif
+
+// Mark the next root pointer. Returns false once there are none left.
+static bool gc_inc_mark_next_root(void) {
+    size_t root_start = offsetof(mp_state_ctx_t, thread.dict_locals) / sizeof(void *);
+    size_t root_len = offsetof(mp_state_ctx_t, vm.qstr_last_chunk) / sizeof(void *) - root_start;
+    size_t i = MP_STATE_MEM(gc_inc_root_index);
+    void *ptr;
+    if (i < root_len) {
+        ptr = gc_get_ptr((void **)(void *)&mp_state_ctx, root_start + i);
+    } else {
+        #if MICROPY_ENABLE_PYSTACK
+        // The Python stack may have changed since the last step, so check
+        // against where it ends now.
+        size_t pystack_len = (MP_STATE_THREAD(pystack_cur) - MP_STATE_THREAD(pystack_start)) / sizeof(void *);
+        if (i - root_len >= pystack_len) {
+            return false;
+        }
+        ptr = gc_get_ptr((void **)(void *)MP_STATE_THREAD(pystack_start), i - root_len);
+        #else
+        return false;
+        #endif
+    }
+    if (gc_inc_shade(ptr)) {
+        MP_STATE_MEM(gc_inc_root_index) = i + 1;
+    }
+    return true;
+}
+
+// Check the children of the next marked block found when rescanning the heap
+// after a stack overflow. Returns false once the rescan is complete.
+static bool gc_inc_rescan_next(void) {
+    mp_state_mem_area_t *area = MP_STATE_MEM(gc_inc_rescan_area);
+    size_t block = MP_STATE_MEM(gc_inc_rescan_block);
+    while (area != NULL) {
+        size_t max_block = area->gc_alloc_table_byte_len * BLOCKS_PER_ATB;
+        for (; block < max_block; block++) {
+            if (ATB_GET_KIND(area, block) == AT_MARK) {
+                MP_STATE_MEM(gc_inc_sp) = gc_mark_children(area, block, MP_STATE_MEM(gc_inc_sp));
+                MP_STATE_MEM(gc_inc_rescan_area) = area;
+                MP_STATE_MEM(gc_inc_rescan_block) = block + 1;
+                return true;
+            }
+        }
+        area = NEXT_AREA(area);
+        block = 0;
+    }
+    MP_STATE_MEM(gc_inc_rescan_area) = NULL;
+    return false;
+}
+
+// Mark until the budget runs out or marking is complete, in which case
+// true is returned.
+static bool gc_inc_mark(mp_uint_t start_us, mp_uint_t budget_us) {
+    for (size_t n = 1;; n++) {
+        if (n % GC_INC_BLOCKS_PER_CHECK == 0
+            && (mp_uint_t)(MICROPY_GC_INCREMENTAL_TICKS_US() - start_us) >= budget_us) {
+            return false;
+        }
+        size_t sp = MP_STATE_MEM(gc_inc_sp);
+        if (sp > 0) {
+            sp -= 1;
+            #if MICROPY_GC_SPLIT_HEAP
+            mp_state_mem_area_t *area = MP_STATE_MEM(gc_area_stack)[sp];
+            #else
+            mp_state_mem_area_t *area = &MP_STATE_MEM(area);
+            #endif
+            MP_STATE_MEM(gc_inc_sp) = gc_mark_children(area, MP_STATE_MEM(gc_block_stack)[sp], sp);
+        } else if (gc_inc_mark_next_root()) {
+            continue;
+        } else if (MP_STATE_MEM(gc_inc_rescan_area) != NULL) {
+            gc_inc_rescan_next();
+        } else if (MP_STATE_MEM(gc_stack_overflow)) {
+            MP_STATE_MEM(gc_stack_overflow) = 0;
+            MP_STATE_MEM(gc_inc_rescan_area) = &MP_STATE_MEM(area);
+            MP_STATE_MEM(gc_inc_rescan_block) = 0;
+        } else {
+            return true;
+        }
+    }
+}
+
+bool gc_collect_step(mp_uint_t budget_us) {
+    // Can't collect while locked, which includes during a collection.
+    if (MP_STATE_THREAD(gc_lock_depth) > 0) {
+        return false;
+    }
+    mp_uint_t start_us = MICROPY_GC_INCREMENTAL_TICKS_US();
+    GC_ENTER();
+    if (MP_STATE_MEM(gc_inc_phase) == GC_INC_IDLE) {
+        MP_STATE_MEM(gc_inc_phase) = GC_INC_MARK;
+        MP_STATE_MEM(gc_inc_sp) = 0;
+        MP_STATE_MEM(gc_inc_root_index) = 0;
+        MP_STATE_MEM(gc_inc_rescan_area) = NULL;
+        MP_STATE_MEM(gc_stack_overflow) = 0;
+    }
+    bool marked = gc_inc_mark(start_us, budget_us);
+    GC_EXIT();
+    if (!marked) {
+        return false;
+    }
+    gc_collect();
+    return true;
+}
+
+void gc_collect_step_auto(void) {
+    mp_uint_t budget_us = MP_STATE_MEM(gc_inc_auto_budget_us);
+    if (budget_us == 0 || !gc_alloc_possible() || !MP_STATE_MEM(gc_auto_collect_enabled)
+        || MP_STATE_THREAD(gc_lock_depth) > 0) {
+        return;
+    }
+    if (MP_STATE_MEM(gc_inc_phase) == GC_INC_IDLE) {
+        // Start a collection once an eighth of the heap has been allocated
+        // since the last one.
+        size_t total_blocks = 0;
+        for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
+            total_blocks += area->gc_alloc_table_byte_len * BLOCKS_PER_ATB;
+        }
+        if (MP_STATE_MEM(gc_inc_alloc_amount) < total_blocks / 8) {
+            return;
+        }
+    }
+    // Leave the program at least three quarters of the time.
+    mp_uint_t now_us = MICROPY_GC_INCREMENTAL_TICKS_US();
+    if ((mp_uint_t)(now_us - MP_STATE_MEM(gc_inc_auto_last_us)) < 4 * budget_us) {
+        return;
+    }
+    MP_STATE_MEM(gc_inc_auto_last_us) = now_us;
+    gc_collect_step(budget_us);
+}
+
+#endif // MICROPY_GC_INCREMENTAL
+
 void gc_sweep_all(void) {
     gc_collect_start_common();
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_INCREMENTAL
+    if (MP_STATE_MEM(gc_inc_phase) != GC_INC_IDLE) {
+        // Drop the marks of the incremental collection in progress so that
+        // everything is swept.
+        for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
+            for (size_t block = 0; block < area->gc_alloc_table_byte_len * BLOCKS_PER_ATB; block++) {
+                if (ATB_GET_KIND(area, block) == AT_MARK) {
+                    ATB_MARK_TO_HEAD(area, block);
+                }
+            }
+        }
+        MP_STATE_MEM(gc_inc_phase) = GC_INC_IDLE;
+        MP_STATE_MEM(gc_stack_overflow) = 0;
+    }
+    #endif
     gc_collect_end();
 }
 
 void gc_collect_end(void) {
     gc_deal_with_stack_overflow();
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_INCREMENTAL
+    MP_STATE_MEM(gc_inc_phase) = GC_INC_IDLE;
+    MP_STATE_MEM(gc_inc_alloc_amount) = 0;
+    #endif
     gc_sweep_run_finalisers();
     gc_sweep_free_blocks();
     #if MICROPY_GC_SPLIT_HEAP
@@ -705,6 +1100,14 @@ static void gc_deal_with_stack_overflow(void) {
         for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
             for (size_t block = 0; block < area->gc_alloc_table_byte_len * BLOCKS_PER_ATB; block++) {
                 MICROPY_GC_HOOK_LOOP(block);
+                #if ATB_WORD_ACCESS
+                // CIRCUITPY-CHANGE: skip whole words of the ATB without any marks
+                if ((block & (BLOCKS_PER_ATB - 1)) == 0 && ATB_WORD_STARTS_AT(area, block / BLOCKS_PER_ATB)
+                    && ATB_WORD_MARK(ATB_WORD_GET(area, block / BLOCKS_PER_ATB)) == 0) {
+                    block += BLOCKS_PER_ATB_WORD - 1;
+                    continue;
+                }
+                #endif
                 // trace (again) if mark bit set
                 if (ATB_GET_KIND(area, block) == AT_MARK) {
                     #if MICROPY_GC_SPLIT_HEAP
@@ -776,6 +1179,38 @@ static void gc_sweep_free_blocks(void) {
 
         for (size_t block = 0; block <= area->gc_last_used_block; block++) {
             MICROPY_GC_HOOK_LOOP(block);
+            #if ATB_WORD_ACCESS
+            // CIRCUITPY-CHANGE: sweep a whole word of the ATB at once when
+            // that doesn't need per-block bookkeeping
+            if ((block & (BLOCKS_PER_ATB - 1)) == 0 && ATB_WORD_STARTS_AT(area, block / BLOCKS_PER_ATB)) {
+                size_t atb = block / BLOCKS_PER_ATB;
+                atb_word_t w = ATB_WORD_GET(area, atb);
+                if (ATB_WORD_HEAD(w) == 0 && !(free_tail && (w & ATB_MASK_0) == AT_TAIL)) {
+                    // Nothing in this word is freed: turn marks back into
+                    // heads, which only needs the high bit of each cleared.
+                    atb_word_t marks = ATB_WORD_MARK(w);
+                    atb_word_t used = ATB_WORD_USED(w);
+                    ATB_WORD_SET(area, atb, w & ~(marks << 1));
+                    if (marks) {
+                        free_tail = 0;
+                    }
+                    if (used) {
+                        last_used_block = block + ATB_WORD_LAST_BLOCK(used);
+                    }
+                    block += BLOCKS_PER_ATB_WORD - 1;
+                    continue;
+                }
+                if (free_tail && w == ATB_WORD_ALL_TAIL) {
+                    // The middle of a long chain that is being freed.
+                    ATB_WORD_SET(area, atb, 0);
+                    #if CLEAR_ON_SWEEP
+                    memset((void *)PTR_FROM_BLOCK(area, block), 0, BLOCKS_PER_ATB_WORD * BYTES_PER_BLOCK);
+                    #endif
+                    block += BLOCKS_PER_ATB_WORD - 1;
+                    continue;
+                }
+            }
+            #endif
             switch (ATB_GET_KIND(area, block)) {
                 case AT_HEAD:
                     free_tail = 1;
@@ -805,6 +1240,11 @@ static void gc_sweep_free_blocks(void) {
             }
         }
 
+        #if MICROPY_GC_FREE_RUN_INDEX
+        // Rebuild the free summary for the part of the area that was swept
+        gc_free_summary_update(area, 0, area->gc_last_used_block);
+        #endif
+
         area->gc_last_used_block = last_used_block;
 
         #if MICROPY_GC_SPLIT_HEAP_AUTO
@@ -820,6 +1260,77 @@ static void gc_sweep_free_blocks(void) {
     }
 }
 
+#if MICROPY_GC_FREE_RUN_INDEX
+// Recompute the FSB bits for the ATBs that cover blocks start_block to
+// end_block inclusive.  Must be called whenever those blocks change between
+// free and non-free.
+static void gc_free_summary_update(mp_state_mem_area_t *area, size_t start_block, size_t end_block) {
+    size_t end_atb = MIN(end_block / BLOCKS_PER_ATB, area->gc_alloc_table_byte_len - 1);
+    for (size_t atb = start_block / BLOCKS_PER_ATB; atb <= end_atb; atb++) {
+        if (area->gc_alloc_table_start[atb] == 0) {
+            FSB_SET(area, atb);
+        } else {
+            FSB_CLEAR(area, atb);
+        }
+    }
+}
+
+// Find the first run of at least n_blocks free blocks in the area, using the
+// FSB to skip over ATBs that aren't completely free.  n_blocks must be at
+// least FSB_MIN_BLOCKS so that the run is guaranteed to contain a free ATB.
+// On success, *end_block is set to the last block of the allocation.
+static bool gc_find_free_run(const mp_state_mem_area_t *area, size_t n_blocks, size_t *end_block) {
+    const byte *atbs = area->gc_alloc_table_start;
+    size_t atb_len = area->gc_alloc_table_byte_len;
+    size_t atb = area->gc_last_free_atb_index;
+    while (atb < atb_len) {
+        MICROPY_GC_HOOK_LOOP(atb);
+        byte fsb = area->gc_free_summary_start[atb / ATBS_PER_FSB] >> (atb & 7);
+        if (fsb == 0) {
+            // no free ATBs in the rest of this FSB
+            atb = (atb | (ATBS_PER_FSB - 1)) + 1;
+            continue;
+        }
+        atb += mp_ctz(fsb);
+        if (atb >= atb_len) {
+            break;
+        }
+
+        // atb is the first free ATB of a run; find where the run of free ATBs ends
+        size_t run_end = atb + 1;
+        while (run_end < atb_len && FSB_GET(area, run_end)) {
+            run_end++;
+        }
+
+        // extend the run with the free blocks at the end of the previous ATB
+        // and at the start of the next one
+        size_t n_lead = 0;
+        if (atb > 0) {
+            byte a = atbs[atb - 1];
+            while (n_lead < BLOCKS_PER_ATB - 1 && (a & (ATB_MASK_3 >> (2 * n_lead))) == 0) {
+                n_lead++;
+            }
+        }
+        size_t n_trail = 0;
+        if (run_end < atb_len) {
+            byte a = atbs[run_end];
+            while (n_trail < BLOCKS_PER_ATB - 1 && (a & (ATB_MASK_0 << (2 * n_trail))) == 0) {
+                n_trail++;
+            }
+        }
+
+        if (n_lead + (run_end - atb) * BLOCKS_PER_ATB + n_trail >= n_blocks) {
+            *end_block = atb * BLOCKS_PER_ATB - n_lead + n_blocks - 1;
+            return true;
+        }
+
+        // the ATB at run_end has a used block, so continue after it
+        atb = run_end + 1;
+    }
+    return false;
+}
+#endif
+
 // CIRCUITPY-CHANGE: add function
 void gc_collect_ptr(void *ptr) {
     void *ptrs[1] = { ptr };
@@ -857,6 +1368,13 @@ void gc_info(gc_info_t *info) {
         for (size_t block = 0, len = 0, len_free = 0; !finish;) {
             MICROPY_GC_HOOK_LOOP(block);
             size_t kind = ATB_GET_KIND(area, block);
+            // CIRCUITPY-CHANGE
+            #if MICROPY_GC_INCREMENTAL
+            if (kind == AT_MARK) {
+                // marked by an incremental collection in progress
+                kind = AT_HEAD;
+            }
+            #endif
             switch (kind) {
                 case AT_FREE:
                     info->free += 1;
@@ -884,6 +1402,12 @@ void gc_info(gc_info_t *info) {
             // Get next block type if possible
             if (!finish) {
                 kind = ATB_GET_KIND(area, block);
+                // CIRCUITPY-CHANGE
+                #if MICROPY_GC_INCREMENTAL
+                if (kind == AT_MARK) {
+                    kind = AT_HEAD;
+                }
+                #endif
             }
 
             if (finish || kind == AT_FREE || kind == AT_HEAD) {
@@ -973,9 +1497,36 @@ void *gc_alloc(size_t n_bytes, unsigned int alloc_flags) {
 
         // look for a run of n_blocks available blocks
         for (; area != NULL; area = NEXT_AREA(area), i = 0) {
+            #if MICROPY_GC_FREE_RUN_INDEX
+            // CIRCUITPY-CHANGE: use the free summary to find long runs
+            if (n_blocks >= FSB_MIN_BLOCKS) {
+                if (gc_find_free_run(area, n_blocks, &i)) {
+                    n_free = n_blocks;
+                    goto found;
+                }
+                continue;
+            }
+            #endif
             n_free = 0;
             for (i = area->gc_last_free_atb_index; i < area->gc_alloc_table_byte_len; i++) {
                 MICROPY_GC_HOOK_LOOP(i);
+                #if ATB_WORD_ACCESS
+                // CIRCUITPY-CHANGE: skip a whole word of ATBs if it has no free
+                // blocks, or if all its blocks are free but not enough to end the run
+                if (ATB_WORD_STARTS_AT(area, i)) {
+                    atb_word_t w = ATB_WORD_GET(area, i);
+                    if (ATB_WORD_FREE(w) == 0) {
+                        n_free = 0;
+                        i += ATBS_PER_WORD - 1;
+                        continue;
+                    }
+                    if (w == 0 && n_free + BLOCKS_PER_ATB_WORD < n_blocks) {
+                        n_free += BLOCKS_PER_ATB_WORD;
+                        i += ATBS_PER_WORD - 1;
+                        continue;
+                    }
+                }
+                #endif
                 byte a = area->gc_alloc_table_start[i];
                 // *FORMAT-OFF*
                 if (ATB_0_IS_FREE(a)) { if (++n_free >= n_blocks) { i = i * BLOCKS_PER_ATB + 0; goto found; } } else { n_free = 0; }
@@ -1051,6 +1602,10 @@ found:
         ATB_FREE_TO_TAIL(area, bl);
     }
 
+    #if MICROPY_GC_FREE_RUN_INDEX
+    gc_free_summary_update(area, start_block, end_block);
+    #endif
+
     // get pointer to first block
     // we must create this pointer before unlocking the GC so a collection can find it
     void *ret_ptr = (void *)(area->gc_pool_start + start_block * BYTES_PER_BLOCK);
@@ -1059,6 +1614,10 @@ found:
     #if MICROPY_GC_ALLOC_THRESHOLD
     MP_STATE_MEM(gc_alloc_amount) += n_blocks;
     #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_INCREMENTAL
+    MP_STATE_MEM(gc_inc_alloc_amount) += n_blocks;
+    #endif
 
     GC_EXIT();
 
@@ -1154,8 +1713,13 @@ void gc_free(void *ptr) {
     #endif
 
     size_t block = BLOCK_FROM_PTR(area, ptr);
+    // CIRCUITPY-CHANGE: blocks are also marked during incremental marking
     assert(ATB_GET_KIND(area, block) == AT_HEAD
-        || (ATB_GET_KIND(area, block) == AT_MARK && (MP_STATE_THREAD(gc_lock_depth) & GC_COLLECT_FLAG)));
+        || (ATB_GET_KIND(area, block) == AT_MARK && (MP_STATE_THREAD(gc_lock_depth) & GC_COLLECT_FLAG))
+        #if MICROPY_GC_INCREMENTAL
+        || (ATB_GET_KIND(area, block) == AT_MARK && MP_STATE_MEM(gc_inc_phase) == GC_INC_MARK)
+        #endif
+        );
 
     #if MICROPY_ENABLE_FINALISER
     FTB_CLEAR(area, block);
@@ -1187,11 +1751,18 @@ void gc_free(void *ptr) {
     #endif
 
     // free head and all of its tail blocks
+    #if MICROPY_GC_FREE_RUN_INDEX
+    size_t start_block = block;
+    #endif
     do {
         ATB_ANY_TO_FREE(area, block);
         block += 1;
     } while (ATB_GET_KIND(area, block) == AT_TAIL);
 
+    #if MICROPY_GC_FREE_RUN_INDEX
+    gc_free_summary_update(area, start_block, block - 1);
+    #endif
+
     GC_EXIT();
     gc_perfetto_emit_heap_stats();
 
@@ -1216,7 +1787,12 @@ size_t gc_nbytes(const void *ptr) {
 
     if (area) {
         size_t block = BLOCK_FROM_PTR(area, ptr);
-        if (ATB_GET_KIND(area, block) == AT_HEAD) {
+        // CIRCUITPY-CHANGE: blocks are also marked during incremental marking
+        if (ATB_GET_KIND(area, block) == AT_HEAD
+            #if MICROPY_GC_INCREMENTAL
+            || (ATB_GET_KIND(area, block) == AT_MARK && MP_STATE_MEM(gc_inc_phase) == GC_INC_MARK)
+            #endif
+            ) {
             // work out number of consecutive blocks in the chain starting with this on
             size_t n_blocks = 0;
             do {
@@ -1263,7 +1839,14 @@ void *gc_realloc(void *ptr_in, size_t n_bytes, bool allow_move) {
     area = &MP_STATE_MEM(area);
     #endif
     size_t block = BLOCK_FROM_PTR(area, ptr);
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_INCREMENTAL
+    // A block moved while incremental marking is in progress must stay marked.
+    bool marked = ATB_GET_KIND(area, block) == AT_MARK;
+    assert(ATB_GET_KIND(area, block) == AT_HEAD || (marked && MP_STATE_MEM(gc_inc_phase) == GC_INC_MARK));
+    #else
     assert(ATB_GET_KIND(area, block) == AT_HEAD);
+    #endif
 
     // compute number of new blocks that are requested
     size_t new_blocks = (n_bytes + BYTES_PER_BLOCK - 1) / BYTES_PER_BLOCK;
@@ -1307,6 +1890,10 @@ void *gc_realloc(void *ptr_in, size_t n_bytes, bool allow_move) {
             ATB_ANY_TO_FREE(area, bl);
         }
 
+        #if MICROPY_GC_FREE_RUN_INDEX
+        gc_free_summary_update(area, block + new_blocks, block + n_blocks - 1);
+        #endif
+
         #if MICROPY_GC_SPLIT_HEAP
         if (MP_STATE_MEM(gc_last_free_area) != area) {
             // See comment in gc_free.
@@ -1348,6 +1935,10 @@ void *gc_realloc(void *ptr_in, size_t n_bytes, bool allow_move) {
             ATB_FREE_TO_TAIL(area, bl);
         }
 
+        #if MICROPY_GC_FREE_RUN_INDEX
+        gc_free_summary_update(area, block + n_blocks, end_block - 1);
+        #endif
+
         area->gc_last_used_block = MAX(area->gc_last_used_block, end_block);
 
         GC_EXIT();
@@ -1412,6 +2003,12 @@ void *gc_realloc(void *ptr_in, size_t n_bytes, bool allow_move) {
     DEBUG_printf("gc_realloc(%p -> %p)\n", ptr_in, ptr_out);
     memcpy(ptr_out, ptr_in, n_blocks * BYTES_PER_BLOCK);
     gc_free(ptr_in);
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_INCREMENTAL
+    if (marked) {
+        GC_WRITE_BARRIER(ptr_out);
+    }
+    #endif
     return ptr_out;
 }
 
@@ -68,6 +68,32 @@ void gc_collect_end(void);
 // Is the gc heap available?
 bool gc_alloc_possible(void);
 
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_INCREMENTAL
+enum {
+    GC_INC_IDLE,
+    GC_INC_MARK,
+    GC_INC_FINISH,
+};
+
+// Do up to budget_us of marking, starting a new collection if none is in
+// progress.  Once marking is complete the collection is finished with
+// gc_collect() and true is returned.
+bool gc_collect_step(mp_uint_t budget_us);
+// Called regularly from background tasks to run the automatic steps.
+void gc_collect_step_auto(void);
+// Called after a heap pointer is stored into the heap block ptr, or after the
+// block ptr is stored somewhere, while a collection is in progress.
+void gc_write_barrier(const void *ptr);
+#define GC_WRITE_BARRIER(ptr) do { \
+        if (MP_STATE_MEM(gc_inc_phase) == GC_INC_MARK) { \
+            gc_write_barrier(ptr); \
+        } \
+} while (0)
+#else
+#define GC_WRITE_BARRIER(ptr) (void)0
+#endif
+
 // Use this function to sweep the whole heap and run all finalisers
 void gc_sweep_all(void);
 
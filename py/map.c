@@ -32,6 +32,8 @@
 #include "py/mpconfig.h"
 #include "py/misc.h"
 #include "py/runtime.h"
+// CIRCUITPY-CHANGE
+#include "py/gc.h"
 
 #if MICROPY_DEBUG_VERBOSE // print debugging info
 #define DEBUG_PRINT (1)
@@ -86,15 +88,266 @@ static size_t get_hash_alloc_greater_or_equal_to(size_t x) {
 /******************************************************************************/
 /* map                                                                        */
 
-// CIRCUITPY-CHANGE: Helper for allocating tables of elements
-#define malloc_table(num) m_new0(mp_map_elem_t, num)
+// CIRCUITPY-CHANGE: Helpers for allocating tables of elements
+#define malloc_table(num) ((mp_map_elem_t *)m_malloc0(MP_MAP_TABLE_BYTES(num)))
+#define free_table(table, num) m_del(byte, table, MP_MAP_TABLE_BYTES(num))
+
+// CIRCUITPY-CHANGE
+#if MICROPY_MAP_ROBIN_HOOD || MICROPY_MAP_ORDERED_INDEX
+static inline mp_uint_t map_hash(mp_obj_t key) {
+    if (mp_obj_is_qstr(key)) {
+        return qstr_hash(MP_OBJ_QSTR_VALUE(key));
+    } else {
+        return MP_OBJ_SMALL_INT_VALUE(mp_unary_op(MP_UNARY_OP_HASH, key));
+    }
+}
+
+// Only the low bits of the hash select the home slot, so first mix in the
+// high bits: object hashes are often aligned pointers, and small ints that
+// are multiples of the table size would otherwise all share a slot.
+static inline size_t map_home_slot(mp_uint_t hash, size_t mask) {
+    uint32_t h = hash;
+    h = (h ^ (h >> 16)) * 0x45d9f3b;
+    h ^= h >> 16;
+    return h & mask;
+}
+
+#endif
+
+// CIRCUITPY-CHANGE
+#if MICROPY_MAP_ROBIN_HOOD
+
+// Unordered maps are power-of-two sized tables using Robin Hood linear
+// probing: an element being added takes the slot of any element that is
+// closer to its own home slot, and moves that one further along instead.
+// Elements sharing a probe sequence are then ordered by their distance from
+// home, so a lookup can stop as soon as it passes the point where the key
+// would have been.  Removing an element shifts the following elements of its
+// probe sequence back one slot, so no tombstones are ever left behind.  The
+// distance of each slot's element is kept in the bytes after the table (see
+// MP_MAP_PROBE_DISTS); distances of MAP_DIST_FAR or more are stored as
+// MAP_DIST_FAR, and elements that far from home are never displaced.
+#define MAP_DIST_FAR (255)
+
+// Small tables may fill up completely; larger ones are kept at most 7/8 full.
+#define MAP_CAPACITY(alloc) ((alloc) <= 8 ? (alloc) : (alloc) - (alloc) / 8)
+
+static size_t get_map_alloc_greater_or_equal_to(size_t x) {
+    size_t alloc = 1;
+    while (alloc < x) {
+        alloc <<= 1;
+    }
+    return alloc;
+}
+
+static inline byte map_dist_next(byte dist) {
+    return dist < MAP_DIST_FAR ? dist + 1 : MAP_DIST_FAR;
+}
+
+// Empty the given slot and shift the rest of its probe sequence back into it.
+// Returns the slot left empty at the end of the sequence.
+static mp_map_elem_t *map_remove_slot_at(mp_map_t *map, size_t pos) {
+    byte *dists = MP_MAP_PROBE_DISTS(map);
+    size_t mask = map->alloc - 1;
+
+    // The exact distance of an element MAP_DIST_FAR from home is not stored,
+    // so it has to be worked out from its hash to tell whether it comes back
+    // under MAP_DIST_FAR when shifted.  Hashing may run a user __hash__ that
+    // raises, so do it for the whole sequence before anything is changed.
+    size_t n_far = 0;
+    for (size_t i = (pos + 1) & mask; map->table[i].key != MP_OBJ_NULL && dists[i] != 0; i = (i + 1) & mask) {
+        n_far += dists[i] == MAP_DIST_FAR;
+    }
+    bool *at_dist_far = NULL;
+    if (n_far > 0) {
+        at_dist_far = m_new(bool, n_far);
+        size_t j = 0;
+        for (size_t i = (pos + 1) & mask; map->table[i].key != MP_OBJ_NULL && dists[i] != 0; i = (i + 1) & mask) {
+            if (dists[i] == MAP_DIST_FAR) {
+                size_t dist = (i - map_home_slot(map_hash(map->table[i].key), mask)) & mask;
+                at_dist_far[j++] = dist == MAP_DIST_FAR;
+            }
+        }
+    }
+
+    map->used--;
+    size_t j = 0;
+    for (;;) {
+        size_t next = (pos + 1) & mask;
+        if (map->table[next].key == MP_OBJ_NULL || dists[next] == 0) {
+            break;
+        }
+        map->table[pos] = map->table[next];
+        if (dists[next] < MAP_DIST_FAR || at_dist_far[j++]) {
+            dists[pos] = dists[next] - 1;
+        } else {
+            dists[pos] = MAP_DIST_FAR;
+        }
+        pos = next;
+    }
+    map->table[pos].key = MP_OBJ_NULL;
+    dists[pos] = 0;
+    if (at_dist_far != NULL) {
+        m_del(bool, at_dist_far, n_far);
+    }
+    return &map->table[pos];
+}
+
+#define map_alloc_greater_or_equal_to get_map_alloc_greater_or_equal_to
+#else
+#define map_alloc_greater_or_equal_to get_hash_alloc_greater_or_equal_to
+#endif
+
+// CIRCUITPY-CHANGE
+#if MICROPY_MAP_ORDERED_INDEX
+
+#if !MICROPY_PY_COLLECTIONS_ORDEREDDICT
+#error MICROPY_MAP_ORDERED_INDEX requires MICROPY_PY_COLLECTIONS_ORDEREDDICT
+#endif
+
+// Ordered maps are searched linearly, which gets slow as they grow.  Once one
+// holds MICROPY_MAP_ORDERED_INDEX_MIN elements, the table of elements (still
+// in insertion order) is followed by a hash index, as in CPython's compact
+// dicts: a sparse, power-of-two sized array of element positions plus one,
+// with 0 marking an empty slot, probed linearly and at most 2/3 full.  Slots
+// are 1, 2 or 4 bytes wide, as needed for the size of the table.
+
+static inline size_t map_index_len(size_t alloc) {
+    size_t len = 1;
+    while (len < alloc + alloc / 2) {
+        len <<= 1;
+    }
+    return len;
+}
+
+static inline size_t map_index_width(size_t alloc) {
+    return alloc < 0xff ? 1 : alloc < 0xffff ? 2 : 4;
+}
+
+static inline void *map_index(const mp_map_t *map) {
+    return map->table + map->alloc;
+}
+
+static size_t map_index_get(const mp_map_t *map, size_t i) {
+    switch (map_index_width(map->alloc)) {
+        case 1:
+            return ((uint8_t *)map_index(map))[i];
+        case 2:
+            return ((uint16_t *)map_index(map))[i];
+        default:
+            return ((uint32_t *)map_index(map))[i];
+    }
+}
+
+static void map_index_set(const mp_map_t *map, size_t i, size_t value) {
+    switch (map_index_width(map->alloc)) {
+        case 1:
+            ((uint8_t *)map_index(map))[i] = value;
+            break;
+        case 2:
+            ((uint16_t *)map_index(map))[i] = value;
+            break;
+        default:
+            ((uint32_t *)map_index(map))[i] = value;
+            break;
+    }
+}
+
+static size_t map_ordered_table_bytes(size_t alloc, bool indexed) {
+    if (indexed) {
+        return alloc * sizeof(mp_map_elem_t) + map_index_len(alloc) * map_index_width(alloc);
+    } else {
+        return MP_MAP_TABLE_BYTES(alloc);
+    }
+}
+
+// Returns the element with the given key, or NULL if there isn't one.
+static mp_map_elem_t *map_index_lookup(const mp_map_t *map, mp_obj_t index, mp_uint_t hash, bool compare_only_ptrs) {
+    size_t mask = map_index_len(map->alloc) - 1;
+    for (size_t i = map_home_slot(hash, mask);; i = (i + 1) & mask) {
+        size_t value = map_index_get(map, i);
+        if (value == 0) {
+            return NULL;
+        }
+        mp_map_elem_t *elem = &map->table[value - 1];
+        if (elem->key == index || (!compare_only_ptrs && mp_obj_equal(elem->key, index))) {
+            return elem;
+        }
+    }
+}
+
+static void map_index_insert(const mp_map_t *map, size_t pos, mp_uint_t hash) {
+    size_t mask = map_index_len(map->alloc) - 1;
+    size_t i = map_home_slot(hash, mask);
+    while (map_index_get(map, i) != 0) {
+        i = (i + 1) & mask;
+    }
+    map_index_set(map, i, pos + 1);
+}
+
+static void map_index_build(const mp_map_t *map) {
+    memset(map_index(map), 0, map_index_len(map->alloc) * map_index_width(map->alloc));
+    for (size_t pos = 0; pos < map->used; pos++) {
+        map_index_insert(map, pos, map_hash(map->table[pos].key));
+    }
+}
+
+// Take the element at pos out of the index, and renumber the elements after
+// it, which the caller is about to move down by one.
+static void map_index_remove(const mp_map_t *map, size_t pos) {
+    size_t mask = map_index_len(map->alloc) - 1;
+    size_t i = map_home_slot(map_hash(map->table[pos].key), mask);
+    while (map_index_get(map, i) != pos + 1) {
+        i = (i + 1) & mask;
+    }
+    // shift back any later slots in the probe sequence that may move into i
+    for (size_t j = (i + 1) & mask;; j = (j + 1) & mask) {
+        size_t value = map_index_get(map, j);
+        if (value == 0) {
+            break;
+        }
+        size_t home = map_home_slot(map_hash(map->table[value - 1].key), mask);
+        if (((j - home) & mask) >= ((j - i) & mask)) {
+            map_index_set(map, i, value);
+            i = j;
+        }
+    }
+    map_index_set(map, i, 0);
+    if (pos + 1 < map->used) {
+        for (size_t j = 0; j <= mask; j++) {
+            size_t value = map_index_get(map, j);
+            if (value > pos + 1) {
+                map_index_set(map, j, value - 1);
+            }
+        }
+    }
+}
+
+// Rebuild the index of an ordered map after its elements have been reordered.
+void mp_map_reindex(mp_map_t *map) {
+    if (map->is_indexed) {
+        map_index_build(map);
+    }
+}
+
+static size_t map_table_bytes(const mp_map_t *map) {
+    return map->is_indexed ? map_ordered_table_bytes(map->alloc, true) : MP_MAP_TABLE_BYTES(map->alloc);
+}
+#else
+#define map_table_bytes(map) MP_MAP_TABLE_BYTES((map)->alloc)
+#endif
 
 void mp_map_init(mp_map_t *map, size_t n) {
     if (n == 0) {
         map->alloc = 0;
         map->table = NULL;
     } else {
+        // CIRCUITPY-CHANGE
+        #if MICROPY_MAP_ROBIN_HOOD
+        map->alloc = get_map_alloc_greater_or_equal_to(n);
+        #else
         map->alloc = n;
+        #endif
         // CIRCUITPY-CHANGE
         map->table = malloc_table(map->alloc);
     }
@@ -102,6 +355,10 @@ void mp_map_init(mp_map_t *map, size_t n) {
     map->all_keys_are_qstrs = 1;
     map->is_fixed = 0;
     map->is_ordered = 0;
+    // CIRCUITPY-CHANGE
+    #if MICROPY_MAP_ORDERED_INDEX
+    map->is_indexed = 0;
+    #endif
 }
 
 void mp_map_init_fixed_table(mp_map_t *map, size_t n, const mp_obj_t *table) {
@@ -110,21 +367,35 @@ void mp_map_init_fixed_table(mp_map_t *map, size_t n, const mp_obj_t *table) {
     map->all_keys_are_qstrs = 1;
     map->is_fixed = 1;
     map->is_ordered = 1;
+    // CIRCUITPY-CHANGE
+    #if MICROPY_MAP_ORDERED_INDEX
+    map->is_indexed = 0;
+    #endif
     map->table = (mp_map_elem_t *)table;
 }
 
 // Differentiate from mp_map_clear() - semantics is different
 void mp_map_deinit(mp_map_t *map) {
     if (!map->is_fixed) {
-        m_del(mp_map_elem_t, map->table, map->alloc);
+        // CIRCUITPY-CHANGE
+        m_del(byte, map->table, map_table_bytes(map));
     }
     map->used = map->alloc = 0;
+    // CIRCUITPY-CHANGE
+    #if MICROPY_MAP_ORDERED_INDEX
+    map->is_indexed = 0;
+    #endif
 }
 
 void mp_map_clear(mp_map_t *map) {
     if (!map->is_fixed) {
-        m_del(mp_map_elem_t, map->table, map->alloc);
+        // CIRCUITPY-CHANGE
+        m_del(byte, map->table, map_table_bytes(map));
     }
+    // CIRCUITPY-CHANGE
+    #if MICROPY_MAP_ORDERED_INDEX
+    map->is_indexed = 0;
+    #endif
     map->alloc = 0;
     map->used = 0;
     map->all_keys_are_qstrs = 1;
@@ -134,11 +405,13 @@ void mp_map_clear(mp_map_t *map) {
 
 static void mp_map_rehash(mp_map_t *map) {
     size_t old_alloc = map->alloc;
-    size_t new_alloc = get_hash_alloc_greater_or_equal_to(map->alloc + 1);
+    // CIRCUITPY-CHANGE
+    size_t new_alloc = map_alloc_greater_or_equal_to(map->alloc + 1);
     DEBUG_printf("mp_map_rehash(%p): " UINT_FMT " -> " UINT_FMT "\n", map, old_alloc, new_alloc);
     mp_map_elem_t *old_table = map->table;
     // CIRCUITPY-CHANGE
     mp_map_elem_t *new_table = malloc_table(new_alloc);
+    GC_WRITE_BARRIER(new_table);
     // If we reach this point, table resizing succeeded, now we can edit the old map.
     map->alloc = new_alloc;
     map->used = 0;
@@ -149,9 +422,131 @@ static void mp_map_rehash(mp_map_t *map) {
             mp_map_lookup(map, old_table[i].key, MP_MAP_LOOKUP_ADD_IF_NOT_FOUND)->value = old_table[i].value;
         }
     }
-    m_del(mp_map_elem_t, old_table, old_alloc);
+    // CIRCUITPY-CHANGE
+    free_table(old_table, old_alloc);
+}
+
+// CIRCUITPY-CHANGE
+#if MICROPY_MAP_ROBIN_HOOD
+static mp_map_elem_t *mp_map_lookup_robin_hood(mp_map_t *map, mp_obj_t index, mp_map_lookup_kind_t lookup_kind, bool compare_only_ptrs) {
+    if (map->alloc == 0) {
+        if (lookup_kind == MP_MAP_LOOKUP_ADD_IF_NOT_FOUND) {
+            mp_map_rehash(map);
+        } else {
+            return NULL;
+        }
+    }
+
+    mp_uint_t hash = map_hash(index);
+
+    for (;;) {
+        byte *dists = MP_MAP_PROBE_DISTS(map);
+        size_t mask = map->alloc - 1;
+        size_t pos = map_home_slot(hash, mask);
+        byte dist = 0;
+        for (;;) {
+            mp_map_elem_t *slot = &map->table[pos];
+            if (slot->key == MP_OBJ_NULL || dists[pos] < dist) {
+                // index would have been found by now, so it's not in the table
+                break;
+            }
+            if (slot->key == index || (!compare_only_ptrs && mp_obj_equal(slot->key, index))) {
+                // found index
+                if (lookup_kind == MP_MAP_LOOKUP_REMOVE_IF_FOUND) {
+                    // delete element, handing its value back in the slot left empty
+                    mp_obj_t value = slot->value;
+                    slot = map_remove_slot_at(map, pos);
+                    slot->value = value;
+                    return slot;
+                }
+                MAP_CACHE_SET(index, pos);
+                return slot;
+            }
+            pos = (pos + 1) & mask;
+            dist = map_dist_next(dist);
+        }
+
+        if (lookup_kind != MP_MAP_LOOKUP_ADD_IF_NOT_FOUND) {
+            return NULL;
+        }
+
+        if (map->used + 1 > MAP_CAPACITY(map->alloc)) {
+            // not enough room in table, rehash it and restart the search
+            mp_map_rehash(map);
+            continue;
+        }
+
+        // Insert index at pos, moving each element it displaces one slot
+        // further along until an empty slot is reached.
+        map->used++;
+        if (!mp_obj_is_qstr(index)) {
+            map->all_keys_are_qstrs = 0;
+        }
+        mp_map_elem_t *found = &map->table[pos];
+        mp_map_elem_t elem = { index, MP_OBJ_NULL };
+        while (map->table[pos].key != MP_OBJ_NULL) {
+            if (dists[pos] < dist) {
+                mp_map_elem_t tmp_elem = map->table[pos];
+                byte tmp_dist = dists[pos];
+                map->table[pos] = elem;
+                dists[pos] = dist;
+                elem = tmp_elem;
+                dist = tmp_dist;
+            }
+            pos = (pos + 1) & mask;
+            dist = map_dist_next(dist);
+        }
+        map->table[pos] = elem;
+        dists[pos] = dist;
+        return found;
+    }
+}
+#endif
+
+// CIRCUITPY-CHANGE
+#if MICROPY_PY_COLLECTIONS_ORDEREDDICT
+// Remove an element from an ordered map by moving the rest of the array down.
+// The removed element is put after the end, with a null key, so the caller
+// can access it if needed.
+// note: caller must NULL the value so the GC can clean up (e.g. see dict_get_helper).
+static mp_map_elem_t *map_ordered_remove(mp_map_t *map, mp_map_elem_t *elem) {
+    mp_map_elem_t *top = &map->table[map->used];
+    mp_obj_t value = elem->value;
+    #if MICROPY_MAP_ORDERED_INDEX
+    if (map->is_indexed) {
+        map_index_remove(map, elem - map->table);
+    }
+    #endif
+    --map->used;
+    memmove(elem, elem + 1, (top - elem - 1) * sizeof(*elem));
+    elem = &map->table[map->used];
+    elem->key = MP_OBJ_NULL;
+    elem->value = value;
+    return elem;
 }
 
+#if MICROPY_MAP_ORDERED_INDEX
+// Make room for another element, adding the hash index once the map is big
+// enough.  Indexed maps grow by half so the index isn't rebuilt too often.
+static void map_ordered_grow(mp_map_t *map) {
+    size_t old_bytes = map_table_bytes(map);
+    bool indexed = map->used + 1 >= MICROPY_MAP_ORDERED_INDEX_MIN;
+    size_t new_alloc = map->alloc;
+    if (map->used == map->alloc) {
+        new_alloc += indexed ? MAX(4, map->alloc / 2) : 4;
+    }
+    map->table = (mp_map_elem_t *)m_renew(byte, map->table, old_bytes, map_ordered_table_bytes(new_alloc, indexed));
+    mp_seq_clear(map->table, map->used, new_alloc, sizeof(*map->table));
+    GC_WRITE_BARRIER(map->table);
+    map->alloc = new_alloc;
+    map->is_indexed = indexed;
+    if (indexed) {
+        map_index_build(map);
+    }
+}
+#endif
+#endif
+
 // MP_MAP_LOOKUP behaviour:
 //  - returns NULL if not found, else the slot it was found in with key,value non-null
 // MP_MAP_LOOKUP_ADD_IF_NOT_FOUND behaviour:
@@ -162,6 +557,11 @@ mp_map_elem_t *MICROPY_WRAP_MP_MAP_LOOKUP(mp_map_lookup)(mp_map_t * map, mp_obj_
     // If the map is a fixed array then we must only be called for a lookup
     assert(!map->is_fixed || lookup_kind == MP_MAP_LOOKUP);
 
+    // CIRCUITPY-CHANGE: the caller may store a value in the returned slot
+    if (lookup_kind == MP_MAP_LOOKUP_ADD_IF_NOT_FOUND) {
+        GC_WRITE_BARRIER(map->table);
+    }
+
     #if MICROPY_OPT_MAP_LOOKUP_CACHE
     // Try the cache for lookup or add-if-not-found.
     if (lookup_kind != MP_MAP_LOOKUP_REMOVE_IF_FOUND && map->alloc) {
@@ -195,19 +595,25 @@ mp_map_elem_t *MICROPY_WRAP_MP_MAP_LOOKUP(mp_map_lookup)(mp_map_t * map, mp_obj_
 
     // if the map is an ordered array then we must do a brute force linear search
     if (map->is_ordered) {
+        // CIRCUITPY-CHANGE: unless it is big enough to have a hash index
+        #if MICROPY_MAP_ORDERED_INDEX
+        if (map->is_indexed) {
+            mp_map_elem_t *elem = map_index_lookup(map, index, map_hash(index), compare_only_ptrs);
+            if (elem != NULL) {
+                if (MP_UNLIKELY(lookup_kind == MP_MAP_LOOKUP_REMOVE_IF_FOUND)) {
+                    elem = map_ordered_remove(map, elem);
+                }
+                MAP_CACHE_SET(index, elem - map->table);
+                return elem;
+            }
+        } else
+        #endif
         for (mp_map_elem_t *elem = &map->table[0], *top = &map->table[map->used]; elem < top; elem++) {
             if (elem->key == index || (!compare_only_ptrs && mp_obj_equal(elem->key, index))) {
                 #if MICROPY_PY_COLLECTIONS_ORDEREDDICT
                 if (MP_UNLIKELY(lookup_kind == MP_MAP_LOOKUP_REMOVE_IF_FOUND)) {
-                    // remove the found element by moving the rest of the array down
-                    mp_obj_t value = elem->value;
-                    --map->used;
-                    memmove(elem, elem + 1, (top - elem - 1) * sizeof(*elem));
-                    // put the found element after the end so the caller can access it if needed
-                    // note: caller must NULL the value so the GC can clean up (e.g. see dict_get_helper).
-                    elem = &map->table[map->used];
-                    elem->key = MP_OBJ_NULL;
-                    elem->value = value;
+                    // CIRCUITPY-CHANGE: factored out
+                    elem = map_ordered_remove(map, elem);
                 }
                 #endif
                 MAP_CACHE_SET(index, elem - map->table);
@@ -218,18 +624,33 @@ mp_map_elem_t *MICROPY_WRAP_MP_MAP_LOOKUP(mp_map_lookup)(mp_map_t * map, mp_obj_
         if (MP_LIKELY(lookup_kind != MP_MAP_LOOKUP_ADD_IF_NOT_FOUND)) {
             return NULL;
         }
+        // CIRCUITPY-CHANGE
+        #if MICROPY_MAP_ORDERED_INDEX
+        if (map->used == map->alloc || (!map->is_indexed && map->used + 1 >= MICROPY_MAP_ORDERED_INDEX_MIN)) {
+            map_ordered_grow(map);
+        }
+        #else
         if (map->used == map->alloc) {
             // TODO: Alloc policy
             map->alloc += 4;
-            map->table = m_renew(mp_map_elem_t, map->table, map->used, map->alloc);
+            // CIRCUITPY-CHANGE: allocate the same way as hash tables
+            map->table = (mp_map_elem_t *)m_renew(byte, map->table, MP_MAP_TABLE_BYTES(map->used), MP_MAP_TABLE_BYTES(map->alloc));
             mp_seq_clear(map->table, map->used, map->alloc, sizeof(*map->table));
+            GC_WRITE_BARRIER(map->table);
         }
+        #endif
         mp_map_elem_t *elem = map->table + map->used++;
         elem->key = index;
         elem->value = MP_OBJ_NULL;
         if (!mp_obj_is_qstr(index)) {
             map->all_keys_are_qstrs = 0;
         }
+        // CIRCUITPY-CHANGE
+        #if MICROPY_MAP_ORDERED_INDEX
+        if (map->is_indexed) {
+            map_index_insert(map, map->used - 1, map_hash(index));
+        }
+        #endif
         return elem;
         #else
         return NULL;
@@ -238,6 +659,10 @@ mp_map_elem_t *MICROPY_WRAP_MP_MAP_LOOKUP(mp_map_lookup)(mp_map_t * map, mp_obj_
 
     // map is a hash table (not an ordered array), so do a hash lookup
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_MAP_ROBIN_HOOD
+    return mp_map_lookup_robin_hood(map, index, lookup_kind, compare_only_ptrs);
+    #else
     if (map->alloc == 0) {
         if (lookup_kind == MP_MAP_LOOKUP_ADD_IF_NOT_FOUND) {
             mp_map_rehash(map);
@@ -324,6 +749,32 @@ mp_map_elem_t *MICROPY_WRAP_MP_MAP_LOOKUP(mp_map_lookup)(mp_map_t * map, mp_obj_
             }
         }
     }
+    #endif
+}
+
+// CIRCUITPY-CHANGE
+// Remove the element in the given filled slot of a map that is not fixed.
+void mp_map_remove_slot(mp_map_t *map, mp_map_elem_t *slot) {
+    assert(!map->is_fixed);
+    if (map->is_ordered) {
+        #if MICROPY_PY_COLLECTIONS_ORDEREDDICT
+        slot = map_ordered_remove(map, slot);
+        #endif
+    } else {
+        #if MICROPY_MAP_ROBIN_HOOD
+        slot = map_remove_slot_at(map, slot - map->table);
+        #else
+        size_t pos = slot - map->table;
+        map->used--;
+        if (map->table[(pos + 1) % map->alloc].key == MP_OBJ_NULL) {
+            // optimisation if next slot is empty
+            slot->key = MP_OBJ_NULL;
+        } else {
+            slot->key = MP_OBJ_SENTINEL;
+        }
+        #endif
+    }
+    slot->value = MP_OBJ_NULL;
 }
 
 /******************************************************************************/
@@ -345,6 +796,7 @@ static void mp_set_rehash(mp_set_t *set) {
     set->used = 0;
     // CIRCUITPY-CHANGE
     set->table = m_malloc_items0(set->alloc);
+    GC_WRITE_BARRIER(set->table);
     for (size_t i = 0; i < old_alloc; i++) {
         if (old_table[i] != MP_OBJ_NULL && old_table[i] != MP_OBJ_SENTINEL) {
             mp_set_lookup(set, old_table[i], MP_MAP_LOOKUP_ADD_IF_NOT_FOUND);
@@ -357,6 +809,11 @@ mp_obj_t mp_set_lookup(mp_set_t *set, mp_obj_t index, mp_map_lookup_kind_t looku
     // Note: lookup_kind can be MP_MAP_LOOKUP_ADD_IF_NOT_FOUND_OR_REMOVE_IF_FOUND which
     // is handled by using bitwise operations.
 
+    // CIRCUITPY-CHANGE
+    if (lookup_kind & MP_MAP_LOOKUP_ADD_IF_NOT_FOUND) {
+        GC_WRITE_BARRIER(set->table);
+    }
+
     if (set->alloc == 0) {
         if (lookup_kind & MP_MAP_LOOKUP_ADD_IF_NOT_FOUND) {
             mp_set_rehash(set);
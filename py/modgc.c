@@ -27,6 +27,8 @@
 #include "py/mpstate.h"
 #include "py/obj.h"
 #include "py/gc.h"
+// CIRCUITPY-CHANGE
+#include "py/runtime.h"
 
 #if MICROPY_PY_GC && MICROPY_ENABLE_GC
 
@@ -100,6 +102,28 @@ static mp_obj_t gc_threshold(size_t n_args, const mp_obj_t *args) {
 MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(gc_threshold_obj, 0, 1, gc_threshold);
 #endif
 
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_INCREMENTAL
+// collect_step([budget_us]): do up to budget_us microseconds of an incremental
+// collection, returning True once the collection has been finished
+static mp_obj_t gc_collect_step_(size_t n_args, const mp_obj_t *args) {
+    mp_int_t budget_us = n_args == 0 ? 1000 : mp_arg_validate_int_min(mp_obj_get_int(args[0]), 0, MP_QSTR_budget_us);
+    return mp_obj_new_bool(gc_collect_step(budget_us));
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(gc_collect_step_obj, 0, 1, gc_collect_step_);
+
+// incremental([budget_us]): get or set the budget of the automatic
+// incremental steps run from background tasks; 0 turns them off
+static mp_obj_t gc_incremental(size_t n_args, const mp_obj_t *args) {
+    if (n_args == 0) {
+        return mp_obj_new_int_from_uint(MP_STATE_MEM(gc_inc_auto_budget_us));
+    }
+    MP_STATE_MEM(gc_inc_auto_budget_us) = mp_arg_validate_int_min(mp_obj_get_int(args[0]), 0, MP_QSTR_budget_us);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(gc_incremental_obj, 0, 1, gc_incremental);
+#endif
+
 static const mp_rom_map_elem_t mp_module_gc_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_gc) },
     { MP_ROM_QSTR(MP_QSTR_collect), MP_ROM_PTR(&gc_collect_obj) },
@@ -111,6 +135,11 @@ static const mp_rom_map_elem_t mp_module_gc_globals_table[] = {
     #if MICROPY_GC_ALLOC_THRESHOLD
     { MP_ROM_QSTR(MP_QSTR_threshold), MP_ROM_PTR(&gc_threshold_obj) },
     #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_INCREMENTAL
+    { MP_ROM_QSTR(MP_QSTR_collect_step), MP_ROM_PTR(&gc_collect_step_obj) },
+    { MP_ROM_QSTR(MP_QSTR_incremental), MP_ROM_PTR(&gc_incremental_obj) },
+    #endif
 };
 
 static MP_DEFINE_CONST_DICT(mp_module_gc_globals, mp_module_gc_globals_table);
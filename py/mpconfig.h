@@ -290,6 +290,39 @@ typedef uint64_t mp_uint_t;
 #define MICROPY_GC_CONSERVATIVE_CLEAR (MICROPY_ENABLE_GC)
 #endif
 
+// CIRCUITPY-CHANGE
+// Keep a summary bitmap with one bit per allocation table byte, set when all
+// the blocks covered by that byte are free.  gc_alloc() uses it to skip over
+// used parts of the heap when looking for a long run of free blocks, which
+// keeps large allocations fast on big, fragmented heaps.  It costs one bit of
+// RAM per BLOCKS_PER_ATB heap blocks.
+#ifndef MICROPY_GC_FREE_RUN_INDEX
+#define MICROPY_GC_FREE_RUN_INDEX (0)
+#endif
+
+// CIRCUITPY-CHANGE
+// Support incremental garbage collection: gc_collect_step() marks for a
+// bounded amount of time and only the final step, which rescans the roots and
+// sweeps, stops the program.  While a collection is in progress, stores of
+// heap pointers into heap objects must be followed by GC_WRITE_BARRIER().
+// Not all C code does that yet (the pairing heap behind asyncio's TaskQueue
+// relinks its nodes without it), and an object only reachable through such a
+// store is freed while still in use, so leave this off.
+#ifndef MICROPY_GC_INCREMENTAL
+#define MICROPY_GC_INCREMENTAL (0)
+#endif
+
+// Microsecond tick counter used to bound incremental collection steps.
+#ifndef MICROPY_GC_INCREMENTAL_TICKS_US
+#define MICROPY_GC_INCREMENTAL_TICKS_US() mp_hal_ticks_us()
+#endif
+
+// Default time budget of the automatic incremental steps, in microseconds
+// (0 to only step when gc.collect_step() is called).
+#ifndef MICROPY_GC_INCREMENTAL_AUTO_BUDGET_US
+#define MICROPY_GC_INCREMENTAL_AUTO_BUDGET_US (0)
+#endif
+
 // Support automatic GC when reaching allocation threshold,
 // configurable by gc.threshold().
 #ifndef MICROPY_GC_ALLOC_THRESHOLD
@@ -395,6 +428,15 @@ typedef uint64_t mp_uint_t;
 #endif
 #endif
 
+// CIRCUITPY-CHANGE
+// Keep an open-addressed hash index over the qstrs interned at runtime, so
+// looking up a string stays O(1) however many strings have been interned,
+// instead of searching the runtime pools linearly.  It costs one qstr-sized
+// slot per runtime qstr, with the table kept at most 3/4 full.
+#ifndef MICROPY_QSTR_RUNTIME_INDEX
+#define MICROPY_QSTR_RUNTIME_INDEX (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
+#endif
+
 // Avoid using C stack when making Python function calls. C stack still
 // may be used if there's no free heap.
 #ifndef MICROPY_STACKLESS
@@ -702,6 +744,29 @@ typedef uint64_t mp_uint_t;
 #define MICROPY_OPT_MAP_LOOKUP_CACHE_SIZE (128)
 #endif
 
+// CIRCUITPY-CHANGE
+// Lay out unordered maps (dicts, instance members, globals) as power-of-two
+// sized tables using Robin Hood probing and backward-shift deletion instead
+// of prime-sized tables with tombstones.  Lookups of missing keys stop early
+// and deleting keys never leaves tombstones behind, which keeps dicts with a
+// lot of insert/delete churn fast.  Costs one extra byte of RAM per table
+// slot, and tables are kept at most 7/8 full.
+#ifndef MICROPY_MAP_ROBIN_HOOD
+#define MICROPY_MAP_ROBIN_HOOD (0)
+#endif
+
+// CIRCUITPY-CHANGE
+// Give ordered maps (OrderedDict) that hold MICROPY_MAP_ORDERED_INDEX_MIN or
+// more elements a compact hash index after the elements, so lookups in them
+// don't have to search all the elements.  Needs MICROPY_PY_COLLECTIONS_ORDEREDDICT.
+#ifndef MICROPY_MAP_ORDERED_INDEX
+#define MICROPY_MAP_ORDERED_INDEX (MICROPY_PY_COLLECTIONS_ORDEREDDICT)
+#endif
+
+#ifndef MICROPY_MAP_ORDERED_INDEX_MIN
+#define MICROPY_MAP_ORDERED_INDEX_MIN (16)
+#endif
+
 // Whether to use fast versions of bitwise operations (and, or, xor) when the
 // arguments are both positive.  Increases Thumb2 code size by about 250 bytes.
 #ifndef MICROPY_OPT_MPZ_BITWISE
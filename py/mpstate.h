@@ -122,6 +122,10 @@ typedef struct _mp_state_mem_area_t {
     #if MICROPY_ENABLE_SELECTIVE_COLLECT
     byte *gc_collect_table_start;
     #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_FREE_RUN_INDEX
+    byte *gc_free_summary_start;
+    #endif
     byte *gc_pool_start;
     byte *gc_pool_end;
 
@@ -164,6 +168,26 @@ typedef struct _mp_state_mem_t {
     size_t gc_collected;
     #endif
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_INCREMENTAL
+    // State of an incremental collection.  Between steps the blocks that are
+    // marked but whose children are still to be checked are kept on
+    // gc_block_stack, with gc_inc_sp entries in use.
+    uint8_t gc_inc_phase;
+    size_t gc_inc_sp;
+    // Next root pointer to mark, counting the root pointer section and then
+    // the Python stack.
+    size_t gc_inc_root_index;
+    // Position of the heap rescan that deals with a gc_block_stack overflow.
+    mp_state_mem_area_t *gc_inc_rescan_area;
+    size_t gc_inc_rescan_block;
+    // Automatic steps from background tasks; a budget of 0 disables them.
+    mp_uint_t gc_inc_auto_budget_us;
+    mp_uint_t gc_inc_auto_last_us;
+    // Blocks allocated since the last collection, used to start a cycle.
+    size_t gc_inc_alloc_amount;
+    #endif
+
     #if MICROPY_PY_THREAD && !MICROPY_PY_THREAD_GIL
     // This is a global mutex used to make the GC thread-safe.
     mp_thread_recursive_mutex_t gc_mutex;
@@ -182,6 +206,12 @@ typedef struct _mp_state_vm_t {
 
     qstr_pool_t *last_pool;
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_QSTR_RUNTIME_INDEX
+    // hash index over the qstrs in the runtime pools (0 marks an empty slot)
+    qstr *qstr_index;
+    #endif
+
     #if MICROPY_TRACKED_ALLOC
     struct _m_tracked_node_t *m_tracked_head;
     #endif
@@ -241,6 +271,11 @@ typedef struct _mp_state_vm_t {
     size_t qstr_last_alloc;
     size_t qstr_last_used;
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_QSTR_RUNTIME_INDEX
+    size_t qstr_index_alloc;
+    #endif
+
     #if MICROPY_PY_THREAD && !MICROPY_PY_THREAD_GIL
     // This is a global mutex used to make qstr interning thread-safe.
     mp_thread_mutex_t qstr_mutex;
@@ -40,6 +40,8 @@
 #include "py/qstr.h"
 #include "py/runtime.h"
 #include "py/cstack.h"
+// CIRCUITPY-CHANGE
+#include "py/gc.h"
 #include "py/stream.h" // for mp_obj_print
 
 // CIRCUITPY-CHANGE
@@ -674,6 +676,8 @@ mp_obj_t mp_obj_len_maybe(mp_obj_t o_in) {
 mp_obj_t mp_obj_subscr(mp_obj_t base, mp_obj_t index, mp_obj_t value) {
     const mp_obj_type_t *type = mp_obj_get_type(base);
     if (MP_OBJ_TYPE_HAS_SLOT(type, subscr)) {
+        // CIRCUITPY-CHANGE: native types may keep value without a write barrier
+        GC_WRITE_BARRIER(MP_OBJ_TO_PTR(value));
         mp_obj_t ret = MP_OBJ_TYPE_GET_SLOT(type, subscr)(base, index, value);
         // CIRCUITPY-CHANGE
         // May have called port specific C code. Make sure it didn't mess up the heap.
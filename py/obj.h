@@ -515,7 +515,13 @@ typedef struct _mp_map_t {
     size_t all_keys_are_qstrs : 1;
     size_t is_fixed : 1;    // if set, table is fixed/read-only and can't be modified
     size_t is_ordered : 1;  // if set, table is an ordered array, not a hash map
+    // CIRCUITPY-CHANGE
+    #if MICROPY_MAP_ORDERED_INDEX
+    size_t is_indexed : 1;  // if set, an ordered table is followed by a hash index
+    size_t used : (8 * sizeof(size_t) - 4);
+    #else
     size_t used : (8 * sizeof(size_t) - 3);
+    #endif
     size_t alloc;
     mp_map_elem_t *table;
 } mp_map_t;
@@ -533,10 +539,29 @@ static inline bool mp_map_slot_is_filled(const mp_map_t *map, size_t pos) {
     return (map)->table[pos].key != MP_OBJ_NULL && (map)->table[pos].key != MP_OBJ_SENTINEL;
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_MAP_ROBIN_HOOD
+// Allocated tables are followed by one byte per slot, giving the distance of
+// the element in that slot from its home slot (not used by ordered maps).
+#define MP_MAP_TABLE_BYTES(alloc) ((alloc) * (sizeof(mp_map_elem_t) + 1))
+#define MP_MAP_PROBE_DISTS(map) ((byte *)((map)->table + (map)->alloc))
+#else
+#define MP_MAP_TABLE_BYTES(alloc) ((alloc) * sizeof(mp_map_elem_t))
+#endif
+
 void mp_map_init(mp_map_t *map, size_t n);
 void mp_map_init_fixed_table(mp_map_t *map, size_t n, const mp_obj_t *table);
 void mp_map_deinit(mp_map_t *map);
 mp_map_elem_t *mp_map_lookup(mp_map_t *map, mp_obj_t index, mp_map_lookup_kind_t lookup_kind);
+// CIRCUITPY-CHANGE
+void mp_map_remove_slot(mp_map_t *map, mp_map_elem_t *slot);
+#if MICROPY_MAP_ORDERED_INDEX
+void mp_map_reindex(mp_map_t *map);
+#else
+static inline void mp_map_reindex(mp_map_t *map) {
+    (void)map;
+}
+#endif
 void mp_map_clear(mp_map_t *map);
 void mp_map_dump(mp_map_t *map);
 
@@ -1168,10 +1193,18 @@ static inline mp_obj_t mp_obj_cell_get(mp_obj_t self_in) {
     return self->obj;
 }
 
+// CIRCUITPY-CHANGE
+extern const mp_obj_type_t mp_type_cell;
+
+// CIRCUITPY-CHANGE: with incremental GC, storing into a cell needs a write barrier
+#if MICROPY_GC_INCREMENTAL
+void mp_obj_cell_set(mp_obj_t self_in, mp_obj_t obj);
+#else
 static inline void mp_obj_cell_set(mp_obj_t self_in, mp_obj_t obj) {
     mp_obj_cell_t *self = (mp_obj_cell_t *)MP_OBJ_TO_PTR(self_in);
     self->obj = obj;
 }
+#endif
 
 // int
 // For long int, returns value truncated to mp_int_t
@@ -25,6 +25,8 @@
  */
 
 #include "py/obj.h"
+// CIRCUITPY-CHANGE
+#include "py/gc.h"
 
 #if MICROPY_ERROR_REPORTING == MICROPY_ERROR_REPORTING_DETAILED
 static void cell_print(const mp_print_t *print, mp_obj_t o_in, mp_print_kind_t kind) {
@@ -46,12 +48,22 @@ static void cell_print(const mp_print_t *print, mp_obj_t o_in, mp_print_kind_t k
 #define CELL_TYPE_PRINT
 #endif
 
-static MP_DEFINE_CONST_OBJ_TYPE(
+// CIRCUITPY-CHANGE: not static, the GC looks for cells when finishing an incremental collection
+MP_DEFINE_CONST_OBJ_TYPE(
     // cell representation is just value in < >
     mp_type_cell, MP_QSTR_, MP_TYPE_FLAG_NONE
     CELL_TYPE_PRINT
     );
 
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_INCREMENTAL
+void mp_obj_cell_set(mp_obj_t self_in, mp_obj_t obj) {
+    mp_obj_cell_t *self = (mp_obj_cell_t *)MP_OBJ_TO_PTR(self_in);
+    self->obj = obj;
+    GC_WRITE_BARRIER(self);
+}
+#endif
+
 mp_obj_t mp_obj_new_cell(mp_obj_t obj) {
     mp_obj_cell_t *o = mp_obj_malloc(mp_obj_cell_t, &mp_type_cell);
     o->obj = obj;
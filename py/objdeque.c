@@ -27,6 +27,8 @@
 #include <unistd.h> // for ssize_t
 
 #include "py/runtime.h"
+// CIRCUITPY-CHANGE
+#include "py/gc.h"
 
 #if MICROPY_PY_COLLECTIONS_DEQUE
 
@@ -117,6 +119,8 @@ static mp_obj_t mp_obj_deque_append(mp_obj_t self_in, mp_obj_t arg) {
     }
 
     self->items[self->i_put] = arg;
+    // CIRCUITPY-CHANGE
+    GC_WRITE_BARRIER(MP_OBJ_TO_PTR(arg));
     self->i_put = new_i_put;
 
     if (self->i_get == new_i_put) {
@@ -144,6 +148,8 @@ static mp_obj_t mp_obj_deque_appendleft(mp_obj_t self_in, mp_obj_t arg) {
 
     self->i_get = new_i_get;
     self->items[self->i_get] = arg;
+    // CIRCUITPY-CHANGE
+    GC_WRITE_BARRIER(MP_OBJ_TO_PTR(arg));
 
     // overwriting first element in deque
     if (self->i_put == new_i_get) {
@@ -230,6 +236,8 @@ static mp_obj_t deque_subscr(mp_obj_t self_in, mp_obj_t index, mp_obj_t value) {
     } else {
         // store into deque
         self->items[index_val] = value;
+        // CIRCUITPY-CHANGE
+        GC_WRITE_BARRIER(MP_OBJ_TO_PTR(value));
         return mp_const_none;
     }
 }
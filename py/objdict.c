@@ -310,6 +310,12 @@ mp_obj_t mp_obj_dict_copy(mp_obj_t self_in) {
     other->map.is_fixed = 0;
     other->map.is_ordered = self->map.is_ordered;
     memcpy(other->map.table, self->map.table, self->map.alloc * sizeof(mp_map_elem_t));
+    // CIRCUITPY-CHANGE: hash tables also carry the probe distance of each slot
+    #if MICROPY_MAP_ROBIN_HOOD
+    if (!self->map.is_ordered) {
+        memcpy(MP_MAP_PROBE_DISTS(&other->map), MP_MAP_PROBE_DISTS(&self->map), self->map.alloc);
+    }
+    #endif
     return other_out;
 }
 static MP_DEFINE_CONST_FUN_OBJ_1(dict_copy_obj, mp_obj_dict_copy);
@@ -412,10 +418,9 @@ static mp_obj_t dict_popitem(mp_obj_t self_in) {
     #endif
     mp_map_elem_t *next = dict_iter_next(self, &cur);
     assert(next);
-    self->map.used--;
     mp_obj_t items[] = {next->key, next->value};
-    next->key = MP_OBJ_SENTINEL; // must mark key as sentinel to indicate that it was deleted
-    next->value = MP_OBJ_NULL;
+    // CIRCUITPY-CHANGE: let the map remove the slot in the way its layout needs
+    mp_map_remove_slot(&self->map, next);
     mp_obj_t tuple = mp_obj_new_tuple(2, items);
 
     return tuple;
@@ -515,6 +520,8 @@ static mp_obj_t dict_move_to_end(size_t n_args, const mp_obj_t *pos_args, mp_map
     }
     memmove(move_dest, move_begin, move_count * sizeof(*elem));
     *dest = tmp;
+    // CIRCUITPY-CHANGE: the elements have moved, so the index must be redone
+    mp_map_reindex(&self->map);
 
     return mp_const_none;
 }
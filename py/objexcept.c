@@ -665,6 +665,7 @@ void mp_obj_exception_add_traceback(mp_obj_t self_in, qstr file, size_t line, qs
         }
         // populate traceback object
         *self->traceback = mp_const_empty_traceback_obj;
+        GC_WRITE_BARRIER(self->traceback);
     }
 
     // append the provided traceback info to traceback data
@@ -690,6 +691,7 @@ void mp_obj_exception_add_traceback(mp_obj_t self_in, qstr file, size_t line, qs
         } else {
             // Allocated the traceback data on the heap
             self->traceback->alloc = TRACEBACK_ENTRY_LEN;
+            GC_WRITE_BARRIER(self->traceback->data);
         }
         self->traceback->len = 0;
     } else if (self->traceback->len + TRACEBACK_ENTRY_LEN > self->traceback->alloc) {
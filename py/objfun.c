@@ -35,6 +35,8 @@
 #include "py/runtime.h"
 #include "py/bc.h"
 #include "py/cstack.h"
+// CIRCUITPY-CHANGE
+#include "py/gc.h"
 
 #if MICROPY_DEBUG_VERBOSE // print debugging info
 #define DEBUG_PRINT (1)
@@ -50,6 +52,21 @@
 /******************************************************************************/
 /* builtin functions                                                          */
 
+// CIRCUITPY-CHANGE: builtin functions may store their arguments in heap objects
+// without a write barrier, so shade them all during incremental marking.
+static inline void fun_builtin_write_barrier(size_t n, const mp_obj_t *args) {
+    #if MICROPY_GC_INCREMENTAL
+    if (MP_STATE_MEM(gc_inc_phase) == GC_INC_MARK) {
+        for (size_t i = 0; i < n; i++) {
+            gc_write_barrier(MP_OBJ_TO_PTR(args[i]));
+        }
+    }
+    #else
+    (void)n;
+    (void)args;
+    #endif
+}
+
 // CIRCUITPY-CHANGE: PLACE_IN_ITCM
 static mp_obj_t PLACE_IN_ITCM(fun_builtin_0_call)(mp_obj_t self_in, size_t n_args, size_t n_kw, const mp_obj_t *args) {
     (void)args;
@@ -69,6 +86,7 @@ static mp_obj_t PLACE_IN_ITCM(fun_builtin_1_call)(mp_obj_t self_in, size_t n_arg
     assert(mp_obj_is_type(self_in, &mp_type_fun_builtin_1));
     mp_obj_fun_builtin_fixed_t *self = MP_OBJ_TO_PTR(self_in);
     mp_arg_check_num(n_args, n_kw, 1, 1, false);
+    fun_builtin_write_barrier(1, args);
     return self->fun._1(args[0]);
 }
 
@@ -81,6 +99,7 @@ static mp_obj_t fun_builtin_2_call(mp_obj_t self_in, size_t n_args, size_t n_kw,
     assert(mp_obj_is_type(self_in, &mp_type_fun_builtin_2));
     mp_obj_fun_builtin_fixed_t *self = MP_OBJ_TO_PTR(self_in);
     mp_arg_check_num(n_args, n_kw, 2, 2, false);
+    fun_builtin_write_barrier(2, args);
     return self->fun._2(args[0], args[1]);
 }
 
@@ -94,6 +113,7 @@ static mp_obj_t PLACE_IN_ITCM(fun_builtin_3_call)(mp_obj_t self_in, size_t n_arg
     assert(mp_obj_is_type(self_in, &mp_type_fun_builtin_3));
     mp_obj_fun_builtin_fixed_t *self = MP_OBJ_TO_PTR(self_in);
     mp_arg_check_num(n_args, n_kw, 3, 3, false);
+    fun_builtin_write_barrier(3, args);
     return self->fun._3(args[0], args[1], args[2]);
 }
 
@@ -108,6 +128,7 @@ static mp_obj_t fun_builtin_var_call(mp_obj_t self_in, size_t n_args, size_t n_k
 
     // check number of arguments
     mp_arg_check_num_sig(n_args, n_kw, self->sig);
+    fun_builtin_write_barrier(n_args + 2 * n_kw, args);
 
     if (self->sig & 1) {
         // function allows keywords
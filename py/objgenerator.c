@@ -34,6 +34,8 @@
 #include "py/objgenerator.h"
 #include "py/objfun.h"
 #include "py/cstack.h"
+// CIRCUITPY-CHANGE
+#include "py/gc.h"
 
 // Instance of GeneratorExit exception - needed by generator.close()
 // CIRCUITPY-CHANGE: https://github.com/adafruit/circuitpython/pull/7069 fix
@@ -274,6 +276,10 @@ mp_vm_return_kind_t mp_obj_gen_resume(mp_obj_t self_in, mp_obj_t send_value, mp_
 
     mp_globals_set(self->code_state.old_globals);
 
+    // CIRCUITPY-CHANGE: the generator's state was written without barriers
+    // while it ran.
+    GC_WRITE_BARRIER(self);
+
     // Mark as not running
     self->pend_exc = mp_const_none;
 
@@ -30,6 +30,7 @@
 #include "py/objlist.h"
 #include "py/runtime.h"
 #include "py/cstack.h"
+#include "py/gc.h"
 
 static mp_obj_t mp_obj_new_list_iterator(mp_obj_t list, size_t cur, mp_obj_iter_buf_t *iter_buf);
 static mp_obj_list_t *list_new(size_t n);
@@ -214,6 +215,8 @@ static mp_obj_t list_subscr(mp_obj_t self_in, mp_obj_t index, mp_obj_t value) {
             mp_seq_clear(self->items, self->len + len_adj, self->len, sizeof(*self->items));
             // TODO: apply allocation policy re: alloc_size
         }
+        // CIRCUITPY-CHANGE
+        GC_WRITE_BARRIER(self->items);
         self->len += len_adj;
         return mp_const_none;
     }
@@ -250,6 +253,8 @@ mp_obj_t mp_obj_list_append(mp_obj_t self_in, mp_obj_t arg) {
         mp_seq_clear(self->items, self->len + 1, self->alloc, sizeof(*self->items));
     }
     self->items[self->len++] = arg;
+    // CIRCUITPY-CHANGE
+    GC_WRITE_BARRIER(MP_OBJ_TO_PTR(arg));
     return mp_const_none; // return None, as per CPython
 }
 
@@ -269,6 +274,8 @@ static mp_obj_t list_extend(mp_obj_t self_in, mp_obj_t arg_in) {
 
         memcpy(self->items + self->len, arg->items, sizeof(mp_obj_t) * arg->len);
         self->len += arg->len;
+        // CIRCUITPY-CHANGE
+        GC_WRITE_BARRIER(self->items);
     } else {
         list_extend_from_iter(self_in, arg_in);
     }
@@ -414,6 +421,8 @@ inline void mp_obj_list_insert(mp_obj_list_t *self_in, size_t index, mp_obj_t ob
         self->items[i] = self->items[i - 1];
     }
     self->items[index] = obj;
+    // CIRCUITPY-CHANGE
+    GC_WRITE_BARRIER(MP_OBJ_TO_PTR(obj));
 }
 
 static mp_obj_t list_insert(mp_obj_t self_in, mp_obj_t idx, mp_obj_t obj) {
@@ -548,6 +557,7 @@ void mp_obj_list_store(mp_obj_t self_in, mp_obj_t index, mp_obj_t value) {
     mp_obj_list_t *self = native_list(self_in);
     size_t i = mp_get_index(self->base.type, self->len, index, false);
     self->items[i] = value;
+    GC_WRITE_BARRIER(MP_OBJ_TO_PTR(value));
 }
 
 /******************************************************************************/
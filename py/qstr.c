@@ -60,13 +60,18 @@
 // allocated pool is twice this size.  The value here must be <= MP_QSTRnumber_of.
 #define MICROPY_ALLOC_QSTR_ENTRIES_INIT (10)
 
+// CIRCUITPY-CHANGE: split out the full-width hash, used by the runtime qstr index
 // this must match the equivalent function in makeqstrdata.py
-size_t qstr_compute_hash(const byte *data, size_t len) {
+static inline size_t qstr_compute_hash_full(const byte *data, size_t len) {
     // djb2 algorithm; see http://www.cse.yorku.ca/~oz/hash.html
     size_t hash = 5381;
     for (const byte *top = data + len; data < top; data++) {
         hash = ((hash << 5) + hash) ^ (*data); // hash * 33 ^ data
     }
+    return hash;
+}
+
+static inline size_t qstr_mask_hash(size_t hash) {
     hash &= Q_HASH_MASK;
     // Make sure that valid hash is never zero, zero means "hash not computed"
     if (hash == 0) {
@@ -75,6 +80,10 @@ size_t qstr_compute_hash(const byte *data, size_t len) {
     return hash;
 }
 
+size_t qstr_compute_hash(const byte *data, size_t len) {
+    return qstr_mask_hash(qstr_compute_hash_full(data, len));
+}
+
 // The first pool is the static qstr table. The contents must remain stable as
 // it is part of the .mpy ABI. See the top of py/persistentcode.c and
 // static_qstr_list in makeqstrdata.py. This pool is unsorted (although in a
@@ -206,6 +215,11 @@ extern const qstr_pool_t MICROPY_QSTR_EXTRA_POOL;
 void qstr_reset(void) {
     MP_STATE_VM(last_pool) = (qstr_pool_t *)&CONST_POOL; // we won't modify the const_pool since it has no allocated room left
     MP_STATE_VM(qstr_last_chunk) = NULL;
+    // CIRCUITPY-CHANGE
+    #if MICROPY_QSTR_RUNTIME_INDEX
+    MP_STATE_VM(qstr_index) = NULL;
+    MP_STATE_VM(qstr_index_alloc) = 0;
+    #endif
 }
 
 void qstr_init(void) {
@@ -228,15 +242,122 @@ static const qstr_pool_t *find_qstr(qstr *q) {
     return pool;
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_QSTR_RUNTIME_INDEX
+
+// The runtime qstr index is an open-addressed hash table, using linear
+// probing, of the qstrs in all the pools added after CONST_POOL.  Slots are
+// placed by the full-width string hash rather than the (possibly 1 byte)
+// hash stored in the pools, so the slots stay spread out however big the
+// table grows.  Entries are never removed, and MP_QSTRnull marks an empty slot.
+
+// Initial number of slots in the index; must be a power of 2.
+#define QSTR_INDEX_ALLOC_INIT (32)
+
+// djb2 mixes each byte into the low bits only weakly, so similar strings like
+// "key1", "key2" would land in clusters of nearby slots; scramble it first.
+static inline size_t qstr_index_slot(size_t full_hash, size_t mask) {
+    uint32_t h = full_hash;
+    h = (h ^ (h >> 16)) * 0x45d9f3b;
+    h ^= h >> 16;
+    return h & mask;
+}
+
+static qstr qstr_index_find(const char *str, size_t str_len, size_t full_hash) {
+    const qstr *index = MP_STATE_VM(qstr_index);
+    size_t mask = MP_STATE_VM(qstr_index_alloc) - 1;
+    #if MICROPY_QSTR_BYTES_IN_HASH
+    size_t str_hash = qstr_mask_hash(full_hash);
+    #endif
+    for (size_t pos = qstr_index_slot(full_hash, mask);; pos = (pos + 1) & mask) {
+        qstr q = index[pos];
+        if (q == MP_QSTRnull) {
+            return MP_QSTRnull;
+        }
+        qstr at = q;
+        const qstr_pool_t *pool = find_qstr(&at);
+        if (
+            #if MICROPY_QSTR_BYTES_IN_HASH
+            pool->hashes[at] == str_hash &&
+            #endif
+            pool->lengths[at] == str_len
+            && memcmp(pool->qstrs[at], str, str_len) == 0) {
+            return q;
+        }
+    }
+}
+
+static void qstr_index_insert(qstr *index, size_t alloc, qstr q, size_t full_hash) {
+    size_t mask = alloc - 1;
+    size_t pos = qstr_index_slot(full_hash, mask);
+    while (index[pos] != MP_QSTRnull) {
+        pos = (pos + 1) & mask;
+    }
+    index[pos] = q;
+}
+
+// Make room in the index for one more qstr, rebuilding it at a larger size if
+// it would become more than 3/4 full.  If there is not enough memory to grow
+// a full index it is dropped, and lookups search the runtime pools instead
+// until a later qstr_add manages to rebuild it.
+static void qstr_index_grow(void) {
+    size_t used = MP_STATE_VM(last_pool)->total_prev_len + MP_STATE_VM(last_pool)->len
+        - (CONST_POOL.total_prev_len + CONST_POOL.len);
+    size_t alloc = MP_STATE_VM(qstr_index_alloc);
+    if ((used + 1) * 4 <= alloc * 3) {
+        return;
+    }
+    size_t new_alloc = alloc == 0 ? QSTR_INDEX_ALLOC_INIT : alloc * 2;
+    while ((used + 1) * 4 > new_alloc * 3) {
+        new_alloc *= 2;
+    }
+    qstr *index = m_new_maybe(qstr, new_alloc);
+    if (index == NULL) {
+        if (used + 1 >= alloc) {
+            // no free slot would be left to end a probe
+            m_del(qstr, MP_STATE_VM(qstr_index), alloc);
+            MP_STATE_VM(qstr_index) = NULL;
+            MP_STATE_VM(qstr_index_alloc) = 0;
+        }
+        return;
+    }
+    memset(index, 0, new_alloc * sizeof(qstr));
+    for (const qstr_pool_t *pool = MP_STATE_VM(last_pool); pool != &CONST_POOL; pool = pool->prev) {
+        for (size_t at = 0; at < pool->len; at++) {
+            size_t full_hash = qstr_compute_hash_full((const byte *)pool->qstrs[at], pool->lengths[at]);
+            qstr_index_insert(index, new_alloc, pool->total_prev_len + at, full_hash);
+        }
+    }
+    m_del(qstr, MP_STATE_VM(qstr_index), alloc);
+    MP_STATE_VM(qstr_index) = index;
+    MP_STATE_VM(qstr_index_alloc) = new_alloc;
+}
+
+#endif
+
 // qstr_mutex must be taken while in this function
 static qstr qstr_add(mp_uint_t len, const char *q_ptr) {
+    // CIRCUITPY-CHANGE
+    #if MICROPY_QSTR_RUNTIME_INDEX
+    size_t full_hash = qstr_compute_hash_full((const byte *)q_ptr, len);
+    #endif
     #if MICROPY_QSTR_BYTES_IN_HASH
+    // CIRCUITPY-CHANGE
+    #if MICROPY_QSTR_RUNTIME_INDEX
+    mp_uint_t hash = qstr_mask_hash(full_hash);
+    #else
     mp_uint_t hash = qstr_compute_hash((const byte *)q_ptr, len);
+    #endif
     DEBUG_printf("QSTR: add hash=%d len=%d data=%.*s\n", hash, len, len, q_ptr);
     #else
     DEBUG_printf("QSTR: add len=%d data=%.*s\n", len, len, q_ptr);
     #endif
 
+    // CIRCUITPY-CHANGE: make sure the index has room for the new qstr
+    #if MICROPY_QSTR_RUNTIME_INDEX
+    qstr_index_grow();
+    #endif
+
     // make sure we have room in the pool for a new qstr
     if (MP_STATE_VM(last_pool)->len >= MP_STATE_VM(last_pool)->alloc) {
         size_t new_alloc = MP_STATE_VM(last_pool)->alloc * 2;
@@ -284,6 +405,13 @@ static qstr qstr_add(mp_uint_t len, const char *q_ptr) {
     MP_STATE_VM(last_pool)->qstrs[at] = q_ptr;
     MP_STATE_VM(last_pool)->len++;
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_QSTR_RUNTIME_INDEX
+    if (MP_STATE_VM(qstr_index) != NULL) {
+        qstr_index_insert(MP_STATE_VM(qstr_index), MP_STATE_VM(qstr_index_alloc), MP_STATE_VM(last_pool)->total_prev_len + at, full_hash);
+    }
+    #endif
+
     // return id for the newly-added qstr
     return MP_STATE_VM(last_pool)->total_prev_len + at;
 }
@@ -294,13 +422,28 @@ qstr qstr_find_strn(const char *str, size_t str_len) {
         return MP_QSTR_;
     }
 
+    // CIRCUITPY-CHANGE: look up the runtime pools through the index
+    const qstr_pool_t *pool = MP_STATE_VM(last_pool);
+    #if MICROPY_QSTR_RUNTIME_INDEX
+    size_t full_hash = qstr_compute_hash_full((const byte *)str, str_len);
     #if MICROPY_QSTR_BYTES_IN_HASH
+    size_t str_hash = qstr_mask_hash(full_hash);
+    #endif
+    if (MP_STATE_VM(qstr_index) != NULL) {
+        qstr q = qstr_index_find(str, str_len, full_hash);
+        if (q != MP_QSTRnull) {
+            return q;
+        }
+        // only the ROM pools are left to search
+        pool = &CONST_POOL;
+    }
+    #elif MICROPY_QSTR_BYTES_IN_HASH
     // work out hash of str
     size_t str_hash = qstr_compute_hash((const byte *)str, str_len);
     #endif
 
     // search pools for the data
-    for (const qstr_pool_t *pool = MP_STATE_VM(last_pool); pool != NULL; pool = pool->prev) {
+    for (; pool != NULL; pool = pool->prev) {
         size_t low = 0;
         size_t high = pool->len - 1;
 
@@ -14,6 +14,6 @@
 extern const mp_obj_type_t audioio_wavefile_type;
 
 void common_hal_audioio_wavefile_construct(audioio_wavefile_obj_t *self,
-    pyb_file_obj_t *file, uint8_t *buffer, size_t buffer_size);
+    pyb_file_obj_t *file, uint8_t *buffer, size_t buffer_size, bool prefetch);
 
 void common_hal_audioio_wavefile_deinit(audioio_wavefile_obj_t *self);
@@ -9,18 +9,70 @@
 #include "py/obj.h"
 #include "py/objproperty.h"
 #include "py/gc.h"
+#include "py/mphal.h"
 #include "py/runtime.h"
+#include "py/stream.h"
 
 #include "shared-bindings/audiocore/__init__.h"
 #include "shared-bindings/audiocore/RawSample.h"
 #include "shared-bindings/audiocore/WaveFile.h"
 #include "shared-bindings/util.h"
+#include "shared-module/audiocore/__init__.h"
 // #include "shared-bindings/audiomixer/Mixer.h"
 
 //| """Support for audio samples"""
 
 #if CIRCUITPY_AUDIOCORE_DEBUG
 // (no docstrings so that the debug functions are not shown on docs.circuitpython.org)
+static uint32_t audiocore_frame_size(mp_obj_t sample_in) {
+    audiosample_base_t *sample = audiosample_check(sample_in);
+    audiosample_check_for_deinit(sample);
+    return audiosample_get_channel_count(sample) * audiosample_get_bits_per_sample(sample) / 8;
+}
+
+// render_into(sample, buffer) -> int
+// Plays sample from its beginning into buffer as fast as possible, in the sample's own format.
+// Returns the number of frames rendered, fewer than buffer holds if the sample finished first.
+static mp_obj_t audiocore_render_into(mp_obj_t sample_in, mp_obj_t buffer_in) {
+    uint32_t frame_size = audiocore_frame_size(sample_in);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer_in, &bufinfo, MP_BUFFER_WRITE);
+    uint32_t length = bufinfo.len - bufinfo.len % frame_size;
+    uint32_t rendered = audiosample_render(sample_in, bufinfo.buf, MP_OBJ_NULL, length);
+    return mp_obj_new_int_from_uint(rendered / frame_size);
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(audiocore_render_into_obj, audiocore_render_into);
+
+// render(sample, nframes, output=None) -> (frames, frames_per_second)
+// Plays nframes of sample from its beginning as fast as possible, writing the raw data to the
+// output stream if one is given. A chain that renders slower than its sample_rate can't play
+// back without dropouts.
+static mp_obj_t audiocore_render(size_t n_args, const mp_obj_t *args) {
+    mp_obj_t sample_in = args[0];
+    uint32_t frame_size = audiocore_frame_size(sample_in);
+    mp_int_t nframes = mp_arg_validate_int_range(mp_obj_get_int(args[1]), 0, INT32_MAX / frame_size, MP_QSTR_nframes);
+    mp_obj_t output = MP_OBJ_NULL;
+    if (n_args > 2 && args[2] != mp_const_none) {
+        output = args[2];
+        mp_get_stream_raise(output, MP_STREAM_OP_WRITE);
+    }
+
+    mp_uint_t start = mp_hal_ticks_ms();
+    uint32_t rendered = audiosample_render(sample_in, NULL, output, nframes * frame_size) / frame_size;
+    mp_uint_t elapsed = mp_hal_ticks_ms() - start;
+    // Millisecond ticks are coarse; treat a render that finished within one tick as taking one.
+    if (elapsed == 0) {
+        elapsed = 1;
+    }
+
+    mp_obj_t result[2] = {
+        mp_obj_new_int_from_uint(rendered),
+        mp_obj_new_float((mp_float_t)rendered * 1000 / elapsed),
+    };
+    return mp_obj_new_tuple(2, result);
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(audiocore_render_obj, 2, 3, audiocore_render);
+
 static mp_obj_t audiocore_get_buffer(mp_obj_t sample_in) {
     uint8_t *buffer = NULL;
     uint32_t buffer_length = 0;
@@ -84,6 +136,8 @@ static const mp_rom_map_elem_t audiocore_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_RawSample), MP_ROM_PTR(&audioio_rawsample_type) },
     { MP_ROM_QSTR(MP_QSTR_WaveFile), MP_ROM_PTR(&audioio_wavefile_type) },
     #if CIRCUITPY_AUDIOCORE_DEBUG
+    { MP_ROM_QSTR(MP_QSTR_render), MP_ROM_PTR(&audiocore_render_obj) },
+    { MP_ROM_QSTR(MP_QSTR_render_into), MP_ROM_PTR(&audiocore_render_into_obj) },
     { MP_ROM_QSTR(MP_QSTR_get_buffer), MP_ROM_PTR(&audiocore_get_buffer_obj) },
     { MP_ROM_QSTR(MP_QSTR_reset_buffer), MP_ROM_PTR(&audiocore_reset_buffer_obj) },
     { MP_ROM_QSTR(MP_QSTR_get_structure), MP_ROM_PTR(&audiocore_get_structure_obj) },
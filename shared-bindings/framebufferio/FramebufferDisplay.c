@@ -15,7 +15,6 @@
 #include "py/objtype.h"
 #include "py/runtime.h"
 #include "shared-bindings/displayio/Group.h"
-#include "shared-bindings/microcontroller/Pin.h"
 #include "shared-bindings/util.h"
 #include "shared-module/displayio/__init__.h"
 
@@ -176,7 +175,7 @@ MP_DEFINE_CONST_FUN_OBJ_1(framebufferio_framebufferdisplay_get_brightness_obj, f
 static mp_obj_t framebufferio_framebufferdisplay_obj_set_brightness(mp_obj_t self_in, mp_obj_t brightness_obj) {
     framebufferio_framebufferdisplay_obj_t *self = native_display(self_in);
     mp_float_t brightness = mp_obj_get_float(brightness_obj);
-    if (brightness < 0.0f || brightness > 1.0f) {
+    if (brightness < MICROPY_FLOAT_CONST(0.0) || brightness > MICROPY_FLOAT_CONST(1.0)) {
         mp_raise_ValueError_varg(MP_ERROR_TEXT("%q must be %d-%d"), MP_QSTR_brightness, 0, 1);
     }
     bool ok = common_hal_framebufferio_framebufferdisplay_set_brightness(self, brightness);
@@ -19,6 +19,36 @@
 #include "shared-bindings/synthio/__init__.h"
 #include "shared-bindings/audiocore/__init__.h"
 
+//| class VoiceStealing:
+//|     """What a `Synthesizer` does when a note is pressed while all of its voices are sounding
+//|
+//|     A voice whose note is in its release phase is always reused first, whatever the policy."""
+//|
+//|     NONE: VoiceStealing
+//|     """The new note is not played"""
+//|     OLDEST: VoiceStealing
+//|     """The note that was pressed longest ago is cut off to play the new note"""
+//|     QUIETEST: VoiceStealing
+//|     """The note with the lowest envelope level is cut off to play the new note"""
+//|
+//|
+
+MAKE_ENUM_VALUE(synthio_voice_stealing_type, voice_stealing, NONE, SYNTHIO_VOICE_STEALING_NONE);
+MAKE_ENUM_VALUE(synthio_voice_stealing_type, voice_stealing, OLDEST, SYNTHIO_VOICE_STEALING_OLDEST);
+MAKE_ENUM_VALUE(synthio_voice_stealing_type, voice_stealing, QUIETEST, SYNTHIO_VOICE_STEALING_QUIETEST);
+
+MAKE_ENUM_MAP(synthio_voice_stealing) {
+    MAKE_ENUM_MAP_ENTRY(voice_stealing, NONE),
+    MAKE_ENUM_MAP_ENTRY(voice_stealing, OLDEST),
+    MAKE_ENUM_MAP_ENTRY(voice_stealing, QUIETEST),
+};
+
+static MP_DEFINE_CONST_DICT(synthio_voice_stealing_locals_dict, synthio_voice_stealing_locals_table);
+
+MAKE_PRINTER(synthio, synthio_voice_stealing);
+
+MAKE_ENUM_TYPE(synthio, VoiceStealing, synthio_voice_stealing);
+
 //| NoteSequence = Sequence[Union[int, Note]]
 //| """A sequence of notes, which can each be integer MIDI note numbers or `Note` objects"""
 //| NoteOrNoteSequence = Union[int, Note, NoteSequence]
@@ -35,6 +65,8 @@
 //|         channel_count: int = 1,
 //|         waveform: Optional[ReadableBuffer] = None,
 //|         envelope: Optional[Envelope] = None,
+//|         max_voices: int = max_polyphony,
+//|         voice_stealing: VoiceStealing = VoiceStealing.NONE,
 //|     ) -> None:
 //|         """Create a synthesizer object.
 //|
@@ -48,15 +80,19 @@
 //|         :param int channel_count: The number of output channels (1=mono, 2=stereo)
 //|         :param ReadableBuffer waveform: A single-cycle waveform. Default is a 50% duty cycle square wave. If specified, must be a ReadableBuffer of type 'h' (signed 16 bit)
 //|         :param Optional[Envelope] envelope: An object that defines the loudness of a note over time. The default envelope, `None` provides no ramping, voices turn instantly on and off.
+//|         :param int max_voices: The number of notes that can sound at once, from 1 to 255. Each voice takes about 30 bytes of RAM, and the mix is scaled for this many voices, so a smaller pool is also louder
+//|         :param VoiceStealing voice_stealing: What to do when a note is pressed while all the voices are sounding
 //|         """
 //|
 static mp_obj_t synthio_synthesizer_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
-    enum { ARG_sample_rate, ARG_channel_count, ARG_waveform, ARG_envelope };
+    enum { ARG_sample_rate, ARG_channel_count, ARG_waveform, ARG_envelope, ARG_max_voices, ARG_voice_stealing };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_sample_rate, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 11025} },
         { MP_QSTR_channel_count, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 1} },
         { MP_QSTR_waveform, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none } },
         { MP_QSTR_envelope, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none } },
+        { MP_QSTR_max_voices, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = CIRCUITPY_SYNTHIO_MAX_CHANNELS} },
+        { MP_QSTR_voice_stealing, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_rom_obj = MP_ROM_PTR(&voice_stealing_NONE_obj)} },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
@@ -66,7 +102,9 @@ static mp_obj_t synthio_synthesizer_make_new(const mp_obj_type_t *type, size_t n
         args[ARG_sample_rate].u_int,
         args[ARG_channel_count].u_int,
         args[ARG_waveform].u_obj,
-        args[ARG_envelope].u_obj);
+        args[ARG_envelope].u_obj,
+        args[ARG_max_voices].u_int,
+        cp_enum_value(&synthio_voice_stealing_type, args[ARG_voice_stealing].u_obj, MP_QSTR_voice_stealing));
 
     return MP_OBJ_FROM_PTR(self);
 }
@@ -228,6 +266,43 @@ MP_PROPERTY_GETSET(synthio_synthesizer_envelope_obj,
 //|     sample_rate: int
 //|     """32 bit value that tells how quickly samples are played in Hertz (cycles per second)."""
 
+//|     max_polyphony: int
+//|     """The default number of voices of a Synthesizer on this board"""
+
+//|     max_voices: int
+//|     """The number of notes that can sound at once (read-only property)"""
+static mp_obj_t synthio_synthesizer_obj_get_max_voices(mp_obj_t self_in) {
+    synthio_synthesizer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_synthio_synthesizer_get_max_voices(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_synthesizer_get_max_voices_obj, synthio_synthesizer_obj_get_max_voices);
+
+MP_PROPERTY_GETTER(synthio_synthesizer_max_voices_obj,
+    (mp_obj_t)&synthio_synthesizer_get_max_voices_obj);
+
+//|     voice_stealing: VoiceStealing
+//|     """What to do when a note is pressed while all the voices are sounding"""
+static mp_obj_t synthio_synthesizer_obj_get_voice_stealing(mp_obj_t self_in) {
+    synthio_synthesizer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return cp_enum_find(&synthio_voice_stealing_type, common_hal_synthio_synthesizer_get_voice_stealing(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_synthesizer_get_voice_stealing_obj, synthio_synthesizer_obj_get_voice_stealing);
+
+static mp_obj_t synthio_synthesizer_obj_set_voice_stealing(mp_obj_t self_in, mp_obj_t voice_stealing) {
+    synthio_synthesizer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_synthio_synthesizer_set_voice_stealing(self,
+        cp_enum_value(&synthio_voice_stealing_type, voice_stealing, MP_QSTR_voice_stealing));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(synthio_synthesizer_set_voice_stealing_obj, synthio_synthesizer_obj_set_voice_stealing);
+
+MP_PROPERTY_GETSET(synthio_synthesizer_voice_stealing_obj,
+    (mp_obj_t)&synthio_synthesizer_get_voice_stealing_obj,
+    (mp_obj_t)&synthio_synthesizer_set_voice_stealing_obj);
+
 //|     pressed: NoteSequence
 //|     """A sequence of the currently pressed notes (read-only property).
 //|
@@ -294,6 +369,8 @@ static const mp_rom_map_elem_t synthio_synthesizer_locals_dict_table[] = {
     // Properties
     { MP_ROM_QSTR(MP_QSTR_envelope), MP_ROM_PTR(&synthio_synthesizer_envelope_obj) },
     { MP_ROM_QSTR(MP_QSTR_max_polyphony), MP_ROM_INT(CIRCUITPY_SYNTHIO_MAX_CHANNELS) },
+    { MP_ROM_QSTR(MP_QSTR_max_voices), MP_ROM_PTR(&synthio_synthesizer_max_voices_obj) },
+    { MP_ROM_QSTR(MP_QSTR_voice_stealing), MP_ROM_PTR(&synthio_synthesizer_voice_stealing_obj) },
     { MP_ROM_QSTR(MP_QSTR_pressed), MP_ROM_PTR(&synthio_synthesizer_pressed_obj) },
     { MP_ROM_QSTR(MP_QSTR_note_info), MP_ROM_PTR(&synthio_synthesizer_note_info_obj) },
     { MP_ROM_QSTR(MP_QSTR_blocks), MP_ROM_PTR(&synthio_synthesizer_blocks_obj) },
@@ -16,6 +16,10 @@ typedef enum {
     SYNTHIO_ENVELOPE_STATE_SUSTAIN, SYNTHIO_ENVELOPE_STATE_RELEASE
 } envelope_state_e;
 
+typedef enum {
+    SYNTHIO_VOICE_STEALING_NONE, SYNTHIO_VOICE_STEALING_OLDEST, SYNTHIO_VOICE_STEALING_QUIETEST
+} synthio_voice_stealing_t;
+
 typedef enum synthio_bend_mode_e {
     SYNTHIO_BEND_MODE_STATIC, SYNTHIO_BEND_MODE_VIBRATO, SYNTHIO_BEND_MODE_SWEEP, SYNTHIO_BEND_MODE_SWEEP_IN
 } synthio_bend_mode_t;
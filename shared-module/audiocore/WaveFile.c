@@ -14,6 +14,13 @@
 
 #include "shared-module/audiocore/WaveFile.h"
 #include "shared-bindings/audiocore/__init__.h"
+#include "supervisor/background_callback.h"
+
+#if defined(MICROPY_UNIX_COVERAGE)
+#define background_callback_prevent() ((void)0)
+#define background_callback_allow() ((void)0)
+#define background_callback_add(buf, fn, arg) ((fn)((arg)))
+#endif
 
 struct wave_format_chunk {
     uint16_t audio_format;
@@ -32,7 +39,8 @@ struct wave_format_chunk {
 void common_hal_audioio_wavefile_construct(audioio_wavefile_obj_t *self,
     pyb_file_obj_t *file,
     uint8_t *buffer,
-    size_t buffer_size) {
+    size_t buffer_size,
+    bool prefetch) {
     // Load the wave
     self->file = file;
     uint8_t chunk_header[16];
@@ -78,6 +86,7 @@ void common_hal_audioio_wavefile_construct(audioio_wavefile_obj_t *self,
     self->base.samples_signed = format.bits_per_sample > 8;
     self->base.max_buffer_length = 512;
     self->base.single_buffer = false;
+    self->base.writable_buffers = true;
 
     uint8_t chunk_tag[4];
     uint32_t chunk_length;
@@ -112,33 +121,83 @@ void common_hal_audioio_wavefile_construct(audioio_wavefile_obj_t *self,
     self->data_start = self->file->fp.fptr;
 
     // Try to allocate two buffers, one will be loaded from file and the other
-    // DMAed to DAC.
+    // DMAed to DAC. Prefetching needs a third to load while the DAC holds two.
+    self->prefetch = prefetch;
+    self->buffer_count = prefetch ? 3 : 2;
     if (buffer_size) {
-        self->len = buffer_size / 2;
-        self->buffer = buffer;
-        self->second_buffer = buffer + self->len;
+        self->len = buffer_size / self->buffer_count;
+        if (prefetch) {
+            // Keep every buffer aligned to whole 16-bit stereo frames.
+            self->len &= ~3;
+        }
+        for (uint8_t i = 0; i < self->buffer_count; i++) {
+            self->buffer[i] = buffer + i * self->len;
+        }
     } else {
         self->len = 256;
-        self->buffer = m_malloc_without_collect(self->len);
-        if (self->buffer == NULL) {
-            common_hal_audioio_wavefile_deinit(self);
-            m_malloc_fail(self->len);
-        }
-
-        self->second_buffer = m_malloc_without_collect(self->len);
-        if (self->second_buffer == NULL) {
-            common_hal_audioio_wavefile_deinit(self);
-            m_malloc_fail(self->len);
+        for (uint8_t i = 0; i < self->buffer_count; i++) {
+            self->buffer[i] = m_malloc_without_collect(self->len);
+            if (self->buffer[i] == NULL) {
+                common_hal_audioio_wavefile_deinit(self);
+                m_malloc_fail(self->len);
+            }
         }
     }
 }
 
 void common_hal_audioio_wavefile_deinit(audioio_wavefile_obj_t *self) {
-    self->buffer = NULL;
-    self->second_buffer = NULL;
+    for (uint8_t i = 0; i < AUDIOIO_WAVEFILE_MAX_BUFFERS; i++) {
+        self->buffer[i] = NULL;
+    }
     audiosample_mark_deinit(&self->base);
 }
 
+// Read the next load from the file into buffer[buffer_index].
+static bool wavefile_load(audioio_wavefile_obj_t *self) {
+    uint8_t *buffer = self->buffer[self->buffer_index];
+    uint32_t num_bytes_to_load = self->len;
+    if (num_bytes_to_load > self->bytes_remaining) {
+        num_bytes_to_load = self->bytes_remaining;
+    }
+    UINT length_read;
+    if (f_read(&self->file->fp, buffer, num_bytes_to_load, &length_read) != FR_OK || length_read != num_bytes_to_load) {
+        return false;
+    }
+    self->bytes_remaining -= length_read;
+    // Pad the last buffer to word align it.
+    if (self->bytes_remaining == 0 && length_read % sizeof(uint32_t) != 0) {
+        uint32_t pad = length_read % sizeof(uint32_t);
+        length_read += pad;
+        if (self->base.bits_per_sample == 8) {
+            for (uint32_t i = 0; i < pad; i++) {
+                ((uint8_t *)(buffer))[length_read / sizeof(uint8_t) - i - 1] = 0x80;
+            }
+        } else if (self->base.bits_per_sample == 16) {
+            // We know the buffer is aligned because we allocated it onto the heap ourselves.
+            #pragma GCC diagnostic push
+            #pragma GCC diagnostic ignored "-Wcast-align"
+            ((int16_t *)(buffer))[length_read / sizeof(int16_t) - 1] = 0;
+            #pragma GCC diagnostic pop
+        }
+    }
+    self->buffer_length[self->buffer_index] = length_read;
+    return true;
+}
+
+// Load the next buffer while the output is still busy with the ones handed out
+// already, so that get_buffer doesn't wait on the filesystem.
+static void wavefile_prefetch_cb(void *self_in) {
+    audioio_wavefile_obj_t *self = self_in;
+    if (audiosample_deinited(&self->base) || self->prefetched || self->bytes_remaining == 0) {
+        return;
+    }
+    if (wavefile_load(self)) {
+        self->prefetched = true;
+    } else {
+        self->prefetch_failed = true;
+    }
+}
+
 void audioio_wavefile_reset_buffer(audioio_wavefile_obj_t *self,
     bool single_channel_output,
     uint8_t channel) {
@@ -147,11 +206,19 @@ void audioio_wavefile_reset_buffer(audioio_wavefile_obj_t *self,
     }
     // We don't reset the buffer index in case we're looping and we have an odd number of buffer
     // loads
+    // A queued prefetch must not read the file while the seek is waiting on it.
+    background_callback_prevent();
     self->bytes_remaining = self->file_length;
     f_lseek(&self->file->fp, self->data_start);
     self->read_count = 0;
     self->left_read_count = 0;
     self->right_read_count = 0;
+    self->prefetched = false;
+    self->prefetch_failed = false;
+    if (self->prefetch) {
+        background_callback_add(&self->prefetch_cb, wavefile_prefetch_cb, self);
+    }
+    background_callback_allow();
 }
 
 audioio_get_buffer_result_t audioio_wavefile_get_buffer(audioio_wavefile_obj_t *self,
@@ -170,61 +237,31 @@ audioio_get_buffer_result_t audioio_wavefile_get_buffer(audioio_wavefile_obj_t *
 
     bool need_more_data = self->read_count == channel_read_count;
 
-    if (self->bytes_remaining == 0 && need_more_data) {
+    if (self->bytes_remaining == 0 && !self->prefetched && need_more_data) {
         *buffer = NULL;
         *buffer_length = 0;
         return GET_BUFFER_DONE;
     }
 
     if (need_more_data) {
-        uint32_t num_bytes_to_load = self->len;
-        if (num_bytes_to_load > self->bytes_remaining) {
-            num_bytes_to_load = self->bytes_remaining;
-        }
-        UINT length_read;
-        if (self->buffer_index % 2 == 1) {
-            *buffer = self->second_buffer;
-        } else {
-            *buffer = self->buffer;
-        }
-        if (f_read(&self->file->fp, *buffer, num_bytes_to_load, &length_read) != FR_OK || length_read != num_bytes_to_load) {
+        // Read synchronously when the prefetch hasn't run yet, or prefetching is off. The
+        // filesystem may run background tasks while it waits, and the prefetch queued earlier
+        // must not read the same file from inside them.
+        background_callback_prevent();
+        bool loaded = !self->prefetch_failed && (self->prefetched || wavefile_load(self));
+        background_callback_allow();
+        if (!loaded) {
             return GET_BUFFER_ERROR;
         }
-        self->bytes_remaining -= length_read;
-        // Pad the last buffer to word align it.
-        if (self->bytes_remaining == 0 && length_read % sizeof(uint32_t) != 0) {
-            uint32_t pad = length_read % sizeof(uint32_t);
-            length_read += pad;
-            if (self->base.bits_per_sample == 8) {
-                for (uint32_t i = 0; i < pad; i++) {
-                    ((uint8_t *)(*buffer))[length_read / sizeof(uint8_t) - i - 1] = 0x80;
-                }
-            } else if (self->base.bits_per_sample == 16) {
-                // We know the buffer is aligned because we allocated it onto the heap ourselves.
-                #pragma GCC diagnostic push
-                #pragma GCC diagnostic ignored "-Wcast-align"
-                ((int16_t *)(*buffer))[length_read / sizeof(int16_t) - 1] = 0;
-                #pragma GCC diagnostic pop
-            }
-        }
-        *buffer_length = length_read;
-        if (self->buffer_index % 2 == 1) {
-            self->second_buffer_length = length_read;
-        } else {
-            self->buffer_length = length_read;
-        }
-        self->buffer_index += 1;
+        self->prefetched = false;
+        self->buffer_index = (self->buffer_index + 1) % self->buffer_count;
         self->read_count += 1;
     }
 
     uint32_t buffers_back = self->read_count - 1 - channel_read_count;
-    if ((self->buffer_index - buffers_back) % 2 == 0) {
-        *buffer = self->second_buffer;
-        *buffer_length = self->second_buffer_length;
-    } else {
-        *buffer = self->buffer;
-        *buffer_length = self->buffer_length;
-    }
+    uint8_t index = (self->buffer_index + 2 * self->buffer_count - 1 - buffers_back) % self->buffer_count;
+    *buffer = self->buffer[index];
+    *buffer_length = self->buffer_length[index];
 
     if (channel == 0) {
         self->left_read_count += 1;
@@ -233,5 +270,13 @@ audioio_get_buffer_result_t audioio_wavefile_get_buffer(audioio_wavefile_obj_t *
         *buffer = *buffer + self->base.bits_per_sample / 8;
     }
 
-    return self->bytes_remaining == 0 ? GET_BUFFER_DONE : GET_BUFFER_MORE_DATA;
+    audioio_get_buffer_result_t result =
+        (self->bytes_remaining == 0 && !self->prefetched) ? GET_BUFFER_DONE : GET_BUFFER_MORE_DATA;
+
+    // The buffer loaded before the previous one is free again now; refill it in the background.
+    if (need_more_data && self->prefetch && self->bytes_remaining > 0) {
+        background_callback_add(&self->prefetch_cb, wavefile_prefetch_cb, self);
+    }
+
+    return result;
 }
@@ -6,21 +6,30 @@
 
 #pragma once
 
+#include "supervisor/background_callback.h"
 #include "extmod/vfs_fat.h"
 #include "py/obj.h"
 
 #include "shared-module/audiocore/__init__.h"
 
+// Two buffers alternate between the file and the output. Prefetching adds a
+// third, so that one can be read from the file while the output holds the others.
+#define AUDIOIO_WAVEFILE_MAX_BUFFERS (3)
+
 typedef struct {
     audiosample_base_t base;
-    uint8_t *buffer;
-    uint32_t buffer_length;
-    uint8_t *second_buffer;
-    uint32_t second_buffer_length;
+    uint8_t *buffer[AUDIOIO_WAVEFILE_MAX_BUFFERS];
+    uint32_t buffer_length[AUDIOIO_WAVEFILE_MAX_BUFFERS];
+    uint8_t buffer_count;
+    uint8_t buffer_index; // The buffer the next load goes into
     uint32_t file_length; // In bytes
     uint16_t data_start; // Where the data values start
-    uint16_t buffer_index;
-    uint32_t bytes_remaining;
+    uint32_t bytes_remaining; // Not yet read from the file
+
+    background_callback_t prefetch_cb;
+    bool prefetch;
+    bool prefetched; // buffer[buffer_index] already holds the next load
+    bool prefetch_failed;
 
     uint32_t len;
     pyb_file_obj_t *file;
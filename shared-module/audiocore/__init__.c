@@ -6,8 +6,12 @@
 
 #include "shared-module/audioio/__init__.h"
 
+#include <string.h>
+
+#include "py/mphal.h"
 #include "py/obj.h"
 #include "py/runtime.h"
+#include "py/stream.h"
 #include "shared-bindings/audiocore/__init__.h"
 #include "shared-bindings/audiocore/RawSample.h"
 #include "shared-bindings/audiocore/WaveFile.h"
@@ -29,6 +33,14 @@ void audiosample_reset_buffer(mp_obj_t sample_obj, bool single_channel_output, u
     proto->reset_buffer(MP_OBJ_TO_PTR(sample_obj), single_channel_output, audio_channel);
 }
 
+#if CIRCUITPY_AUDIOCORE_DEBUG
+// Players pull from a sample at least this often, a buffer at a time.
+#define AUDIOSAMPLE_PLAYING_MS (500)
+
+// Pulls made while rendering don't mark samples as played.
+static bool rendering;
+#endif
+
 audioio_get_buffer_result_t audiosample_get_buffer(mp_obj_t sample_obj,
     bool single_channel_output,
     uint8_t channel,
@@ -39,9 +51,74 @@ audioio_get_buffer_result_t audiosample_get_buffer(mp_obj_t sample_obj,
         *buffer_length = 0;
         return GET_BUFFER_ERROR;
     }
+    #if CIRCUITPY_AUDIOCORE_DEBUG
+    if (!rendering) {
+        audiosample_cast_obj(sample_obj)->last_played_ms = mp_hal_ticks_ms() | 1;
+    }
+    #endif
     return proto->get_buffer(MP_OBJ_TO_PTR(sample_obj), single_channel_output, channel, buffer, buffer_length);
 }
 
+#if CIRCUITPY_AUDIOCORE_DEBUG
+static uint32_t render(mp_obj_t sample_obj, uint8_t *buffer, mp_obj_t stream, uint32_t length) {
+    audiosample_reset_buffer(sample_obj, false, 0);
+    uint32_t rendered = 0;
+    while (rendered < length) {
+        uint8_t *chunk = NULL;
+        uint32_t chunk_length = 0;
+        audioio_get_buffer_result_t result = audiosample_get_buffer(sample_obj, false, 0, &chunk, &chunk_length);
+        if (result == GET_BUFFER_ERROR) {
+            break;
+        }
+        // A sample that has more to give but gives nothing would keep us here forever.
+        if (result == GET_BUFFER_MORE_DATA && chunk_length == 0) {
+            mp_raise_RuntimeError(MP_ERROR_TEXT("Audio source error"));
+        }
+        if (chunk_length > length - rendered) {
+            chunk_length = length - rendered;
+        }
+        if (buffer != NULL) {
+            memcpy(buffer + rendered, chunk, chunk_length);
+        }
+        if (stream != MP_OBJ_NULL) {
+            int err;
+            mp_stream_write_exactly(stream, chunk, chunk_length, &err);
+            if (err != 0) {
+                mp_raise_OSError(err);
+            }
+        }
+        rendered += chunk_length;
+        if (result == GET_BUFFER_DONE) {
+            break;
+        }
+        // Nothing else gets a turn while we render, so let ctrl-C and background work in.
+        RUN_BACKGROUND_TASKS;
+        mp_handle_pending(true);
+    }
+    return rendered;
+}
+
+uint32_t audiosample_render(mp_obj_t sample_obj, uint8_t *buffer, mp_obj_t stream, uint32_t length) {
+    audiosample_base_t *sample = audiosample_check(sample_obj);
+    // Rendering resets the sample, which would garble it for a player that is still pulling.
+    // last_played_ms was rounded up to odd, so it may be a tick ahead of now.
+    if (sample->last_played_ms != 0 &&
+        (uint32_t)(mp_hal_ticks_ms() + 1 - sample->last_played_ms) <= AUDIOSAMPLE_PLAYING_MS) {
+        mp_raise_RuntimeError_varg(MP_ERROR_TEXT("%q in use"), MP_QSTR_sample);
+    }
+    rendering = true;
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        uint32_t rendered = render(sample_obj, buffer, stream, length);
+        nlr_pop();
+        rendering = false;
+        return rendered;
+    }
+    rendering = false;
+    nlr_jump(nlr.ret_val);
+}
+#endif
+
 void audiosample_convert_u8m_s16s(int16_t *buffer_out, const uint8_t *buffer_in, size_t nframes) {
     for (; nframes--;) {
         int16_t sample = (*buffer_in++ - 0x80) << 8;
@@ -26,6 +26,15 @@ typedef struct audiosample_base {
     uint8_t channel_count;
     uint8_t samples_signed;
     bool single_buffer;
+    // The buffer from the last get_buffer call was filled afresh for it, so whoever called
+    // get_buffer may process the data in place rather than copying it, until the call after
+    // next. Effects that may pass their sample's buffer on update this on every call.
+    bool writable_buffers;
+    #if CIRCUITPY_AUDIOCORE_DEBUG
+    // mp_hal_ticks_ms() (made odd so that it is never 0) of the last get_buffer from anything
+    // but audiosample_render, so rendering can refuse a sample that is being played.
+    uint32_t last_played_ms;
+    #endif
 } audiosample_base_t;
 
 typedef void (*audiosample_reset_buffer_fun)(mp_obj_t,
@@ -56,6 +65,10 @@ static inline uint8_t audiosample_get_channel_count(audiosample_base_t *self) {
     return self->channel_count;
 }
 
+static inline bool audiosample_get_writable_buffers(audiosample_base_t *self) {
+    return self->writable_buffers;
+}
+
 void audiosample_reset_buffer(mp_obj_t sample_obj, bool single_channel_output, uint8_t audio_channel);
 audioio_get_buffer_result_t audiosample_get_buffer(mp_obj_t sample_obj,
     bool single_channel_output,
@@ -91,6 +104,14 @@ static inline void audiosample_get_buffer_structure_checked(mp_obj_t self_in, bo
 
 void audiosample_must_match(audiosample_base_t *self, mp_obj_t other, bool allow_mono_to_stereo);
 
+#if CIRCUITPY_AUDIOCORE_DEBUG
+// Pull up to `length` bytes from the start of `sample_obj` as fast as it will produce
+// them, copying them to `buffer` and/or writing them to `stream` when those are given.
+// Stops early when the sample finishes or reports an error. Returns the bytes produced.
+// Raises if something else is playing the sample or it stalls without producing data.
+uint32_t audiosample_render(mp_obj_t sample_obj, uint8_t *buffer, mp_obj_t stream, uint32_t length);
+#endif
+
 void audiosample_convert_u8m_s16s(int16_t *buffer_out, const uint8_t *buffer_in, size_t nframes);
 void audiosample_convert_u8s_s16s(int16_t *buffer_out, const uint8_t *buffer_in, size_t nframes);
 void audiosample_convert_s8m_s16s(int16_t *buffer_out, const int8_t *buffer_in, size_t nframes);
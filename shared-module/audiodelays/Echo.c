@@ -240,6 +240,49 @@ void common_hal_audiodelays_echo_stop(audiodelays_echo_obj_t *self) {
     return;
 }
 
+// Run the filter over `count` samples of one channel of the echo buffer, which were stored
+// unfiltered starting at `start`. They wrap around the end of the echo buffer at most once.
+static void echo_filter_writes(audiodelays_echo_obj_t *self, int16_t *echo_buffer, uint32_t echo_buf_len,
+    uint8_t channel, uint32_t start, uint32_t count, bool narrow) {
+    while (count) {
+        // A write past a just-shortened delay is followed by a wrap to the start
+        uint32_t n = start < echo_buf_len ? MIN(count, echo_buf_len - start) : 1;
+        int16_t *segment = echo_buffer + start;
+        audiofilters_process_filter_chain_block(&self->filter, self->base.channel_count, channel, segment, 1, n);
+        if (narrow) {
+            for (uint32_t i = 0; i < n; i++) {
+                segment[i] = (int8_t)segment[i];
+            }
+        }
+        count -= n;
+        start = 0;
+    }
+}
+
+// Load the sample's next buffer, resetting the sample if loop is on or clearing it when it is done
+static void echo_load_sample(audiodelays_echo_obj_t *self) {
+    if (!self->more_data) { // The sample has indicated it has no more data to play
+        if (self->loop && self->sample) { // If we are supposed to loop reset the sample to the start
+            audiosample_reset_buffer(self->sample, false, 0);
+        } else { // If we were not supposed to loop the sample, stop playing it but we still need to play the echo
+            self->sample = NULL;
+        }
+    }
+    if (self->sample) {
+        // Load another sample buffer to play
+        audioio_get_buffer_result_t result = audiosample_get_buffer(self->sample, false, 0, (uint8_t **)&self->sample_remaining_buffer, &self->sample_buffer_length);
+        if (result == GET_BUFFER_ERROR) {
+            self->sample = NULL;
+            self->sample_buffer_length = 0;
+            self->more_data = false;
+        } else {
+            // Track length in terms of words.
+            self->sample_buffer_length /= (self->base.bits_per_sample / 8);
+            self->more_data = result == GET_BUFFER_MORE_DATA;
+        }
+    }
+}
+
 audioio_get_buffer_result_t audiodelays_echo_get_buffer(audiodelays_echo_obj_t *self, bool single_channel_output, uint8_t channel,
     uint8_t **buffer, uint32_t *buffer_length) {
 
@@ -258,30 +301,44 @@ audioio_get_buffer_result_t audiodelays_echo_get_buffer(audiodelays_echo_obj_t *
     // The echo buffer is always stored as a 16-bit value internally
     int16_t *echo_buffer = (int16_t *)self->echo_buffer;
 
+    if (self->sample_buffer_length == 0) {
+        echo_load_sample(self);
+    }
+    if (self->sample != NULL && self->sample_buffer_length >= length) {
+        // A fixed mix too low to hear the echo leaves the sample untouched (and the echo
+        // buffer unfed), so hand on the sample's own buffer instead of copying it
+        if (mp_obj_is_float(self->mix.obj) && synthio_block_slot_get(&self->mix) <= MICROPY_FLOAT_CONST(0.005)) {
+            shared_bindings_synthio_lfo_tick(self->base.sample_rate, length / self->base.channel_count);
+            (void)synthio_block_slot_get(&self->decay);
+            mp_float_t f_delay_ms = synthio_block_slot_get(&self->delay_ms);
+            if (MICROPY_FLOAT_C_FUN(fabs)(self->current_delay_ms - f_delay_ms) >= self->sample_ms) {
+                recalculate_delay(self, f_delay_ms);
+            }
+            audiofilters_tick_filter_chain(&self->filter);
+
+            *buffer = self->sample_remaining_buffer;
+            *buffer_length = self->buffer_len;
+            self->sample_remaining_buffer += self->buffer_len;
+            self->sample_buffer_length -= length;
+            // The buffer is still the sample's, which may not be ours to change
+            self->base.writable_buffers = false;
+            return GET_BUFFER_MORE_DATA;
+        }
+        // The sample filled this buffer afresh for us (see writable_buffers), so mix in place
+        if (audiosample_get_writable_buffers(MP_OBJ_TO_PTR(self->sample))) {
+            word_buffer = (int16_t *)self->sample_remaining_buffer;
+            hword_buffer = (int8_t *)self->sample_remaining_buffer;
+        }
+    }
+    int8_t *output_buffer = hword_buffer;
+    // Whether ours or worked in place, the buffer is rewritten on every call
+    self->base.writable_buffers = true;
+
     // Loop over the entire length of our buffer to fill it, this may require several calls to get data from the sample
     while (length != 0) {
         // Check if there is no more sample to play, we will either load more data, reset the sample if loop is on or clear the sample
         if (self->sample_buffer_length == 0) {
-            if (!self->more_data) { // The sample has indicated it has no more data to play
-                if (self->loop && self->sample) { // If we are supposed to loop reset the sample to the start
-                    audiosample_reset_buffer(self->sample, false, 0);
-                } else { // If we were not supposed to loop the sample, stop playing it but we still need to play the echo
-                    self->sample = NULL;
-                }
-            }
-            if (self->sample) {
-                // Load another sample buffer to play
-                audioio_get_buffer_result_t result = audiosample_get_buffer(self->sample, false, 0, (uint8_t **)&self->sample_remaining_buffer, &self->sample_buffer_length);
-                if (result == GET_BUFFER_ERROR) {
-                    self->sample = NULL;
-                    self->sample_buffer_length = 0;
-                    self->more_data = false;
-                } else {
-                    // Track length in terms of words.
-                    self->sample_buffer_length /= (self->base.bits_per_sample / 8);
-                    self->more_data = result == GET_BUFFER_MORE_DATA;
-                }
-            }
+            echo_load_sample(self);
         }
 
         // Determine how many bytes we can process to our buffer, the less of the sample we have left and our buffer remaining
@@ -308,25 +365,37 @@ audioio_get_buffer_result_t audiodelays_echo_get_buffer(audiodelays_echo_obj_t *
         uint32_t echo_buf_len = self->echo_buffer_len / sizeof(uint16_t);
         uint32_t max_echo_buf_len = (self->max_echo_buffer_len >> (self->base.channel_count - 1)) / sizeof(uint16_t);
 
+        // New echo samples are stored unfiltered and the filter runs over each channel's
+        // run of them once the chunk is done, so a chunk must not read back what it wrote.
+        if (self->filter.objs_len) {
+            uint32_t max_frames = self->freq_shift ? ((echo_buf_len - 1) << 8) / self->echo_buffer_rate : echo_buf_len;
+            n = MIN(n, MAX(max_frames, 1) * self->base.channel_count);
+        }
+        uint32_t echo_start[2] = {
+            self->freq_shift ? self->echo_buffer_left_pos >> 8 : self->echo_buffer_left_pos,
+            self->freq_shift ? self->echo_buffer_right_pos >> 8 : self->echo_buffer_right_pos,
+        };
+        uint32_t echo_writes[2] = { 0, 0 };
+
         // If we have no sample keep the echo echoing
         if (self->sample == NULL) {
             if (mix <= MICROPY_FLOAT_CONST(0.01)) {  // Mix of 0 is pure sample sound. We have no sample so no sound
                 if (self->base.samples_signed) {
-                    memset(word_buffer, 0, length * (self->base.bits_per_sample / 8));
+                    memset(word_buffer, 0, n * (self->base.bits_per_sample / 8));
                 } else {
                     // For unsigned samples set to the middle which is "quiet"
                     if (MP_LIKELY(self->base.bits_per_sample == 16)) {
                         uint16_t *uword_buffer = (uint16_t *)word_buffer;
-                        while (length--) {
+                        for (uint32_t i = 0; i < n; i++) {
                             *uword_buffer++ = 32768;
                         }
                     } else {
-                        memset(hword_buffer, 128, length * (self->base.bits_per_sample / 8));
+                        memset(hword_buffer, 128, n * (self->base.bits_per_sample / 8));
                     }
                 }
             } else {
-                // Since we have no sample we can just iterate over the our entire remaining buffer and finish
-                for (uint32_t i = 0; i < length; i++) {
+                // Since we have no sample we just keep the echo echoing
+                for (uint32_t i = 0; i < n; i++) {
                     int16_t echo, word = 0;
                     uint32_t next_buffer_pos = 0;
 
@@ -340,12 +409,14 @@ audioio_get_buffer_result_t audiodelays_echo_get_buffer(audiodelays_echo_obj_t *
 
                         for (uint32_t j = echo_buffer_pos >> 8; j < next_buffer_pos >> 8; j++) {
                             word = (int16_t)(echo_buffer[(j % echo_buf_len) + echo_buffer_offset] * decay);
-                            echo_buffer[(j % echo_buf_len) + echo_buffer_offset] = (int16_t)audiofilters_process_filter_chain(&self->filter, self->base.channel_count, !!echo_buffer_offset, word);
+                            echo_buffer[(j % echo_buf_len) + echo_buffer_offset] = word;
                         }
+                        echo_writes[!!echo_buffer_offset] += (next_buffer_pos >> 8) - (echo_buffer_pos >> 8);
                     } else {
                         echo = echo_buffer[echo_buffer_pos + echo_buffer_offset];
                         word = (int16_t)(echo * decay);
-                        echo_buffer[echo_buffer_pos++ + echo_buffer_offset] = (int16_t)audiofilters_process_filter_chain(&self->filter, self->base.channel_count, !!echo_buffer_offset, word);
+                        echo_buffer[echo_buffer_pos++ + echo_buffer_offset] = word;
+                        echo_writes[!!echo_buffer_offset]++;
                     }
 
                     word = (int16_t)(echo * MIN(mix, MICROPY_FLOAT_CONST(1.0)));
@@ -377,7 +448,10 @@ audioio_get_buffer_result_t audiodelays_echo_get_buffer(audiodelays_echo_obj_t *
                 }
             }
 
-            length = 0;
+            // Update the remaining length and the buffer positions based on how much we wrote into our buffer
+            length -= n;
+            word_buffer += n;
+            hword_buffer += n;
         } else {
             // we have a sample to play and echo
             int16_t *sample_src = (int16_t *)self->sample_remaining_buffer; // for 16-bit samples
@@ -425,11 +499,13 @@ audioio_get_buffer_result_t audiodelays_echo_get_buffer(audiodelays_echo_obj_t *
                             for (uint32_t j = echo_buffer_pos >> 8; j < next_buffer_pos >> 8; j++) {
                                 word = (int32_t)(echo_buffer[(j % echo_buf_len) + echo_buffer_offset] * decay + sample_word);
                                 word = synthio_mix_down_sample(word, SYNTHIO_MIX_DOWN_SCALE(2));
-                                echo_buffer[(j % echo_buf_len) + echo_buffer_offset] = (int16_t)audiofilters_process_filter_chain(&self->filter, self->base.channel_count, !!echo_buffer_offset, word);
+                                echo_buffer[(j % echo_buf_len) + echo_buffer_offset] = (int16_t)word;
                             }
+                            echo_writes[!!echo_buffer_offset] += (next_buffer_pos >> 8) - (echo_buffer_pos >> 8);
                         } else {
                             word = synthio_mix_down_sample(word, SYNTHIO_MIX_DOWN_SCALE(2));
-                            echo_buffer[echo_buffer_pos++ + echo_buffer_offset] = (int16_t)audiofilters_process_filter_chain(&self->filter, self->base.channel_count, !!echo_buffer_offset, word);
+                            echo_buffer[echo_buffer_pos++ + echo_buffer_offset] = (int16_t)word;
+                            echo_writes[!!echo_buffer_offset]++;
                         }
                     } else {
                         if (self->freq_shift) {
@@ -437,12 +513,14 @@ audioio_get_buffer_result_t audiodelays_echo_get_buffer(audiodelays_echo_obj_t *
                                 word = (int32_t)(echo_buffer[(j % echo_buf_len) + echo_buffer_offset] * decay + sample_word);
                                 // Do not have mix_down for 8 bit so just hard cap samples into 1 byte
                                 word = MIN(MAX(word, -128), 127);
-                                echo_buffer[(j % echo_buf_len) + echo_buffer_offset] = (int8_t)audiofilters_process_filter_chain(&self->filter, self->base.channel_count, !!echo_buffer_offset, word);
+                                echo_buffer[(j % echo_buf_len) + echo_buffer_offset] = (int16_t)word;
                             }
+                            echo_writes[!!echo_buffer_offset] += (next_buffer_pos >> 8) - (echo_buffer_pos >> 8);
                         } else {
                             // Do not have mix_down for 8 bit so just hard cap samples into 1 byte
                             word = MIN(MAX(word, -128), 127);
-                            echo_buffer[echo_buffer_pos++ + echo_buffer_offset] = (int8_t)audiofilters_process_filter_chain(&self->filter, self->base.channel_count, !!echo_buffer_offset, word);
+                            echo_buffer[echo_buffer_pos++ + echo_buffer_offset] = (int16_t)word;
+                            echo_writes[!!echo_buffer_offset]++;
                         }
                     }
 
@@ -486,10 +564,18 @@ audioio_get_buffer_result_t audiodelays_echo_get_buffer(audiodelays_echo_obj_t *
             self->sample_remaining_buffer += (n * (self->base.bits_per_sample / 8));
             self->sample_buffer_length -= n;
         }
+
+        // Filter what this chunk added to the echo
+        if (self->filter.objs_len) {
+            bool narrow = self->sample != NULL && self->base.bits_per_sample == 8;
+            for (uint8_t c = 0; c < 2; c++) {
+                echo_filter_writes(self, echo_buffer + c * max_echo_buf_len, echo_buf_len, c, echo_start[c], echo_writes[c], narrow);
+            }
+        }
     }
 
     // Finally pass our buffer and length to the calling audio function
-    *buffer = (uint8_t *)self->buffer[self->last_buf_idx];
+    *buffer = (uint8_t *)output_buffer;
     *buffer_length = self->buffer_len;
 
     // Echo always returns more data but some effects may return GET_BUFFER_DONE or GET_BUFFER_ERROR (see audiocore/__init__.h)
@@ -118,6 +118,30 @@ void common_hal_audiofilters_filter_stop(audiofilters_filter_obj_t *self) {
     return;
 }
 
+// Load the sample's next buffer, resetting the sample if loop is on or clearing it when it is done
+static void filter_load_sample(audiofilters_filter_obj_t *self) {
+    if (!self->more_data) { // The sample has indicated it has no more data to play
+        if (self->loop && self->sample) { // If we are supposed to loop reset the sample to the start
+            audiosample_reset_buffer(self->sample, false, 0);
+        } else { // If we were not supposed to loop the sample, stop playing it
+            self->sample = NULL;
+        }
+    }
+    if (self->sample) {
+        // Load another sample buffer to play
+        audioio_get_buffer_result_t result = audiosample_get_buffer(self->sample, false, 0, (uint8_t **)&self->sample_remaining_buffer, &self->sample_buffer_length);
+        if (result == GET_BUFFER_ERROR) {
+            self->sample = NULL;
+            self->sample_buffer_length = 0;
+            self->more_data = false;
+        } else {
+            // Track length in terms of words.
+            self->sample_buffer_length /= (self->base.bits_per_sample / 8);
+            self->more_data = result == GET_BUFFER_MORE_DATA;
+        }
+    }
+}
+
 audioio_get_buffer_result_t audiofilters_filter_get_buffer(audiofilters_filter_obj_t *self, bool single_channel_output, uint8_t channel,
     uint8_t **buffer, uint32_t *buffer_length) {
     (void)channel;
@@ -134,30 +158,39 @@ audioio_get_buffer_result_t audiofilters_filter_get_buffer(audiofilters_filter_o
     int8_t *hword_buffer = self->buffer[self->last_buf_idx];
     uint32_t length = self->buffer_len / (self->base.bits_per_sample / 8);
 
+    if (self->sample_buffer_length == 0) {
+        filter_load_sample(self);
+    }
+    if (self->sample != NULL && self->sample_buffer_length >= length) {
+        // With no filters, or a fixed mix too low to hear them, the sample passes through
+        // untouched so hand on its own buffer instead of copying it
+        if (!self->filter.states || (mp_obj_is_float(self->mix.obj) && synthio_block_slot_get(&self->mix) <= MICROPY_FLOAT_CONST(0.01))) {
+            shared_bindings_synthio_lfo_tick(self->base.sample_rate, length / self->base.channel_count);
+            (void)synthio_block_slot_get(&self->mix);
+
+            *buffer = self->sample_remaining_buffer;
+            *buffer_length = self->buffer_len;
+            self->sample_remaining_buffer += self->buffer_len;
+            self->sample_buffer_length -= length;
+            // The buffer is still the sample's, which may not be ours to change
+            self->base.writable_buffers = false;
+            return GET_BUFFER_MORE_DATA;
+        }
+        // The sample filled this buffer afresh for us (see writable_buffers), so filter in place
+        if (audiosample_get_writable_buffers(MP_OBJ_TO_PTR(self->sample))) {
+            word_buffer = (int16_t *)self->sample_remaining_buffer;
+            hword_buffer = (int8_t *)self->sample_remaining_buffer;
+        }
+    }
+    int8_t *output_buffer = hword_buffer;
+    // Whether ours or worked in place, the buffer is rewritten on every call
+    self->base.writable_buffers = true;
+
     // Loop over the entire length of our buffer to fill it, this may require several calls to get data from the sample
     while (length != 0) {
         // Check if there is no more sample to play, we will either load more data, reset the sample if loop is on or clear the sample
         if (self->sample_buffer_length == 0) {
-            if (!self->more_data) { // The sample has indicated it has no more data to play
-                if (self->loop && self->sample) { // If we are supposed to loop reset the sample to the start
-                    audiosample_reset_buffer(self->sample, false, 0);
-                } else { // If we were not supposed to loop the sample, stop playing it
-                    self->sample = NULL;
-                }
-            }
-            if (self->sample) {
-                // Load another sample buffer to play
-                audioio_get_buffer_result_t result = audiosample_get_buffer(self->sample, false, 0, (uint8_t **)&self->sample_remaining_buffer, &self->sample_buffer_length);
-                if (result == GET_BUFFER_ERROR) {
-                    self->sample = NULL;
-                    self->sample_buffer_length = 0;
-                    self->more_data = false;
-                } else {
-                    // Track length in terms of words.
-                    self->sample_buffer_length /= (self->base.bits_per_sample / 8);
-                    self->more_data = result == GET_BUFFER_MORE_DATA;
-                }
-            }
+            filter_load_sample(self);
         }
 
         if (self->sample == NULL) {
@@ -225,12 +258,9 @@ audioio_get_buffer_result_t audiofilters_filter_get_buffer(audiofilters_filter_o
                     }
 
                     // Process biquad filters
-                    for (uint8_t j = 0; j < self->filter.objs_len; j++) {
-                        mp_obj_t filter_obj = self->filter.objs[j];
-                        common_hal_synthio_biquad_tick(filter_obj);
-                        for (uint8_t k = 0; k < self->base.channel_count; k++) {
-                            synthio_biquad_filter_samples(filter_obj, &self->filter.states[j * self->base.channel_count + k], self->filter_buffer + k * SYNTHIO_MAX_DUR, n_samples);
-                        }
+                    audiofilters_tick_filter_chain(&self->filter);
+                    for (uint8_t k = 0; k < self->base.channel_count; k++) {
+                        audiofilters_process_filter_chain_samples(&self->filter, self->base.channel_count, k, self->filter_buffer + k * SYNTHIO_MAX_DUR, n_samples);
                     }
 
                     // Mix processed signal with original sample and transfer to output buffer
@@ -265,7 +295,7 @@ audioio_get_buffer_result_t audiofilters_filter_get_buffer(audiofilters_filter_o
     }
 
     // Finally pass our buffer and length to the calling audio function
-    *buffer = (uint8_t *)self->buffer[self->last_buf_idx];
+    *buffer = (uint8_t *)output_buffer;
     *buffer_length = self->buffer_len;
 
     // Filter always returns more data but some effects may return GET_BUFFER_DONE or GET_BUFFER_ERROR (see audiocore/__init__.h)
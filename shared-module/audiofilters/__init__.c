@@ -5,6 +5,7 @@
 // SPDX-License-Identifier: MIT
 
 #include "shared-module/audiofilters/__init__.h"
+#include "shared-module/synthio/__init__.h"
 
 void audiofilters_assign_filter_chain(audiofilters_filter_chain_t *self, mp_obj_t filter_in, uint8_t channel_count) {
     size_t n_items;
@@ -44,6 +45,10 @@ void audiofilters_assign_filter_chain(audiofilters_filter_chain_t *self, mp_obj_
         n_items * channel_count);
     self->objs = items;
     self->objs_len = n_items;
+
+    if (n_items && !self->block) {
+        self->block = m_malloc_without_collect(SYNTHIO_MAX_DUR * sizeof(int32_t));
+    }
 }
 
 void audiofilters_reset_filter_chain(audiofilters_filter_chain_t *self, uint8_t channel_count) {
@@ -60,12 +65,32 @@ void audiofilters_tick_filter_chain(audiofilters_filter_chain_t *self) {
     }
 }
 
-int32_t audiofilters_process_filter_chain(audiofilters_filter_chain_t *self, uint8_t channel_count, uint8_t channel, int32_t word) {
-    // Process biquad filters
+// Filter n_samples of one channel in place. Each filter runs over the whole
+// buffer before the next one starts, rather than the chain once per sample.
+void audiofilters_process_filter_chain_samples(audiofilters_filter_chain_t *self, uint8_t channel_count, uint8_t channel, int32_t *buffer, size_t n_samples) {
     for (uint8_t j = 0; j < self->objs_len; j++) {
-        word = synthio_biquad_filter_sample(self->objs[j], &self->states[j * channel_count + channel], word);
+        synthio_biquad_filter_samples(self->objs[j], &self->states[j * channel_count + channel], buffer, n_samples);
+    }
+}
+
+// As above, for 16-bit samples `stride` apart, so that one channel of interleaved
+// audio or a run of a delay line can be filtered where it is.
+void audiofilters_process_filter_chain_block(audiofilters_filter_chain_t *self, uint8_t channel_count, uint8_t channel, int16_t *buffer, size_t stride, size_t n_samples) {
+    if (!self->objs_len) {
+        return;
+    }
+    while (n_samples) {
+        size_t n = MIN(n_samples, SYNTHIO_MAX_DUR);
+        for (size_t i = 0; i < n; i++) {
+            self->block[i] = buffer[i * stride];
+        }
+        audiofilters_process_filter_chain_samples(self, channel_count, channel, self->block, n);
+        for (size_t i = 0; i < n; i++) {
+            buffer[i * stride] = (int16_t)self->block[i];
+        }
+        buffer += n * stride;
+        n_samples -= n;
     }
-    return word;
 }
 
 void audiofilters_deinit_filter_chain(audiofilters_filter_chain_t *self) {
@@ -73,4 +98,5 @@ void audiofilters_deinit_filter_chain(audiofilters_filter_chain_t *self) {
     self->objs = NULL;
     self->objs_len = 0;
     self->states = NULL;
+    self->block = NULL;
 }
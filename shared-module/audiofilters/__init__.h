@@ -13,11 +13,13 @@ typedef struct audiofilters_filter_chain {
     mp_obj_t obj;
     mp_obj_t *objs;
     size_t objs_len;
-    biquad_filter_state *states;
+    biquad_filter_state *states; // objs_len * channel_count, one per filter and channel
+    int32_t *block; // SYNTHIO_MAX_DUR samples of working space, allocated with the first filter
 } audiofilters_filter_chain_t;
 
 void audiofilters_assign_filter_chain(audiofilters_filter_chain_t *filter_chain, mp_obj_t filter_in, uint8_t channel_count);
 void audiofilters_reset_filter_chain(audiofilters_filter_chain_t *filter_chain, uint8_t channel_count);
 void audiofilters_tick_filter_chain(audiofilters_filter_chain_t *filter_chain);
-int32_t audiofilters_process_filter_chain(audiofilters_filter_chain_t *filter_chain, uint8_t channel_count, uint8_t channel, int32_t word);
+void audiofilters_process_filter_chain_samples(audiofilters_filter_chain_t *filter_chain, uint8_t channel_count, uint8_t channel, int32_t *buffer, size_t n_samples);
+void audiofilters_process_filter_chain_block(audiofilters_filter_chain_t *filter_chain, uint8_t channel_count, uint8_t channel, int16_t *buffer, size_t stride, size_t n_samples);
 void audiofilters_deinit_filter_chain(audiofilters_filter_chain_t *self);
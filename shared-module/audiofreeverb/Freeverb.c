@@ -26,6 +26,9 @@ void common_hal_audiofreeverb_freeverb_construct(audiofreeverb_freeverb_obj_t *s
     self->base.channel_count = channel_count; // Channels can be 1 for mono or 2 for stereo
     self->base.sample_rate = sample_rate; // Sample rate for the effect, this generally needs to match all audio objects
     self->base.single_buffer = false;
+    // The dry sample is needed for the mix so we can't work in the sample's buffer,
+    // but ours are rewritten on every call so the next effect may work in them
+    self->base.writable_buffers = true;
     self->base.max_buffer_length = buffer_size;
 
     // To smooth things out as CircuitPython is doing other tasks most audio objects have a buffer
@@ -82,42 +85,43 @@ void common_hal_audiofreeverb_freeverb_construct(audiofreeverb_freeverb_obj_t *s
 
     // Set up the comb filters
     // These values come from FreeVerb and are selected for the best reverb sound
-    self->combbuffersizes[0] = self->combbuffersizes[8] = 1116;
-    self->combbuffersizes[1] = self->combbuffersizes[9] = 1188;
-    self->combbuffersizes[2] = self->combbuffersizes[10] = 1277;
-    self->combbuffersizes[3] = self->combbuffersizes[11] = 1356;
-    self->combbuffersizes[4] = self->combbuffersizes[12] = 1422;
-    self->combbuffersizes[5] = self->combbuffersizes[13] = 1491;
-    self->combbuffersizes[6] = self->combbuffersizes[14] = 1557;
-    self->combbuffersizes[7] = self->combbuffersizes[15] = 1617;
-    for (uint32_t i = 0; i < 8 * channel_count; i++) {
-        self->combbuffers[i] = m_malloc_maybe(self->combbuffersizes[i] * sizeof(uint16_t));
+    static const int16_t comb_sizes[AUDIOFREEVERB_COMBS] = { 1116, 1188, 1277, 1356, 1422, 1491, 1557, 1617 };
+    for (uint32_t i = 0; i < AUDIOFREEVERB_COMBS; i++) {
+        self->combbuffersizes[i] = comb_sizes[i] * channel_count;
+        size_t nbytes = self->combbuffersizes[i] * sizeof(uint16_t);
+        self->combbuffers[i] = m_malloc_maybe(nbytes);
         if (self->combbuffers[i] == NULL) {
             common_hal_audiofreeverb_freeverb_deinit(self);
-            m_malloc_fail(self->combbuffersizes[i]);
+            m_malloc_fail(nbytes);
         }
-        memset(self->combbuffers[i], 0, self->combbuffersizes[i]);
+        memset(self->combbuffers[i], 0, nbytes);
 
         self->combbufferindex[i] = 0;
-        self->combfitlers[i] = 0;
+        self->combfilters[i][0] = self->combfilters[i][1] = 0;
     }
 
     // Set up the allpass filters
     // These values come from FreeVerb and are selected for the best reverb sound
-    self->allpassbuffersizes[0] = self->allpassbuffersizes[4] = 556;
-    self->allpassbuffersizes[1] = self->allpassbuffersizes[5] = 441;
-    self->allpassbuffersizes[2] = self->allpassbuffersizes[6] = 341;
-    self->allpassbuffersizes[3] = self->allpassbuffersizes[7] = 225;
-    for (uint32_t i = 0; i < 4 * channel_count; i++) {
-        self->allpassbuffers[i] = m_malloc_maybe(self->allpassbuffersizes[i] * sizeof(uint16_t));
+    static const int16_t allpass_sizes[AUDIOFREEVERB_ALLPASSES] = { 556, 441, 341, 225 };
+    for (uint32_t i = 0; i < AUDIOFREEVERB_ALLPASSES; i++) {
+        self->allpassbuffersizes[i] = allpass_sizes[i] * channel_count;
+        size_t nbytes = self->allpassbuffersizes[i] * sizeof(uint16_t);
+        self->allpassbuffers[i] = m_malloc_maybe(nbytes);
         if (self->allpassbuffers[i] == NULL) {
             common_hal_audiofreeverb_freeverb_deinit(self);
-            m_malloc_fail(self->allpassbuffersizes[i]);
+            m_malloc_fail(nbytes);
         }
-        memset(self->allpassbuffers[i], 0, self->allpassbuffersizes[i]);
+        memset(self->allpassbuffers[i], 0, nbytes);
 
         self->allpassbufferindex[i] = 0;
     }
+
+    size_t sum_bytes = SYNTHIO_MAX_DUR * channel_count * sizeof(int32_t);
+    self->comb_sum = m_malloc_maybe(sum_bytes);
+    if (self->comb_sum == NULL) {
+        common_hal_audiofreeverb_freeverb_deinit(self);
+        m_malloc_fail(sum_bytes);
+    }
 }
 
 bool common_hal_audiofreeverb_freeverb_deinited(audiofreeverb_freeverb_obj_t *self) {
@@ -241,6 +245,91 @@ void common_hal_audiofreeverb_freeverb_stop(audiofreeverb_freeverb_obj_t *self)
     return;
 }
 
+// One channel_count-wide step of a comb filter: feed back the damped delay line
+// output and add it to the sum of all combs.
+static inline __attribute__((always_inline))
+void freeverb_comb_run(int16_t *line, const int16_t *input, int32_t *sum, uint32_t n, int16_t *filter,
+    int16_t damp1, int16_t damp2, int16_t feedback, const uint8_t channel_count) {
+    int16_t filter0 = filter[0], filter1 = filter[1];
+    for (uint32_t i = 0; i < n; i += channel_count) {
+        int16_t bufout = line[i];
+        sum[i] += bufout;
+        filter0 = synthio_sat16(bufout * damp2 + filter0 * damp1, 15);
+        line[i] = synthio_sat16(input[i] + synthio_sat16(filter0 * feedback, 15), 0);
+        if (channel_count == 2) {
+            bufout = line[i + 1];
+            sum[i + 1] += bufout;
+            filter1 = synthio_sat16(bufout * damp2 + filter1 * damp1, 15);
+            line[i + 1] = synthio_sat16(input[i + 1] + synthio_sat16(filter1 * feedback, 15), 0);
+        }
+    }
+    filter[0] = filter0;
+    filter[1] = filter1;
+}
+
+static inline __attribute__((always_inline))
+void freeverb_allpass_run(int16_t *line, int16_t *io, uint32_t n) {
+    for (uint32_t i = 0; i < n; i++) {
+        int16_t bufout = line[i];
+        line[i] = io[i] + (bufout >> 1); // bufout >> 1 same as bufout*0.5f
+        io[i] = synthio_sat16(bufout - io[i], 1);
+    }
+}
+
+// Replace n samples of interleaved input in io with the reverb. Rather than stepping
+// every filter once per sample, each comb and allpass filter runs across the whole
+// chunk, walking its delay line in linear runs split only where it wraps around.
+static void freeverb_process(audiofreeverb_freeverb_obj_t *self, int16_t *io, uint32_t n,
+    int16_t damp1, int16_t damp2, int16_t feedback) {
+    int32_t *sum = self->comb_sum;
+    for (uint32_t i = 0; i < n; i++) {
+        io[i] = synthio_sat16((int32_t)io[i] * 8738, 17); // Initial input scaled down so we can add reverb
+        sum[i] = 0;
+    }
+
+    // The 8 comb filters run in parallel on the input
+    for (uint32_t j = 0; j < AUDIOFREEVERB_COMBS; j++) {
+        int16_t *line = self->combbuffers[j];
+        uint32_t size = self->combbuffersizes[j];
+        uint32_t index = self->combbufferindex[j];
+        for (uint32_t i = 0; i < n;) {
+            uint32_t run = MIN(n - i, size - index);
+            if (self->base.channel_count == 2) {
+                freeverb_comb_run(line + index, io + i, sum + i, run, self->combfilters[j], damp1, damp2, feedback, 2);
+            } else {
+                freeverb_comb_run(line + index, io + i, sum + i, run, self->combfilters[j], damp1, damp2, feedback, 1);
+            }
+            i += run;
+            index += run;
+            if (index >= size) {
+                index = 0;
+            }
+        }
+        self->combbufferindex[j] = index;
+    }
+
+    for (uint32_t i = 0; i < n; i++) {
+        io[i] = synthio_sat16(sum[i] * 31457, 17); // 31457 = 0.24f with shift of 17
+    }
+
+    // The 4 allpass filters run in series on their sum
+    for (uint32_t j = 0; j < AUDIOFREEVERB_ALLPASSES; j++) {
+        int16_t *line = self->allpassbuffers[j];
+        uint32_t size = self->allpassbuffersizes[j];
+        uint32_t index = self->allpassbufferindex[j];
+        for (uint32_t i = 0; i < n;) {
+            uint32_t run = MIN(n - i, size - index);
+            freeverb_allpass_run(line + index, io + i, run);
+            i += run;
+            index += run;
+            if (index >= size) {
+                index = 0;
+            }
+        }
+        self->allpassbufferindex[j] = index;
+    }
+}
+
 audioio_get_buffer_result_t audiofreeverb_freeverb_get_buffer(audiofreeverb_freeverb_obj_t *self, bool single_channel_output, uint8_t channel,
     uint8_t **buffer, uint32_t *buffer_length) {
 
@@ -303,62 +392,34 @@ audioio_get_buffer_result_t audiofreeverb_freeverb_get_buffer(audiofreeverb_free
         audiofilters_tick_filter_chain(&self->post_filter);
 
         int16_t *sample_src = (int16_t *)self->sample_remaining_buffer;
+        uint8_t channel_count = self->base.channel_count;
 
+        // Stage the input in our output buffer so the Pre-EQ can filter it in place
         for (uint32_t i = 0; i < n; i++) {
-            int32_t sample_word = 0;
-            if (self->sample != NULL) {
-                sample_word = sample_src[i];
-            }
-
-            int32_t word, sum;
-            int16_t input, bufout, output;
-            uint32_t channel_comb_offset = 0, channel_allpass_offset = 0;
-
-            // Apply filters as Pre-EQ
-            input = (int16_t)audiofilters_process_filter_chain(&self->pre_filter, self->base.channel_count, n % self->base.channel_count, sample_word);
+            word_buffer[i] = self->sample != NULL ? sample_src[i] : 0;
+        }
+        for (uint8_t c = 0; c < channel_count; c++) {
+            audiofilters_process_filter_chain_block(&self->pre_filter, channel_count, c, word_buffer + c, channel_count, (n - c + channel_count - 1) / channel_count);
+        }
 
-            input = synthio_sat16((int32_t)input * 8738, 17); // Initial input scaled down so we can add reverb
-            sum = 0;
+        freeverb_process(self, word_buffer, n, damp1, damp2, feedback);
 
-            // Calculate each of the 8 comb buffers
-            for (uint32_t j = 0 + channel_comb_offset; j < 8 + channel_comb_offset; j++) {
-                bufout = self->combbuffers[j][self->combbufferindex[j]];
-                sum += bufout;
-                self->combfitlers[j] = synthio_sat16(bufout * damp2 + self->combfitlers[j] * damp1, 15);
-                self->combbuffers[j][self->combbufferindex[j]] = synthio_sat16(input + synthio_sat16(self->combfitlers[j] * feedback, 15), 0);
-                if (++self->combbufferindex[j] >= self->combbuffersizes[j]) {
-                    self->combbufferindex[j] = 0;
-                }
-            }
-
-            output = synthio_sat16(sum * 31457, 17); // 31457 = 0.24f with shift of 17
+        // Apply filters as Post-EQ
+        for (uint8_t c = 0; c < channel_count; c++) {
+            audiofilters_process_filter_chain_block(&self->post_filter, channel_count, c, word_buffer + c, channel_count, (n - c + channel_count - 1) / channel_count);
+        }
 
-            // Calculate each of the 4 all pass buffers
-            for (uint32_t j = 0 + channel_allpass_offset; j < 4 + channel_allpass_offset; j++) {
-                bufout = self->allpassbuffers[j][self->allpassbufferindex[j]];
-                self->allpassbuffers[j][self->allpassbufferindex[j]] = output + (bufout >> 1); // bufout >> 1 same as bufout*0.5f
-                output = synthio_sat16(bufout - output, 1);
-                if (++self->allpassbufferindex[j] >= self->allpassbuffersizes[j]) {
-                    self->allpassbufferindex[j] = 0;
-                }
+        for (uint32_t i = 0; i < n; i++) {
+            int32_t sample_word = 0;
+            if (self->sample != NULL) {
+                sample_word = sample_src[i];
             }
 
-            // Apply filters as Post-EQ
-            output = (int16_t)audiofilters_process_filter_chain(&self->post_filter, self->base.channel_count, n % self->base.channel_count, (int32_t)output);
-
-            word = output * 30; // Add some volume back don't have to saturate as next step will
+            int32_t word = word_buffer[i] * 30; // Add some volume back don't have to saturate as next step will
 
             word = synthio_sat16(sample_word * mix_sample, 15) + synthio_sat16(word * mix_effect, 15);
             word = synthio_mix_down_sample(word, SYNTHIO_MIX_DOWN_SCALE(2));
             word_buffer[i] = (int16_t)word;
-
-            if ((self->base.channel_count == 2) && (channel_comb_offset == 0)) {
-                channel_comb_offset = 8;
-                channel_allpass_offset = 4;
-            } else {
-                channel_comb_offset = 0;
-                channel_allpass_offset = 0;
-            }
         }
 
         // Update the remaining length and the buffer positions based on how much we wrote into our buffer
@@ -15,6 +15,9 @@
 
 extern const mp_obj_type_t audiofreeverb_freeverb_type;
 
+#define AUDIOFREEVERB_COMBS (8)
+#define AUDIOFREEVERB_ALLPASSES (4)
+
 typedef struct {
     audiosample_base_t base;
     synthio_block_slot_t roomsize;
@@ -33,14 +36,19 @@ typedef struct {
     bool loop;
     bool more_data;
 
-    int16_t combbuffersizes[16];
-    int16_t *combbuffers[16];
-    int16_t combbufferindex[16];
-    int16_t combfitlers[16];
+    // Each comb and allpass filter keeps the delay lines of all channels interleaved,
+    // so that a single index and wraparound serve every channel. Sizes and indexes
+    // count samples, which is frames * channel_count.
+    int16_t combbuffersizes[AUDIOFREEVERB_COMBS];
+    int16_t *combbuffers[AUDIOFREEVERB_COMBS];
+    int16_t combbufferindex[AUDIOFREEVERB_COMBS];
+    int16_t combfilters[AUDIOFREEVERB_COMBS][2];
+
+    int16_t allpassbuffersizes[AUDIOFREEVERB_ALLPASSES];
+    int16_t *allpassbuffers[AUDIOFREEVERB_ALLPASSES];
+    int16_t allpassbufferindex[AUDIOFREEVERB_ALLPASSES];
 
-    int16_t allpassbuffersizes[8];
-    int16_t *allpassbuffers[8];
-    int16_t allpassbufferindex[8];
+    int32_t *comb_sum; // SYNTHIO_MAX_DUR frames of the combs' summed output
 
     mp_obj_t sample;
 } audiofreeverb_freeverb_obj_t;
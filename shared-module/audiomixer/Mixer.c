@@ -43,6 +43,7 @@ void common_hal_audiomixer_mixer_construct(audiomixer_mixer_obj_t *self,
     self->base.channel_count = channel_count;
     self->base.sample_rate = sample_rate;
     self->base.single_buffer = false;
+    self->base.writable_buffers = true;
     self->voice_count = voice_count;
     self->base.max_buffer_length = buffer_size;
 }
@@ -23,6 +23,9 @@
 #define BITMAP_DEBUG(...) (void)0
 // #define BITMAP_DEBUG(...) mp_printf(&mp_plat_print, __VA_ARGS__)
 
+// Rows are read and written through a stack buffer of this many values at a time.
+#define ROW_CHUNK (64)
+
 void common_hal_bitmaptools_rotozoom(displayio_bitmap_t *self, int16_t ox, int16_t oy,
     int16_t dest_clip0_x, int16_t dest_clip0_y,
     int16_t dest_clip1_x, int16_t dest_clip1_y,
@@ -186,18 +189,28 @@ void common_hal_bitmaptools_rotozoom(displayio_bitmap_t *self, int16_t ox, int16
     displayio_area_t dirty_area = {minx, miny, maxx + 1, maxy + 1, NULL};
     displayio_bitmap_set_dirty_area(self, &dirty_area);
 
+    uint32_t values[ROW_CHUNK];
     for (y = miny; y <= maxy; y++) {
         mp_float_t u = rowu + minx * duRow;
         mp_float_t v = rowv + minx * dvRow;
-        for (x = minx; x <= maxx; x++) {
-            if (u >= source_clip0_x && u < source_clip1_x && v >= source_clip0_y && v < source_clip1_y) {
-                uint32_t c = common_hal_displayio_bitmap_get_pixel(source, (int)u, (int)v);
-                if ((skip_index_none) || (c != skip_index)) {
-                    displayio_bitmap_write_pixel(self, x, y, c);
+        for (x = minx; x <= maxx; x += ROW_CHUNK) {
+            uint16_t count = MIN(ROW_CHUNK, maxx + 1 - x);
+            bool changed = false;
+            displayio_bitmap_read_row(self, x, y, values, count);
+            for (uint16_t i = 0; i < count; i++) {
+                if (u >= source_clip0_x && u < source_clip1_x && v >= source_clip0_y && v < source_clip1_y) {
+                    uint32_t c = common_hal_displayio_bitmap_get_pixel(source, (int)u, (int)v);
+                    if ((skip_index_none) || (c != skip_index)) {
+                        values[i] = c;
+                        changed = true;
+                    }
                 }
+                u += duRow;
+                v += dvRow;
+            }
+            if (changed) {
+                displayio_bitmap_write_row(self, x, y, values, count);
             }
-            u += duRow;
-            v += dvRow;
         }
         rowu += duCol;
         rowv += dvCol;
@@ -208,12 +221,20 @@ void common_hal_bitmaptools_replace_color(displayio_bitmap_t *destination,
     uint32_t old_color,
     uint32_t new_color) {
 
-    int16_t x, y;
-    for (x = 0; x < destination->width; x++) {
-        for (y = 0; y < destination->height; y++) {
-            uint32_t pixel_val = common_hal_displayio_bitmap_get_pixel(destination, x, y);
-            if (pixel_val == old_color) {
-                displayio_bitmap_write_pixel(destination, x, y, new_color);
+    uint32_t values[ROW_CHUNK];
+    for (int16_t y = 0; y < destination->height; y++) {
+        for (int16_t x = 0; x < destination->width; x += ROW_CHUNK) {
+            uint16_t count = MIN(ROW_CHUNK, destination->width - x);
+            bool changed = false;
+            displayio_bitmap_read_row(destination, x, y, values, count);
+            for (uint16_t i = 0; i < count; i++) {
+                if (values[i] == old_color) {
+                    values[i] = new_color;
+                    changed = true;
+                }
+            }
+            if (changed) {
+                displayio_bitmap_write_row(destination, x, y, values, count);
             }
         }
     }
@@ -236,10 +257,13 @@ void common_hal_bitmaptools_fill_region(displayio_bitmap_t *destination,
     // update the dirty rectangle
     displayio_bitmap_set_dirty_area(destination, &area);
 
-    int16_t x, y;
-    for (x = area.x1; x < area.x2; x++) {
-        for (y = area.y1; y < area.y2; y++) {
-            displayio_bitmap_write_pixel(destination, x, y, value);
+    uint32_t values[ROW_CHUNK];
+    for (size_t i = 0; i < ROW_CHUNK; i++) {
+        values[i] = value;
+    }
+    for (int16_t y = area.y1; y < area.y2; y++) {
+        for (int16_t x = area.x1; x < area.x2; x += ROW_CHUNK) {
+            displayio_bitmap_write_row(destination, x, y, values, MIN(ROW_CHUNK, area.x2 - x));
         }
     }
 }
@@ -545,28 +569,37 @@ void common_hal_bitmaptools_draw_polygon(displayio_bitmap_t *destination, void *
 
 void common_hal_bitmaptools_arrayblit(displayio_bitmap_t *self, void *data, int element_size, int x1, int y1, int x2, int y2, bool skip_specified, uint32_t skip_value) {
     uint32_t mask = (1 << common_hal_displayio_bitmap_get_bits_per_value(self)) - 1;
+    uint32_t values[ROW_CHUNK];
 
     for (int y = y1; y < y2; y++) {
-        for (int x = x1; x < x2; x++) {
-            uint32_t value;
-            switch (element_size) {
-                default:
-                case 1:
-                    value = *(uint8_t *)data;
-                    data = (void *)((uint8_t *)data + 1);
-                    break;
-                case 2:
-                    value = *(uint16_t *)data;
-                    data = (void *)((uint16_t *)data + 1);
-                    break;
-                case 4:
-                    value = *(uint32_t *)data;
-                    data = (void *)((uint32_t *)data + 1);
-                    break;
+        for (int x = x1; x < x2; x += ROW_CHUNK) {
+            uint16_t count = MIN(ROW_CHUNK, x2 - x);
+            // Skipped pixels keep the value already in the bitmap.
+            if (skip_specified) {
+                displayio_bitmap_read_row(self, x, y, values, count);
             }
-            if (!skip_specified || value != skip_value) {
-                displayio_bitmap_write_pixel(self, x, y, value & mask);
+            for (uint16_t i = 0; i < count; i++) {
+                uint32_t value;
+                switch (element_size) {
+                    default:
+                    case 1:
+                        value = *(uint8_t *)data;
+                        data = (void *)((uint8_t *)data + 1);
+                        break;
+                    case 2:
+                        value = *(uint16_t *)data;
+                        data = (void *)((uint16_t *)data + 1);
+                        break;
+                    case 4:
+                        value = *(uint32_t *)data;
+                        data = (void *)((uint32_t *)data + 1);
+                        break;
+                }
+                if (!skip_specified || value != skip_value) {
+                    values[i] = value & mask;
+                }
             }
+            displayio_bitmap_write_row(self, x, y, values, count);
         }
     }
     displayio_area_t area = { x1, y1, x2, y2, NULL };
@@ -587,6 +620,7 @@ void common_hal_bitmaptools_readinto(displayio_bitmap_t *self, mp_obj_t *file, i
     size_t rowsize_in_u16 = (rowsize + sizeof(uint16_t) - 1) / sizeof(uint16_t);
 
     for (int y = 0; y < self->height; y++) {
+        uint32_t values[ROW_CHUNK];
         uint32_t rowdata32[rowsize_in_u32];
         uint16_t *rowdata16 = (uint16_t *)rowdata32;
         uint8_t *rowdata8 = (uint8_t *)rowdata32;
@@ -658,7 +692,10 @@ void common_hal_bitmaptools_readinto(displayio_bitmap_t *self, mp_obj_t *file, i
                     value = rowdata32[x];
                     break;
             }
-            displayio_bitmap_write_pixel(self, x, y_draw, value & mask);
+            values[x % ROW_CHUNK] = value & mask;
+            if (x % ROW_CHUNK == ROW_CHUNK - 1 || x == self->width - 1) {
+                displayio_bitmap_write_row(self, x - x % ROW_CHUNK, y_draw, values, x % ROW_CHUNK + 1);
+            }
         }
     }
 }
@@ -746,23 +783,13 @@ static void fill_row(displayio_bitmap_t *bitmap, int swap, int16_t *luminance_da
 }
 
 static void write_pixels(displayio_bitmap_t *bitmap, int y, bool *data) {
-    if (bitmap->bits_per_value == 1) {
-        uint32_t *pixel_data = (uint32_t *)(bitmap->data + bitmap->stride * y);
-        for (int i = 0; i < bitmap->width; i++) {
-            uint32_t p = 0;
-            for (int j = 0; j < 32; j++) {
-                p = (p << 1);
-                if (*data++) {
-                    p |= 1;
-                }
-            }
-            *pixel_data++ = p;
-        }
-    } else {
-        uint16_t *pixel_data = (uint16_t *)(bitmap->data + bitmap->stride * y);
-        for (int i = 0; i < bitmap->width; i++) {
-            *pixel_data++ = *data++ ? 65535 : 0;
+    uint32_t values[ROW_CHUNK];
+    for (int x = 0; x < bitmap->width; x += ROW_CHUNK) {
+        uint16_t count = MIN(ROW_CHUNK, bitmap->width - x);
+        for (uint16_t i = 0; i < count; i++) {
+            values[i] = data[x + i] ? bitmap->bitmask : 0;
         }
+        displayio_bitmap_write_row(bitmap, x, y, values, count);
     }
 }
 
@@ -785,8 +812,8 @@ void common_hal_bitmaptools_dither(displayio_bitmap_t *dest_bitmap, displayio_bi
     int16_t *rows[3] = {
         rowdata + info->mx, rowdata + width + info->mx * 3, rowdata + 2 * width + info->mx * 5
     };
-    // out holds one output row of pixels, and is padded to be a multiple of 32 so that the 1bpp storage loop can be simplified
-    bool out[(width + 31) / 32 * 32];
+    // out holds one output row of pixels
+    bool out[width];
 
     fill_row(source_bitmap, swap, rows[0], 0, info->mx);
     fill_row(source_bitmap, swap, rows[1], 1, info->mx);
@@ -1116,34 +1143,53 @@ void common_hal_bitmaptools_blit(displayio_bitmap_t *destination, displayio_bitm
         y_reverse = true;
     }
 
-    // simplest version - use internal functions for get/set pixels
-    for (int16_t i = 0; i < (x2 - x1); i++) {
-
-        const int xs_index = x_reverse ? ((x2) - i - 1) : x1 + i; // x-index into the source bitmap
-        const int xd_index = x_reverse ? ((x + (x2 - x1)) - i - 1) : x + i; // x-index into the destination bitmap
-
-        if ((xd_index >= 0) && (xd_index < destination->width)) {
-            for (int16_t j = 0; j < (y2 - y1); j++) {
-
-                const int ys_index = y_reverse ? ((y2) - j - 1) : y1 + j;  // y-index into the source bitmap
-                const int yd_index = y_reverse ? ((y + (y2 - y1)) - j - 1) : y + j; // y-index into the destination bitmap
-
-                if ((yd_index >= 0) && (yd_index < destination->height)) {
-                    uint32_t value = common_hal_displayio_bitmap_get_pixel(source, xs_index, ys_index);
-                    if (skip_dest_index_none) { // if skip_dest_index is none, then only check source skip
-                        if ((skip_source_index_none) || (value != skip_source_index)) {   // write if skip_value_none is True
-                            displayio_bitmap_write_pixel(destination, xd_index, yd_index, value);
-                        }
-                    } else { // check dest_value index against skip_dest_index and skip if they match
-                        uint32_t dest_value = common_hal_displayio_bitmap_get_pixel(destination, xd_index, yd_index);
-                        if (dest_value != skip_dest_index) {
-                            if ((skip_source_index_none) || (value != skip_source_index)) {   // write if skip_value_none is True
-                                displayio_bitmap_write_pixel(destination, xd_index, yd_index, value);
-                            }
-                        }
-                    }
+    // Clip the copy to the destination, in offsets from the top left of the region.
+    const int16_t start_x = MAX(0, -x);
+    const int16_t end_x = MIN(x2 - x1, destination->width - x);
+    const int16_t start_y = MAX(0, -y);
+    const int16_t end_y = MIN(y2 - y1, destination->height - y);
+    if (start_x >= end_x || start_y >= end_y) {
+        return;
+    }
+
+    const bool skip = !skip_source_index_none || !skip_dest_index_none;
+    // Rows of whole bytes with nothing skipped are copied as they are.
+    const uint8_t copy_bytes = (!skip && source->bits_per_value == destination->bits_per_value) ? source->bits_per_value / 8 : 0;
+    uint32_t values[ROW_CHUNK];
+    uint32_t dest_values[ROW_CHUNK];
+
+    for (int16_t n = 0; n < end_y - start_y; n++) {
+        const int16_t j = y_reverse ? end_y - 1 - n : start_y + n;
+        const int ys_index = y1 + j; // y-index into the source bitmap
+        const int yd_index = y + j; // y-index into the destination bitmap
+
+        if (copy_bytes > 0) {
+            memmove((uint8_t *)(destination->data + yd_index * destination->stride) + (x + start_x) * copy_bytes,
+                (uint8_t *)(source->data + ys_index * source->stride) + (x1 + start_x) * copy_bytes,
+                (end_x - start_x) * copy_bytes);
+            continue;
+        }
+
+        // Each run is read completely before it is written so the copy direction only matters
+        // between runs.
+        for (int16_t m = start_x; m < end_x; m += ROW_CHUNK) {
+            const uint16_t count = MIN(ROW_CHUNK, end_x - m);
+            const int16_t i = x_reverse ? end_x - (m - start_x) - count : m;
+            displayio_bitmap_read_row(source, x1 + i, ys_index, values, count);
+            if (!skip) {
+                displayio_bitmap_write_row(destination, x + i, yd_index, values, count);
+                continue;
+            }
+            displayio_bitmap_read_row(destination, x + i, yd_index, dest_values, count);
+            for (uint16_t k = 0; k < count; k++) {
+                // skip pixels that match skip_source_index in the source or skip_dest_index in
+                // the destination
+                if ((skip_source_index_none || values[k] != skip_source_index) &&
+                    (skip_dest_index_none || dest_values[k] != skip_dest_index)) {
+                    dest_values[k] = values[k];
                 }
             }
+            displayio_bitmap_write_row(destination, x + i, yd_index, dest_values, count);
         }
     }
 }
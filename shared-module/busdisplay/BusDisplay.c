@@ -201,12 +201,17 @@ mp_obj_t common_hal_busdisplay_busdisplay_get_root_group(busdisplay_busdisplay_o
     return self->core.current_group;
 }
 
+// Overhead of sending one rectangle over the bus, in pixels. Covers the column, row and write
+// commands plus the transaction around them.
+#define BUSDISPLAY_REFRESH_SETUP_COST (64)
+
 static const displayio_area_t *_get_refresh_areas(busdisplay_busdisplay_obj_t *self) {
     if (self->core.full_refresh) {
         self->core.area.next = NULL;
         return &self->core.area;
     } else if (self->core.current_group != NULL) {
-        return displayio_group_get_refresh_areas(self->core.current_group, NULL);
+        return displayio_display_core_plan_refresh_areas(&self->core,
+            displayio_group_get_refresh_areas(self->core.current_group, NULL), BUSDISPLAY_REFRESH_SETUP_COST);
     }
     return NULL;
 }
@@ -60,6 +60,22 @@ void common_hal_displayio_bitmap_construct_from_buffer(displayio_bitmap_t *self,
     self->dirty_area.x2 = width;
     self->dirty_area.y1 = 0;
     self->dirty_area.y2 = height;
+
+    #if DISPLAYIO_BITMAP_DIRTY_TILE_SIZE > 0
+    self->dirty_tiles = NULL;
+    self->dirty_tiles_width = (width + DISPLAYIO_BITMAP_DIRTY_TILE_SIZE - 1) / DISPLAYIO_BITMAP_DIRTY_TILE_SIZE;
+    self->dirty_tiles_stride = (self->dirty_tiles_width + 31) / 32;
+    uint32_t tiles_height = (height + DISPLAYIO_BITMAP_DIRTY_TILE_SIZE - 1) / DISPLAYIO_BITMAP_DIRTY_TILE_SIZE;
+    // A single tile is no finer than the bounding area. Caller supplied buffers may live outside
+    // the VM heap (the supervisor's glyph cache uses port memory), so only track tiles when the
+    // bitmap owns its GC allocated data.
+    if (!read_only && self->data_alloc && self->dirty_tiles_width * tiles_height > 1) {
+        size_t size = self->dirty_tiles_stride * tiles_height * sizeof(uint32_t);
+        self->dirty_tiles = m_malloc_without_collect(size);
+        // Everything starts dirty, like dirty_area.
+        memset(self->dirty_tiles, 0xff, size);
+    }
+    #endif
 }
 
 void common_hal_displayio_bitmap_deinit(displayio_bitmap_t *self) {
@@ -67,6 +83,12 @@ void common_hal_displayio_bitmap_deinit(displayio_bitmap_t *self) {
         gc_free(self->data);
     }
     self->data = NULL;
+    #if DISPLAYIO_BITMAP_DIRTY_TILE_SIZE > 0
+    if (self->dirty_tiles != NULL) {
+        gc_free(self->dirty_tiles);
+        self->dirty_tiles = NULL;
+    }
+    #endif
 }
 
 bool common_hal_displayio_bitmap_deinited(displayio_bitmap_t *self) {
@@ -116,9 +138,27 @@ void displayio_bitmap_set_dirty_area(displayio_bitmap_t *self, const displayio_a
 
     displayio_area_t area = *dirty_area;
     displayio_area_canon(&area);
-    displayio_area_union(&area, &self->dirty_area, &area);
     displayio_area_t bitmap_area = {0, 0, self->width, self->height, NULL};
-    displayio_area_compute_overlap(&area, &bitmap_area, &self->dirty_area);
+    if (!displayio_area_compute_overlap(&area, &bitmap_area, &area)) {
+        return;
+    }
+    displayio_area_union(&area, &self->dirty_area, &self->dirty_area);
+
+    #if DISPLAYIO_BITMAP_DIRTY_TILE_SIZE > 0
+    if (self->dirty_tiles == NULL) {
+        return;
+    }
+    uint16_t tx1 = area.x1 / DISPLAYIO_BITMAP_DIRTY_TILE_SIZE;
+    uint16_t tx2 = (area.x2 - 1) / DISPLAYIO_BITMAP_DIRTY_TILE_SIZE;
+    uint16_t ty1 = area.y1 / DISPLAYIO_BITMAP_DIRTY_TILE_SIZE;
+    uint16_t ty2 = (area.y2 - 1) / DISPLAYIO_BITMAP_DIRTY_TILE_SIZE;
+    for (uint16_t ty = ty1; ty <= ty2; ty++) {
+        uint32_t *row = self->dirty_tiles + ty * self->dirty_tiles_stride;
+        for (uint16_t tx = tx1; tx <= tx2; tx++) {
+            row[tx / 32] |= 1u << (tx % 32);
+        }
+    }
+    #endif
 }
 
 void displayio_bitmap_write_pixel(displayio_bitmap_t *self, int16_t x, int16_t y, uint32_t value) {
@@ -155,6 +195,107 @@ void displayio_bitmap_write_pixel(displayio_bitmap_t *self, int16_t x, int16_t y
     }
 }
 
+// Values narrower than a byte are packed with the first one in the most significant bits. Bytes are
+// only touched while there are values left in them so runs ending at the end of the data are safe.
+#define READ_PACKED_ROW(bits) do { \
+        const uint8_t *src = row + x / (8 / bits); \
+        int shift = 8 - bits - (x % (8 / bits)) * bits; \
+        uint8_t packed = *src; \
+        for (uint16_t i = 0; i < count; i++) { \
+            if (shift < 0) { \
+                shift = 8 - bits; \
+                packed = *++src; \
+            } \
+            values[i] = (packed >> shift) & ((1 << bits) - 1); \
+            shift -= bits; \
+        } \
+} while (0)
+
+#define WRITE_PACKED_ROW(bits) do { \
+        uint8_t *dst = row + x / (8 / bits); \
+        int shift = 8 - bits - (x % (8 / bits)) * bits; \
+        uint8_t packed = *dst; \
+        for (uint16_t i = 0; i < count; i++) { \
+            if (shift < 0) { \
+                *dst = packed; \
+                shift = 8 - bits; \
+                packed = *++dst; \
+            } \
+            packed = (packed & ~(((1 << bits) - 1) << shift)) | ((values[i] & ((1 << bits) - 1)) << shift); \
+            shift -= bits; \
+        } \
+        *dst = packed; \
+} while (0)
+
+void displayio_bitmap_read_row(const displayio_bitmap_t *self, int16_t x, int16_t y, uint32_t *values, uint16_t count) {
+    if (count == 0) {
+        return;
+    }
+    const uint8_t *row = (const uint8_t *)(self->data + y * self->stride);
+    switch (self->bits_per_value) {
+        case 1:
+            READ_PACKED_ROW(1);
+            break;
+        case 2:
+            READ_PACKED_ROW(2);
+            break;
+        case 4:
+            READ_PACKED_ROW(4);
+            break;
+        case 8:
+            for (uint16_t i = 0; i < count; i++) {
+                values[i] = row[x + i];
+            }
+            break;
+        case 16: {
+            const uint16_t *src = (const uint16_t *)row + x;
+            for (uint16_t i = 0; i < count; i++) {
+                values[i] = src[i];
+            }
+            break;
+        }
+        case 32:
+            memcpy(values, (const uint32_t *)row + x, count * sizeof(uint32_t));
+            break;
+    }
+}
+
+void displayio_bitmap_write_row(displayio_bitmap_t *self, int16_t x, int16_t y, const uint32_t *values, uint16_t count) {
+    if (self->read_only) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Read-only"));
+    }
+    if (count == 0) {
+        return;
+    }
+    uint8_t *row = (uint8_t *)(self->data + y * self->stride);
+    switch (self->bits_per_value) {
+        case 1:
+            WRITE_PACKED_ROW(1);
+            break;
+        case 2:
+            WRITE_PACKED_ROW(2);
+            break;
+        case 4:
+            WRITE_PACKED_ROW(4);
+            break;
+        case 8:
+            for (uint16_t i = 0; i < count; i++) {
+                row[x + i] = values[i];
+            }
+            break;
+        case 16: {
+            uint16_t *dst = (uint16_t *)row + x;
+            for (uint16_t i = 0; i < count; i++) {
+                dst[i] = values[i];
+            }
+            break;
+        }
+        case 32:
+            memcpy((uint32_t *)row + x, values, count * sizeof(uint32_t));
+            break;
+    }
+}
+
 void common_hal_displayio_bitmap_set_pixel(displayio_bitmap_t *self, int16_t x, int16_t y, uint32_t value) {
     if (self->read_only) {
         mp_raise_RuntimeError(MP_ERROR_TEXT("Read-only"));
@@ -168,10 +309,79 @@ void common_hal_displayio_bitmap_set_pixel(displayio_bitmap_t *self, int16_t x,
 
 }
 
+#if DISPLAYIO_BITMAP_DIRTY_TILE_SIZE > 0
+// Adds a run of dirty tiles, in tile units, to the rectangles found so far. Runs that continue a
+// rectangle from the row above extend it. Once all rectangles are in use, the run is merged into
+// the one that grows the least.
+static size_t _add_dirty_run(displayio_area_t *rects, size_t count, const displayio_area_t *run) {
+    for (size_t i = 0; i < count; i++) {
+        if (rects[i].y2 == run->y1 && rects[i].x1 == run->x1 && rects[i].x2 == run->x2) {
+            rects[i].y2 = run->y2;
+            return count;
+        }
+    }
+    if (count < DISPLAYIO_BITMAP_DIRTY_RECTS) {
+        displayio_area_copy(run, &rects[count]);
+        return count + 1;
+    }
+    size_t best = 0;
+    uint32_t best_growth = UINT32_MAX;
+    for (size_t i = 0; i < count; i++) {
+        displayio_area_t merged;
+        displayio_area_union(&rects[i], run, &merged);
+        uint32_t growth = displayio_area_size(&merged) - displayio_area_size(&rects[i]);
+        if (growth < best_growth) {
+            best = i;
+            best_growth = growth;
+        }
+    }
+    displayio_area_union(&rects[best], run, &rects[best]);
+    return count;
+}
+#endif
+
 displayio_area_t *displayio_bitmap_get_refresh_areas(displayio_bitmap_t *self, displayio_area_t *tail) {
     if (self->dirty_area.x1 == self->dirty_area.x2 || self->read_only) {
         return tail;
     }
+    #if DISPLAYIO_BITMAP_DIRTY_TILE_SIZE > 0
+    if (self->dirty_tiles != NULL) {
+        displayio_area_t *rects = self->dirty_rects;
+        size_t count = 0;
+        uint16_t ty1 = self->dirty_area.y1 / DISPLAYIO_BITMAP_DIRTY_TILE_SIZE;
+        uint16_t ty2 = (self->dirty_area.y2 - 1) / DISPLAYIO_BITMAP_DIRTY_TILE_SIZE;
+        uint16_t tx1 = self->dirty_area.x1 / DISPLAYIO_BITMAP_DIRTY_TILE_SIZE;
+        uint16_t tx2 = (self->dirty_area.x2 - 1) / DISPLAYIO_BITMAP_DIRTY_TILE_SIZE + 1;
+        for (uint16_t ty = ty1; ty <= ty2; ty++) {
+            const uint32_t *row = self->dirty_tiles + ty * self->dirty_tiles_stride;
+            uint16_t tx = tx1;
+            while (tx < tx2) {
+                if ((row[tx / 32] & (1u << (tx % 32))) == 0) {
+                    tx++;
+                    continue;
+                }
+                displayio_area_t run = {tx, ty, tx, ty + 1, NULL};
+                while (tx < tx2 && (row[tx / 32] & (1u << (tx % 32))) != 0) {
+                    tx++;
+                }
+                run.x2 = tx;
+                count = _add_dirty_run(rects, count, &run);
+            }
+        }
+        if (count > 0) {
+            displayio_area_t bitmap_area = {0, 0, self->width, self->height, NULL};
+            for (size_t i = 0; i < count; i++) {
+                rects[i].x1 *= DISPLAYIO_BITMAP_DIRTY_TILE_SIZE;
+                rects[i].y1 *= DISPLAYIO_BITMAP_DIRTY_TILE_SIZE;
+                rects[i].x2 *= DISPLAYIO_BITMAP_DIRTY_TILE_SIZE;
+                rects[i].y2 *= DISPLAYIO_BITMAP_DIRTY_TILE_SIZE;
+                displayio_area_compute_overlap(&rects[i], &bitmap_area, &rects[i]);
+                rects[i].next = i + 1 < count ? &rects[i + 1] : tail;
+            }
+            return rects;
+        }
+    }
+    #endif
     self->dirty_area.next = tail;
     return &self->dirty_area;
 }
@@ -180,6 +390,12 @@ void displayio_bitmap_finish_refresh(displayio_bitmap_t *self) {
     if (self->read_only) {
         return;
     }
+    #if DISPLAYIO_BITMAP_DIRTY_TILE_SIZE > 0
+    if (self->dirty_tiles != NULL && self->dirty_area.x1 != self->dirty_area.x2) {
+        uint32_t tiles_height = (self->height + DISPLAYIO_BITMAP_DIRTY_TILE_SIZE - 1) / DISPLAYIO_BITMAP_DIRTY_TILE_SIZE;
+        memset(self->dirty_tiles, 0, self->dirty_tiles_stride * tiles_height * sizeof(uint32_t));
+    }
+    #endif
     self->dirty_area.x1 = 0;
     self->dirty_area.x2 = 0;
 }
@@ -12,6 +12,17 @@
 #include "py/obj.h"
 #include "shared-module/displayio/area.h"
 
+// Writes are tracked per square tile of this many pixels so that sparse updates only refresh the
+// tiles they touch. Zero tracks a single bounding area instead.
+#ifndef DISPLAYIO_BITMAP_DIRTY_TILE_SIZE
+#define DISPLAYIO_BITMAP_DIRTY_TILE_SIZE (16)
+#endif
+
+// Maximum number of rectangles the dirty tiles are coalesced into for a refresh.
+#ifndef DISPLAYIO_BITMAP_DIRTY_RECTS
+#define DISPLAYIO_BITMAP_DIRTY_RECTS (4)
+#endif
+
 typedef struct {
     mp_obj_base_t base;
     uint16_t width;
@@ -21,7 +32,13 @@ typedef struct {
     uint8_t bits_per_value;
     uint8_t x_shift;
     size_t x_mask;
-    displayio_area_t dirty_area;
+    displayio_area_t dirty_area; // Bounds of all dirty tiles.
+    #if DISPLAYIO_BITMAP_DIRTY_TILE_SIZE > 0
+    uint32_t *dirty_tiles; // One bit per tile, row by row. NULL when only dirty_area is tracked.
+    uint16_t dirty_tiles_width;
+    uint16_t dirty_tiles_stride; // uint32_t's
+    displayio_area_t dirty_rects[DISPLAYIO_BITMAP_DIRTY_RECTS];
+    #endif
     uint16_t bitmask;
     bool read_only;
     bool data_alloc; // did bitmap allocate data or someone else
@@ -31,3 +48,8 @@ void displayio_bitmap_finish_refresh(displayio_bitmap_t *self);
 displayio_area_t *displayio_bitmap_get_refresh_areas(displayio_bitmap_t *self, displayio_area_t *tail);
 void displayio_bitmap_set_dirty_area(displayio_bitmap_t *self, const displayio_area_t *area);
 void displayio_bitmap_write_pixel(displayio_bitmap_t *self, int16_t x, int16_t y, uint32_t value);
+
+// Bulk access to a run of count values starting at (x, y), which must lie within the bitmap. Like
+// displayio_bitmap_write_pixel, writing doesn't update the dirty area.
+void displayio_bitmap_read_row(const displayio_bitmap_t *self, int16_t x, int16_t y, uint32_t *values, uint16_t count);
+void displayio_bitmap_write_row(displayio_bitmap_t *self, int16_t x, int16_t y, const uint32_t *values, uint16_t count);
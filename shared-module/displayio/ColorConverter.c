@@ -376,6 +376,10 @@ void displayio_convert_color(const _displayio_colorspace_t *colorspace, bool dit
     output_color->opaque = false;
 }
 
+bool displayio_colorconverter_is_opaque(displayio_colorconverter_t *self) {
+    return self->transparent_color == NO_TRANSPARENT_COLOR;
+}
+
 void displayio_colorconverter_convert(displayio_colorconverter_t *self, const _displayio_colorspace_t *colorspace, const displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_color) {
     uint32_t pixel = input_pixel->pixel;
 
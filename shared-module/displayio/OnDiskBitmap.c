@@ -158,8 +158,41 @@ void common_hal_displayio_ondiskbitmap_construct(displayio_ondiskbitmap_t *self,
         self->stride = (bit_stride / 8);
     }
 
+    #if DISPLAYIO_ONDISKBITMAP_CACHE_ROWS > 0
+    // Without the cache every pixel is read on its own, so running out of memory isn't fatal.
+    size_t cache_rows = MIN(DISPLAYIO_ONDISKBITMAP_CACHE_ROWS, self->height);
+    self->row_cache = m_malloc_maybe_without_collect(cache_rows * self->stride);
+    self->row_cache_first = 0;
+    self->row_cache_rows = 0;
+    #endif
 }
 
+#if DISPLAYIO_ONDISKBITMAP_CACHE_ROWS > 0
+// Returns the cached copy of the given row of the file, refilling the cache with the strip of rows
+// around it when needed. Returns NULL when the pixel must be read from the file instead.
+static const uint8_t *cached_row(displayio_ondiskbitmap_t *self, uint16_t row) {
+    if (self->row_cache == NULL) {
+        return NULL;
+    }
+    if ((uint16_t)(row - self->row_cache_first) >= self->row_cache_rows) {
+        uint16_t first = row - row % DISPLAYIO_ONDISKBITMAP_CACHE_ROWS;
+        uint16_t rows = MIN(DISPLAYIO_ONDISKBITMAP_CACHE_ROWS, self->height - first);
+        UINT size = rows * self->stride;
+        UINT bytes_read;
+        self->row_cache_rows = 0;
+        if (f_lseek(&self->file->fp, self->data_offset + first * self->stride) != FR_OK ||
+            f_read(&self->file->fp, self->row_cache, size, &bytes_read) != FR_OK) {
+            return NULL;
+        }
+        // A truncated file reads as zeros, like reading the pixels one at a time.
+        memset(self->row_cache + bytes_read, 0, size - bytes_read);
+        self->row_cache_first = first;
+        self->row_cache_rows = rows;
+    }
+    return self->row_cache + (row - self->row_cache_first) * self->stride;
+}
+#endif
+
 
 uint32_t common_hal_displayio_ondiskbitmap_get_pixel(displayio_ondiskbitmap_t *self,
     int16_t x, int16_t y) {
@@ -170,16 +203,25 @@ uint32_t common_hal_displayio_ondiskbitmap_get_pixel(displayio_ondiskbitmap_t *s
     uint32_t location;
     uint8_t bytes_per_pixel = (self->bits_per_pixel / 8)  ? (self->bits_per_pixel / 8) : 1;
     uint8_t pixels_per_byte = 8 / self->bits_per_pixel;
+    uint16_t row = self->height - y - 1;
     if (pixels_per_byte == 0) {
-        location = self->data_offset + (self->height - y - 1) * self->stride + x * bytes_per_pixel;
+        location = x * bytes_per_pixel;
     } else {
-        location = self->data_offset + (self->height - y - 1) * self->stride + x / pixels_per_byte;
+        location = x / pixels_per_byte;
     }
-    // We don't cache here because the underlying FS caches sectors.
-    f_lseek(&self->file->fp, location);
-    UINT bytes_read;
     uint32_t pixel_data = 0;
-    uint32_t result = f_read(&self->file->fp, &pixel_data, bytes_per_pixel, &bytes_read);
+    uint32_t result = FR_OK;
+    #if DISPLAYIO_ONDISKBITMAP_CACHE_ROWS > 0
+    const uint8_t *row_data = cached_row(self, row);
+    if (row_data != NULL) {
+        memcpy(&pixel_data, row_data + location, bytes_per_pixel);
+    } else
+    #endif
+    {
+        f_lseek(&self->file->fp, self->data_offset + row * self->stride + location);
+        UINT bytes_read;
+        result = f_read(&self->file->fp, &pixel_data, bytes_per_pixel, &bytes_read);
+    }
     if (result == FR_OK) {
         uint32_t tmp = 0;
         uint8_t red;
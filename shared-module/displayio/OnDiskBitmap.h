@@ -13,6 +13,12 @@
 
 #include "extmod/vfs_fat.h"
 
+// Number of consecutive rows of pixel data kept in RAM. A miss refills the whole strip with a
+// single file read. Zero reads every pixel from the file.
+#ifndef DISPLAYIO_ONDISKBITMAP_CACHE_ROWS
+#define DISPLAYIO_ONDISKBITMAP_CACHE_ROWS (4)
+#endif
+
 typedef struct {
     mp_obj_base_t base;
     uint16_t width;
@@ -28,6 +34,11 @@ typedef struct {
         struct displayio_palette *palette;
         struct displayio_colorconverter *colorconverter;
     };
+    #if DISPLAYIO_ONDISKBITMAP_CACHE_ROWS > 0
+    uint8_t *row_cache; // NULL when it couldn't be allocated.
+    uint16_t row_cache_first; // File row of the first cached row. Rows are stored bottom up.
+    uint16_t row_cache_rows; // Number of valid rows. Zero when empty.
+    #endif
     bool bitfield_compressed;
     uint8_t bits_per_pixel;
 } displayio_ondiskbitmap_t;
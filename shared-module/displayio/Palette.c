@@ -11,7 +11,10 @@
 void common_hal_displayio_palette_construct(displayio_palette_t *self, uint16_t color_count, bool dither) {
     self->color_count = color_count;
     self->colors = (_displayio_color_t *)m_malloc_without_collect(color_count * sizeof(_displayio_color_t));
+    self->converted = (uint32_t *)m_malloc_without_collect(color_count * sizeof(uint32_t));
+    self->converted_colorspace = NULL;
     self->dither = dither;
+    self->opacity_valid = false;
 }
 
 void common_hal_displayio_palette_set_dither(displayio_palette_t *self, bool dither) {
@@ -24,11 +27,15 @@ bool common_hal_displayio_palette_get_dither(displayio_palette_t *self) {
 
 void common_hal_displayio_palette_make_opaque(displayio_palette_t *self, uint32_t palette_index) {
     self->colors[palette_index].transparent = false;
+    self->opacity_valid = false;
+    self->converted_colorspace = NULL;
     self->needs_refresh = true;
 }
 
 void common_hal_displayio_palette_make_transparent(displayio_palette_t *self, uint32_t palette_index) {
     self->colors[palette_index].transparent = true;
+    self->opacity_valid = false;
+    self->converted_colorspace = NULL;
     self->needs_refresh = true;
 }
 
@@ -45,7 +52,7 @@ void common_hal_displayio_palette_set_color(displayio_palette_t *self, uint32_t
         return;
     }
     self->colors[palette_index].rgb888 = color;
-    self->colors[palette_index].cached_colorspace = NULL;
+    self->converted_colorspace = NULL;
     self->needs_refresh = true;
 }
 
@@ -53,34 +60,83 @@ uint32_t common_hal_displayio_palette_get_color(displayio_palette_t *self, uint3
     return self->colors[palette_index].rgb888;
 }
 
+// Returns every color converted to colorspace, or NULL when dithering because the result then
+// depends on the pixel position, or when a statically defined palette has no space for the
+// conversion. The conversion is redone only when a color or the colorspace changes.
+const uint32_t *displayio_palette_get_converted(displayio_palette_t *self, const _displayio_colorspace_t *colorspace) {
+    if (self->dither || self->converted == NULL) {
+        return NULL;
+    }
+    // Check the grayscale settings because EPaperDisplay will change them on
+    // the same object.
+    if (self->converted_colorspace == colorspace &&
+        self->converted_grayscale_bit == colorspace->grayscale_bit &&
+        self->converted_grayscale == colorspace->grayscale) {
+        return self->converted;
+    }
+    displayio_input_pixel_t rgb888_pixel = { 0 };
+    displayio_output_pixel_t output_color;
+    for (uint32_t i = 0; i < self->color_count; i++) {
+        if (self->colors[i].transparent) {
+            self->converted[i] = DISPLAYIO_PALETTE_TRANSPARENT;
+            continue;
+        }
+        rgb888_pixel.pixel = self->colors[i].rgb888;
+        displayio_convert_color(colorspace, false, &rgb888_pixel, &output_color);
+        if (!output_color.opaque) {
+            self->converted[i] = DISPLAYIO_PALETTE_TRANSPARENT;
+        } else if (output_color.pixel == DISPLAYIO_PALETTE_TRANSPARENT) {
+            // Only 32 bit colorspaces pass the unused top byte of rgb888 through.
+            self->converted[i] = output_color.pixel & 0xffffff;
+        } else {
+            self->converted[i] = output_color.pixel;
+        }
+    }
+    self->converted_colorspace = colorspace;
+    self->converted_grayscale_bit = colorspace->grayscale_bit;
+    self->converted_grayscale = colorspace->grayscale;
+    return self->converted;
+}
+
 void displayio_palette_get_color(displayio_palette_t *self, const _displayio_colorspace_t *colorspace, const displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_color) {
     uint32_t palette_index = input_pixel->pixel;
-    if (palette_index > self->color_count || self->colors[palette_index].transparent) {
+    if (palette_index >= self->color_count) {
         output_color->opaque = false;
         return;
     }
 
-    // Cache results when not dithering.
-    _displayio_color_t *color = &self->colors[palette_index];
-    // Check the grayscale settings because EPaperDisplay will change them on
-    // the same object.
-    if (!self->dither &&
-        color->cached_colorspace == colorspace &&
-        color->cached_colorspace_grayscale_bit == colorspace->grayscale_bit &&
-        color->cached_colorspace_grayscale == colorspace->grayscale) {
-        output_color->pixel = self->colors[palette_index].cached_color;
+    const uint32_t *converted = displayio_palette_get_converted(self, colorspace);
+    if (converted != NULL) {
+        uint32_t color = converted[palette_index];
+        if (color == DISPLAYIO_PALETTE_TRANSPARENT) {
+            output_color->opaque = false;
+        } else {
+            output_color->pixel = color;
+        }
         return;
     }
 
+    if (self->colors[palette_index].transparent) {
+        output_color->opaque = false;
+        return;
+    }
     displayio_input_pixel_t rgb888_pixel = *input_pixel;
     rgb888_pixel.pixel = self->colors[palette_index].rgb888;
     displayio_convert_color(colorspace, self->dither, &rgb888_pixel, output_color);
-    if (!self->dither) {
-        color->cached_colorspace = colorspace;
-        color->cached_color = output_color->pixel;
-        color->cached_colorspace_grayscale = colorspace->grayscale;
-        color->cached_colorspace_grayscale_bit = colorspace->grayscale_bit;
+}
+
+bool displayio_palette_is_opaque(displayio_palette_t *self) {
+    if (!self->opacity_valid) {
+        self->opaque = true;
+        for (uint32_t i = 0; i < self->color_count; i++) {
+            if (self->colors[i].transparent) {
+                self->opaque = false;
+                break;
+            }
+        }
+        self->opacity_valid = true;
     }
+    return self->opaque;
 }
 
 bool displayio_palette_needs_refresh(displayio_palette_t *self) {
@@ -30,18 +30,17 @@ typedef struct {
 
 typedef struct {
     uint32_t rgb888;
-    const _displayio_colorspace_t *cached_colorspace;
-    uint32_t cached_color;
-    uint8_t cached_colorspace_grayscale_bit;
-    bool cached_colorspace_grayscale;
     bool transparent; // This may have additional bits added later for blending.
 } _displayio_color_t;
 
+// Converted palette value of a transparent color. No colorspace produces it for an opaque one.
+#define DISPLAYIO_PALETTE_TRANSPARENT (0xffffffff)
+
 typedef struct {
     uint32_t pixel;
     uint16_t x;
     uint16_t y;
-    uint8_t tile;
+    uint16_t tile;
     uint16_t tile_x;
     uint16_t tile_y;
 } displayio_input_pixel_t;
@@ -54,13 +53,21 @@ typedef struct {
 typedef struct displayio_palette {
     mp_obj_base_t base;
     _displayio_color_t *colors;
+    // Every color converted to converted_colorspace, or DISPLAYIO_PALETTE_TRANSPARENT.
+    uint32_t *converted;
+    const _displayio_colorspace_t *converted_colorspace;
+    uint8_t converted_grayscale_bit;
+    bool converted_grayscale;
     uint32_t color_count;
     bool needs_refresh;
     bool dither;
+    bool opacity_valid; // opaque is up to date with the transparency of colors.
+    bool opaque; // No color is transparent.
 } displayio_palette_t;
 
 
+const uint32_t *displayio_palette_get_converted(displayio_palette_t *self, const _displayio_colorspace_t *colorspace);
 void displayio_palette_get_color(displayio_palette_t *palette, const _displayio_colorspace_t *colorspace, const displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_color);
-;
+bool displayio_palette_is_opaque(displayio_palette_t *self);
 bool displayio_palette_needs_refresh(displayio_palette_t *self);
 void displayio_palette_finish_refresh(displayio_palette_t *self);
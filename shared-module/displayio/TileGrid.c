@@ -425,6 +425,142 @@ void common_hal_displayio_tilegrid_set_top_left(displayio_tilegrid_t *self, uint
     self->full_change = true;
 }
 
+// Reads one value from a bitmap row without the bounds and type checks of
+// common_hal_displayio_bitmap_get_pixel. The caller guarantees x is in range.
+static inline uint32_t _bitmap_row_value(const displayio_bitmap_t *bitmap, const uint32_t *row, uint16_t x) {
+    switch (bitmap->bits_per_value) {
+        case 8:
+            return ((const uint8_t *)row)[x];
+        case 16:
+            return ((const uint16_t *)row)[x];
+        case 32:
+            return row[x];
+        default: {
+            uint8_t values_per_byte = 8 / bitmap->bits_per_value;
+            uint8_t bits = ((const uint8_t *)row)[x >> bitmap->x_shift];
+            uint8_t bit_position = (values_per_byte - (x & bitmap->x_mask) - 1) * bitmap->bits_per_value;
+            return (bits >> bit_position) & bitmap->bitmask;
+        }
+    }
+}
+
+// Renders the overlap a row at a time for the common case of an unflipped, untransposed and
+// unscaled Bitmap shaded by a Palette or nothing. The tile is resolved once per run of pixels
+// that fall within it and the bitmap row is then read directly. Palette values are looked up in
+// the palette's converted colors.
+static bool _fill_area_span(displayio_tilegrid_t *self, const void *tiles,
+    const _displayio_colorspace_t *colorspace, uint32_t *mask, uint32_t *buffer,
+    int16_t row_offset, int16_t y_stride,
+    int16_t start_x, int16_t end_x, int16_t start_y, int16_t end_y, bool check_mask, bool full_coverage) {
+    const displayio_bitmap_t *bitmap = self->bitmap;
+    const uint32_t *converted = NULL;
+    uint32_t color_count = 0;
+    if (self->pixel_shader != mp_const_none) {
+        displayio_palette_t *palette = self->pixel_shader;
+        converted = displayio_palette_get_converted(palette, colorspace);
+        color_count = palette->color_count;
+    }
+    bool wide_tiles = self->tiles_in_bitmap > 255;
+    uint8_t depth = colorspace->depth;
+
+    uint16_t start_x_tile_index = (start_x / self->tile_width + self->top_left_x) % self->width_in_tiles;
+    uint16_t start_in_tile_x = start_x % self->tile_width;
+    uint16_t y_tile_index = (start_y / self->tile_height + self->top_left_y) % self->height_in_tiles;
+    uint16_t in_tile_y = start_y % self->tile_height;
+
+    for (int16_t y = start_y; y < end_y; ++y, row_offset += y_stride) {
+        uint32_t tile_row = y_tile_index * self->width_in_tiles;
+        uint16_t x_tile_index = start_x_tile_index;
+        uint16_t in_tile_x = start_in_tile_x;
+        int16_t offset = row_offset;
+
+        for (int16_t x = start_x; x < end_x;) {
+            uint16_t run = MIN(self->tile_width - in_tile_x, end_x - x);
+            uint16_t tile;
+            if (wide_tiles) {
+                tile = ((const uint16_t *)tiles)[tile_row + x_tile_index];
+            } else {
+                tile = ((const uint8_t *)tiles)[tile_row + x_tile_index];
+            }
+            uint16_t bx = (tile % self->bitmap_width_in_tiles) * self->tile_width + in_tile_x;
+            uint16_t by = (tile / self->bitmap_width_in_tiles) * self->tile_height + in_tile_y;
+            const uint32_t *row = NULL;
+            if (by < bitmap->height) {
+                row = bitmap->data + by * bitmap->stride;
+            }
+
+            for (uint16_t i = 0; i < run; i++, offset++, bx++) {
+                uint32_t bit = 1u << (offset % 32);
+                if (check_mask && (mask[offset / 32] & bit) != 0) {
+                    continue;
+                }
+                uint32_t value = 0;
+                if (row != NULL && bx < bitmap->width) {
+                    value = _bitmap_row_value(bitmap, row, bx);
+                }
+                uint32_t pixel = value;
+                if (converted != NULL) {
+                    pixel = value < color_count ? converted[value] : DISPLAYIO_PALETTE_TRANSPARENT;
+                    if (pixel == DISPLAYIO_PALETTE_TRANSPARENT) {
+                        // A pixel is transparent so we haven't fully covered the area ourselves.
+                        full_coverage = false;
+                        continue;
+                    }
+                }
+                if (check_mask) {
+                    mask[offset / 32] |= bit;
+                }
+                if (depth == 16) {
+                    ((uint16_t *)buffer)[offset] = pixel;
+                } else if (depth == 32) {
+                    buffer[offset] = pixel;
+                } else {
+                    ((uint8_t *)buffer)[offset] = pixel;
+                }
+            }
+
+            x += run;
+            in_tile_x = 0;
+            x_tile_index++;
+            if (x_tile_index == self->width_in_tiles) {
+                x_tile_index = 0;
+            }
+        }
+
+        if (++in_tile_y == self->tile_height) {
+            in_tile_y = 0;
+            if (++y_tile_index == self->height_in_tiles) {
+                y_tile_index = 0;
+            }
+        }
+    }
+    return full_coverage;
+}
+
+// Returns true when every pixel this TileGrid can produce in the given colorspace is opaque.
+static bool _tilegrid_is_opaque(displayio_tilegrid_t *self, const _displayio_colorspace_t *colorspace) {
+    if (self->pixel_shader == mp_const_none) {
+        return true;
+    }
+    // Conversion to other colorspaces can produce transparent pixels.
+    if (colorspace->depth < 4 && !colorspace->grayscale && !colorspace->tricolor && !colorspace->fourcolor) {
+        return false;
+    }
+    if (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type)) {
+        return displayio_colorconverter_is_opaque(self->pixel_shader);
+    }
+    if (mp_obj_is_type(self->pixel_shader, &displayio_palette_type) &&
+        mp_obj_is_type(self->bitmap, &displayio_bitmap_type)) {
+        // Values past the end of the palette are transparent so the palette must cover every value
+        // the bitmap can hold.
+        displayio_palette_t *palette = self->pixel_shader;
+        displayio_bitmap_t *bitmap = self->bitmap;
+        return bitmap->bits_per_value < 16 && palette->color_count >= (1u << bitmap->bits_per_value) &&
+               displayio_palette_is_opaque(palette);
+    }
+    return false;
+}
+
 bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
     const _displayio_colorspace_t *colorspace, const displayio_area_t *area,
     uint32_t *mask, uint32_t *buffer) {
@@ -447,6 +583,15 @@ bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
         return false;
     }
 
+    // Layers above us have already drawn every pixel we would.
+    if (displayio_area_mask_is_full(area, &overlap, mask)) {
+        return displayio_area_equal(area, &overlap);
+    }
+
+    // An opaque layer drawing onto pixels that are all unset can skip the per-pixel mask tests and
+    // set the whole overlap in the mask at the end.
+    bool check_mask = !(_tilegrid_is_opaque(self, colorspace) && displayio_area_mask_is_empty(area, &overlap, mask));
+
     int16_t x_stride = 1;
     int16_t y_stride = displayio_area_width(area);
 
@@ -473,11 +618,6 @@ bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
     // layers at that point.
     bool full_coverage = displayio_area_equal(area, &overlap);
 
-    // TODO(tannewt): Skip coverage tracking if all pixels outside the overlap have already been
-    // set and our palette is all opaque.
-
-    // TODO(tannewt): Check to see if the pixel_shader has any transparency. If it doesn't then we
-    // can either return full coverage or bulk update the mask.
     displayio_area_t transformed;
     displayio_area_transform_within(flip_x != (self->absolute_transform->dx < 0), flip_y != (self->absolute_transform->dy < 0), self->transpose_xy != self->absolute_transform->transpose_xy,
         &overlap,
@@ -512,37 +652,89 @@ bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
         y_shift = temp_shift;
     }
 
+    // Unflipped, untransposed and unscaled Bitmaps with a Palette or no shader are drawn a run of
+    // pixels at a time.
+    if (x_stride == 1 && y_stride > 0 && self->absolute_transform->scale == 1 &&
+        mp_obj_is_type(self->bitmap, &displayio_bitmap_type) &&
+        (self->pixel_shader == mp_const_none ||
+         (mp_obj_is_type(self->pixel_shader, &displayio_palette_type) &&
+          !((displayio_palette_t *)self->pixel_shader)->dither)) &&
+        (colorspace->depth == 8 || colorspace->depth == 16 || colorspace->depth == 32)) {
+        full_coverage = _fill_area_span(self, tiles, colorspace, mask, buffer,
+            start + y_shift * y_stride + x_shift, y_stride,
+            start_x, end_x, start_y, end_y, check_mask, full_coverage);
+        if (!check_mask) {
+            displayio_area_mask_fill(area, &overlap, mask);
+        }
+        return full_coverage;
+    }
+
     displayio_input_pixel_t input_pixel;
     displayio_output_pixel_t output_pixel;
 
-    for (input_pixel.y = start_y; input_pixel.y < end_y; ++input_pixel.y) {
-        int16_t row_start = start + (input_pixel.y - start_y + y_shift) * y_stride; // in pixels
-        int16_t local_y = input_pixel.y / self->absolute_transform->scale;
-        for (input_pixel.x = start_x; input_pixel.x < end_x; ++input_pixel.x) {
-            // Compute the destination pixel in the buffer and mask based on the transformations.
-            int16_t offset = row_start + (input_pixel.x - start_x + x_shift) * x_stride; // in pixels
+    // Bitmap coordinates are stepped along with the pixel instead of being divided out of it. The
+    // x position at the start of every row is the same so it is only divided once.
+    uint16_t scale = self->absolute_transform->scale;
+    uint16_t start_local_x = start_x / scale;
+    uint16_t start_scale_x = start_x % scale;
+    uint16_t start_in_tile_x = start_local_x % self->tile_width;
+    uint16_t start_x_tile_index = (start_local_x / self->tile_width + self->top_left_x) % self->width_in_tiles;
+
+    uint16_t local_y = start_y / scale;
+    uint16_t scale_y = start_y % scale;
+    uint16_t in_tile_y = local_y % self->tile_height;
+    uint16_t y_tile_index = (local_y / self->tile_height + self->top_left_y) % self->height_in_tiles;
+    int16_t row_start = start + y_shift * y_stride; // in pixels
 
+    for (input_pixel.y = start_y; input_pixel.y < end_y; ++input_pixel.y) {
+        // Compute the destination pixel in the buffer and mask based on the transformations.
+        int16_t offset = row_start + x_shift * x_stride; // in pixels
+        uint16_t scale_x = start_scale_x;
+        uint16_t in_tile_x = start_in_tile_x;
+        uint16_t x_tile_index = start_x_tile_index;
+        uint32_t tile_row = y_tile_index * self->width_in_tiles;
+        bool tile_changed = true;
+        uint16_t tile_x = 0;
+        uint16_t tile_y = 0;
+        for (input_pixel.x = start_x; input_pixel.x < end_x; ++input_pixel.x, offset += x_stride) {
             // This is super useful for debugging out of range accesses. Uncomment to use.
             // if (offset < 0 || offset >= (int32_t) displayio_area_size(area)) {
             //     asm("bkpt");
             // }
 
-            // Check the mask first to see if the pixel has already been set.
-            if ((mask[offset / 32] & (1 << (offset % 32))) != 0) {
-                continue;
+            // Look up the tile only when we enter a new one.
+            if (tile_changed) {
+                if (self->tiles_in_bitmap > 255) {
+                    input_pixel.tile = ((uint16_t *)tiles)[tile_row + x_tile_index];
+                } else {
+                    input_pixel.tile = ((uint8_t *)tiles)[tile_row + x_tile_index];
+                }
+                tile_x = (input_pixel.tile % self->bitmap_width_in_tiles) * self->tile_width;
+                tile_y = (input_pixel.tile / self->bitmap_width_in_tiles) * self->tile_height + in_tile_y;
+                tile_changed = false;
             }
-            int16_t local_x = input_pixel.x / self->absolute_transform->scale;
-            uint16_t x_tile_index = (local_x / self->tile_width + self->top_left_x) % self->width_in_tiles;
-            uint16_t y_tile_index = (local_y / self->tile_height + self->top_left_y) % self->height_in_tiles;
-            uint16_t tile_location = y_tile_index * self->width_in_tiles + x_tile_index;
+            input_pixel.tile_x = tile_x + in_tile_x;
+            input_pixel.tile_y = tile_y;
+            #if CIRCUITPY_TILEPALETTEMAPPER
+            uint16_t pixel_x_tile_index = x_tile_index;
+            #endif
 
-            if (self->tiles_in_bitmap > 255) {
-                input_pixel.tile = ((uint16_t *)tiles)[tile_location];
-            } else {
-                input_pixel.tile = ((uint8_t *)tiles)[tile_location];
+            // Step to the next pixel now so that skipping this one is a plain continue.
+            if (++scale_x == scale) {
+                scale_x = 0;
+                if (++in_tile_x == self->tile_width) {
+                    in_tile_x = 0;
+                    tile_changed = true;
+                    if (++x_tile_index == self->width_in_tiles) {
+                        x_tile_index = 0;
+                    }
+                }
+            }
+
+            // Check the mask first to see if the pixel has already been set.
+            if (check_mask && (mask[offset / 32] & (1 << (offset % 32))) != 0) {
+                continue;
             }
-            input_pixel.tile_x = (input_pixel.tile % self->bitmap_width_in_tiles) * self->tile_width + local_x % self->tile_width;
-            input_pixel.tile_y = (input_pixel.tile / self->bitmap_width_in_tiles) * self->tile_height + local_y % self->tile_height;
 
             output_pixel.pixel = 0;
             input_pixel.pixel = 0;
@@ -558,7 +750,7 @@ bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
             output_pixel.opaque = true;
             #if CIRCUITPY_TILEPALETTEMAPPER
             if (mp_obj_is_type(self->pixel_shader, &tilepalettemapper_tilepalettemapper_type)) {
-                tilepalettemapper_tilepalettemapper_get_color(self->pixel_shader, colorspace, &input_pixel, &output_pixel, x_tile_index, y_tile_index);
+                tilepalettemapper_tilepalettemapper_get_color(self->pixel_shader, colorspace, &input_pixel, &output_pixel, pixel_x_tile_index, y_tile_index);
             }
             #endif
             if (self->pixel_shader == mp_const_none) {
@@ -572,7 +764,9 @@ bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
                 // A pixel is transparent so we haven't fully covered the area ourselves.
                 full_coverage = false;
             } else {
-                mask[offset / 32] |= 1 << (offset % 32);
+                if (check_mask) {
+                    mask[offset / 32] |= 1 << (offset % 32);
+                }
                 if (colorspace->depth == 16) {
                     *(((uint16_t *)buffer) + offset) = output_pixel.pixel;
                 } else if (colorspace->depth == 32) {
@@ -583,29 +777,44 @@ bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
                     *(((uint8_t *)buffer) + offset) = output_pixel.pixel;
                 } else if (colorspace->depth < 8) {
                     uint8_t pixels_per_byte = 8 / colorspace->depth;
+                    int16_t packed_offset = offset;
 
                     // Reorder the offsets to pack multiple rows into a byte (meaning they share a column).
                     if (!colorspace->pixels_in_byte_share_row) {
                         uint16_t width = displayio_area_width(area);
-                        uint16_t row = offset / width;
-                        uint16_t col = offset % width;
+                        uint16_t row = packed_offset / width;
+                        uint16_t col = packed_offset % width;
                         // Dividing by pixels_per_byte does truncated division even if we multiply it back out.
-                        offset = col * pixels_per_byte + (row / pixels_per_byte) * pixels_per_byte * width + row % pixels_per_byte;
+                        packed_offset = col * pixels_per_byte + (row / pixels_per_byte) * pixels_per_byte * width + row % pixels_per_byte;
                         // Also useful for validating that the bitpacking worked correctly.
-                        // if (offset > displayio_area_size(area)) {
+                        // if (packed_offset > displayio_area_size(area)) {
                         //     asm("bkpt");
                         // }
                     }
-                    uint8_t shift = (offset % pixels_per_byte) * colorspace->depth;
+                    uint8_t shift = (packed_offset % pixels_per_byte) * colorspace->depth;
                     if (colorspace->reverse_pixels_in_byte) {
                         // Reverse the shift by subtracting it from the leftmost shift.
                         shift = (pixels_per_byte - 1) * colorspace->depth - shift;
                     }
-                    ((uint8_t *)buffer)[offset / pixels_per_byte] |= output_pixel.pixel << shift;
+                    ((uint8_t *)buffer)[packed_offset / pixels_per_byte] |= output_pixel.pixel << shift;
+                }
+            }
+        }
+
+        row_start += y_stride;
+        if (++scale_y == scale) {
+            scale_y = 0;
+            if (++in_tile_y == self->tile_height) {
+                in_tile_y = 0;
+                if (++y_tile_index == self->height_in_tiles) {
+                    y_tile_index = 0;
                 }
             }
         }
     }
+    if (!check_mask) {
+        displayio_area_mask_fill(area, &overlap, mask);
+    }
     return full_coverage;
 }
 
@@ -621,6 +830,7 @@ void displayio_tilegrid_finish_refresh(displayio_tilegrid_t *self) {
     self->moved = false;
     self->full_change = false;
     self->partial_change = false;
+    self->bitmap_dirty_count = 0;
     if (mp_obj_is_type(self->pixel_shader, &displayio_palette_type)) {
         displayio_palette_finish_refresh(self->pixel_shader);
     } else if (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type)) {
@@ -636,6 +846,50 @@ void displayio_tilegrid_finish_refresh(displayio_tilegrid_t *self) {
     // That way they won't change during a refresh and tear.
 }
 
+// Converts an area relative to the TileGrid into an absolute area on the display.
+static void _transform_dirty_area(displayio_tilegrid_t *self, displayio_area_t *area) {
+    int16_t x = self->x;
+    int16_t y = self->y;
+    if (self->absolute_transform->transpose_xy) {
+        int16_t temp = y;
+        y = x;
+        x = temp;
+    }
+    int16_t x1 = area->x1;
+    int16_t x2 = area->x2;
+    if (self->flip_x) {
+        x1 = self->pixel_width - x1;
+        x2 = self->pixel_width - x2;
+    }
+    int16_t y1 = area->y1;
+    int16_t y2 = area->y2;
+    if (self->flip_y) {
+        y1 = self->pixel_height - y1;
+        y2 = self->pixel_height - y2;
+    }
+    if (self->transpose_xy != self->absolute_transform->transpose_xy) {
+        int16_t temp1 = y1, temp2 = y2;
+        y1 = x1;
+        x1 = temp1;
+        y2 = x2;
+        x2 = temp2;
+    }
+    area->x1 = self->absolute_transform->x + self->absolute_transform->dx * (x + x1);
+    area->y1 = self->absolute_transform->y + self->absolute_transform->dy * (y + y1);
+    area->x2 = self->absolute_transform->x + self->absolute_transform->dx * (x + x2);
+    area->y2 = self->absolute_transform->y + self->absolute_transform->dy * (y + y2);
+    if (area->y2 < area->y1) {
+        int16_t temp = area->y2;
+        area->y2 = area->y1;
+        area->y1 = temp;
+    }
+    if (area->x2 < area->x1) {
+        int16_t temp = area->x2;
+        area->x2 = area->x1;
+        area->x1 = temp;
+    }
+}
+
 displayio_area_t *displayio_tilegrid_get_refresh_areas(displayio_tilegrid_t *self, displayio_area_t *tail) {
     bool first_draw = self->previous_area.x1 == self->previous_area.x2;
     bool hidden = self->hidden || self->hidden_by_parent;
@@ -667,6 +921,12 @@ displayio_area_t *displayio_tilegrid_get_refresh_areas(displayio_tilegrid_t *sel
             // dirty area. Copy it to ours so we can transform it.
             if (self->tiles_in_bitmap == 1) {
                 displayio_area_copy(refresh_area, &self->dirty_area);
+                self->bitmap_dirty_count = 0;
+                for (const displayio_area_t *area = refresh_area->next;
+                     area != tail && self->bitmap_dirty_count < DISPLAYIO_BITMAP_DIRTY_RECTS - 1;
+                     area = area->next) {
+                    displayio_area_copy(area, &self->bitmap_dirty_areas[self->bitmap_dirty_count++]);
+                }
                 self->partial_change = true;
             } else {
                 self->full_change = true;
@@ -686,47 +946,12 @@ displayio_area_t *displayio_tilegrid_get_refresh_areas(displayio_tilegrid_t *sel
     }
 
     if (self->partial_change) {
-        int16_t x = self->x;
-        int16_t y = self->y;
-        if (self->absolute_transform->transpose_xy) {
-            int16_t temp = y;
-            y = x;
-            x = temp;
-        }
-        int16_t x1 = self->dirty_area.x1;
-        int16_t x2 = self->dirty_area.x2;
-        if (self->flip_x) {
-            x1 = self->pixel_width - x1;
-            x2 = self->pixel_width - x2;
-        }
-        int16_t y1 = self->dirty_area.y1;
-        int16_t y2 = self->dirty_area.y2;
-        if (self->flip_y) {
-            y1 = self->pixel_height - y1;
-            y2 = self->pixel_height - y2;
+        for (int8_t i = self->bitmap_dirty_count - 1; i >= 0; i--) {
+            _transform_dirty_area(self, &self->bitmap_dirty_areas[i]);
+            self->bitmap_dirty_areas[i].next = tail;
+            tail = &self->bitmap_dirty_areas[i];
         }
-        if (self->transpose_xy != self->absolute_transform->transpose_xy) {
-            int16_t temp1 = y1, temp2 = y2;
-            y1 = x1;
-            x1 = temp1;
-            y2 = x2;
-            x2 = temp2;
-        }
-        self->dirty_area.x1 = self->absolute_transform->x + self->absolute_transform->dx * (x + x1);
-        self->dirty_area.y1 = self->absolute_transform->y + self->absolute_transform->dy * (y + y1);
-        self->dirty_area.x2 = self->absolute_transform->x + self->absolute_transform->dx * (x + x2);
-        self->dirty_area.y2 = self->absolute_transform->y + self->absolute_transform->dy * (y + y2);
-        if (self->dirty_area.y2 < self->dirty_area.y1) {
-            int16_t temp = self->dirty_area.y2;
-            self->dirty_area.y2 = self->dirty_area.y1;
-            self->dirty_area.y1 = temp;
-        }
-        if (self->dirty_area.x2 < self->dirty_area.x1) {
-            int16_t temp = self->dirty_area.x2;
-            self->dirty_area.x2 = self->dirty_area.x1;
-            self->dirty_area.x1 = temp;
-        }
-
+        _transform_dirty_area(self, &self->dirty_area);
         self->dirty_area.next = tail;
         return &self->dirty_area;
     }
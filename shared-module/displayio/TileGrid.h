@@ -11,6 +11,7 @@
 
 #include "py/obj.h"
 #include "shared-module/displayio/area.h"
+#include "shared-module/displayio/Bitmap.h"
 #include "shared-module/displayio/Palette.h"
 
 typedef struct {
@@ -33,6 +34,9 @@ typedef struct {
     void *tiles;  // Can be either uint8_t* or uint16_t* depending on tiles_in_bitmap
     const displayio_buffer_transform_t *absolute_transform;
     displayio_area_t dirty_area; // Stored as a relative area until the refresh area is fetched.
+    // Further areas of a single tile bitmap that changed in more than one place. Stored like dirty_area.
+    displayio_area_t bitmap_dirty_areas[DISPLAYIO_BITMAP_DIRTY_RECTS - 1];
+    uint8_t bitmap_dirty_count;
     displayio_area_t previous_area; // Stored as an absolute area.
     displayio_area_t current_area; // Stored as an absolute area so it applies across frames.
     bool partial_change : 1;
@@ -139,3 +139,65 @@ void displayio_area_transform_within(bool mirror_x, bool mirror_y, bool transpos
         transformed->x1 = whole->x1 + (y1 - whole->y1);
     }
 }
+
+// Masks hold one bit per pixel of an area in row major order. Bit n lives in word n / 32 at
+// position n % 32.
+
+// Applies op to the bits [start, end) of mask a word at a time. When op is a test it returns false
+// as soon as a word fails.
+typedef enum {
+    MASK_IS_FULL,
+    MASK_IS_EMPTY,
+    MASK_FILL,
+} _mask_op_t;
+
+static bool _mask_range(uint32_t *mask, uint32_t start, uint32_t end, _mask_op_t op) {
+    if (start >= end) {
+        return true;
+    }
+    uint32_t first_word = start / 32;
+    uint32_t last_word = (end - 1) / 32;
+    for (uint32_t w = first_word; w <= last_word; w++) {
+        uint32_t bits = 0xffffffff;
+        if (w == first_word) {
+            bits &= 0xffffffff << (start % 32);
+        }
+        if (w == last_word) {
+            bits &= 0xffffffff >> (31 - (end - 1) % 32);
+        }
+        if (op == MASK_FILL) {
+            mask[w] |= bits;
+        } else if ((mask[w] & bits) != (op == MASK_IS_FULL ? bits : 0)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool _mask_area(uint32_t *mask, const displayio_area_t *area, const displayio_area_t *sub, _mask_op_t op) {
+    uint16_t width = displayio_area_width(area);
+    uint32_t start = (sub->y1 - area->y1) * width + (sub->x1 - area->x1);
+    // Rows spanning the whole area are contiguous in the mask.
+    if (sub->x1 == area->x1 && sub->x2 == area->x2) {
+        return _mask_range(mask, start, start + displayio_area_size(sub), op);
+    }
+    uint16_t sub_width = displayio_area_width(sub);
+    for (int16_t y = sub->y1; y < sub->y2; y++, start += width) {
+        if (!_mask_range(mask, start, start + sub_width, op)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool displayio_area_mask_is_full(const displayio_area_t *area, const displayio_area_t *sub, const uint32_t *mask) {
+    return _mask_area((uint32_t *)mask, area, sub, MASK_IS_FULL);
+}
+
+bool displayio_area_mask_is_empty(const displayio_area_t *area, const displayio_area_t *sub, const uint32_t *mask) {
+    return _mask_area((uint32_t *)mask, area, sub, MASK_IS_EMPTY);
+}
+
+void displayio_area_mask_fill(const displayio_area_t *area, const displayio_area_t *sub, uint32_t *mask) {
+    _mask_area(mask, area, sub, MASK_FILL);
+}
@@ -55,3 +55,8 @@ void displayio_area_transform_within(bool mirror_x, bool mirror_y, bool transpos
     const displayio_area_t *original,
     const displayio_area_t *whole,
     displayio_area_t *transformed);
+
+// Test or set the bits of a pixel mask for area that belong to sub. sub must lie within area.
+bool displayio_area_mask_is_full(const displayio_area_t *area, const displayio_area_t *sub, const uint32_t *mask);
+bool displayio_area_mask_is_empty(const displayio_area_t *area, const displayio_area_t *sub, const uint32_t *mask);
+void displayio_area_mask_fill(const displayio_area_t *area, const displayio_area_t *sub, uint32_t *mask);
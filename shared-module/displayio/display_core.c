@@ -8,7 +8,6 @@
 
 #include "py/gc.h"
 #include "py/runtime.h"
-#include "shared-bindings/microcontroller/Pin.h"
 #include "shared-bindings/time/__init__.h"
 #include "shared-module/displayio/__init__.h"
 #include "supervisor/shared/display.h"
@@ -203,3 +202,61 @@ bool displayio_display_core_clip_area(displayio_display_core_t *self, const disp
     }
     return true;
 }
+
+// Estimated cost of sending an area in pixels. Areas taller than the area buffer are sent as
+// several subrectangles and each one pays the setup cost again.
+static uint32_t _refresh_cost(displayio_display_core_t *self, const displayio_area_t *area, uint32_t setup_cost) {
+    uint32_t buffer_pixels = CIRCUITPY_DISPLAY_AREA_BUFFER_SIZE * 8 / self->colorspace.depth;
+    uint32_t rows_per_buffer = MAX(1, buffer_pixels / displayio_area_width(area));
+    uint32_t subrectangles = (displayio_area_height(area) + rows_per_buffer - 1) / rows_per_buffer;
+    return subrectangles * setup_cost + displayio_area_size(area);
+}
+
+// Coalesces a list of dirty areas into at most CIRCUITPY_DISPLAY_REFRESH_PLAN_LENGTH areas
+// clipped to the display. setup_cost is the overhead of sending one rectangle expressed in
+// pixels. Two areas are merged whenever sending their union is estimated to be no more
+// expensive than sending both, so nearby sprites share one transfer while distant ones don't
+// drag the space between them along. The returned list lives in self and is valid until the
+// next call.
+const displayio_area_t *displayio_display_core_plan_refresh_areas(displayio_display_core_t *self, const displayio_area_t *areas, uint32_t setup_cost) {
+    displayio_area_t *plan = self->refresh_plan;
+    size_t count = 0;
+    for (const displayio_area_t *area = areas; area != NULL; area = area->next) {
+        displayio_area_t pending;
+        if (!displayio_display_core_clip_area(self, area, &pending)) {
+            continue;
+        }
+        // Keep merging because a union may now pay off with another planned area.
+        while (count > 0) {
+            uint32_t pending_cost = _refresh_cost(self, &pending, setup_cost);
+            size_t best = 0;
+            int32_t best_saving = INT32_MIN;
+            for (size_t i = 0; i < count; i++) {
+                displayio_area_t u;
+                displayio_area_union(&plan[i], &pending, &u);
+                int32_t saving = (int32_t)(_refresh_cost(self, &plan[i], setup_cost) + pending_cost) -
+                    (int32_t)_refresh_cost(self, &u, setup_cost);
+                if (saving > best_saving) {
+                    best = i;
+                    best_saving = saving;
+                }
+            }
+            // A full plan has to take the cheapest merge even if it is a loss.
+            if (best_saving < 0 && count < CIRCUITPY_DISPLAY_REFRESH_PLAN_LENGTH) {
+                break;
+            }
+            displayio_area_union(&plan[best], &pending, &pending);
+            plan[best] = plan[--count];
+        }
+        plan[count++] = pending;
+    }
+    if (count == 0) {
+        return NULL;
+    }
+    for (size_t i = 0; i < count - 1; i++) {
+        plan[i].next = &plan[i + 1];
+    }
+    plan[count - 1].next = NULL;
+    DISPLAYIO_CORE_DEBUG("refresh plan: %d areas\n", (int)count);
+    return plan;
+}
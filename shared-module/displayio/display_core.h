@@ -23,6 +23,9 @@ typedef struct {
     uint16_t rotation;
     _displayio_colorspace_t colorspace;
 
+    // Coalesced dirty areas of the current refresh.
+    displayio_area_t refresh_plan[CIRCUITPY_DISPLAY_REFRESH_PLAN_LENGTH];
+
     bool full_refresh; // New group means we need to refresh the whole display.
     bool refresh_in_progress;
 } displayio_display_core_t;
@@ -51,3 +54,5 @@ void displayio_display_core_collect_ptrs(displayio_display_core_t *self);
 bool displayio_display_core_fill_area(displayio_display_core_t *self, displayio_area_t *area, uint32_t *mask, uint32_t *buffer);
 
 bool displayio_display_core_clip_area(displayio_display_core_t *self, const displayio_area_t *area, displayio_area_t *clipped);
+
+const displayio_area_t *displayio_display_core_plan_refresh_areas(displayio_display_core_t *self, const displayio_area_t *areas, uint32_t setup_cost);
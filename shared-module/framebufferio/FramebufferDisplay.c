@@ -9,7 +9,6 @@
 
 #include "py/gc.h"
 #include "py/runtime.h"
-#include "shared-bindings/microcontroller/Pin.h"
 #include "shared-bindings/time/__init__.h"
 #include "shared-module/displayio/__init__.h"
 #include "shared-module/displayio/display_core.h"
@@ -105,17 +104,37 @@ mp_obj_t common_hal_framebufferio_framebufferdisplay_get_framebuffer(framebuffer
     return self->framebuffer;
 }
 
+// Overhead of rendering one rectangle into the framebuffer, in pixels.
+#define FRAMEBUFFERDISPLAY_REFRESH_SETUP_COST (16)
+
 static const displayio_area_t *_get_refresh_areas(framebufferio_framebufferdisplay_obj_t *self) {
     if (self->core.full_refresh) {
         self->core.area.next = NULL;
         return &self->core.area;
     } else if (self->core.current_group != NULL) {
-        return displayio_group_get_refresh_areas(self->core.current_group, NULL);
+        return displayio_display_core_plan_refresh_areas(&self->core,
+            displayio_group_get_refresh_areas(self->core.current_group, NULL), FRAMEBUFFERDISPLAY_REFRESH_SETUP_COST);
     }
     return NULL;
 }
 
 #define MARK_ROW_DIRTY(r) (dirty_row_bitmask[r / 8] |= (1 << (r & 7)))
+
+// Zeroes the pixels no layer drew, as they would be when rendered into a cleared buffer.
+static void _clear_unset_pixels(uint8_t *pixels, const uint32_t *mask, uint32_t pixel_count, uint8_t bytes_per_pixel) {
+    for (uint32_t i = 0; i < pixel_count; i += 32) {
+        uint32_t unset = ~mask[i / 32];
+        while (unset != 0) {
+            uint32_t pixel = i + __builtin_ctz(unset);
+            if (pixel >= pixel_count) {
+                break;
+            }
+            memset(pixels + pixel * bytes_per_pixel, 0, bytes_per_pixel);
+            unset &= unset - 1;
+        }
+    }
+}
+
 static bool _refresh_area(framebufferio_framebufferdisplay_obj_t *self, const displayio_area_t *area, uint8_t *dirty_row_bitmask) {
     uint16_t buffer_size = CIRCUITPY_DISPLAY_AREA_BUFFER_SIZE / sizeof(uint32_t); // In uint32_ts
 
@@ -159,9 +178,22 @@ static bool _refresh_area(framebufferio_framebufferdisplay_obj_t *self, const di
         }
     }
 
+    uint8_t *buf = (uint8_t *)self->bufinfo.buf, *endbuf = buf + self->bufinfo.len;
+    (void)endbuf; // Hint to compiler that endbuf is "used" even if NDEBUG
+    buf += self->first_pixel_offset;
+
+    size_t rowstride = self->row_stride;
+    size_t rowsize = displayio_area_width(&clipped) * self->core.colorspace.depth / 8;
+
+    // Areas spanning whole framebuffer rows are contiguous in the framebuffer, so they are
+    // rendered in place instead of into a buffer that is then copied. The framebuffer is
+    // addressed as uint32_t like the buffer so every row must be word aligned.
+    bool in_place = self->core.colorspace.depth % 8 == 0 && rowsize == rowstride &&
+        ((uintptr_t)buf % sizeof(uint32_t)) == 0 && rowstride % sizeof(uint32_t) == 0;
+
     // Allocated and shared as a uint32_t array so the compiler knows the
     // alignment everywhere.
-    uint32_t buffer[buffer_size];
+    uint32_t buffer[in_place ? 1 : buffer_size];
     uint32_t mask_length = (pixels_per_buffer / 32) + 1;
     uint32_t mask[mask_length];
     uint16_t remaining_rows = displayio_area_height(&clipped);
@@ -180,25 +212,29 @@ static bool _refresh_area(framebufferio_framebufferdisplay_obj_t *self, const di
         remaining_rows -= rows_per_buffer;
 
         memset(mask, 0, mask_length * sizeof(mask[0]));
-        memset(buffer, 0, buffer_size * sizeof(buffer[0]));
 
-        displayio_display_core_fill_area(&self->core, &subrectangle, mask, buffer);
+        uint8_t *dest = buf + subrectangle.y1 * rowstride + subrectangle.x1 * self->core.colorspace.depth / 8;
+
+        if (in_place) {
+            assert(dest >= buf && dest + displayio_area_height(&subrectangle) * rowsize <= endbuf);
+            displayio_display_core_fill_area(&self->core, &subrectangle, mask, (uint32_t *)dest);
+            _clear_unset_pixels(dest, mask, displayio_area_size(&subrectangle), self->core.colorspace.depth / 8);
+            for (uint16_t i = subrectangle.y1; i < subrectangle.y2; i++) {
+                MARK_ROW_DIRTY(i);
+            }
+        } else {
+            memset(buffer, 0, buffer_size * sizeof(buffer[0]));
 
-        uint8_t *buf = (uint8_t *)self->bufinfo.buf, *endbuf = buf + self->bufinfo.len;
-        (void)endbuf; // Hint to compiler that endbuf is "used" even if NDEBUG
-        buf += self->first_pixel_offset;
+            displayio_display_core_fill_area(&self->core, &subrectangle, mask, buffer);
 
-        size_t rowstride = self->row_stride;
-        uint8_t *dest = buf + subrectangle.y1 * rowstride + subrectangle.x1 * self->core.colorspace.depth / 8;
-        uint8_t *src = (uint8_t *)buffer;
-        size_t rowsize = (subrectangle.x2 - subrectangle.x1) * self->core.colorspace.depth / 8;
-
-        for (uint16_t i = subrectangle.y1; i < subrectangle.y2; i++) {
-            assert(dest >= buf && dest < endbuf && dest + rowsize <= endbuf);
-            MARK_ROW_DIRTY(i);
-            memcpy(dest, src, rowsize);
-            dest += rowstride;
-            src += rowsize;
+            uint8_t *src = (uint8_t *)buffer;
+            for (uint16_t i = subrectangle.y1; i < subrectangle.y2; i++) {
+                assert(dest >= buf && dest < endbuf && dest + rowsize <= endbuf);
+                MARK_ROW_DIRTY(i);
+                memcpy(dest, src, rowsize);
+                dest += rowstride;
+                src += rowsize;
+            }
         }
         // Run background tasks so they can run during an explicit refresh.
         // Auto-refresh won't run background tasks here because it is a background task itself.
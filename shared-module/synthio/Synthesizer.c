@@ -15,9 +15,9 @@
 
 void common_hal_synthio_synthesizer_construct(synthio_synthesizer_obj_t *self,
     uint32_t sample_rate, int channel_count, mp_obj_t waveform_obj,
-    mp_obj_t envelope_obj) {
+    mp_obj_t envelope_obj, int max_voices, synthio_voice_stealing_t voice_stealing) {
 
-    synthio_synth_init(&self->synth, sample_rate, channel_count, waveform_obj, envelope_obj);
+    synthio_synth_init(&self->synth, sample_rate, channel_count, waveform_obj, envelope_obj, max_voices, voice_stealing);
     self->blocks = mp_obj_new_list(0, NULL);
 }
 
@@ -56,10 +56,8 @@ audioio_get_buffer_result_t synthio_synthesizer_get_buffer(synthio_synthesizer_o
 }
 
 void common_hal_synthio_synthesizer_release_all(synthio_synthesizer_obj_t *self) {
-    for (size_t i = 0; i < CIRCUITPY_SYNTHIO_MAX_CHANNELS; i++) {
-        if (self->synth.span.note_obj[i] != SYNTHIO_SILENCE) {
-            synthio_span_change_note(&self->synth, self->synth.span.note_obj[i], SYNTHIO_SILENCE);
-        }
+    for (size_t i = 0; i < self->synth.active_count; i++) {
+        synthio_span_change_note(&self->synth, self->synth.span.note_obj[self->synth.active[i]], SYNTHIO_SILENCE);
     }
 }
 
@@ -134,13 +132,13 @@ void common_hal_synthio_synthesizer_retrigger(synthio_synthesizer_obj_t *self, m
 
 mp_obj_t common_hal_synthio_synthesizer_get_pressed_notes(synthio_synthesizer_obj_t *self) {
     int count = 0;
-    for (int chan = 0; chan < CIRCUITPY_SYNTHIO_MAX_CHANNELS; chan++) {
+    for (int chan = 0; chan < self->synth.max_voices; chan++) {
         if (self->synth.span.note_obj[chan] != SYNTHIO_SILENCE && SYNTHIO_NOTE_IS_PLAYING(&self->synth, chan)) {
             count += 1;
         }
     }
     mp_obj_tuple_t *result = MP_OBJ_TO_PTR(mp_obj_new_tuple(count, NULL));
-    for (size_t chan = 0, j = 0; chan < CIRCUITPY_SYNTHIO_MAX_CHANNELS; chan++) {
+    for (size_t chan = 0, j = 0; chan < self->synth.max_voices; chan++) {
         if (self->synth.span.note_obj[chan] != SYNTHIO_SILENCE && SYNTHIO_NOTE_IS_PLAYING(&self->synth, chan)) {
             result->items[j++] = self->synth.span.note_obj[chan];
         }
@@ -149,7 +147,8 @@ mp_obj_t common_hal_synthio_synthesizer_get_pressed_notes(synthio_synthesizer_ob
 }
 
 envelope_state_e common_hal_synthio_synthesizer_note_info(synthio_synthesizer_obj_t *self, mp_obj_t note, mp_float_t *vol_out) {
-    for (int chan = 0; chan < CIRCUITPY_SYNTHIO_MAX_CHANNELS; chan++) {
+    for (int i = 0; i < self->synth.active_count; i++) {
+        int chan = self->synth.active[i];
         if (self->synth.span.note_obj[chan] == note) {
             *vol_out = self->synth.envelope_state[chan].level / 32767.;
             return self->synth.envelope_state[chan].state;
@@ -159,6 +158,18 @@ envelope_state_e common_hal_synthio_synthesizer_note_info(synthio_synthesizer_ob
 }
 
 
+mp_int_t common_hal_synthio_synthesizer_get_max_voices(synthio_synthesizer_obj_t *self) {
+    return self->synth.max_voices;
+}
+
+synthio_voice_stealing_t common_hal_synthio_synthesizer_get_voice_stealing(synthio_synthesizer_obj_t *self) {
+    return self->synth.voice_stealing;
+}
+
+void common_hal_synthio_synthesizer_set_voice_stealing(synthio_synthesizer_obj_t *self, synthio_voice_stealing_t voice_stealing) {
+    self->synth.voice_stealing = voice_stealing;
+}
+
 mp_obj_t common_hal_synthio_synthesizer_get_blocks(synthio_synthesizer_obj_t *self) {
     return self->blocks;
 }
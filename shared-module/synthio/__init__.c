@@ -14,6 +14,10 @@
 #include <math.h>
 #include <stdlib.h>
 
+#if defined(__arm__) && __arm__
+#include "cmsis_compiler.h"
+#endif
+
 #define MP_PI MICROPY_FLOAT_CONST(3.14159265358979323846)
 
 mp_float_t synthio_global_rate_scale, synthio_global_W_scale;
@@ -171,7 +175,17 @@ int16_t synthio_mix_down_sample(int32_t sample, int32_t scale) {
     return sample;
 }
 
-static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *out_buffer32, int16_t dur, int16_t loudness[2]) {
+// The oscillator parameters of one voice for one block. They are gathered by
+// synth_note_prepare so that the kernels below only have to step accumulators.
+typedef struct {
+    const int16_t *waveform;
+    uint32_t dds_rate, offset, lim;
+    // ring_waveform is NULL when the note is not ring modulated
+    const int16_t *ring_waveform;
+    uint32_t ring_dds_rate, ring_offset, ring_lim;
+} synthio_voice_t;
+
+static bool synth_note_prepare(synthio_synth_t *synth, int chan, synthio_voice_t *voice, int16_t dur, int16_t loudness[2]) {
     mp_obj_t note_obj = synth->span.note_obj[chan];
 
     int32_t sample_rate = synth->base.sample_rate;
@@ -220,62 +234,158 @@ static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *ou
         }
     }
 
-    uint32_t offset = waveform_start << SYNTHIO_FREQUENCY_SHIFT;
-    uint32_t lim = waveform_length << SYNTHIO_FREQUENCY_SHIFT;
-    uint32_t accum = synth->accum[chan];
+    voice->waveform = waveform;
+    voice->dds_rate = dds_rate;
+    voice->offset = waveform_start << SYNTHIO_FREQUENCY_SHIFT;
+    voice->lim = waveform_length << SYNTHIO_FREQUENCY_SHIFT;
 
-    if (dds_rate > lim / 2) {
+    if (dds_rate > voice->lim / 2) {
         // beyond nyquist, can't play note
         return false;
     }
 
     // can happen if note waveform gets set mid-note, but the expensive modulo is usually avoided
-    if (accum > lim) {
-        accum = accum % lim + offset;
+    if (synth->accum[chan] > voice->lim) {
+        synth->accum[chan] = synth->accum[chan] % voice->lim + voice->offset;
+    }
+
+    voice->ring_waveform = NULL;
+    // beyond nyquist, can't play ring (but can still synth main sound)
+    if (ring_dds_rate && ring_dds_rate <= voice->lim / 2) {
+        voice->ring_waveform = ring_waveform;
+        voice->ring_dds_rate = ring_dds_rate;
+        voice->ring_offset = ring_waveform_start << SYNTHIO_FREQUENCY_SHIFT;
+        voice->ring_lim = ring_waveform_length << SYNTHIO_FREQUENCY_SHIFT;
+        if (synth->ring_accum[chan] > voice->ring_lim) {
+            synth->ring_accum[chan] = synth->ring_accum[chan] % voice->ring_lim + voice->ring_offset;
+        }
     }
+    return true;
+}
 
-    // first, fill with waveform
-    for (uint16_t i = 0; i < dur; i++) {
-        accum += dds_rate;
-        // because dds_rate is low enough, the subtraction is guaranteed to go back into range, no expensive modulo needed
-        if (accum > lim) {
-            accum = accum - lim + offset;
+// What a voice kernel does with each sample it generates
+enum {
+    SYNTHIO_KERNEL_STORE, // store the raw sample, for filtering
+    SYNTHIO_KERNEL_MONO, // scale by loudness and add into a mono buffer
+    SYNTHIO_KERNEL_STEREO, // scale by left and right loudness and add into a stereo buffer
+};
+
+// Equal to synthio_sat16(word * loudness, 16) when both are in int16 range,
+// because the product then never needs saturating.
+__attribute__((always_inline))
+static inline int32_t scale_by_loudness(int32_t word, int32_t loudness) {
+    #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
+    int32_t n = __SMULBB(word, loudness);
+    #else
+    int32_t n = word * loudness;
+    #endif
+    // round towards 0, like synthio_sat16
+    return (n + ((n >> 31) & 0xffff)) >> 16;
+}
+
+// Generate one sample of a voice: step the oscillator, apply the ring
+// modulator, then store or accumulate it according to mode.
+__attribute__((always_inline))
+static inline void voice_sample(const synthio_voice_t *voice, uint32_t *accum, uint32_t *ring_accum, int32_t *out, const int mode, const bool ring, int32_t left, int32_t right) {
+    *accum += voice->dds_rate;
+    // because dds_rate is low enough, the subtraction is guaranteed to go back into range, no expensive modulo needed
+    if (*accum > voice->lim) {
+        *accum = *accum - voice->lim + voice->offset;
+    }
+    int32_t word = voice->waveform[*accum >> SYNTHIO_FREQUENCY_SHIFT];
+    if (ring) {
+        *ring_accum += voice->ring_dds_rate;
+        if (*ring_accum > voice->ring_lim) {
+            *ring_accum = *ring_accum - voice->ring_lim + voice->ring_offset;
         }
-        int16_t idx = accum >> SYNTHIO_FREQUENCY_SHIFT;
-        out_buffer32[i] = waveform[idx];
+        word = (int16_t)((voice->ring_waveform[*ring_accum >> SYNTHIO_FREQUENCY_SHIFT] * word) / 32768); // consider for synthio_sat16 but had a weird artificat
     }
-    synth->accum[chan] = accum;
-
-    if (ring_dds_rate) {
-        if (ring_dds_rate > lim / 2) {
-            // beyond nyquist, can't play ring (but did synth main sound so
-            // return true)
-            return true;
+    if (mode == SYNTHIO_KERNEL_STORE) {
+        out[0] = word;
+    } else if (mode == SYNTHIO_KERNEL_MONO) {
+        out[0] += scale_by_loudness(word, left);
+    } else {
+        out[0] += scale_by_loudness(word, left);
+        out[1] += scale_by_loudness(word, right);
+    }
+}
+
+// Oscillator, ring modulator, loudness and accumulation fused into a single
+// pass over the block. mode and ring are constants at every call site, so
+// each combination compiles to its own branch-free loop, unrolled 4 times.
+__attribute__((always_inline))
+static inline void voice_kernel(const synthio_voice_t *voice, uint32_t *accum_ptr, uint32_t *ring_accum_ptr, int32_t *out, size_t dur, const int mode, const bool ring, const int16_t loudness[2]) {
+    const size_t stride = mode == SYNTHIO_KERNEL_STEREO ? 2 : 1;
+    const synthio_voice_t v = *voice;
+    uint32_t accum = *accum_ptr;
+    uint32_t ring_accum = *ring_accum_ptr;
+    int32_t left = loudness[0], right = loudness[1];
+    size_t i = 0;
+    for (; i + 4 <= dur; i += 4, out += 4 * stride) {
+        voice_sample(&v, &accum, &ring_accum, out, mode, ring, left, right);
+        voice_sample(&v, &accum, &ring_accum, out + stride, mode, ring, left, right);
+        voice_sample(&v, &accum, &ring_accum, out + 2 * stride, mode, ring, left, right);
+        voice_sample(&v, &accum, &ring_accum, out + 3 * stride, mode, ring, left, right);
+    }
+    for (; i < dur; i++, out += stride) {
+        voice_sample(&v, &accum, &ring_accum, out, mode, ring, left, right);
+    }
+    *accum_ptr = accum;
+    if (ring) {
+        *ring_accum_ptr = ring_accum;
+    }
+}
+
+static void synth_voice_render(synthio_synth_t *synth, int chan, const synthio_voice_t *voice, int32_t *out, size_t dur, int mode, const int16_t loudness[2]) {
+    uint32_t *accum = &synth->accum[chan];
+    uint32_t *ring_accum = &synth->ring_accum[chan];
+    if (voice->ring_waveform) {
+        switch (mode) {
+            case SYNTHIO_KERNEL_STORE:
+                voice_kernel(voice, accum, ring_accum, out, dur, SYNTHIO_KERNEL_STORE, true, loudness);
+                break;
+            case SYNTHIO_KERNEL_MONO:
+                voice_kernel(voice, accum, ring_accum, out, dur, SYNTHIO_KERNEL_MONO, true, loudness);
+                break;
+            default:
+                voice_kernel(voice, accum, ring_accum, out, dur, SYNTHIO_KERNEL_STEREO, true, loudness);
         }
-
-        // now modulate by ring and accumulate
-        accum = synth->ring_accum[chan];
-        offset = ring_waveform_start << SYNTHIO_FREQUENCY_SHIFT;
-        lim = ring_waveform_length << SYNTHIO_FREQUENCY_SHIFT;
-
-        // can happen if note waveform gets set mid-note, but the expensive modulo is usually avoided
-        if (accum > lim) {
-            accum = accum % lim + offset;
+    } else {
+        switch (mode) {
+            case SYNTHIO_KERNEL_STORE:
+                voice_kernel(voice, accum, ring_accum, out, dur, SYNTHIO_KERNEL_STORE, false, loudness);
+                break;
+            case SYNTHIO_KERNEL_MONO:
+                voice_kernel(voice, accum, ring_accum, out, dur, SYNTHIO_KERNEL_MONO, false, loudness);
+                break;
+            default:
+                voice_kernel(voice, accum, ring_accum, out, dur, SYNTHIO_KERNEL_STEREO, false, loudness);
         }
+    }
+}
 
-        for (uint16_t i = 0; i < dur; i++) {
-            accum += ring_dds_rate;
-            // because dds_rate is low enough, the subtraction is guaranteed to go back into range, no expensive modulo needed
-            if (accum > lim) {
-                accum = accum - lim + offset;
-            }
-            int16_t idx = accum >> SYNTHIO_FREQUENCY_SHIFT;
-            int16_t wi = (ring_waveform[idx] * out_buffer32[i]) / 32768; // consider for synthio_sat16 but had a weird artificat
-            out_buffer32[i] = wi;
+// Add already generated (and possibly filtered) samples into the output at a
+// constant loudness, unrolled the same way as voice_kernel.
+static void sum_settled(int32_t *out_buffer32, const int32_t *tmp_buffer32, const int16_t loudness[2], size_t dur, int synth_chan) {
+    int32_t left = loudness[0], right = loudness[1];
+    size_t i = 0;
+    if (synth_chan == 1) {
+        for (; i + 4 <= dur; i += 4, out_buffer32 += 4, tmp_buffer32 += 4) {
+            out_buffer32[0] += scale_by_loudness(tmp_buffer32[0], left);
+            out_buffer32[1] += scale_by_loudness(tmp_buffer32[1], left);
+            out_buffer32[2] += scale_by_loudness(tmp_buffer32[2], left);
+            out_buffer32[3] += scale_by_loudness(tmp_buffer32[3], left);
+        }
+        for (; i < dur; i++) {
+            *out_buffer32++ += scale_by_loudness(*tmp_buffer32++, left);
+        }
+    } else {
+        for (; i < dur; i++) {
+            int32_t word = *tmp_buffer32++;
+            *out_buffer32++ += scale_by_loudness(word, left);
+            *out_buffer32++ += scale_by_loudness(word, right);
         }
-        synth->ring_accum[chan] = accum;
     }
-    return true;
 }
 
 static mp_obj_t synthio_synth_get_note_filter(mp_obj_t note_obj) {
@@ -316,14 +426,16 @@ static void assign_loudness(int32_t word, int32_t *last_word, int16_t active_lou
 
 static void sum_with_loudness(int32_t *out_buffer32, int32_t *tmp_buffer32, int16_t active_loudness[2], int16_t pending_loudness[2], size_t dur, int synth_chan) {
     int32_t word, last_word = 0;
+    size_t i = 0;
+    // Check for a zero crossing sample by sample only until the pending loudness takes effect
     if (synth_chan == 1) {
-        for (size_t i = 0; i < dur; i++) {
+        for (; i < dur && (active_loudness[0] != pending_loudness[0] || active_loudness[1] != pending_loudness[1]); i++) {
             word = *tmp_buffer32++;
             assign_loudness(word, &last_word, active_loudness, pending_loudness);
             *out_buffer32++ += synthio_sat16((word * active_loudness[0]), 16);
         }
     } else {
-        for (size_t i = 0; i < dur; i++) {
+        for (; i < dur && (active_loudness[0] != pending_loudness[0] || active_loudness[1] != pending_loudness[1]); i++) {
             word = *tmp_buffer32;
             assign_loudness(word, &last_word, active_loudness, pending_loudness);
             *out_buffer32++ += synthio_sat16((word * active_loudness[0]), 16);
@@ -331,6 +443,7 @@ static void sum_with_loudness(int32_t *out_buffer32, int32_t *tmp_buffer32, int1
             tmp_buffer32++;
         }
     }
+    sum_settled(out_buffer32, tmp_buffer32, active_loudness, dur - i, synth_chan);
 
     // Force the active loudness to match the pending loudness just in case the conditions of a
     // zero crossing weren't met within the last `SYNTHIO_MAX_DUR` frames. Will ensure minimal
@@ -339,6 +452,12 @@ static void sum_with_loudness(int32_t *out_buffer32, int32_t *tmp_buffer32, int1
     active_loudness[1] = pending_loudness[1];
 }
 
+// Silence the voice at position i of the active list
+static void synth_voice_free(synthio_synth_t *synth, int i) {
+    synth->span.note_obj[synth->active[i]] = SYNTHIO_SILENCE;
+    synth->active[i] = synth->active[--synth->active_count];
+}
+
 void synthio_synth_synthesize(synthio_synth_t *synth, uint8_t **bufptr, uint32_t *buffer_length, uint8_t channel) {
 
     if (channel == synth->other_channel) {
@@ -360,27 +479,36 @@ void synthio_synth_synthesize(synthio_synth_t *synth, uint8_t **bufptr, uint32_t
     int32_t tmp_buffer32[SYNTHIO_MAX_DUR];
     memset(out_buffer32, 0, synth->base.channel_count * dur * sizeof(int32_t));
 
-    for (int chan = 0; chan < CIRCUITPY_SYNTHIO_MAX_CHANNELS; chan++) {
+    for (int i = 0; i < synth->active_count; i++) {
+        int chan = synth->active[i];
         mp_obj_t note_obj = synth->span.note_obj[chan];
-        if (note_obj == SYNTHIO_SILENCE) {
-            continue;
-        }
 
         if (synth->envelope_state[chan].level == 0) {
             // note is truly finished, but we only just noticed
-            synth->span.note_obj[chan] = SYNTHIO_SILENCE;
+            synth_voice_free(synth, i--);
             continue;
         }
 
         int16_t loudness[2] = {synth->envelope_state[chan].level, synth->envelope_state[chan].level};
 
-        if (!synth_note_into_buffer(synth, chan, tmp_buffer32, dur, loudness)) {
+        synthio_voice_t voice;
+        if (!synth_note_prepare(synth, chan, &voice, dur, loudness)) {
             // for some other reason, such as being above nyquist, note
             // couldn't be synthed, so don't filter or sum it in
             continue;
         }
 
         mp_obj_t filter_obj = synthio_synth_get_note_filter(note_obj);
+        int16_t *active_loudness = synth->active_loudness[chan];
+        if (filter_obj == mp_const_none && active_loudness[0] == loudness[0] && active_loudness[1] == loudness[1]) {
+            // nothing to wait for or filter, so the voice goes straight into the mix
+            synth_voice_render(synth, chan, &voice, out_buffer32, dur,
+                synth->base.channel_count == 1 ? SYNTHIO_KERNEL_MONO : SYNTHIO_KERNEL_STEREO, loudness);
+            continue;
+        }
+
+        synth_voice_render(synth, chan, &voice, tmp_buffer32, dur, SYNTHIO_KERNEL_STORE, loudness);
+
         if (filter_obj != mp_const_none) {
             synthio_note_obj_t *note = MP_OBJ_TO_PTR(note_obj);
             common_hal_synthio_biquad_tick(filter_obj);
@@ -388,7 +516,7 @@ void synthio_synth_synthesize(synthio_synth_t *synth, uint8_t **bufptr, uint32_t
         }
 
         // adjust loudness by envelope
-        sum_with_loudness(out_buffer32, tmp_buffer32, synth->active_loudness[chan], loudness, dur, synth->base.channel_count);
+        sum_with_loudness(out_buffer32, tmp_buffer32, active_loudness, loudness, dur, synth->base.channel_count);
     }
 
     int16_t *out_buffer16 = (int16_t *)(void *)synth->buffers[synth->buffer_index];
@@ -396,15 +524,13 @@ void synthio_synth_synthesize(synthio_synth_t *synth, uint8_t **bufptr, uint32_t
     // mix down audio
     for (size_t i = 0; i < dur * synth->base.channel_count; i++) {
         int32_t sample = out_buffer32[i];
-        out_buffer16[i] = synthio_mix_down_sample(sample, SYNTHIO_MIX_DOWN_SCALE(CIRCUITPY_SYNTHIO_MAX_CHANNELS));
+        out_buffer16[i] = synthio_mix_down_sample(sample, synth->mix_down_scale);
     }
 
     // advance envelope states
-    for (int chan = 0; chan < CIRCUITPY_SYNTHIO_MAX_CHANNELS; chan++) {
+    for (int i = 0; i < synth->active_count; i++) {
+        int chan = synth->active[i];
         mp_obj_t note_obj = synth->span.note_obj[chan];
-        if (note_obj == SYNTHIO_SILENCE) {
-            continue;
-        }
         synthio_envelope_state_step(&synth->envelope_state[chan], synthio_synth_get_note_envelope(synth, note_obj), dur);
     }
 
@@ -422,6 +548,14 @@ void synthio_synth_reset_buffer(synthio_synth_t *synth, bool single_channel_outp
 void synthio_synth_deinit(synthio_synth_t *synth) {
     synth->buffers[0] = NULL;
     synth->buffers[1] = NULL;
+    synth->span.note_obj = NULL;
+    synth->active = NULL;
+    synth->accum = NULL;
+    synth->ring_accum = NULL;
+    synth->started = NULL;
+    synth->envelope_state = NULL;
+    synth->active_loudness = NULL;
+    synth->max_voices = synth->active_count = 0;
     audiosample_mark_deinit(&synth->base);
 }
 
@@ -434,14 +568,16 @@ mp_obj_t synthio_synth_envelope_get(synthio_synth_t *synth) {
     return synth->envelope_obj;
 }
 
-void synthio_synth_init(synthio_synth_t *synth, uint32_t sample_rate, int channel_count, mp_obj_t waveform_obj, mp_obj_t envelope_obj) {
+void synthio_synth_init(synthio_synth_t *synth, uint32_t sample_rate, int channel_count, mp_obj_t waveform_obj, mp_obj_t envelope_obj, int max_voices, synthio_voice_stealing_t voice_stealing) {
     synthio_synth_parse_waveform(&synth->waveform_bufinfo, waveform_obj);
     mp_arg_validate_int_range(channel_count, 1, 2, MP_QSTR_channel_count);
+    mp_arg_validate_int_range(max_voices, 1, SYNTHIO_MAX_VOICES, MP_QSTR_max_voices);
     synth->buffer_length = SYNTHIO_MAX_DUR * SYNTHIO_BYTES_PER_SAMPLE * channel_count;
     synth->buffers[0] = m_malloc_without_collect(synth->buffer_length);
     synth->buffers[1] = m_malloc_without_collect(synth->buffer_length);
     synth->base.channel_count = channel_count;
     synth->base.single_buffer = false;
+    synth->base.writable_buffers = true;
     synth->other_channel = -1;
     synth->waveform_obj = waveform_obj;
     synth->base.sample_rate = sample_rate;
@@ -450,7 +586,25 @@ void synthio_synth_init(synthio_synth_t *synth, uint32_t sample_rate, int channe
     synth->base.max_buffer_length = synth->buffer_length;
     synthio_synth_envelope_set(synth, envelope_obj);
 
-    for (size_t i = 0; i < CIRCUITPY_SYNTHIO_MAX_CHANNELS; i++) {
+    synth->max_voices = max_voices;
+    synth->active_count = 0;
+    synth->voice_stealing = voice_stealing;
+    synth->mix_down_scale = SYNTHIO_MIX_DOWN_SCALE(max_voices);
+    synth->note_counter = 0;
+    // note_obj holds objects, so it is the only per-voice array the gc has to scan
+    synth->span.note_obj = m_malloc(max_voices * sizeof(mp_obj_t));
+    synth->active = m_malloc_without_collect(max_voices * sizeof(uint8_t));
+    synth->accum = m_malloc_without_collect(max_voices * sizeof(uint32_t));
+    synth->ring_accum = m_malloc_without_collect(max_voices * sizeof(uint32_t));
+    synth->started = m_malloc_without_collect(max_voices * sizeof(uint32_t));
+    synth->envelope_state = m_malloc_without_collect(max_voices * sizeof(synthio_envelope_state_t));
+    synth->active_loudness = m_malloc_without_collect(max_voices * sizeof(*synth->active_loudness));
+    memset(synth->accum, 0, max_voices * sizeof(uint32_t));
+    memset(synth->ring_accum, 0, max_voices * sizeof(uint32_t));
+    memset(synth->envelope_state, 0, max_voices * sizeof(synthio_envelope_state_t));
+    memset(synth->active_loudness, 0, max_voices * sizeof(*synth->active_loudness));
+
+    for (size_t i = 0; i < (size_t)max_voices; i++) {
         synth->span.note_obj[i] = SYNTHIO_SILENCE;
     }
 }
@@ -472,25 +626,53 @@ void synthio_synth_parse_waveform(mp_buffer_info_t *bufinfo_waveform, mp_obj_t w
 }
 
 static int find_channel_with_note(synthio_synth_t *synth, mp_obj_t note) {
-    for (int i = 0; i < CIRCUITPY_SYNTHIO_MAX_CHANNELS; i++) {
-        if (synth->span.note_obj[i] == note) {
-            return i;
+    if (note != SYNTHIO_SILENCE) {
+        for (int i = 0; i < synth->active_count; i++) {
+            if (synth->span.note_obj[synth->active[i]] == note) {
+                return synth->active[i];
+            }
+        }
+        return -1;
+    }
+    if (synth->active_count < synth->max_voices) {
+        // reuse the lowest numbered silent voice
+        for (int chan = 0; chan < synth->max_voices; chan++) {
+            if (synth->span.note_obj[chan] == SYNTHIO_SILENCE) {
+                return chan;
+            }
         }
     }
+    // replace the releasing note with lowest volume level
     int result = -1;
-    if (note == SYNTHIO_SILENCE) {
-        // replace the releasing note with lowest volume level
-        int level = 32768;
-        for (int chan = 0; chan < CIRCUITPY_SYNTHIO_MAX_CHANNELS; chan++) {
-            if (!SYNTHIO_NOTE_IS_PLAYING(synth, chan)) {
-                synthio_envelope_state_t *state = &synth->envelope_state[chan];
-                if (state->level < level) {
-                    result = chan;
-                    level = state->level;
-                }
+    int level = 32768;
+    for (int i = 0; i < synth->active_count; i++) {
+        int chan = synth->active[i];
+        if (!SYNTHIO_NOTE_IS_PLAYING(synth, chan)) {
+            synthio_envelope_state_t *state = &synth->envelope_state[chan];
+            if (state->level < level || (state->level == level && chan < result)) {
+                result = chan;
+                level = state->level;
             }
         }
     }
+    if (result != -1 || synth->voice_stealing == SYNTHIO_VOICE_STEALING_NONE) {
+        return result;
+    }
+    // every voice is still sounding, so cut one short
+    uint32_t age = 0;
+    for (int i = 0; i < synth->active_count; i++) {
+        int chan = synth->active[i];
+        if (synth->voice_stealing == SYNTHIO_VOICE_STEALING_OLDEST) {
+            uint32_t chan_age = synth->note_counter - synth->started[chan];
+            if (result == -1 || chan_age > age) {
+                result = chan;
+                age = chan_age;
+            }
+        } else if (synth->envelope_state[chan].level < level) {
+            result = chan;
+            level = synth->envelope_state[chan].level;
+        }
+    }
     return result;
 }
 
@@ -506,7 +688,11 @@ bool synthio_span_change_note(synthio_synth_t *synth, mp_obj_t old_note, mp_obj_
         if (new_note == SYNTHIO_SILENCE) {
             synthio_envelope_state_release(&synth->envelope_state[channel], synthio_synth_get_note_envelope(synth, old_note));
         } else {
+            if (synth->span.note_obj[channel] == SYNTHIO_SILENCE) {
+                synth->active[synth->active_count++] = channel;
+            }
             synth->span.note_obj[channel] = new_note;
+            synth->started[channel] = synth->note_counter++;
             synthio_envelope_state_init(&synth->envelope_state[channel], synthio_synth_get_note_envelope(synth, new_note));
             synth->accum[channel] = 0;
         }
@@ -9,6 +9,7 @@
 #define SYNTHIO_BITS_PER_SAMPLE (16)
 #define SYNTHIO_BYTES_PER_SAMPLE (SYNTHIO_BITS_PER_SAMPLE / 8)
 #define SYNTHIO_MAX_DUR (256)
+#define SYNTHIO_MAX_VOICES (255)
 #define SYNTHIO_SILENCE (mp_const_none)
 #define SYNTHIO_NOTE_IS_SIMPLE(note) (mp_obj_is_small_int(note))
 #define SYNTHIO_NOTE_IS_PLAYING(synth, i) ((synth)->envelope_state[(i)].state != SYNTHIO_ENVELOPE_STATE_RELEASE)
@@ -24,7 +25,7 @@
 
 typedef struct {
     uint16_t dur;
-    mp_obj_t note_obj[CIRCUITPY_SYNTHIO_MAX_CHANNELS];
+    mp_obj_t *note_obj;
 } synthio_midi_span_t;
 
 typedef struct {
@@ -52,10 +53,19 @@ typedef struct synthio_synth {
     synthio_envelope_definition_t global_envelope_definition;
     mp_obj_t waveform_obj, filter_obj, envelope_obj;
     synthio_midi_span_t span;
-    uint32_t accum[CIRCUITPY_SYNTHIO_MAX_CHANNELS];
-    uint32_t ring_accum[CIRCUITPY_SYNTHIO_MAX_CHANNELS];
-    synthio_envelope_state_t envelope_state[CIRCUITPY_SYNTHIO_MAX_CHANNELS];
-    int16_t active_loudness[CIRCUITPY_SYNTHIO_MAX_CHANNELS][2];
+    // The per-voice arrays below all have max_voices entries. active lists
+    // the active_count voices whose note_obj is not SYNTHIO_SILENCE, so that
+    // silent voices cost nothing while synthesizing.
+    uint8_t max_voices, active_count;
+    synthio_voice_stealing_t voice_stealing;
+    int32_t mix_down_scale;
+    uint32_t note_counter;
+    uint8_t *active;
+    uint32_t *accum;
+    uint32_t *ring_accum;
+    uint32_t *started;
+    synthio_envelope_state_t *envelope_state;
+    int16_t (*active_loudness)[2];
 } synthio_synth_t;
 
 typedef struct {
@@ -71,7 +81,7 @@ typedef struct {
 void synthio_synth_synthesize(synthio_synth_t *synth, uint8_t **buffer, uint32_t *buffer_length, uint8_t channel);
 void synthio_synth_deinit(synthio_synth_t *synth);
 bool synthio_synth_deinited(synthio_synth_t *synth);
-void synthio_synth_init(synthio_synth_t *synth, uint32_t sample_rate, int channel_count, mp_obj_t waveform_obj, mp_obj_t envelope);
+void synthio_synth_init(synthio_synth_t *synth, uint32_t sample_rate, int channel_count, mp_obj_t waveform_obj, mp_obj_t envelope, int max_voices, synthio_voice_stealing_t voice_stealing);
 void synthio_synth_reset_buffer(synthio_synth_t *synth, bool single_channel_output, uint8_t channel);
 void synthio_synth_parse_waveform(mp_buffer_info_t *bufinfo_waveform, mp_obj_t waveform_obj);
 void synthio_synth_parse_filter(mp_buffer_info_t *bufinfo_filter, mp_obj_t filter_obj);
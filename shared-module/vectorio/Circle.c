@@ -44,6 +44,31 @@ uint32_t common_hal_vectorio_circle_get_pixel(void *obj, int16_t x, int16_t y) {
     return pythagorasSmallerThanRadius ? self->color_index : 0;
 }
 
+int16_t common_hal_vectorio_circle_get_run(void *obj, int16_t x, int16_t y, int16_t x_end, uint32_t *pixel) {
+    vectorio_circle_t *self = obj;
+    int32_t radius = (int16_t)self->radius;
+    int32_t abs_y = abs(y);
+    *pixel = 0;
+    if (abs_y > radius) {
+        return x_end;
+    }
+    // The row covers -half_width..half_width, the largest x with x * x + y * y <= radius * radius.
+    // It is the integer square root, found by Newton's method starting above it.
+    int32_t remaining = radius * radius - abs_y * abs_y;
+    int32_t half_width = radius;
+    while (half_width * half_width > remaining) {
+        half_width = (half_width + remaining / half_width) / 2;
+    }
+    if (x < -half_width) {
+        return MIN(x_end, -half_width);
+    }
+    if (x <= half_width) {
+        *pixel = self->color_index;
+        return MIN(x_end, half_width + 1);
+    }
+    return x_end;
+}
+
 
 void common_hal_vectorio_circle_get_area(void *circle, displayio_area_t *out_area) {
     vectorio_circle_t *self = circle;
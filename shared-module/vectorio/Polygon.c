@@ -185,6 +185,65 @@ uint32_t common_hal_vectorio_polygon_get_pixel(void *obj, int16_t x, int16_t y)
     return winding_number == 0 ? 0 : self->color_index;
 }
 
+// Rounds a / b up for b > 0.
+static inline int32_t ceil_div(int32_t a, int32_t b) {
+    return a >= 0 ? (a + b - 1) / b : -(-a / b);
+}
+
+// Returns the same winding result as get_pixel for every pixel of the run, but evaluates each
+// edge once per change in winding rather than once per pixel. An edge crossing row y adds its
+// direction to the winding number of every pixel left of where it crosses, so within a row the
+// winding number only changes at those crossings.
+int16_t common_hal_vectorio_polygon_get_run(void *obj, int16_t x, int16_t y, int16_t x_end, uint32_t *pixel) {
+    vectorio_polygon_t *self = obj;
+    if (self->len == 0) {
+        *pixel = 0;
+        return x_end;
+    }
+    bool covered = false;
+    int16_t run_start = x;
+    while (x < x_end) {
+        int16_t winding_number = 0;
+        int32_t next = x_end;
+        int16_t x1 = self->points_list[self->len - 2];
+        int16_t y1 = self->points_list[self->len - 1];
+        for (uint16_t i = 0; i < self->len; i += 2) {
+            int16_t x2 = self->points_list[i];
+            int16_t y2 = self->points_list[i + 1];
+            int8_t direction = 0;
+            if (y1 <= y && y2 > y) {
+                direction = 1;
+            } else if (y1 > y && y2 <= y) {
+                direction = -1;
+            }
+            if (direction != 0) {
+                // get_pixel's line_side test for this edge holds exactly for pixels left of crossing.
+                int32_t dy = y2 - y1;
+                int32_t numerator = (y - y1) * (x2 - x1);
+                if (dy < 0) {
+                    dy = -dy;
+                    numerator = -numerator;
+                }
+                int32_t crossing = x1 + ceil_div(numerator, dy);
+                if (x < crossing) {
+                    winding_number += direction;
+                    next = MIN(next, crossing);
+                }
+            }
+            x1 = x2;
+            y1 = y2;
+        }
+        bool run_covered = winding_number != 0;
+        if (x != run_start && run_covered != covered) {
+            break;
+        }
+        covered = run_covered;
+        x = next;
+    }
+    *pixel = covered ? self->color_index : 0;
+    return x;
+}
+
 mp_obj_t common_hal_vectorio_polygon_get_draw_protocol(void *polygon) {
     vectorio_polygon_t *self = polygon;
     return self->draw_protocol_instance;
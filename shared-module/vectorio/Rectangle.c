@@ -33,6 +33,19 @@ uint32_t common_hal_vectorio_rectangle_get_pixel(void *obj, int16_t x, int16_t y
     return 0;
 }
 
+int16_t common_hal_vectorio_rectangle_get_run(void *obj, int16_t x, int16_t y, int16_t x_end, uint32_t *pixel) {
+    vectorio_rectangle_t *self = obj;
+    *pixel = 0;
+    if (y < 0 || y >= self->height || x >= self->width) {
+        return x_end;
+    }
+    if (x < 0) {
+        return MIN(x_end, 0);
+    }
+    *pixel = self->color_index;
+    return MIN(x_end, self->width);
+}
+
 
 void common_hal_vectorio_rectangle_get_area(void *rectangle, displayio_area_t *out_area) {
     vectorio_rectangle_t *self = rectangle;
@@ -326,6 +326,49 @@ void common_hal_vectorio_vector_shape_set_pixel_shader(vectorio_vector_shape_t *
     common_hal_vectorio_vector_shape_set_dirty(self);
 }
 
+// Converts a shape's pixel value through the pixel shader.
+inline __attribute__((always_inline))
+static void _shade_pixel(vectorio_vector_shape_t *self, const _displayio_colorspace_t *colorspace, const displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_pixel) {
+    output_pixel->pixel = 0;
+    output_pixel->opaque = true;
+    if (self->pixel_shader == mp_const_none) {
+        output_pixel->pixel = input_pixel->pixel;
+    } else if (mp_obj_is_type(self->pixel_shader, &displayio_palette_type)) {
+        displayio_palette_get_color(self->pixel_shader, colorspace, input_pixel, output_pixel);
+    } else if (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type)) {
+        displayio_colorconverter_convert(self->pixel_shader, colorspace, input_pixel, output_pixel);
+    }
+}
+
+// Stores a shaded pixel at pixel_index of the area buffer.
+inline __attribute__((always_inline))
+static void _write_pixel(const _displayio_colorspace_t *colorspace, uint32_t *buffer, uint16_t pixel_index, uint16_t linestride_px, uint8_t pixels_per_byte, uint32_t pixel) {
+    if (colorspace->depth == 16) {
+        VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %04x 16", pixel);
+        *(((uint16_t *)buffer) + pixel_index) = pixel;
+    } else if (colorspace->depth == 32) {
+        VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %04x 32", pixel);
+        *(((uint32_t *)buffer) + pixel_index) = pixel;
+    } else if (colorspace->depth == 8) {
+        VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %02x 8", pixel);
+        *(((uint8_t *)buffer) + pixel_index) = pixel;
+    } else if (colorspace->depth < 8) {
+        // Reorder the offsets to pack multiple rows into a byte (meaning they share a column).
+        if (!colorspace->pixels_in_byte_share_row) {
+            uint16_t row = pixel_index / linestride_px;
+            uint16_t col = pixel_index % linestride_px;
+            pixel_index = col * pixels_per_byte + (row / pixels_per_byte) * pixels_per_byte * linestride_px + row % pixels_per_byte;
+        }
+        uint8_t shift = (pixel_index % pixels_per_byte) * colorspace->depth;
+        if (colorspace->reverse_pixels_in_byte) {
+            // Reverse the shift by subtracting it from the leftmost shift.
+            shift = (pixels_per_byte - 1) * colorspace->depth - shift;
+        }
+        VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %2d %d", pixel, colorspace->depth);
+        ((uint8_t *)buffer)[pixel_index / pixels_per_byte] |= pixel << shift;
+    }
+}
+
 bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displayio_colorspace_t *colorspace, const displayio_area_t *area, uint32_t *mask, uint32_t *buffer) {
     // Shape areas are relative to 0,0.  This will allow rotation about a known axis.
     //   The consequence is that the area reported by the shape itself is _relative_ to 0,0.
@@ -352,6 +395,12 @@ bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displ
     }
     VECTORIO_SHAPE_DEBUG(", overlap: {(%3d,%3d), (%3d,%3d)}", overlap.x1, overlap.y1, overlap.x2, overlap.y2);
 
+    // Layers above us have already drawn every pixel we would.
+    if (displayio_area_mask_is_full(area, &overlap, mask)) {
+        VECTORIO_SHAPE_DEBUG(" occluded\n");
+        return displayio_area_equal(area, &overlap);
+    }
+
     bool full_coverage = displayio_area_equal(area, &overlap);
 
     uint8_t pixels_per_byte = 8 / colorspace->depth;
@@ -373,9 +422,66 @@ bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displ
     displayio_area_t shape_area;
     self->ishape.get_area(self->ishape.shape, &shape_area);
 
+    // Untransposed rows of the screen are rows of the shape, so the shape is asked for runs of
+    // equal pixels instead of one pixel at a time. Each run is shaded once unless the shader
+    // dithers, which depends on the pixel.
+    bool use_runs = !self->absolute_transform->transpose_xy;
+    bool mirror_x = self->absolute_transform->dx < 1;
+    bool shade_per_pixel =
+        (mp_obj_is_type(self->pixel_shader, &displayio_palette_type) &&
+            ((displayio_palette_t *)self->pixel_shader)->dither) ||
+        (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type) &&
+            ((displayio_colorconverter_t *)self->pixel_shader)->dither);
+
     uint16_t mask_start_px = line_dirty_offset_px;
     for (input_pixel.y = overlap.y1; input_pixel.y < overlap.y2; ++input_pixel.y) {
         mask_start_px += column_dirty_offset_px;
+        if (use_runs) {
+            // Shape x of the first and last screen pixel of the row. They are reversed when mirrored.
+            int16_t first_shape_x;
+            int16_t last_shape_x;
+            int16_t shape_y;
+            screen_to_shape_coordinates(self, overlap.x1, input_pixel.y, &first_shape_x, &shape_y);
+            screen_to_shape_coordinates(self, overlap.x2 - 1, input_pixel.y, &last_shape_x, &shape_y);
+            int16_t shape_x_end = MAX(first_shape_x, last_shape_x) + 1;
+            for (int16_t shape_x = MIN(first_shape_x, last_shape_x); shape_x < shape_x_end;) {
+                uint32_t value;
+                int16_t run_end = self->ishape.get_run(self->ishape.shape, shape_x, shape_y, shape_x_end, &value);
+                int16_t run_start = shape_x;
+                shape_x = run_end;
+                if (value == 0) {
+                    VECTORIO_SHAPE_PIXEL_DEBUG(" (encountered transparent run; input area is not fully covered)");
+                    full_coverage = false;
+                    continue;
+                }
+                // Screen x of the leftmost pixel of the run.
+                int16_t run_x = overlap.x1 + (mirror_x ? first_shape_x - (run_end - 1) : run_start - first_shape_x);
+                input_pixel.pixel = value - 1;
+                input_pixel.x = run_x;
+                if (!shade_per_pixel) {
+                    _shade_pixel(self, colorspace, &input_pixel, &output_pixel);
+                }
+                for (int16_t i = 0; i < run_end - run_start; i++) {
+                    uint16_t pixel_index = mask_start_px + (run_x + i - overlap.x1);
+                    uint32_t *mask_doubleword = &(mask[pixel_index / 32]);
+                    uint8_t mask_bit = pixel_index % 32;
+                    if ((*mask_doubleword & (1u << mask_bit)) != 0) {
+                        continue;
+                    }
+                    if (shade_per_pixel) {
+                        input_pixel.x = run_x + i;
+                        _shade_pixel(self, colorspace, &input_pixel, &output_pixel);
+                    }
+                    if (!output_pixel.opaque) {
+                        full_coverage = false;
+                    }
+                    *mask_doubleword |= 1u << mask_bit;
+                    _write_pixel(colorspace, buffer, pixel_index, linestride_px, pixels_per_byte, output_pixel.pixel);
+                }
+            }
+            mask_start_px += linestride_px - column_dirty_offset_px;
+            continue;
+        }
         for (input_pixel.x = overlap.x1; input_pixel.x < overlap.x2; ++input_pixel.x) {
             // Check the mask first to see if the pixel has already been set.
             uint16_t pixel_index = mask_start_px + (input_pixel.x - overlap.x1);
@@ -386,7 +492,6 @@ bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displ
                 VECTORIO_SHAPE_PIXEL_DEBUG(" masked");
                 continue;
             }
-            output_pixel.pixel = 0;
 
             // Cast input screen coordinates to shape coordinates to pick the pixel to draw
             int16_t pixel_to_get_x;
@@ -412,15 +517,7 @@ bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displ
             } else {
                 // Pixel is not transparent. Let's pull the pixel value index down to 0-base for more error-resistant palettes.
                 input_pixel.pixel -= 1;
-                output_pixel.opaque = true;
-
-                if (self->pixel_shader == mp_const_none) {
-                    output_pixel.pixel = input_pixel.pixel;
-                } else if (mp_obj_is_type(self->pixel_shader, &displayio_palette_type)) {
-                    displayio_palette_get_color(self->pixel_shader, colorspace, &input_pixel, &output_pixel);
-                } else if (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type)) {
-                    displayio_colorconverter_convert(self->pixel_shader, colorspace, &input_pixel, &output_pixel);
-                }
+                _shade_pixel(self, colorspace, &input_pixel, &output_pixel);
 
                 // We double-check this to fast-path the case when a pixel is not covered by the shape & not call the color converter unnecessarily.
                 if (!output_pixel.opaque) {
@@ -429,30 +526,7 @@ bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displ
                 }
 
                 *mask_doubleword |= 1u << mask_bit;
-                if (colorspace->depth == 16) {
-                    VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %04x 16", output_pixel.pixel);
-                    *(((uint16_t *)buffer) + pixel_index) = output_pixel.pixel;
-                } else if (colorspace->depth == 32) {
-                    VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %04x 32", output_pixel.pixel);
-                    *(((uint32_t *)buffer) + pixel_index) = output_pixel.pixel;
-                } else if (colorspace->depth == 8) {
-                    VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %02x 8", output_pixel.pixel);
-                    *(((uint8_t *)buffer) + pixel_index) = output_pixel.pixel;
-                } else if (colorspace->depth < 8) {
-                    // Reorder the offsets to pack multiple rows into a byte (meaning they share a column).
-                    if (!colorspace->pixels_in_byte_share_row) {
-                        uint16_t row = pixel_index / linestride_px;
-                        uint16_t col = pixel_index % linestride_px;
-                        pixel_index = col * pixels_per_byte + (row / pixels_per_byte) * pixels_per_byte * linestride_px + row % pixels_per_byte;
-                    }
-                    uint8_t shift = (pixel_index % pixels_per_byte) * colorspace->depth;
-                    if (colorspace->reverse_pixels_in_byte) {
-                        // Reverse the shift by subtracting it from the leftmost shift.
-                        shift = (pixels_per_byte - 1) * colorspace->depth - shift;
-                    }
-                    VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %2d %d", output_pixel.pixel, colorspace->depth);
-                    ((uint8_t *)buffer)[pixel_index / pixels_per_byte] |= output_pixel.pixel << shift;
-                }
+                _write_pixel(colorspace, buffer, pixel_index, linestride_px, pixels_per_byte, output_pixel.pixel);
             }
         }
         mask_start_px += linestride_px - column_dirty_offset_px;
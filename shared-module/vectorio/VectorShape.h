@@ -16,6 +16,9 @@
 
 typedef void get_area_function(mp_obj_t shape, displayio_area_t *out_area);
 typedef uint32_t get_pixel_function(mp_obj_t shape, int16_t x, int16_t y);
+// Returns the end of the run of pixels on row y, starting at x and ending no later than x_end,
+//   that all have the same value as get_pixel would return. The value is stored in pixel.
+typedef int16_t get_run_function(mp_obj_t shape, int16_t x, int16_t y, int16_t x_end, uint32_t *pixel);
 
 // This struct binds a shape's common Shape support functions (its vector shape interface)
 //   to its instance pointer.  We only check at construction time what the type of the
@@ -27,6 +30,7 @@ typedef struct {
     mp_obj_t shape;
     get_area_function *get_area;
     get_pixel_function *get_pixel;
+    get_run_function *get_run;
 } vectorio_ishape_t;
 
 typedef struct {
@@ -60,6 +60,12 @@ static int background_prevention_count;
 
 void PLACE_IN_ITCM(background_callback_run_all)(void) {
     port_background_task();
+    #if MICROPY_GC_INCREMENTAL
+    // Spread garbage collection work over the time the VM is running.
+    if (!background_prevention_count) {
+        gc_collect_step_auto();
+    }
+    #endif
     if (!background_callback_pending()) {
         return;
     }
@@ -111,6 +111,13 @@ uint32_t supervisor_ticks_ms32(void) {
     return supervisor_ticks_ms64();
 }
 
+uint32_t supervisor_ticks_us32(void) {
+    uint8_t subticks = 0;
+    uint64_t ticks = port_get_raw_ticks(&subticks);
+    // A subtick is 1/32 of a tick, and 15625 / 512 is 1e6 / 32768.
+    return (ticks * 32 + subticks) * 15625 / 512;
+}
+
 void mp_hal_delay_ms(mp_uint_t delay_ms) {
     uint64_t start_subtick = _get_raw_subticks();
     // Convert delay from ms to subticks
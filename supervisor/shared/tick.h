@@ -33,6 +33,13 @@ extern uint32_t supervisor_ticks_ms32(void);
  */
 extern uint64_t supervisor_ticks_ms64(void);
 
+/** @brief Get the lower 32 bits of the time in microseconds
+ *
+ * The resolution is that of the port's subticks, about 30us. Wraps around
+ * after ~71.5 minutes, so only use it for short relative durations.
+ */
+extern uint32_t supervisor_ticks_us32(void);
+
 extern void supervisor_enable_tick(void);
 extern void supervisor_disable_tick(void);
 
@@ -0,0 +1,73 @@
+# test dicts with many keys added and removed, including keys whose hashes collide
+
+
+class Collide:
+    def __init__(self, n):
+        self.n = n
+
+    def __hash__(self):
+        return 1
+
+    def __eq__(self, other):
+        return isinstance(other, Collide) and self.n == other.n
+
+
+# keys added and removed in a sliding window, checked against a list
+d = {}
+live = []
+for i in range(2000):
+    k = (i * 37) % 1000
+    if k in d:
+        del d[k]
+        live.remove(k)
+    else:
+        d[k] = i
+        live.append(k)
+    if i % 97 == 0:
+        print(len(d), all(d.get(x) is not None for x in live), (k + 1000) in d)
+print(sorted(d) == sorted(live))
+
+# pop and popitem until empty
+n = 0
+while d:
+    if n % 2:
+        d.popitem()
+    else:
+        d.pop(next(iter(d)))
+    n += 1
+print(n, len(d))
+
+# many keys with the same hash
+d = {Collide(i): i for i in range(300)}
+print(len(d), d[Collide(0)], d[Collide(150)], d[Collide(299)], Collide(300) in d)
+for i in range(0, 300, 3):
+    del d[Collide(i)]
+print(len(d), Collide(0) in d, d[Collide(1)], d[Collide(299)])
+e = d.copy()
+for i in range(1, 300, 3):
+    del e[Collide(i)]
+print(len(d), len(e), all(e[Collide(i)] == i for i in range(2, 300, 3)))
+
+# removing a key must leave the dict intact even if hashing another key raises
+class Fragile(Collide):
+    broken = False
+
+    def __hash__(self):
+        if Fragile.broken:
+            raise ValueError
+        return 1
+
+
+d = {Fragile(i): i for i in range(300)}
+Fragile.broken = True
+try:
+    del d[Collide(0)]
+    removed = True
+except ValueError:
+    removed = False
+Fragile.broken = False
+print(len(d) == 300 - removed, (Collide(0) in d) != removed)
+print(all(d[Collide(i)] == i for i in range(1, 300)))
+for i in range(1, 300, 2):
+    del d[Collide(i)]
+print(len(d) == 150 - removed, all(d[Collide(i)] == i for i in range(2, 300, 2)))
@@ -0,0 +1,42 @@
+# test OrderedDicts big enough to be looked up through a hash index
+
+try:
+    from collections import OrderedDict
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+# string and int keys, added one at a time
+d = OrderedDict()
+for i in range(100):
+    d["k%d" % i] = i
+    d[i * 1000] = -i
+print(len(d), d["k0"], d["k99"], d[0], d[99000], "k100" in d, 1 in d)
+print(list(d.keys())[:4], list(d.values())[-4:])
+
+# remove from the middle, the end and the start, then re-add
+for i in range(0, 100, 7):
+    del d["k%d" % i]
+print(d.pop(99000), d.popitem(), len(d))
+print(list(d.items())[:3])
+d["k0"] = "new"
+print(d["k0"], list(d)[-1], all(d["k%d" % i] == i for i in range(1, 99) if i % 7))
+
+# reorder
+d.move_to_end("k1")
+d.move_to_end(1000, last=False)
+print(list(d)[:2], list(d)[-2:], d["k1"], d[1000])
+
+# copy and equality
+e = d.copy()
+print(e == d, len(e), e["k50"], e[50000])
+e[12345] = 1
+print(e == d, list(e)[-1])
+
+# build from a list of pairs
+d = OrderedDict([(str(i), i) for i in range(50)])
+print(list(d)[:3], d["49"], "50" in d)
+d.clear()
+print(len(d), "1" in d)
+d["1"] = 1
+print(list(d.items()))
@@ -0,0 +1,69 @@
+# Report how fast the displayio scenes in perf_bench render on the unix port:
+# frames per second through an offscreen FramebufferDisplay, and the time each
+# layer of the scene takes to fill the whole screen on its own.
+#
+# Run from the tests directory with the coverage build, for example:
+#   ../ports/unix/build-coverage/micropython circuitpython-manual/displayio/render_report.py \
+#       perf_bench/displayio_scene_*.py
+
+import sys
+import displayio
+from framebufferio import FramebufferDisplay
+from offscreen import Framebuffer
+
+try:
+    from time import ticks_us, ticks_diff
+except ImportError:
+    import time
+
+    ticks_us = lambda: int(time.monotonic_ns() // 1000)
+    ticks_diff = lambda a, b: a - b
+
+FRAMES = 50
+FILLS = 10
+
+
+def report_layers(layer, name, buf, width, height):
+    start = ticks_us()
+    for _ in range(FILLS):
+        covered = displayio._fill_area(layer, buf, width, height)
+    us = ticks_diff(ticks_us(), start) / FILLS
+    print("  %-16s %10.1f us/fill %s" % (name, us, "covered" if covered else ""))
+    if isinstance(layer, displayio.Group):
+        for i, child in enumerate(layer):
+            report_layers(child, "%s.%d %s" % (name.split()[0], i, type(child).__name__), buf, width, height)
+
+
+def report(filename):
+    scene = {"__name__": "scene"}
+    try:
+        with open(filename) as f:
+            exec(f.read(), scene)
+    except SystemExit:
+        print("%s: SKIP" % filename)
+        return
+    width = scene["WIDTH"]
+    height = scene["HEIGHT"]
+
+    displayio.release_displays()
+    framebuffer = Framebuffer(width, height)
+    display = FramebufferDisplay(framebuffer, auto_refresh=False)
+    group, step = scene["make_scene"]()
+    display.root_group = group
+    display.refresh()
+
+    start = ticks_us()
+    for frame in range(FRAMES):
+        step(frame)
+        display.refresh()
+    us = ticks_diff(ticks_us(), start)
+    print("%s: %.1f frames/s" % (filename, FRAMES * 1e6 / us))
+
+    buf = bytearray(width * height * 2)
+    for i, layer in enumerate(group):
+        report_layers(layer, "%d %s" % (i, type(layer).__name__), buf, width, height)
+    displayio.release_displays()
+
+
+for filename in sys.argv[1:]:
+    report(filename)
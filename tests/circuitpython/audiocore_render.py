@@ -0,0 +1,59 @@
+import array
+import io
+import time
+from audiocore import RawSample, get_buffer, render, render_into
+from audiodelays import Echo
+from audiofilters import Filter
+from audiomixer import Mixer
+from synthio import Synthesizer
+
+ramp = RawSample(array.array("h", range(0, 10000, 100)), sample_rate=8000)
+
+# a short sample stops the render early
+buf = array.array("h", [-1] * 150)
+print(render_into(ramp, buf))
+print(list(buf[:3]), list(buf[98:102]))
+
+# every render starts from the beginning of the sample
+buf = array.array("h", [-1] * 10)
+print(render_into(ramp, buf), list(buf))
+print(render_into(ramp, buf), list(buf))
+
+frames, rate = render(ramp, 1000)
+print(frames, rate > 0)
+
+stream = io.BytesIO()
+print(render(ramp, 40, stream)[0], stream.getvalue() == bytes(array.array("h", range(0, 4000, 100))))
+
+# a chain of effects never finishes, so it renders exactly what was asked for
+synth = Synthesizer(sample_rate=8000, channel_count=2)
+synth.press((60, 64, 67))
+effect = Filter(bits_per_sample=16, samples_signed=True, sample_rate=8000, channel_count=2)
+effect.play(synth)
+echo = Echo(bits_per_sample=16, samples_signed=True, sample_rate=8000, channel_count=2)
+echo.play(effect)
+mixer = Mixer(voice_count=1, sample_rate=8000, channel_count=2)
+mixer.voice[0].play(echo)
+
+buf = array.array("h", [0] * 2 * 1000)
+print(render_into(mixer, buf), any(buf))
+print(render(mixer, 4000)[0], render(mixer, 0)[0])
+
+stream = io.BytesIO()
+print(render(mixer, 1000, stream)[0], len(stream.getvalue()))
+
+try:
+    render(ramp, -1)
+except ValueError as e:
+    print("ValueError", e)
+
+# anything else pulling from a sample is playing it, so render won't reset it underneath
+get_buffer(ramp)
+try:
+    render(ramp, 10)
+except RuntimeError as e:
+    print("RuntimeError", e)
+
+# once nothing has pulled from it for a while the sample can be rendered again
+time.sleep(0.6)
+print(render(ramp, 10)[0])
@@ -0,0 +1,89 @@
+# WaveFile reads the same samples from a file whether or not it prefetches, for any buffer size
+
+import struct
+from audiocore import WaveFile, get_buffer, reset_buffer
+
+try:
+    from vfs import VfsFat, mount, umount
+except ImportError:
+    from os import VfsFat, mount, umount
+
+
+class RAMBlockDevice:
+    SEC_SIZE = 512
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.SEC_SIZE)
+
+    def readblocks(self, n, buf):
+        start = n * self.SEC_SIZE
+        buf[:] = memoryview(self.data)[start : start + len(buf)]
+
+    def writeblocks(self, n, buf):
+        start = n * self.SEC_SIZE
+        self.data[start : start + len(buf)] = buf
+
+    def ioctl(self, op, arg):
+        if op == 4:  # MP_BLOCKDEV_IOCTL_BLOCK_COUNT
+            return len(self.data) // self.SEC_SIZE
+        if op == 5:  # MP_BLOCKDEV_IOCTL_BLOCK_SIZE
+            return self.SEC_SIZE
+
+
+def write_wav(name, bits, channels, frames):
+    size = frames * channels * bits // 8
+    data = bytes((i * 37 + i // 7) & 0xFF for i in range(size))
+    with open(name, "wb") as f:
+        f.write(b"RIFF")
+        f.write(struct.pack("<I", 36 + size))
+        f.write(b"WAVEfmt ")
+        rate = 8000
+        align = channels * bits // 8
+        f.write(struct.pack("<IHHIIHH", 16, 1, channels, rate, rate * align, align, bits))
+        f.write(b"data")
+        f.write(struct.pack("<I", size))
+        f.write(data)
+    return data
+
+
+def read_pass(wave):
+    out = bytearray()
+    reset_buffer(wave)
+    while True:
+        result, buf = get_buffer(wave)
+        if result == 2:  # GET_BUFFER_ERROR
+            return None
+        out.extend(bytes(buf))
+        if result == 0:  # GET_BUFFER_DONE
+            return out
+
+
+def reads_data(name, size, prefetch, data):
+    with open(name, "rb") as f:
+        buffer = None if size is None else bytearray(size)
+        wave = WaveFile(f, buffer, prefetch=prefetch)
+        # a second pass, as when looping
+        for i in range(2):
+            out = read_pass(wave)
+            # the last buffer may be padded to a whole word
+            if out is None or out[: len(data)] != data or len(out) > len(data) + 3:
+                return False
+    return True
+
+
+bdev = RAMBlockDevice(64)
+VfsFat.mkfs(bdev)
+mount(VfsFat(bdev), "/ramdisk")
+
+for bits in (8, 16):
+    for channels in (1, 2):
+        for frames in (1, 300, 1000):
+            name = "/ramdisk/%d_%d_%d.wav" % (bits, channels, frames)
+            data = write_wav(name, bits, channels, frames)
+            same = True
+            for size in (None, 24, 100, 513, 1024):
+                for prefetch in (False, True):
+                    same = same and reads_data(name, size, prefetch, data)
+            print(bits, channels, frames, same)
+
+umount("/ramdisk")
@@ -0,0 +1,27 @@
+from audiocore import get_buffer
+from audiodelays import Echo
+from synthio import Biquad, FilterMode, Synthesizer
+
+# The filter runs over the echo a chunk at a time. Delays shorter than a chunk
+# must still feed back only filtered samples.
+for freq_shift in (False, True):
+    for delay_ms in (10, 100):
+        synth = Synthesizer(sample_rate=8000)
+        synth.press((60, 67))
+        effect = Echo(
+            max_delay_ms=200,
+            delay_ms=delay_ms,
+            decay=0.8,
+            mix=1.0,
+            filter=(Biquad(FilterMode.LOW_PASS, 800, 0.7), Biquad(FilterMode.HIGH_PASS, 100, 0.7)),
+            freq_shift=freq_shift,
+            sample_rate=8000,
+        )
+        effect.play(synth)
+        for _ in range(4):
+            get_buffer(effect)
+        effect.stop()
+        sums = []
+        for _ in range(4):
+            sums.append(sum(abs(v) for v in get_buffer(effect)[1]))
+        print(freq_shift, delay_ms, sums)
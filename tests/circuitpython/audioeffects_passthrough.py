@@ -0,0 +1,69 @@
+import array
+from audiocore import RawSample, get_buffer, render_into
+from audiodelays import Echo
+from audiofilters import Filter
+from synthio import Biquad, FilterMode, Synthesizer
+
+SAMPLE_RATE = 8000
+SETTINGS = dict(sample_rate=SAMPLE_RATE, bits_per_sample=16, samples_signed=True)
+
+
+def make_synth():
+    synth = Synthesizer(sample_rate=SAMPLE_RATE)
+    synth.press((60, 67))
+    return synth
+
+
+def make_effects():
+    return (
+        Filter(filter=(Biquad(FilterMode.LOW_PASS, 800, 0.7),), mix=1.0, **SETTINGS),
+        Echo(max_delay_ms=50, delay_ms=20, decay=0.7, mix=0.8, **SETTINGS),
+    )
+
+
+def chain(source, effects):
+    for effect in effects:
+        effect.play(source, loop=True)
+        source = effect
+    return source
+
+
+# The synthesizer's buffers may be worked on in place; a RawSample's may not.
+# Both must come out of the same chain identically.
+rendered = array.array("h", [0] * 2048)
+render_into(make_synth(), rendered)
+via_synth = chain(make_synth(), make_effects())
+via_raw = chain(RawSample(rendered, sample_rate=SAMPLE_RATE), make_effects())
+print(all(list(get_buffer(via_synth)[1]) == list(get_buffer(via_raw)[1]) for _ in range(4)))
+
+# With nothing to do, effects pass the sample on unchanged
+raw = RawSample(rendered, sample_rate=SAMPLE_RATE)
+for effect in (
+    Filter(filter=(), **SETTINGS),
+    Filter(filter=(Biquad(FilterMode.LOW_PASS, 800, 0.7),), mix=0.0, **SETTINGS),
+    Echo(max_delay_ms=50, delay_ms=20, mix=0.0, **SETTINGS),
+):
+    effect.play(raw)
+    buf = get_buffer(effect)[1]
+    print(type(effect).__name__, list(buf) == list(rendered[: len(buf)]))
+
+# An effect moved from a writable source to a RawSample passes on the RawSample's own
+# buffer, which the next effect must not work in
+for first, second in (
+    (
+        Filter(filter=None, **SETTINGS),
+        Filter(filter=(Biquad(FilterMode.LOW_PASS, 800, 0.7),), mix=1.0, **SETTINGS),
+    ),
+    (
+        Echo(max_delay_ms=50, delay_ms=20, mix=0.0, **SETTINGS),
+        Echo(max_delay_ms=50, delay_ms=20, decay=0.7, mix=0.8, **SETTINGS),
+    ),
+):
+    data = array.array("h", rendered)
+    first.play(make_synth(), loop=True)
+    second.play(first, loop=True)
+    get_buffer(second)
+    first.play(RawSample(data, sample_rate=SAMPLE_RATE), loop=True)
+    for _ in range(8):
+        get_buffer(second)
+    print(type(second).__name__, data == rendered)
@@ -0,0 +1,26 @@
+from audiocore import get_buffer
+from audiofreeverb import Freeverb
+from synthio import Synthesizer
+
+for channel_count in (1, 2):
+    synth = Synthesizer(sample_rate=8000, channel_count=channel_count)
+    synth.press((60, 64))
+    effect = Freeverb(
+        roomsize=0.8,
+        damp=0.3,
+        mix=1.0,
+        sample_rate=8000,
+        channel_count=channel_count,
+        bits_per_sample=16,
+        samples_signed=True,
+    )
+    effect.play(synth)
+    for _ in range(8):
+        get_buffer(effect)
+    effect.stop()
+    for _ in range(4):
+        buf = get_buffer(effect)[1]
+        left = [buf[i] for i in range(0, len(buf), channel_count)]
+        right = [buf[i] for i in range(channel_count - 1, len(buf), channel_count)]
+        # a centered source reverberates identically in both channels
+        print(sum(abs(v) for v in left), left == right)
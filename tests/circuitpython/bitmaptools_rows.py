@@ -0,0 +1,79 @@
+# bitmaptools kernels that work a row at a time, at every bits per value and at offsets that
+# don't line up with bytes or words.
+import array
+import bitmaptools
+import displayio
+
+seed = 1
+
+
+def rand(n):
+    global seed
+    seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF
+    return (seed >> 8) % n
+
+
+def random_bitmap(width, height, bits):
+    bitmap = displayio.Bitmap(width, height, 1 << bits)
+    for y in range(height):
+        for x in range(width):
+            bitmap[x, y] = rand(1 << bits)
+    return bitmap
+
+
+def checksum(bitmap):
+    total = 0
+    for y in range(bitmap.height):
+        for x in range(bitmap.width):
+            total = (total * 31 + bitmap[x, y] + x) & 0xFFFFFF
+    return total
+
+
+for bits in (1, 2, 4, 8, 16):
+    dest = random_bitmap(75, 9, bits)
+    source = random_bitmap(70, 7, bits)
+    bitmaptools.blit(dest, source, 3, 1, x1=5, y1=1, x2=69, y2=7)
+    bitmaptools.blit(dest, source, 60, 4, skip_source_index=0)
+    bitmaptools.blit(dest, source, 1, 0, x1=2, y1=0, x2=40, y2=5, skip_dest_index=1)
+    # Overlapping copies within one bitmap, in both directions.
+    bitmaptools.blit(dest, dest, 7, 2, x1=0, y1=0, x2=66, y2=7)
+    bitmaptools.blit(dest, dest, 0, 0, x1=5, y1=1, x2=75, y2=9)
+    print("blit", bits, checksum(dest))
+
+    wide = random_bitmap(75, 9, 16)
+    bitmaptools.blit(wide, source, 2, 1, x1=1, y1=0, x2=70, y2=7, skip_source_index=1)
+    print("blit to 16", bits, checksum(wide))
+
+    bitmaptools.fill_region(dest, 3, 2, 71, 8, 1)
+    print("fill_region", bits, checksum(dest))
+
+    bitmaptools.replace_color(dest, 1, 0)
+    print("replace_color", bits, checksum(dest))
+
+    data = array.array("H", (rand(1 << bits) for _ in range(67 * 3)))
+    bitmaptools.arrayblit(dest, data, 5, 3, 72, 6)
+    bitmaptools.arrayblit(dest, data, 1, 6, 68, 9, skip_index=data[0])
+    print("arrayblit", bits, checksum(dest))
+
+    dest = displayio.Bitmap(70, 60, 1 << bits)
+    bitmaptools.rotozoom(dest, source, angle=0.7, scale=2.5, skip_index=0)
+    bitmaptools.rotozoom(dest, source, ox=10, oy=50, angle=-0.3, scale=0.5)
+    print("rotozoom", bits, checksum(dest))
+
+source = displayio.Bitmap(71, 5, 65536)
+for y in range(source.height):
+    for x in range(source.width):
+        source[x, y] = (x * 7 + y * 3) % 32 << 11 | (x * 5) % 64 << 5
+dither16 = displayio.Bitmap(71, 5, 65536)
+dither1 = displayio.Bitmap(71, 5, 2)
+bitmaptools.dither(dither16, source, displayio.Colorspace.RGB565)
+bitmaptools.dither(dither1, source, displayio.Colorspace.RGB565)
+print("dither", checksum(dither16), checksum(dither1))
+print(
+    "dither 1 bit",
+    all(
+        (dither16[x, y] != 0) == dither1[x, y]
+        for y in range(source.height)
+        for x in range(source.width)
+    ),
+)
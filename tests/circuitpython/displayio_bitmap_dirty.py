@@ -0,0 +1,138 @@
+# writes to a Bitmap are tracked per tile, so several disjoint changes are refreshed as separate
+# areas; after every refresh the framebuffer must match a full render of the scene
+
+try:
+    import bitmaptools
+    from displayio import Bitmap, Group, Palette, TileGrid, _fill_area, release_displays
+    from framebufferio import FramebufferDisplay
+    from offscreen import Framebuffer
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+WIDTH = 96
+HEIGHT = 64
+
+seed = 1
+
+
+def rand(n):
+    global seed
+    seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF
+    return (seed >> 8) % n
+
+
+palette = Palette(16)
+for i in range(16):
+    palette[i] = (i * 0x1F0F07) & 0xFFFFFF
+
+release_displays()
+framebuffer = Framebuffer(WIDTH, HEIGHT)
+display = FramebufferDisplay(framebuffer, auto_refresh=False)
+
+
+def matches(group):
+    full = bytearray(WIDTH * HEIGHT * 2)
+    _fill_area(group, full, WIDTH, HEIGHT)
+    return full == memoryview(framebuffer)
+
+
+def run(name, group, changes):
+    display.root_group = group
+    display.refresh()
+    good = matches(group)
+    for change in changes:
+        change()
+        display.refresh()
+        good = good and matches(group)
+    print(name, good)
+
+
+def scatter(bitmap, count):
+    for i in range(count):
+        bitmap[rand(bitmap.width), rand(bitmap.height)] = rand(16)
+
+
+def corners(bitmap):
+    w = bitmap.width - 1
+    h = bitmap.height - 1
+    for x, y in ((0, 0), (w, 0), (0, h), (w, h)):
+        bitmap[x, y] = rand(16)
+
+
+def tile_edges(bitmap):
+    for x in (15, 16, 31, 32, bitmap.width - 1):
+        for y in (15, 16, 31, bitmap.height - 1):
+            bitmap[x, y] = rand(16)
+
+
+def blocks(bitmap):
+    for i in range(3):
+        x = rand(bitmap.width - 20)
+        y = rand(bitmap.height - 20)
+        bitmaptools.fill_region(bitmap, x, y, x + 3 + rand(18), y + 3 + rand(18), rand(16))
+
+
+def blit(bitmap, source):
+    bitmaptools.blit(bitmap, source, rand(bitmap.width), rand(bitmap.height))
+
+
+def marked(bitmap):
+    # writes through the buffer protocol show once their areas are marked dirty
+    data = memoryview(bitmap).cast("B")
+    stride = (bitmap.width * 4 + 31) // 32 * 4
+    for x1, y1, x2, y2 in ((3, 20, 9, 24), (bitmap.width - 20, 2, bitmap.width - 2, 5)):
+        for y in range(y1, y2):
+            for x in range(x1, x2, 2):
+                data[y * stride + x // 2] ^= 0x55
+        bitmap.dirty(x1, y1, x2, y2)
+
+
+def changes(bitmap, source):
+    return (
+        [lambda: scatter(bitmap, 2)] * 3
+        + [lambda: scatter(bitmap, 9)] * 3
+        + [lambda: corners(bitmap), lambda: tile_edges(bitmap), lambda: blocks(bitmap)]
+        + [lambda: blit(bitmap, source)] * 3
+        + [lambda: bitmap.fill(rand(16)), lambda: marked(bitmap)]
+    )
+
+
+def make_bitmap(width, height):
+    bitmap = Bitmap(width, height, 16)
+    for y in range(height):
+        for x in range(width):
+            bitmap[x, y] = (x // 3 + y // 2) % 16
+    return bitmap
+
+
+source = make_bitmap(17, 13)
+
+# one tile bitmap, placed directly and through each transform
+for flip_x, flip_y, transpose_xy in ((0, 0, 0), (1, 0, 0), (0, 1, 0), (1, 1, 1), (0, 0, 1)):
+    bitmap = make_bitmap(HEIGHT, HEIGHT) if transpose_xy else make_bitmap(WIDTH, HEIGHT)
+    grid = TileGrid(bitmap, pixel_shader=palette, x=-3 if transpose_xy else 0, y=2)
+    grid.flip_x = bool(flip_x)
+    grid.flip_y = bool(flip_y)
+    grid.transpose_xy = bool(transpose_xy)
+    group = Group()
+    group.append(grid)
+    run("transform %d%d%d" % (flip_x, flip_y, transpose_xy), group, changes(bitmap, source))
+
+# a scaled bitmap that is larger than the display
+bitmap = make_bitmap(70, 50)
+group = Group(scale=2, x=-20, y=-10)
+group.append(TileGrid(bitmap, pixel_shader=palette))
+run("scaled", group, changes(bitmap, source))
+
+# the same bitmap shown twice, once as tiles
+bitmap = make_bitmap(48, 32)
+group = Group()
+group.append(TileGrid(bitmap, pixel_shader=palette, x=40, y=30))
+tiles = TileGrid(bitmap, pixel_shader=palette, width=4, height=3, tile_width=12, tile_height=16)
+for i in range(12):
+    tiles[i] = (i * 5) % 8
+group.append(tiles)
+run("shared", group, changes(bitmap, source))
+
+release_displays()
@@ -0,0 +1,101 @@
+import struct
+from displayio import Bitmap, OnDiskBitmap, Palette, TileGrid, _fill_area
+
+try:
+    from vfs import VfsFat, mount, umount
+except ImportError:
+    from os import VfsFat, mount, umount
+
+WIDTH = 11
+HEIGHT = 13
+
+
+class RAMBlockDevice:
+    SEC_SIZE = 512
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.SEC_SIZE)
+
+    def readblocks(self, n, buf):
+        start = n * self.SEC_SIZE
+        buf[:] = memoryview(self.data)[start : start + len(buf)]
+
+    def writeblocks(self, n, buf):
+        start = n * self.SEC_SIZE
+        self.data[start : start + len(buf)] = buf
+
+    def ioctl(self, op, arg):
+        if op == 4:  # MP_BLOCKDEV_IOCTL_BLOCK_COUNT
+            return len(self.data) // self.SEC_SIZE
+        if op == 5:  # MP_BLOCKDEV_IOCTL_BLOCK_SIZE
+            return self.SEC_SIZE
+
+
+def value(x, y, bpp):
+    return (x * 37 + y * 101 + x * y * 13) & ((1 << bpp) - 1)
+
+
+def color(i):
+    return (i * 0x1F3D5B) & 0xFFFFFF
+
+
+def expected(x, y, bpp):
+    v = value(x, y, bpp)
+    if bpp <= 8:
+        return color(v)
+    if bpp == 16:  # 5:5:5
+        return ((v & 0x7C00) >> 10) << 19 | ((v & 0x3E0) >> 4) << 10 | (v & 0x1F) << 3
+    return v
+
+
+def write_bmp(name, bpp):
+    colors = 1 << bpp if bpp <= 8 else 0
+    row_size = ((WIDTH * bpp + 31) // 32) * 4
+    data_offset = 14 + 40 + colors * 4
+    with open(name, "wb") as f:
+        f.write(b"BM")
+        f.write(struct.pack("<IHHI", data_offset + row_size * HEIGHT, 0, 0, data_offset))
+        f.write(struct.pack("<IiiHHIIiiII", 40, WIDTH, HEIGHT, 1, bpp, 0, 0, 0, 0, colors, 0))
+        for i in range(colors):
+            f.write(struct.pack("<I", color(i)))
+        for y in range(HEIGHT - 1, -1, -1):
+            row = bytearray(row_size)
+            for x in range(WIDTH):
+                v = value(x, y, bpp)
+                if bpp < 8:
+                    bit = x * bpp
+                    row[bit // 8] |= v << (8 - bpp - bit % 8)
+                else:
+                    row[x * bpp // 8 : (x + 1) * bpp // 8] = v.to_bytes(bpp // 8, "little")
+            f.write(row)
+
+
+def render(bitmap, shader, transform):
+    grid = TileGrid(bitmap, pixel_shader=shader)
+    for name in transform:
+        setattr(grid, name, True)
+    buf = bytearray(WIDTH * HEIGHT * 2)
+    _fill_area(grid, buf, WIDTH, HEIGHT)
+    return buf
+
+
+bdev = RAMBlockDevice(64)
+VfsFat.mkfs(bdev)
+mount(VfsFat(bdev), "/ramdisk")
+
+for bpp in (1, 4, 8, 16, 24):
+    name = "/ramdisk/image%d.bmp" % bpp
+    write_bmp(name, bpp)
+    odb = OnDiskBitmap(name)
+    # Every pixel of the reference has its own palette entry holding the expected color.
+    reference = Bitmap(WIDTH, HEIGHT, WIDTH * HEIGHT)
+    palette = Palette(WIDTH * HEIGHT)
+    for y in range(HEIGHT):
+        for x in range(WIDTH):
+            reference[x, y] = y * WIDTH + x
+            palette[y * WIDTH + x] = expected(x, y, bpp)
+    print(bpp, odb.width, odb.height)
+    for transform in ((), ("flip_x",), ("flip_y",), ("transpose_xy",), ("flip_x", "flip_y")):
+        print(transform, render(odb, odb.pixel_shader, transform) == render(reference, palette, transform))
+
+umount("/ramdisk")
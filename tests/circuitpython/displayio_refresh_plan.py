@@ -0,0 +1,136 @@
+# partial refreshes coalesce dirty areas into a short plan, merging near ones and keeping far
+# ones apart; after every refresh the framebuffer must match a full render of the scene
+
+try:
+    from displayio import Bitmap, Group, Palette, TileGrid, _fill_area, release_displays
+    from framebufferio import FramebufferDisplay
+    from offscreen import Framebuffer
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+WIDTH = 96
+HEIGHT = 64
+
+seed = 1
+
+
+def rand(n):
+    global seed
+    seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF
+    return (seed >> 8) % n
+
+
+palette = Palette(8)
+for i in range(8):
+    palette[i] = (i * 0x3F1F0F) & 0xFFFFFF
+
+background = Bitmap(WIDTH, HEIGHT, 8)
+for y in range(HEIGHT):
+    for x in range(WIDTH):
+        background[x, y] = (x // 5 + y // 3) % 8
+
+
+def make_sprite(width, height):
+    bitmap = Bitmap(width, height, 8)
+    for y in range(height):
+        for x in range(width):
+            bitmap[x, y] = rand(8)
+    return TileGrid(bitmap, pixel_shader=palette)
+
+
+release_displays()
+framebuffer = Framebuffer(WIDTH, HEIGHT)
+display = FramebufferDisplay(framebuffer, auto_refresh=False)
+
+
+def matches(group):
+    full = bytearray(WIDTH * HEIGHT * 2)
+    _fill_area(group, full, WIDTH, HEIGHT)
+    return full == memoryview(framebuffer)
+
+
+def run(name, sprites, moves):
+    group = Group()
+    group.append(TileGrid(background, pixel_shader=palette))
+    for sprite in sprites:
+        group.append(sprite)
+    display.root_group = group
+    display.refresh()
+    good = matches(group)
+    for move in moves:
+        move(sprites)
+        display.refresh()
+        good = good and matches(group)
+    print(name, good)
+
+
+def place(sprite, x, y):
+    sprite.x = x
+    sprite.y = y
+
+
+def jumble(sprites):
+    for sprite in sprites:
+        place(sprite, rand(WIDTH + 20) - 10, rand(HEIGHT + 20) - 10)
+
+
+# two sprites next to each other, which are worth merging
+run(
+    "near",
+    [make_sprite(6, 6), make_sprite(6, 6)],
+    [lambda s, i=i: (place(s[0], 10 + i, 10), place(s[1], 18 + i, 11)) for i in range(6)],
+)
+
+# two sprites in opposite corners, which are kept apart
+def corners(sprites, i):
+    place(sprites[0], i, i)
+    place(sprites[1], WIDTH - 6 - i, HEIGHT - 6 - i)
+
+
+run(
+    "far",
+    [make_sprite(6, 6), make_sprite(6, 6)],
+    [lambda s, i=i: corners(s, i) for i in range(6)],
+)
+
+# one sprite jumping across the display, so its old and new areas are far apart
+run(
+    "jump",
+    [make_sprite(9, 7)],
+    [lambda s, i=i: place(s[0], (i % 2) * (WIDTH - 9), (i % 3) * 20) for i in range(6)],
+)
+
+# sprites partly or wholly off the display
+run("edges", [make_sprite(12, 12) for i in range(3)], [jumble] * 8)
+
+# more dirty areas than the plan holds, so some are merged at a loss
+run("many", [make_sprite(3 + rand(6), 3 + rand(6)) for i in range(20)], [jumble] * 8)
+
+# overlapping and touching areas
+def stack(sprites, i):
+    for j, sprite in enumerate(sprites):
+        place(sprite, 20 + j * (5 + i % 6), 20 + j * (i % 4))
+
+
+run(
+    "overlap",
+    [make_sprite(10, 10) for i in range(4)],
+    [lambda s, i=i: stack(s, i) for i in range(8)],
+)
+
+# wide and tall areas that are split into several subrectangles
+run(
+    "long",
+    [make_sprite(WIDTH - 4, 3), make_sprite(2, HEIGHT - 4)],
+    [lambda s, i=i: (place(s[0], i, 5 * i), place(s[1], 7 * i, i)) for i in range(8)],
+)
+
+# removing sprites leaves their areas dirty
+group = display.root_group
+while len(group) > 1:
+    group.pop()
+    display.refresh()
+print("removed", matches(group))
+
+release_displays()
@@ -0,0 +1,118 @@
+from displayio import Bitmap, ColorConverter, Colorspace, Palette, TileGrid, _fill_area
+
+WIDTH = 23
+HEIGHT = 17
+
+seed = 1
+
+
+def rand(n):
+    global seed
+    seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF
+    return (seed >> 8) % n
+
+
+def checksum(buf):
+    total = 0
+    for i, b in enumerate(buf):
+        total = (total * 31 + b + i) & 0xFFFFFF
+    return total
+
+
+def make_bitmap(width, height, values):
+    bitmap = Bitmap(width, height, values)
+    for y in range(height):
+        for x in range(width):
+            bitmap[x, y] = rand(values)
+    return bitmap
+
+
+def make_palette(count, transparent=()):
+    palette = Palette(count)
+    for i in range(count):
+        palette[i] = rand(0x1000000)
+    for i in transparent:
+        palette.make_transparent(i)
+    return palette
+
+
+def render(name, grid):
+    buf = bytearray(b"\xa5" * (WIDTH * HEIGHT * 2))
+    covered = _fill_area(grid, buf, WIDTH, HEIGHT)
+    print(name, covered, checksum(buf))
+
+
+def transforms(name, make_grid):
+    for flip_x in (False, True):
+        for flip_y in (False, True):
+            for transpose_xy in (False, True):
+                grid = make_grid()
+                grid.flip_x = flip_x
+                grid.flip_y = flip_y
+                grid.transpose_xy = transpose_xy
+                render("%s %d%d%d" % (name, flip_x, flip_y, transpose_xy), grid)
+
+
+# a single bitmap covering the whole area
+bitmap = make_bitmap(30, 20, 16)
+palette = make_palette(16)
+transforms("full", lambda: TileGrid(bitmap, pixel_shader=palette, x=-3, y=-2))
+
+# a bitmap partly outside the area, with transparent colors
+bitmap = make_bitmap(12, 9, 8)
+palette = make_palette(8, (2, 5))
+transforms("partial", lambda: TileGrid(bitmap, pixel_shader=palette, x=15, y=11))
+
+# terminal style tiles of a 1 bit font
+font = make_bitmap(4 * 10, 6, 2)
+palette = make_palette(2)
+
+
+def terminal():
+    grid = TileGrid(
+        font, pixel_shader=palette, width=7, height=4, tile_width=4, tile_height=6, x=-1, y=-3
+    )
+    for y in range(4):
+        for x in range(7):
+            grid[x, y] = rand(10)
+    return grid
+
+
+transforms("terminal", terminal)
+
+# tiles from two rows of the source bitmap
+sheet = make_bitmap(5 * 3, 4 * 2, 16)
+palette = make_palette(16, (0,))
+
+
+def sprites():
+    grid = TileGrid(
+        sheet, pixel_shader=palette, width=6, height=5, tile_width=5, tile_height=4, x=1, y=0
+    )
+    for y in range(5):
+        for x in range(6):
+            grid[x, y] = rand(6)
+    return grid
+
+
+transforms("sprites", sprites)
+
+# more than 255 tiles of one pixel each
+dots = make_bitmap(300, 1, 4)
+palette = make_palette(4, (3,))
+
+
+def wide():
+    grid = TileGrid(dots, pixel_shader=palette, width=9, height=8, tile_width=1, tile_height=1)
+    for y in range(8):
+        for x in range(9):
+            grid[x, y] = rand(300)
+    return grid
+
+
+transforms("wide", wide)
+
+# 16 bit values through a ColorConverter
+rgb = make_bitmap(25, 19, 65536)
+converter = ColorConverter(input_colorspace=Colorspace.RGB565)
+transforms("converter", lambda: TileGrid(rgb, pixel_shader=converter, x=-1, y=-1))
@@ -0,0 +1,39 @@
+from audiocore import get_buffer
+from synthio import Envelope, Synthesizer, VoiceStealing
+
+print(Synthesizer().max_voices == Synthesizer.max_polyphony)
+
+for bad in (0, 256):
+    try:
+        Synthesizer(max_voices=bad)
+    except ValueError as e:
+        print("ValueError", e)
+
+envelope = Envelope(attack_time=0, decay_time=0, release_time=1, attack_level=1, sustain_level=1)
+
+
+def play(s, notes, blocks=1):
+    s.press(notes)
+    for _ in range(blocks):
+        get_buffer(s)
+    print(s.pressed)
+
+
+for stealing in (VoiceStealing.NONE, VoiceStealing.OLDEST, VoiceStealing.QUIETEST):
+    s = Synthesizer(sample_rate=8000, envelope=envelope, max_voices=3, voice_stealing=stealing)
+    print(s.max_voices, s.voice_stealing)
+    play(s, (60, 61, 62), 2)
+    play(s, 63)
+    # a releasing voice is always reused before a sounding one
+    s.release(61)
+    play(s, 64)
+    play(s, 65)
+
+s = Synthesizer(sample_rate=8000, max_voices=40)
+play(s, range(20, 80))
+print(len(s.pressed))
+s.release_all()
+get_buffer(s)
+print(s.pressed, s.note_info(20))
+s.voice_stealing = VoiceStealing.OLDEST
+print(s.voice_stealing)
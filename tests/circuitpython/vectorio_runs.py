@@ -0,0 +1,124 @@
+# vectorio shapes are drawn a run of pixels at a time; compare with the shapes' own
+# per-pixel contains(), and with rotated displays, which draw mirrored and transposed
+
+try:
+    from displayio import Group, Palette, _fill_area, release_displays
+    from framebufferio import FramebufferDisplay
+    from offscreen import Framebuffer
+    from vectorio import Circle, Polygon, Rectangle
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+WIDTH = 40
+HEIGHT = 30
+
+palette = Palette(2)
+palette[0] = 0x102030
+palette[1] = 0xF0E0D0
+
+
+def color(index):
+    buf = bytearray(2)
+    _fill_area(Rectangle(pixel_shader=palette, width=1, height=1, color_index=index), buf, 1, 1)
+    return buf[0] | buf[1] << 8
+
+
+BACKGROUND = color(0)
+FOREGROUND = color(1)
+
+
+def scene(shape):
+    group = Group()
+    group.append(Rectangle(pixel_shader=palette, width=WIDTH, height=HEIGHT, color_index=0))
+    group.append(shape)
+    return group
+
+
+def render(group):
+    buf = bytearray(WIDTH * HEIGHT * 2)
+    _fill_area(group, buf, WIDTH, HEIGHT)
+    return memoryview(buf).cast("H")
+
+
+def matches_contains(shape, pixels):
+    for y in range(HEIGHT):
+        for x in range(WIDTH):
+            if pixels[y * WIDTH + x] != (FOREGROUND if shape.contains(x, y) else BACKGROUND):
+                return False
+    return True
+
+
+# where each rotation puts the display pixel (x, y) in its framebuffer, by row and column
+ROTATIONS = (
+    (90, lambda x, y: (x, HEIGHT - 1 - y)),
+    (180, lambda x, y: (HEIGHT - 1 - y, WIDTH - 1 - x)),
+    (270, lambda x, y: (WIDTH - 1 - x, y)),
+)
+
+
+def matches_rotated(group, pixels):
+    for rotation, place in ROTATIONS:
+        release_displays()
+        if rotation == 180:
+            framebuffer = Framebuffer(WIDTH, HEIGHT)
+        else:
+            framebuffer = Framebuffer(HEIGHT, WIDTH)
+        display = FramebufferDisplay(framebuffer, auto_refresh=False, rotation=rotation)
+        display.root_group = group
+        display.refresh()
+        stride = framebuffer.width
+        rotated = memoryview(framebuffer).cast("H")
+        for y in range(HEIGHT):
+            for x in range(WIDTH):
+                row, column = place(x, y)
+                if rotated[row * stride + column] != pixels[y * WIDTH + x]:
+                    release_displays()
+                    return False
+        display.root_group = None
+    release_displays()
+    return True
+
+
+def check(name, shape):
+    group = scene(shape)
+    pixels = render(group)
+    drawn = sum(1 for p in pixels if p == FOREGROUND)
+    print(name, drawn, matches_contains(shape, pixels), matches_rotated(group, pixels))
+
+
+for radius, x, y in ((1, 5, 5), (2, 20, 15), (7, 20, 15), (12, 3, 27), (9, 38, -2)):
+    check(
+        "circle %d at %d,%d" % (radius, x, y),
+        Circle(pixel_shader=palette, radius=radius, x=x, y=y, color_index=1),
+    )
+
+for width, height, x, y in ((1, 1, 4, 4), (13, 7, 10, 8), (30, 5, -6, 27), (3, 40, 36, -3)):
+    check(
+        "rectangle %dx%d at %d,%d" % (width, height, x, y),
+        Rectangle(pixel_shader=palette, width=width, height=height, x=x, y=y, color_index=1),
+    )
+
+POLYGONS = (
+    ("triangle", [(0, 0), (25, 4), (8, 20)], 6, 3),
+    ("thin", [(0, 0), (30, 1), (0, 2)], 5, 12),
+    ("arrow", [(0, 8), (14, 8), (14, 0), (28, 14), (14, 28), (14, 20), (0, 20)], 4, 1),
+    ("u", [(0, 0), (6, 0), (6, 16), (16, 16), (16, 0), (22, 0), (22, 22), (0, 22)], 9, 4),
+    (
+        "star",
+        [(10, 0), (13, 8), (21, 8), (15, 13), (17, 21)]
+        + [(10, 16), (3, 21), (5, 13), (0, 8), (7, 8)],
+        12,
+        5,
+    ),
+    (
+        "comb",
+        [(0, 0), (4, 12), (8, 0), (12, 12), (16, 0), (20, 12), (24, 0), (24, 16), (0, 16)],
+        8,
+        7,
+    ),
+    ("bowtie", [(0, 0), (20, 14), (20, 0), (0, 14)], 10, 8),
+    ("clockwise", [(0, 0), (0, 20), (10, 10), (20, 20), (20, 0)], -5, 15),
+)
+for name, points, x, y in POLYGONS:
+    check(name, Polygon(pixel_shader=palette, points=points, x=x, y=y, color_index=1))
@@ -0,0 +1,29 @@
+import bench
+import gc
+
+# Allocate multi-block objects with the heap fragmented to each of these
+# levels of fullness in turn. Filling the heap is timed too, but it only
+# makes single-block allocations.
+FILLS = (25, 50, 75)
+
+
+def fill(keep, percent):
+    # Interleave live objects with garbage so the used part of the heap is
+    # full of small holes that a large allocation has to skip over.
+    gc.collect()
+    total = gc.mem_alloc() + gc.mem_free()
+    while gc.mem_alloc() * 100 < total * percent:
+        for i in range(100):
+            keep.append(bytearray(16))
+            bytearray(16)
+
+
+def test(num):
+    keep = []
+    for percent in FILLS:
+        fill(keep, percent)
+        for i in range(num // (2000 * len(FILLS))):
+            bytearray(512)
+
+
+bench.run(test)
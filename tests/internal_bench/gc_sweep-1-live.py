@@ -0,0 +1,14 @@
+import bench
+import gc
+
+# Collect a heap holding mostly large live objects, so the sweep walks
+# long runs of marked heads and tails.
+keep = [bytearray(1024) for i in range(1000)]
+
+
+def test(num):
+    for i in range(num // 200000):
+        gc.collect()
+
+
+bench.run(test)
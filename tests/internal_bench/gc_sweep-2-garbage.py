@@ -0,0 +1,13 @@
+import bench
+import gc
+
+# Collect a heap whose large objects have all just become garbage, so the
+# sweep frees long runs of tails.
+def test(num):
+    for i in range(num // 200000):
+        garbage = [bytearray(1024) for i in range(1000)]
+        garbage = None
+        gc.collect()
+
+
+bench.run(test)
@@ -0,0 +1,71 @@
+# test incremental garbage collection with gc.collect_step()
+
+import gc
+
+try:
+    gc.collect_step
+except AttributeError:
+    print("SKIP")
+    raise SystemExit
+
+
+class A:
+    pass
+
+
+def gen():
+    # keeps a fresh object only in its own state across yields
+    i = 0
+    while True:
+        x = [i] * 3
+        for _ in range(10):
+            yield x
+        i += 1
+
+
+# a budget of 0 marks only a few blocks per step, so the program runs between
+# many steps and mutates objects that have already been marked
+gc.collect()
+old = [[i] for i in range(1000)]
+d = {}
+s = set()
+a = A()
+g = gen()
+gen_ok = True
+steps = 0
+while not gc.collect_step(0):
+    if steps % 8 == 0:
+        n = steps % 1000
+        old[n].append(str(steps))
+        d[str(steps)] = [steps]
+        s.add(str(steps))
+        setattr(a, "x" + str(n), [steps])
+    y = next(g)
+    gen_ok = gen_ok and y == [steps // 10] * 3
+    steps += 1
+    if steps > 100000:
+        break
+print(steps > 1, steps <= 100000)
+
+# allocate lots so anything wrongly freed above gets overwritten
+for i in range(10):
+    gc.collect()
+    junk = [bytearray(16) for _ in range(200)]
+junk = None
+
+ok = True
+for i in range(0, steps, 8):
+    n = i % 1000
+    ok = ok and str(i) in old[n] and d[str(i)] == [i] and str(i) in s
+    ok = ok and getattr(a, "x" + str(n))[0] % 1000 == n
+print(ok)
+print(gen_ok, next(g) == [steps // 10] * 3)
+
+# a large budget finishes the collection in one step
+print(gc.collect_step(1000000))
+
+# the budget of the automatic steps can be read back
+b = gc.incremental()
+gc.incremental(500)
+print(gc.incremental())
+gc.incremental(b)
@@ -0,0 +1,50 @@
+# test raising exceptions that already exist while incremental GC is marking
+
+import gc
+
+try:
+    gc.collect_step
+except AttributeError:
+    print("SKIP")
+    raise SystemExit
+
+
+def count_steps():
+    steps = 1
+    while not gc.collect_step(0):
+        steps += 1
+    return steps
+
+
+gc.collect()
+old = [[i] for i in range(1000)]
+excs = [ValueError(i) for i in range(300)]
+
+# Raising an exception allocates its traceback and stores it into the
+# exception object.  Raise one exception per step towards the end of the
+# collection, when the exceptions have already been marked.
+start = count_steps() * 2 // 3
+steps = 0
+while not gc.collect_step(0):
+    i = steps - start
+    if 0 <= i < len(excs):
+        try:
+            raise excs[i]
+        except ValueError:
+            pass
+    steps += 1
+
+# allocate lots so anything wrongly freed above gets overwritten
+for i in range(10):
+    gc.collect()
+    junk = [bytearray(32) for _ in range(300)]
+    junk = [[1, 2, 3] for _ in range(300)]
+junk = None
+
+# raising them again extends their tracebacks
+for e in excs:
+    try:
+        raise e
+    except ValueError:
+        pass
+print(len(excs))
@@ -0,0 +1,59 @@
+# test native code storing into closure cells while incremental GC is marking
+
+import gc
+
+try:
+    gc.collect_step
+except AttributeError:
+    print("SKIP")
+    raise SystemExit
+
+
+def make(n):
+    x = None
+
+    @micropython.native
+    def set(i):
+        nonlocal x
+        x = [i, str(i)]
+
+    def get():
+        return x
+
+    return set, get
+
+
+def count_steps():
+    steps = 1
+    while not gc.collect_step(0):
+        steps += 1
+    return steps
+
+
+gc.collect()
+old = [[i] for i in range(1000)]
+cells = [make(i) for i in range(300)]
+
+# Native code stores into closure cells without a write barrier.  Store a
+# fresh object, referenced only by the cell, into one cell per step towards
+# the end of the collection, when the cells have already been marked.
+start = count_steps() * 2 // 3
+steps = 0
+while not gc.collect_step(0):
+    i = steps - start
+    if 0 <= i < len(cells):
+        cells[i][0](i)
+    steps += 1
+
+# allocate lots so anything wrongly freed above gets overwritten
+for i in range(10):
+    gc.collect()
+    junk = [bytearray(32) for _ in range(300)]
+    junk = [[1, 2, 3] for _ in range(300)]
+junk = None
+
+ok = True
+for i, (set, get) in enumerate(cells):
+    x = get()
+    ok = ok and (x is None or x == [i, str(i)])
+print(ok)
@@ -0,0 +1,60 @@
+# Render a 22.05kHz stereo Synthesizer through a two stage Filter, an Echo,
+# a Freeverb and a Mixer with audiocore.render, as an effects chain would
+# run on a board.
+
+try:
+    from audiocore import render
+    from audiodelays import Echo
+    from audiofilters import Filter
+    from audiofreeverb import Freeverb
+    from audiomixer import Mixer
+    from synthio import Biquad, FilterMode, Synthesizer
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+RATE = 22050
+FORMAT = dict(sample_rate=RATE, channel_count=2, bits_per_sample=16, samples_signed=True)
+
+
+def make_chain():
+    synth = Synthesizer(sample_rate=RATE, channel_count=2)
+    synth.press((48, 55, 60, 64))
+    filters = (
+        Biquad(FilterMode.LOW_PASS, 2000, 0.7),
+        Biquad(FilterMode.HIGH_PASS, 80, 0.7),
+    )
+    filt = Filter(filter=filters, mix=1.0, **FORMAT)
+    filt.play(synth)
+    echo = Echo(max_delay_ms=250, delay_ms=180, decay=0.5, mix=0.3, **FORMAT)
+    echo.play(filt)
+    reverb = Freeverb(roomsize=0.7, mix=0.3, **FORMAT)
+    reverb.play(echo)
+    mixer = Mixer(voice_count=1, sample_rate=RATE, channel_count=2)
+    mixer.voice[0].play(reverb)
+    return mixer
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (50, 10): (2000,),
+    (100, 100): (10000,),
+    (1000, 1000): (100000,),
+    (5000, 1000): (500000,),
+}
+
+
+def bm_setup(params):
+    (frames,) = params
+    chain = make_chain()
+    rendered = [0]
+
+    def run():
+        rendered[0] = render(chain, frames)[0]
+
+    def result():
+        return frames, rendered[0] == frames
+
+    return run, result
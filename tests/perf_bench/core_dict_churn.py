@@ -0,0 +1,44 @@
+# This tests dict speed when keys are continually added and deleted, as in a
+# cache of recent sensor readings, so the table never grows but its slots are
+# reused over and over.
+
+
+def test(niter, nkeys):
+    d = {}
+    for i in range(nkeys):
+        d[i * 7] = i
+    n = 0
+    for i in range(niter):
+        # replace the oldest key with a new one
+        del d[i * 7]
+        d[(i + nkeys) * 7] = i
+        # look up a present and a missing key
+        if (i + nkeys // 2) * 7 in d:
+            n += 1
+        if (i * 7 + 1) in d:
+            n -= 1
+    return n, len(d)
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (32, 10): (1000, 16),
+    (1000, 10): (20000, 64),
+    (5000, 100): (100000, 1000),
+}
+
+
+def bm_setup(params):
+    niter, nkeys = params
+    state = None
+
+    def run():
+        nonlocal state
+        state = test(niter, nkeys)
+
+    def result():
+        return niter, state
+
+    return run, result
@@ -0,0 +1,42 @@
+# This tests qstr_find_strn() speed when thousands of strings are interned at
+# runtime, as happens with many attribute names or JSON keys.
+
+
+class A:
+    pass
+
+
+def test(names):
+    a = A()
+    for name in names:
+        setattr(a, name, None)
+    n = 0
+    for name in names:
+        if hasattr(a, name):
+            n += 1
+    return n
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (32, 10): (100,),
+    (100, 100): (1000,),
+    (1000, 1000): (10000,),
+}
+
+
+def bm_setup(params):
+    (nqstr,) = params
+    names = ["dynamic_qstr_%d" % i for i in range(nqstr)]
+    state = None
+
+    def run():
+        nonlocal state
+        state = test(names)
+
+    def result():
+        return nqstr, state
+
+    return run, result
@@ -0,0 +1,106 @@
+# Refresh a 320x240 display of a Bitmap canvas that is cleared and redrawn
+# with bitmaptools every frame: lines, circles, a polygon, blits, a scaled
+# rotozoom and an arrayblit.
+
+try:
+    from array import array
+    from bitmaptools import (
+        arrayblit,
+        blit,
+        draw_circle,
+        draw_line,
+        draw_polygon,
+        fill_region,
+        rotozoom,
+    )
+    from displayio import Bitmap, Group, Palette, TileGrid, _fill_area, release_displays
+    from framebufferio import FramebufferDisplay
+    from offscreen import Framebuffer
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+WIDTH = 320
+HEIGHT = 240
+SPRITE = 32
+
+
+def make_scene():
+    palette = Palette(16)
+    for i in range(16):
+        palette[i] = (i * 0x102030) & 0xFFFFFF
+    canvas = Bitmap(WIDTH, HEIGHT, 16)
+    group = Group()
+    group.append(TileGrid(canvas, pixel_shader=palette))
+
+    sprite = Bitmap(SPRITE, SPRITE, 16)
+    for x in range(SPRITE):
+        for y in range(SPRITE):
+            if (x - 16) * (x - 16) + (y - 16) * (y - 16) < 200:
+                sprite[x, y] = 1 + (x // 4 + y // 4) % 15
+    stripe = bytes((x // 4) % 16 for x in range(64)) * 16
+    xs = array("h", (0, 40, 60, 30, 5))
+    ys = array("h", (0, 10, 50, 70, 40))
+
+    def step(frame):
+        fill_region(canvas, 0, 0, WIDTH, HEIGHT, 0)
+        for i in range(8):
+            y = (frame * 3 + i * 29) % HEIGHT
+            draw_line(canvas, 0, y, WIDTH - 1, HEIGHT - 1 - y, 1 + i)
+        for i in range(4):
+            draw_circle(canvas, 40 + i * 80, 120, 10 + (frame + i * 7) % 30, 9 + i)
+        for i in range(5):
+            xs[i] = (xs[i] + 3) % WIDTH
+        draw_polygon(canvas, xs, ys, 13)
+        for i in range(3):
+            x = (frame * 5 + i * 100) % (WIDTH - SPRITE)
+            y = (frame * 3 + i * 60) % (HEIGHT - SPRITE)
+            blit(canvas, sprite, x, y, skip_source_index=0)
+        rotozoom(
+            canvas,
+            sprite,
+            ox=240,
+            oy=60,
+            px=16,
+            py=16,
+            angle=0.0,
+            scale=1.0 + (frame % 3) * 0.5,
+            skip_index=0,
+        )
+        arrayblit(canvas, stripe, 10, 200, 74, 216)
+
+    return group, step
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (50, 10): (4,),
+    (100, 100): (20,),
+    (1000, 1000): (200,),
+    (5000, 1000): (1000,),
+}
+
+
+def bm_setup(params):
+    (frames,) = params
+    release_displays()
+    framebuffer = Framebuffer(WIDTH, HEIGHT)
+    display = FramebufferDisplay(framebuffer, auto_refresh=False)
+    group, step = make_scene()
+    display.root_group = group
+    display.refresh()
+
+    def run():
+        for frame in range(frames):
+            step(frame)
+            display.refresh()
+
+    def result():
+        # The refreshes only redrew what changed, so compare with a full render.
+        full = bytearray(WIDTH * HEIGHT * 2)
+        _fill_area(group, full, WIDTH, HEIGHT)
+        return frames, full == memoryview(framebuffer)
+
+    return run, result
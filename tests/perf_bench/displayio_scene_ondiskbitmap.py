@@ -0,0 +1,128 @@
+# Refresh a 320x240 display showing an 8 bit BMP from a FAT filesystem at 2x
+# scale, like an image viewer. Each frame mirrors the image so all of it is
+# read from the file again.
+
+try:
+    import struct
+    from displayio import Group, OnDiskBitmap, TileGrid, _fill_area, release_displays
+    from framebufferio import FramebufferDisplay
+    from offscreen import Framebuffer
+
+    try:
+        from vfs import VfsFat, mount, umount
+    except ImportError:
+        from os import VfsFat, mount, umount
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+WIDTH = 320
+HEIGHT = 240
+IMAGE_WIDTH = 160
+IMAGE_HEIGHT = 120
+
+
+class RAMBlockDevice:
+    SEC_SIZE = 512
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.SEC_SIZE)
+
+    def readblocks(self, n, buf):
+        start = n * self.SEC_SIZE
+        buf[:] = memoryview(self.data)[start : start + len(buf)]
+
+    def writeblocks(self, n, buf):
+        start = n * self.SEC_SIZE
+        self.data[start : start + len(buf)] = buf
+
+    def ioctl(self, op, arg):
+        if op == 4:  # MP_BLOCKDEV_IOCTL_BLOCK_COUNT
+            return len(self.data) // self.SEC_SIZE
+        if op == 5:  # MP_BLOCKDEV_IOCTL_BLOCK_SIZE
+            return self.SEC_SIZE
+
+
+def write_bmp(name):
+    row_size = (IMAGE_WIDTH + 3) & ~3
+    data_offset = 14 + 40 + 256 * 4
+    with open(name, "wb") as f:
+        f.write(b"BM")
+        f.write(struct.pack("<IHHI", data_offset + row_size * IMAGE_HEIGHT, 0, 0, data_offset))
+        f.write(
+            struct.pack(
+                "<IiiHHIIiiII",
+                40,
+                IMAGE_WIDTH,
+                IMAGE_HEIGHT,
+                1,
+                8,
+                0,
+                row_size * IMAGE_HEIGHT,
+                2835,
+                2835,
+                256,
+                0,
+            )
+        )
+        f.write(bytes((i, 255 - i, (i * 7) & 255, 0)[j] for i in range(256) for j in range(4)))
+        row = bytearray(row_size)
+        for y in range(IMAGE_HEIGHT):
+            for x in range(IMAGE_WIDTH):
+                row[x] = (x * x + y * 3 + (x ^ y)) & 255
+            f.write(row)
+
+
+def make_scene():
+    try:
+        umount("/ramdisk")
+    except OSError:
+        pass
+    bdev = RAMBlockDevice(128)
+    VfsFat.mkfs(bdev)
+    mount(VfsFat(bdev), "/ramdisk")
+    write_bmp("/ramdisk/image.bmp")
+
+    image = OnDiskBitmap("/ramdisk/image.bmp")
+    viewer = TileGrid(image, pixel_shader=image.pixel_shader)
+    group = Group(scale=2)
+    group.append(viewer)
+
+    def step(frame):
+        viewer.flip_x = not viewer.flip_x
+
+    return group, step
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (50, 10): (4,),
+    (100, 100): (20,),
+    (1000, 1000): (100,),
+    (5000, 1000): (500,),
+}
+
+
+def bm_setup(params):
+    (frames,) = params
+    release_displays()
+    framebuffer = Framebuffer(WIDTH, HEIGHT)
+    display = FramebufferDisplay(framebuffer, auto_refresh=False)
+    group, step = make_scene()
+    display.root_group = group
+    display.refresh()
+
+    def run():
+        for frame in range(frames):
+            step(frame)
+            display.refresh()
+
+    def result():
+        # The refreshes only redrew what changed, so compare with a full render.
+        full = bytearray(WIDTH * HEIGHT * 2)
+        _fill_area(group, full, WIDTH, HEIGHT)
+        return frames, full == memoryview(framebuffer)
+
+    return run, result
@@ -0,0 +1,108 @@
+# Refresh a 320x240 display of a text terminal that prints a line per frame.
+# Once the screen is full every line scrolls the whole terminal. Without
+# terminalio, the same scrolling grid of glyph tiles is updated directly.
+
+try:
+    from displayio import Bitmap, Group, Palette, TileGrid, _fill_area, release_displays
+    from framebufferio import FramebufferDisplay
+    from offscreen import Framebuffer
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+try:
+    from terminalio import FONT, Terminal
+except ImportError:
+    FONT = None
+
+WIDTH = 320
+HEIGHT = 240
+TEXT = "The quick brown fox jumps over the lazy dog. 0123456789"
+
+
+def make_font_grid(palette):
+    if FONT is not None:
+        glyph_width, glyph_height = FONT.get_bounding_box()[:2]
+        bitmap = FONT.bitmap
+    else:
+        glyph_width = 6
+        glyph_height = 12
+        bitmap = Bitmap(glyph_width * 95, glyph_height, 2)
+        for x in range(bitmap.width):
+            for y in range(1, glyph_height - 2):
+                bitmap[x, y] = (x * 7 + y * 3) % 5 == 0
+    return TileGrid(
+        bitmap,
+        pixel_shader=palette,
+        width=WIDTH // glyph_width,
+        height=HEIGHT // glyph_height,
+        tile_width=glyph_width,
+        tile_height=glyph_height,
+    )
+
+
+def make_scene():
+    palette = Palette(2)
+    palette[0] = 0x000000
+    palette[1] = 0xFFFFFF
+    grid = make_font_grid(palette)
+    group = Group()
+    group.append(grid)
+    columns = grid.width
+    rows = grid.height
+
+    if FONT is not None:
+        terminal = Terminal(grid, FONT)
+
+        def step(frame):
+            terminal.write("%d %s\r\n" % (frame, TEXT[: columns - 6]))
+
+        return group, step
+
+    lines = []
+
+    def step(frame):
+        line = "%d %s" % (frame, TEXT)
+        lines.append([ord(c) - 32 for c in line[:columns]])
+        if len(lines) > rows:
+            lines.pop(0)
+        for y in range(len(lines)):
+            line = lines[y]
+            for x in range(columns):
+                grid[x, y] = line[x] if x < len(line) else 0
+
+    return group, step
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (50, 10): (4,),
+    (100, 100): (20,),
+    (1000, 1000): (200,),
+    (5000, 1000): (1000,),
+}
+
+
+def bm_setup(params):
+    (frames,) = params
+    release_displays()
+    framebuffer = Framebuffer(WIDTH, HEIGHT)
+    display = FramebufferDisplay(framebuffer, auto_refresh=False)
+    group, step = make_scene()
+    display.root_group = group
+    display.refresh()
+
+    def run():
+        for frame in range(frames):
+            step(frame)
+            display.refresh()
+
+    def result():
+        # The refreshes only redrew what changed, so compare with a full render.
+        full = bytearray(WIDTH * HEIGHT * 2)
+        _fill_area(group, full, WIDTH, HEIGHT)
+        return frames, full == memoryview(framebuffer)
+
+    return run, result
@@ -0,0 +1,128 @@
+# Refresh a 320x240 display of sprites moving over a tiled background.
+# Each frame moves every sprite and swaps a few background tiles, so the
+# refresh renders many small dirty areas.
+
+try:
+    from displayio import Bitmap, Group, Palette, TileGrid, _fill_area, release_displays
+    from framebufferio import FramebufferDisplay
+    from offscreen import Framebuffer
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+WIDTH = 320
+HEIGHT = 240
+TILE = 16
+SPRITES = 12
+
+seed = 1
+
+
+def rand(n):
+    global seed
+    seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF
+    return (seed >> 8) % n
+
+
+def make_scene():
+    tiles = Bitmap(TILE * 8, TILE, 16)
+    for x in range(tiles.width):
+        for y in range(TILE):
+            tiles[x, y] = (x // TILE * 2 + (x ^ y) // 4) % 16
+    tile_palette = Palette(16)
+    for i in range(16):
+        tile_palette[i] = i * 0x0F0F0F
+    columns = WIDTH // TILE
+    rows = HEIGHT // TILE
+    background = TileGrid(
+        tiles,
+        pixel_shader=tile_palette,
+        width=columns,
+        height=rows,
+        tile_width=TILE,
+        tile_height=TILE,
+    )
+    for y in range(rows):
+        for x in range(columns):
+            background[x, y] = rand(8)
+
+    frames = Bitmap(TILE * 4, TILE, 4)
+    for x in range(frames.width):
+        for y in range(TILE):
+            dx = x % TILE - 8
+            dy = y - 8
+            if dx * dx + dy * dy < 40 + x // TILE * 8:
+                frames[x, y] = 1 + (dx + dy + x // TILE) % 3
+    sprite_palette = Palette(4)
+    sprite_palette[1] = 0xFF0000
+    sprite_palette[2] = 0x00FF00
+    sprite_palette[3] = 0xFFFF00
+    sprite_palette.make_transparent(0)
+
+    group = Group()
+    group.append(background)
+    sprites = []
+    for _ in range(SPRITES):
+        sprite = TileGrid(
+            frames,
+            pixel_shader=sprite_palette,
+            tile_width=TILE,
+            tile_height=TILE,
+            x=rand(WIDTH - TILE),
+            y=rand(HEIGHT - TILE),
+        )
+        sprites.append([sprite, rand(7) - 3, rand(7) - 3])
+        group.append(sprite)
+
+    def step(frame):
+        for s in sprites:
+            sprite, dx, dy = s
+            x = sprite.x + dx
+            y = sprite.y + dy
+            if not 0 <= x <= WIDTH - TILE:
+                s[1] = -dx
+                x = sprite.x - dx
+            if not 0 <= y <= HEIGHT - TILE:
+                s[2] = -dy
+                y = sprite.y - dy
+            sprite.x = x
+            sprite.y = y
+            sprite[0] = frame % 4
+        for _ in range(4):
+            background[rand(columns), rand(rows)] = rand(8)
+
+    return group, step
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (50, 10): (8,),
+    (100, 100): (40,),
+    (1000, 1000): (400,),
+    (5000, 1000): (2000,),
+}
+
+
+def bm_setup(params):
+    (frames,) = params
+    release_displays()
+    framebuffer = Framebuffer(WIDTH, HEIGHT)
+    display = FramebufferDisplay(framebuffer, auto_refresh=False)
+    group, step = make_scene()
+    display.root_group = group
+    display.refresh()
+
+    def run():
+        for frame in range(frames):
+            step(frame)
+            display.refresh()
+
+    def result():
+        # The refreshes only redrew what changed, so compare with a full render.
+        full = bytearray(WIDTH * HEIGHT * 2)
+        _fill_area(group, full, WIDTH, HEIGHT)
+        return frames, full == memoryview(framebuffer)
+
+    return run, result
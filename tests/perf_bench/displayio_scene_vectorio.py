@@ -0,0 +1,94 @@
+# Refresh a 320x240 display of circles, rectangles and polygons moving over
+# a full screen rectangle. Each frame moves every shape.
+
+try:
+    from displayio import Group, Palette, _fill_area, release_displays
+    from framebufferio import FramebufferDisplay
+    from offscreen import Framebuffer
+    from vectorio import Circle, Polygon, Rectangle
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+WIDTH = 320
+HEIGHT = 240
+SHAPES = 8
+
+seed = 1
+
+
+def rand(n):
+    global seed
+    seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF
+    return (seed >> 8) % n
+
+
+def make_scene():
+    palette = Palette(8)
+    for i in range(8):
+        palette[i] = (i * 0x3F1F0F) & 0xFFFFFF
+
+    group = Group()
+    group.append(Rectangle(pixel_shader=palette, width=WIDTH, height=HEIGHT, color_index=0))
+    shapes = []
+    for i in range(SHAPES):
+        circle = Circle(pixel_shader=palette, radius=8 + rand(24), color_index=1 + i % 7)
+        rectangle = Rectangle(
+            pixel_shader=palette, width=10 + rand(50), height=10 + rand(40), color_index=1 + rand(7)
+        )
+        points = [(0, 0), (20 + rand(30), rand(10)), (10 + rand(40), 20 + rand(30)), (rand(10), 30)]
+        polygon = Polygon(pixel_shader=palette, points=points, color_index=1 + rand(7))
+        for shape in (circle, rectangle, polygon):
+            shape.x = rand(WIDTH)
+            shape.y = rand(HEIGHT)
+            shapes.append([shape, rand(9) - 4, rand(9) - 4])
+            group.append(shape)
+
+    def step(frame):
+        for s in shapes:
+            shape, dx, dy = s
+            x = shape.x + dx
+            y = shape.y + dy
+            if not 0 <= x < WIDTH:
+                s[1] = -dx
+                x = shape.x - dx
+            if not 0 <= y < HEIGHT:
+                s[2] = -dy
+                y = shape.y - dy
+            shape.location = (x, y)
+
+    return group, step
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (50, 10): (8,),
+    (100, 100): (40,),
+    (1000, 1000): (400,),
+    (5000, 1000): (2000,),
+}
+
+
+def bm_setup(params):
+    (frames,) = params
+    release_displays()
+    framebuffer = Framebuffer(WIDTH, HEIGHT)
+    display = FramebufferDisplay(framebuffer, auto_refresh=False)
+    group, step = make_scene()
+    display.root_group = group
+    display.refresh()
+
+    def run():
+        for frame in range(frames):
+            step(frame)
+            display.refresh()
+
+    def result():
+        # The refreshes only redrew what changed, so compare with a full render.
+        full = bytearray(WIDTH * HEIGHT * 2)
+        _fill_area(group, full, WIDTH, HEIGHT)
+        return frames, full == memoryview(framebuffer)
+
+    return run, result
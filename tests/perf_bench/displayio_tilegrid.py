@@ -0,0 +1,68 @@
+# Render a TileGrid the size of a 320x240 terminal into an RGB565 buffer.
+# Most of the time goes to mapping each pixel to its tile and bitmap position.
+
+try:
+    from displayio import Bitmap, Palette, TileGrid, _fill_area
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+WIDTH = 320
+HEIGHT = 240
+GLYPH_WIDTH = 6
+GLYPH_HEIGHT = 12
+GLYPHS = 95
+
+
+def make_terminal():
+    font = Bitmap(GLYPH_WIDTH * GLYPHS, GLYPH_HEIGHT, 2)
+    for x in range(font.width):
+        for y in range(GLYPH_HEIGHT):
+            font[x, y] = (x * 7 + y * 3) % 5 == 0
+    palette = Palette(2)
+    palette[0] = 0x000000
+    palette[1] = 0xFFFFFF
+    columns = WIDTH // GLYPH_WIDTH
+    rows = HEIGHT // GLYPH_HEIGHT
+    grid = TileGrid(
+        font,
+        pixel_shader=palette,
+        width=columns,
+        height=rows,
+        tile_width=GLYPH_WIDTH,
+        tile_height=GLYPH_HEIGHT,
+    )
+    for y in range(rows):
+        for x in range(columns):
+            grid[x, y] = (x + y * columns) % GLYPHS
+    return grid
+
+
+def test(frames, grid, buf):
+    for _ in range(frames):
+        _fill_area(grid, buf, WIDTH, HEIGHT)
+
+
+def checksum(buf):
+    total = 0
+    for b in buf:
+        total = (total * 31 + b) & 0xFFFFFF
+    return total
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (50, 10): (1,),
+    (100, 100): (4,),
+    (1000, 1000): (20,),
+    (5000, 1000): (100,),
+}
+
+
+def bm_setup(params):
+    (frames,) = params
+    grid = make_terminal()
+    buf = bytearray(WIDTH * HEIGHT * 2)
+    return lambda: test(frames, grid, buf), lambda: (frames, checksum(buf))
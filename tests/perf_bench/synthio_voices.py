@@ -0,0 +1,58 @@
+# Render a 44.1kHz stereo Synthesizer playing 12 voices, a third of them
+# ring modulated and a third panned by an LFO, one 256 frame block at a time.
+
+try:
+    from array import array
+    from math import sin, pi
+    from audiocore import get_buffer
+    from synthio import LFO, Note, Synthesizer
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+VOICES = 12
+
+sine = array("h", [int(32767 * sin(i * 2 * pi / 256)) for i in range(256)])
+saw = array("h", [i * 256 - 32768 for i in range(256)])
+
+
+def make_synth():
+    synth = Synthesizer(sample_rate=44100, channel_count=2, waveform=saw)
+    pan = LFO(sine, rate=0.5)
+    notes = []
+    for i in range(VOICES):
+        note = Note(110 + 37 * i, amplitude=0.7)
+        if i % 3 == 1:
+            note.ring_waveform = sine
+            note.ring_frequency = 3 + 11 * i
+        elif i % 3 == 2:
+            note.panning = pan
+        notes.append(note)
+    synth.press(notes)
+    return synth
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (50, 10): (20,),
+    (100, 100): (100,),
+    (1000, 1000): (1000,),
+    (5000, 1000): (5000,),
+}
+
+
+def bm_setup(params):
+    (blocks,) = params
+    synth = make_synth()
+    total = [0]
+
+    def run():
+        for i in range(blocks):
+            total[0] += len(get_buffer(synth)[1])
+
+    def result():
+        return blocks, total[0] == blocks * 256 * 2
+
+    return run, result
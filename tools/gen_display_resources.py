@@ -202,9 +202,12 @@ _displayio_color_t blinka_colors[7] = {{
     }},
 }};
 
+uint32_t blinka_converted[7];
+
 displayio_palette_t blinka_palette = {{
     .base = {{.type = &displayio_palette_type }},
     .colors = blinka_colors,
+    .converted = blinka_converted,
     .color_count = 7,
     .needs_refresh = false
 }};
@@ -249,9 +252,12 @@ _displayio_color_t terminal_colors[2] = {
     },
 };
 
+uint32_t terminal_converted[2];
+
 displayio_palette_t supervisor_terminal_color = {
     .base = {.type = &displayio_palette_type },
     .colors = terminal_colors,
+    .converted = terminal_converted,
     .color_count = 2,
     .needs_refresh = false
 };